@@ -3,15 +3,25 @@
    Implement a simplified version of a real-time, video/audio/motion (VAM)
    recording system.
 
-   Create three threads named: initializer, data_capture, event_recorder
+   Create four threads named: initializer, data_capture, event_recorder,
+    frame_writer
    Create one byte pool for thread stacks and message queue: my_byte_pool
+   Create one block pool for the captured frames: frame_pool
    Create one mutex to guard protected memory: memory_mutex
    Create one message queue to store event notices: event_notice
+   Create one message queue to pass frames to protected memory: frame_store
    Create nine application timers named: crash_interrupt, unsafe_interrupt,
     warning_interrupt, manual_interrupt, crash_copy_scheduler,
     unsafe_copy_scheduler, manual_copy_scheduler, stats_timer
 
-   For this system, assume that each timer-tick represents one second  */
+   For this system, assume that each timer-tick represents one second.
+
+   Each captured frame is a reference counted block buffer. Recording an
+   event takes a reference to each of its frames instead of copying them,
+   and sends the frame to frame_writer through frame_store, which carries
+   only the buffer pointer. frame_writer keeps the reference it receives in
+   protected memory. A frame's block returns to frame_pool once the last
+   reference to it is released.  */
 
    /****************************************************/
    /*    Declarations, Definitions, and Prototypes     */
@@ -24,6 +34,10 @@
 #define   BYTE_POOL_SIZE     9120
 #define   MAX_EVENTS           16
 #define   MAX_TEMP_MEMORY     200
+#define   EVENT_FRAMES         24
+#define   FRAME_SIZE          (2 * sizeof(ULONG))
+#define   FRAME_BLOCK_SIZE    (sizeof(TX_BLOCK_BUFFER) + sizeof(ALIGN_TYPE) + FRAME_SIZE)
+#define   MAX_FRAMES          (MAX_TEMP_MEMORY + (MAX_EVENTS * EVENT_FRAMES) + 1)
 
 
 /* Define the ThreadX object control blocks */
@@ -31,11 +45,14 @@
 TX_THREAD     initializer;
 TX_THREAD     data_capture;
 TX_THREAD     event_recorder;
+TX_THREAD     frame_writer;
 
 TX_QUEUE      event_notice;
+TX_QUEUE      frame_store;
 
 TX_MUTEX      memory_mutex;
 TX_BYTE_POOL  my_byte_pool;
+TX_BLOCK_POOL frame_pool;
 
 TX_TIMER      crash_interrupt;
 TX_TIMER      unsafe_interrupt;
@@ -52,23 +69,39 @@ TX_TIMER      stats_timer;
 /* Define the counters and variables used in the VAM system  */
 
 ULONG  num_crashes = 0, num_unsafe = 0, num_warning = 0, num_manual = 0;
-ULONG  frame_index, event_count, frame_data[2];
+ULONG  frame_index, event_count, frames_stored, frame_data[2];
 
 /* Define the arrays used to represent temporary memory       */
-/* and protected memory. temp_memory contains pair of data    */
-/* in the form time-data and protected_memory contains rows   */
-/* of 26 elements in the form time-priority-data-data-data... */
+/* and protected memory. temp_memory contains the captured    */
+/* frames, each holding a pair of data in the form time-data, */
+/* and protected_memory contains rows of 2 elements in the    */
+/* form time-priority, with the row's 24 frames kept in       */
+/* protected_frames.                                          */
 /* The working index to temp_memory is frame_index and the    */
-/* working index to protected_memory is event_count.          */
+/* working index to protected_memory is event_count. The      */
+/* frames stored in protected_frames are counted by           */
+/* frames_stored.                                             */
+
+TX_BLOCK_BUFFER  *temp_memory[MAX_TEMP_MEMORY],
+*protected_frames[MAX_EVENTS][EVENT_FRAMES];
+ULONG  protected_memory[MAX_EVENTS][2];
+
+/* Define the memory of the frame pool, which holds a frame   */
+/* for each entry of temp_memory and protected_frames.        */
 
-ULONG  temp_memory[MAX_TEMP_MEMORY][2],
-protected_memory[MAX_EVENTS][26];
+ALIGN_TYPE  frame_pool_memory[(MAX_FRAMES * (FRAME_BLOCK_SIZE + sizeof(VOID *))) / sizeof(ALIGN_TYPE)];
+
+/* Define the memory of the frame_store queue, which holds the */
+/* buffer pointers of the frames of every event.               */
+
+TX_BLOCK_BUFFER  *frame_store_memory[MAX_EVENTS * EVENT_FRAMES];
 
 /* Define thread and function prototypes.  */
 
 void  initializer_process(ULONG);
 void  data_capture_process(ULONG);
 void  event_recorder_process(ULONG);
+void  frame_writer_process(ULONG);
 void  crash_ISR(ULONG);
 void  unsafe_ISR(ULONG);
 void  warning_ISR(ULONG);
@@ -145,6 +178,16 @@ void  tx_application_define(void* first_unused_memory)
         byte_pointer, STACK_SIZE, 12, 12,
         TX_NO_TIME_SLICE, TX_DONT_START);
 
+    /* Allocate the stack for the frame_writer thread.  */
+    tx_byte_allocate(&my_byte_pool, (VOID**)&byte_pointer,
+        STACK_SIZE, TX_NO_WAIT);
+
+    /* Create the frame_writer thread.  */
+    tx_thread_create(&frame_writer, "frame_writer",
+        frame_writer_process, 0,
+        byte_pointer, STACK_SIZE, 13, 13,
+        TX_NO_TIME_SLICE, TX_AUTO_START);
+
     /* Create and activate the 4 timers to simulate interrupts */
     tx_timer_create(&crash_interrupt, "crash_interrupt", crash_ISR,
         0x1234, 1444, 1444, TX_AUTO_ACTIVATE);
@@ -179,6 +222,15 @@ void  tx_application_define(void* first_unused_memory)
     tx_queue_create(&event_notice, "event_notice", TX_2_ULONG,
         byte_pointer, MAX_EVENTS * 2 * sizeof(ULONG));
 
+    /* Create the block pool that holds the captured frames.  */
+    tx_block_pool_create(&frame_pool, "frame_pool", FRAME_BLOCK_SIZE,
+        frame_pool_memory, sizeof(frame_pool_memory));
+
+    /* Create the message queue that passes the frames of each event to  */
+    /* protected memory. Each message is the pointer to a frame buffer.  */
+    tx_queue_create(&frame_store, "frame_store", TX_BLOCK_BUFFER_MESSAGE_SIZE,
+        frame_store_memory, sizeof(frame_store_memory));
+
 }
 
 
@@ -198,6 +250,7 @@ void  initializer_process(ULONG thread_input)
     printf("VAM System - Trace of Event Activities Begins...\n\n");
     frame_index = 0;
     event_count = 0;
+    frames_stored = 0;
 }
 
 /************************************************************/
@@ -209,9 +262,21 @@ void    data_capture_process(ULONG thread_input)
     /* This function simulates the data capture operation by writing */
     /* to an array, which represents a temporary memory file. For    */
     /* simplicity, we will write to the array once every timer-tick   */
+    /* Each frame is captured into a buffer of its own, which        */
+    /* replaces the oldest frame in the array. The capture's         */
+    /* reference to the oldest frame is then released.               */
+    TX_BLOCK_BUFFER *frame, *oldest_frame;
+    ULONG *data;
     while (1) {
-        temp_memory[frame_index][0] = tx_time_get();
-        temp_memory[frame_index][1] = 0x1234;
+        tx_block_buffer_allocate(&frame_pool, &frame, TX_WAIT_FOREVER);
+        data = (ULONG *) frame->tx_block_buffer_data;
+        data[0] = tx_time_get();
+        data[1] = 0x1234;
+        frame->tx_block_buffer_length = FRAME_SIZE;
+        oldest_frame = temp_memory[frame_index];
+        temp_memory[frame_index] = frame;
+        if (oldest_frame != TX_NULL)
+            tx_block_buffer_release(oldest_frame);
         frame_index = (frame_index + 1) % MAX_TEMP_MEMORY;
         tx_thread_sleep(1);
     }
@@ -257,14 +322,16 @@ void    event_recorder_process(ULONG thread_input)
     ULONG frame, event_priority, event_time, index, frame_data[2];
     while (1)
     {
-        /* Copy an event from temporary memory to protected memory.    */
-        /* Get frame_index from event message queue and copy 24 frames */
-        /* from temp_memory to protected_memory.                       */
+        /* Record an event from temporary memory in protected memory. */
+        /* Get frame_index from event message queue and take a         */
+        /* reference to each of 24 frames of temp_memory, so that the  */
+        /* frames are kept without copying them. Each reference is     */
+        /* sent to frame_writer with the frame's buffer pointer.       */
         tx_queue_receive(&event_notice, frame_data, TX_NO_WAIT);
         /* Store event time and event priority in protected memory */
         frame = frame_data[0];
         event_priority = frame_data[1];
-        event_time = temp_memory[frame][0];
+        event_time = ((ULONG *) temp_memory[frame]->tx_block_buffer_data)[0];
         printf("**Event**   Time: %5lu   Count: %2lu   Pri: %lu",
             event_time, event_count, event_priority);
         if (event_count < MAX_EVENTS)
@@ -274,12 +341,14 @@ void    event_recorder_process(ULONG thread_input)
             protected_memory[event_count][1] = event_priority;
             if (frame < 11)
                 frame = (MAX_TEMP_MEMORY - 1) - (frame_index + 1);
-            for (index = 0; index < 24; index++)
+            tx_mutex_put(&memory_mutex);
+            for (index = 0; index < EVENT_FRAMES; index++)
             {
-                protected_memory[event_count][index + 2] = temp_memory[frame][1];
+                tx_block_buffer_reference(temp_memory[frame]);
+                if (tx_block_buffer_send(&frame_store, temp_memory[frame], TX_NO_WAIT) != TX_SUCCESS)
+                    tx_block_buffer_release(temp_memory[frame]);
                 frame = (frame + 1) % MAX_TEMP_MEMORY;
             }
-            tx_mutex_put(&memory_mutex);
             event_count++;
         }
         else printf(" **not processed**");
@@ -288,6 +357,28 @@ void    event_recorder_process(ULONG thread_input)
     }
 }
 
+/************************************************************/
+/***** Entry function definition of thread frame_writer *****/
+/************************************************************/
+
+void    frame_writer_process(ULONG thread_input)
+{
+    /* Store the frames of recorded events in protected memory.    */
+    /* Each frame arrives as a buffer pointer together with the    */
+    /* reference the event recorder took to it, which protected    */
+    /* memory keeps. The frames of an event arrive in order, so    */
+    /* the count of stored frames gives the row and the column.    */
+    TX_BLOCK_BUFFER *frame;
+    while (1)
+    {
+        tx_block_buffer_receive(&frame_store, &frame, TX_WAIT_FOREVER);
+        tx_mutex_get(&memory_mutex, TX_WAIT_FOREVER);
+        protected_frames[frames_stored / EVENT_FRAMES][frames_stored % EVENT_FRAMES] = frame;
+        frames_stored++;
+        tx_mutex_put(&memory_mutex);
+    }
+}
+
 /************************************************************/
 /********** unsafe event detection and processing ***********/
 /************************************************************/
@@ -388,21 +479,29 @@ void    manual_copy_activate(ULONG timer_input)
 void print_stats(ULONG invalue)
 {
     UINT row, col;
+    ULONG available_frames, events_stored;
     printf("\n\n**** VAM System Periodic Event Summary\n\n");
     printf("     Current Time:               %lu\n", tx_time_get());
     printf("       Number of Crashes:        %lu\n", num_crashes);
     printf("       Number of Unsafe Events:  %lu\n", num_unsafe);
     printf("       Number of Warnings:       %lu\n", num_warning);
     printf("       Number of Manual Events:  %lu\n", num_manual);
+    tx_block_pool_info_get(&frame_pool, TX_NULL, &available_frames,
+        TX_NULL, TX_NULL, TX_NULL, TX_NULL);
+    printf("       Frame Buffers in Use:     %lu\n", frame_pool.tx_block_pool_total - available_frames);
 
-    if (event_count > 0)
+    /* Only print the events whose frames have all been stored.  */
+    events_stored = frames_stored / EVENT_FRAMES;
+    if (events_stored > 0)
     {
         printf("\n\n**** Portion of Protected Memory Contents\n\n");
         printf("%6s%6s%6s\n", "Time", "Pri", "Data");
-        for (row = 0; row < event_count; row++)
+        for (row = 0; row < events_stored; row++)
         {
-            for (col = 0; col < 8; col++)
+            for (col = 0; col < 2; col++)
                 printf("%6lu", protected_memory[row][col]);
+            for (col = 0; col < 6; col++)
+                printf("%6lu", ((ULONG *) protected_frames[row][col]->tx_block_buffer_data)[1]);
             printf("    (etc.)\n");
         }
     }
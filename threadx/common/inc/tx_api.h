@@ -82,6 +82,45 @@
 /*                                            add unused parameter macro, */
 /*                                            update patch number,        */
 /*                                            resulting in version 6.1.10 */
+/*  10-16-2026      agent                   Modified comment(s), added    */
+/*                                            tickless timer services     */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            TLSF byte pool create       */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            byte pool magazines         */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            byte pool fragmentation     */
+/*                                            information                 */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            block slabs                 */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            multiple block allocate and */
+/*                                            release                     */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            lock-free block pool        */
+/*                                            option                      */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            aligned byte allocate       */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            block buffers               */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            multiple queue send and     */
+/*                                            receive                     */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            queue message copy routine  */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            byte queues                 */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            channels                    */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            queue peek, commit and      */
+/*                                            reserve services            */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            priority queues             */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            wait for multiple objects   */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            broadcasts                  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -137,6 +176,7 @@ extern   "C" {
 #define TX_4_ULONG                      ((UINT)   4)
 #define TX_8_ULONG                      ((UINT)   8)
 #define TX_16_ULONG                     ((UINT)   16)
+#define TX_PRIORITY_QUEUE_PRIORITIES    ((UINT)   32)
 #define TX_NO_TIME_SLICE                ((ULONG)  0)
 #define TX_AUTO_START                   ((UINT)   1)
 #define TX_DONT_START                   ((UINT)   0)
@@ -147,8 +187,15 @@ extern   "C" {
 #define TX_NULL                         ((void *) 0)
 #define TX_INHERIT                      ((UINT)   1)
 #define TX_NO_INHERIT                   ((UINT)   0)
+#define TX_BLOCK_SLAB_SPILL             ((UINT)   1)
+#define TX_BLOCK_SLAB_NO_SPILL          ((UINT)   0)
+#define TX_BROADCAST_OVERWRITE          ((UINT)   1)
+#define TX_BROADCAST_BLOCK              ((UINT)   0)
 #define TX_THREAD_ENTRY                 ((UINT)   0)
 #define TX_THREAD_EXIT                  ((UINT)   1)
+#define TX_WAIT_QUEUE                   ((UINT)   0)
+#define TX_WAIT_SEMAPHORE               ((UINT)   1)
+#define TX_WAIT_EVENT_FLAGS             ((UINT)   2)
 #define TX_NO_SUSPENSIONS               ((UINT)   0)
 #define TX_NO_MESSAGES                  ((UINT)   0)
 #define TX_EMPTY                        ((ULONG)  0)
@@ -173,6 +220,7 @@ extern   "C" {
 #define TX_TCP_IP                       ((UINT) 12)
 #define TX_MUTEX_SUSP                   ((UINT) 13)
 #define TX_PRIORITY_CHANGE              ((UINT) 14)
+#define TX_MULTIPLE_WAIT                ((UINT) 15)
 
 
 /* API return values.  */
@@ -463,6 +511,10 @@ typedef struct TX_THREAD_STRUCT
     struct TX_MUTEX_STRUCT
                         *tx_thread_owned_mutex_list;
 
+    /* Define the list head of the byte pool magazines of this thread.  */
+    struct TX_BYTE_POOL_MAGAZINE_STRUCT
+                        *tx_thread_byte_pool_magazine;
+
 #ifdef TX_THREAD_ENABLE_PERFORMANCE_INFO
 
     /* Define the number of times this thread is resumed.  */
@@ -539,6 +591,56 @@ typedef struct TX_THREAD_STRUCT
 } TX_THREAD;
 
 
+/* Define the wait block structure utilized by the application to wait for one of
+   several queues, semaphores, and event flags groups with tx_thread_wait_multiple.
+   The application sets up the type of the object, the object, and the arguments
+   of the receive or get.  The remaining fields are private to ThreadX and are
+   valid only while the thread waits.  */
+
+typedef struct TX_WAIT_BLOCK_STRUCT
+{
+
+    /* Define the type of the object, TX_WAIT_QUEUE, TX_WAIT_SEMAPHORE, or
+       TX_WAIT_EVENT_FLAGS, and the pointer to its control block.  */
+    UINT                tx_wait_block_type;
+    VOID                *tx_wait_block_object;
+
+    /* Define the destination of the message received from a queue.  */
+    VOID                *tx_wait_block_destination;
+
+    /* Define the event flags requested from an event flags group, the get
+       option, and the actual event flags returned.  */
+    ULONG               tx_wait_block_requested_flags;
+    UINT                tx_wait_block_get_option;
+    ULONG               tx_wait_block_actual_flags;
+
+    /* Define the waiting thread and the head of the object's wait block list.  */
+    struct TX_THREAD_STRUCT
+                        *tx_wait_block_thread;
+    struct TX_WAIT_BLOCK_STRUCT
+                        **tx_wait_block_list;
+
+    /* Define the next and previous pointers in the object's wait block list.  */
+    struct TX_WAIT_BLOCK_STRUCT
+                        *tx_wait_block_next,
+                        *tx_wait_block_previous;
+
+} TX_WAIT_BLOCK;
+
+
+/* Define the type of the available list head of a block pool when TX_BLOCK_POOL_LOCK_FREE
+   is defined.  The lower half of the head holds the position of the first available block
+   in the pool area, and the upper half holds a tag that changes with every update of the
+   list.  A port without 64-bit atomic operations may define a 32-bit type in tx_port.h,
+   which limits the blocks of each pool to the first 256KB of its area.  */
+
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+#ifndef TX_BLOCK_POOL_TAGGED_HEAD
+#define TX_BLOCK_POOL_TAGGED_HEAD       ULONG64
+#endif
+#endif
+
+
 /* Define the block memory pool structure utilized by the application.  */
 
 typedef struct TX_BLOCK_POOL_STRUCT
@@ -556,8 +658,16 @@ typedef struct TX_BLOCK_POOL_STRUCT
     /* Save the initial number of blocks.  */
     UINT                tx_block_pool_total;
 
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+    /* Define the tagged head of the available block pool.  */
+    TX_BLOCK_POOL_TAGGED_HEAD
+                        tx_block_pool_available_list;
+#else
+
     /* Define the head pointer of the available block pool.  */
     UCHAR               *tx_block_pool_available_list;
+#endif
 
     /* Save the start address of the block pool's memory area.  */
     UCHAR               *tx_block_pool_start;
@@ -601,6 +711,86 @@ typedef struct TX_BLOCK_POOL_STRUCT
 } TX_BLOCK_POOL;
 
 
+/* Define the block slab size classes.  A slab routes each allocation to the block
+   pool of the smallest of at most TX_BLOCK_SLAB_MAX_CLASSES size classes that fits.
+   Unless the sizes are specified when the slab is created, the classes start at
+   TX_BLOCK_SLAB_MIN_SIZE bytes and double for each class.  */
+
+#ifndef TX_BLOCK_SLAB_MAX_CLASSES
+#define TX_BLOCK_SLAB_MAX_CLASSES       8
+#endif
+
+#ifndef TX_BLOCK_SLAB_MIN_SIZE
+#define TX_BLOCK_SLAB_MIN_SIZE          ((ULONG) 32)
+#endif
+
+
+/* Define the block slab structure utilized by the application.  */
+
+typedef struct TX_BLOCK_SLAB_STRUCT
+{
+
+    /* Define the block slab ID used for error checking.  */
+    ULONG               tx_block_slab_id;
+
+    /* Define the block slab's name.  */
+    CHAR                *tx_block_slab_name;
+
+    /* Define the number of size classes.  */
+    UINT                tx_block_slab_class_count;
+
+    /* Define the spill option, which selects whether allocations may be taken
+       from the next larger class once a class is exhausted.  */
+    UINT                tx_block_slab_spill;
+
+    /* Define the block pool of each size class, smallest first.  */
+    TX_BLOCK_POOL       tx_block_slab_pool[TX_BLOCK_SLAB_MAX_CLASSES];
+
+    /* Define the number of allocations of each class that were taken from a
+       larger class.  */
+    ULONG               tx_block_slab_spill_count[TX_BLOCK_SLAB_MAX_CLASSES];
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_BLOCK_SLAB_STRUCT
+                        *tx_block_slab_created_next,
+                        *tx_block_slab_created_previous;
+
+} TX_BLOCK_SLAB;
+
+
+/* Define the block buffer structure utilized by the application.  A block buffer is
+   placed at the start of a block of a block pool and is followed by its data area.
+   The buffer is passed between threads through queues as a pointer, so its data is
+   never copied, and its block is released when the last reference is released.  The
+   application may read the data area pointer and size, and maintains the length.  */
+
+typedef struct TX_BLOCK_BUFFER_STRUCT
+{
+
+    /* Define the block buffer ID used for error checking.  */
+    ULONG               tx_block_buffer_id;
+
+    /* Define the number of references to the buffer.  */
+    UINT                tx_block_buffer_reference_count;
+
+    /* Define the pool of the buffer's block.  */
+    TX_BLOCK_POOL       *tx_block_buffer_pool;
+
+    /* Define the data area of the buffer and its size in bytes.  */
+    UCHAR               *tx_block_buffer_data;
+    ULONG               tx_block_buffer_size;
+
+    /* Define the number of bytes of data in the buffer.  */
+    ULONG               tx_block_buffer_length;
+
+} TX_BLOCK_BUFFER;
+
+
+/* Define the message size, in ULONGs, of the queues that pass block buffers.  */
+
+#define TX_BLOCK_BUFFER_MESSAGE_SIZE    ((UINT) ((sizeof(TX_BLOCK_BUFFER *)) / (sizeof(ULONG))))
+
+
 /* Determine if the byte allocate extension is defined. If not, define the
    extension to whitespace.  */
 
@@ -664,6 +854,16 @@ typedef struct TX_BYTE_POOL_STRUCT
                         *tx_byte_pool_created_next,
                         *tx_byte_pool_created_previous;
 
+    /* Define the pointer to the two-level segregated fit (TLSF) control
+       structure of the pool.  This is TX_NULL for a first-fit pool.  */
+    struct TX_BYTE_POOL_TLSF_STRUCT
+                        *tx_byte_pool_tlsf;
+
+    /* Define the head pointer of the list of magazines that cache blocks
+       of this pool.  */
+    struct TX_BYTE_POOL_MAGAZINE_STRUCT
+                        *tx_byte_pool_magazine_list;
+
 #ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
 
     /* Define the number of allocates.  */
@@ -687,6 +887,11 @@ typedef struct TX_BYTE_POOL_STRUCT
 
     /* Define the number of byte pool timeouts.  */
     ULONG               tx_byte_pool_performance_timeout_count;
+
+    /* Define the number of magazine hits and misses of magazines that
+       have been deleted.  */
+    ULONG               tx_byte_pool_performance_magazine_hit_count;
+    ULONG               tx_byte_pool_performance_magazine_miss_count;
 #endif
 
     /* Define the port extension in the byte pool control block. This
@@ -696,6 +901,79 @@ typedef struct TX_BYTE_POOL_STRUCT
 } TX_BYTE_POOL;
 
 
+/* Define the byte pool magazine size classes.  A magazine caches blocks of
+   TX_BYTE_POOL_MAGAZINE_CLASSES sizes, starting at TX_BYTE_POOL_MAGAZINE_MIN_SIZE
+   bytes and doubling for each class, and holds at most TX_BYTE_POOL_MAGAZINE_SIZE
+   blocks of each size.  */
+
+#ifndef TX_BYTE_POOL_MAGAZINE_CLASSES
+#define TX_BYTE_POOL_MAGAZINE_CLASSES   4
+#endif
+
+#ifndef TX_BYTE_POOL_MAGAZINE_MIN_SIZE
+#define TX_BYTE_POOL_MAGAZINE_MIN_SIZE  ((ULONG) 32)
+#endif
+
+#ifndef TX_BYTE_POOL_MAGAZINE_SIZE
+#define TX_BYTE_POOL_MAGAZINE_SIZE      ((UINT) 16)
+#endif
+
+
+/* Define the byte pool magazine structure utilized by the application.  A magazine
+   caches small blocks of one byte pool for one thread.  */
+
+typedef struct TX_BYTE_POOL_MAGAZINE_STRUCT
+{
+
+    /* Define the magazine ID used for error checking.  */
+    ULONG               tx_byte_pool_magazine_id;
+
+    /* Define the byte pool whose blocks are cached.  */
+    struct TX_BYTE_POOL_STRUCT
+                        *tx_byte_pool_magazine_pool;
+
+    /* Define the thread that uses the magazine.  */
+    struct TX_THREAD_STRUCT
+                        *tx_byte_pool_magazine_thread;
+
+    /* Define the next magazine of the same thread.  */
+    struct TX_BYTE_POOL_MAGAZINE_STRUCT
+                        *tx_byte_pool_magazine_thread_next;
+
+    /* Define the next and previous magazines of the same byte pool.  */
+    struct TX_BYTE_POOL_MAGAZINE_STRUCT
+                        *tx_byte_pool_magazine_pool_next,
+                        *tx_byte_pool_magazine_pool_previous;
+
+    /* Define the list of cached blocks of each size class, which are linked
+       through their memory, and the number of blocks on each list.  */
+    UCHAR               *tx_byte_pool_magazine_list[TX_BYTE_POOL_MAGAZINE_CLASSES];
+    UINT                tx_byte_pool_magazine_count[TX_BYTE_POOL_MAGAZINE_CLASSES];
+
+    /* Define the flag that is set while cached blocks are returned to the pool.  */
+    UINT                tx_byte_pool_magazine_draining;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of allocations satisfied from the magazine.  */
+    ULONG               tx_byte_pool_magazine_hit_count;
+
+    /* Define the number of allocations that found the magazine empty.  */
+    ULONG               tx_byte_pool_magazine_miss_count;
+#endif
+
+} TX_BYTE_POOL_MAGAZINE;
+
+
+/* Define the number of bins of the byte pool fragmentation histograms.  Bin 0 counts
+   the blocks of less than 32 bytes, bin n the blocks of 2^(n+4) to 2^(n+5)-1 bytes, and
+   the last bin also counts all larger blocks.  */
+
+#ifndef TX_BYTE_POOL_FRAGMENTATION_BINS
+#define TX_BYTE_POOL_FRAGMENTATION_BINS 16
+#endif
+
+
 /* Define the event flags group structure utilized by the application.  */
 
 typedef struct TX_EVENT_FLAGS_GROUP_STRUCT
@@ -721,6 +999,11 @@ typedef struct TX_EVENT_FLAGS_GROUP_STRUCT
                         *tx_event_flags_group_suspension_list;
     UINT                tx_event_flags_group_suspended_count;
 
+    /* Define the list of wait blocks of threads that wait for this group among
+       multiple objects.  */
+    struct TX_WAIT_BLOCK_STRUCT
+                        *tx_event_flags_group_wait_block_list;
+
     /* Define the created list next and previous pointers.  */
     struct TX_EVENT_FLAGS_GROUP_STRUCT
                         *tx_event_flags_group_created_next,
@@ -869,6 +1152,10 @@ typedef struct TX_QUEUE_STRUCT
     /* Define the message size that was specified in queue creation.  */
     UINT                tx_queue_message_size;
 
+    /* Define the routine that copies a message of this queue, which is
+       selected for the message size in queue creation.  */
+    VOID                (*tx_queue_message_copy)(ULONG *source_ptr, ULONG *destination_ptr, UINT size);
+
     /* Define the total number of messages in the queue.  */
     UINT                tx_queue_capacity;
 
@@ -893,11 +1180,20 @@ typedef struct TX_QUEUE_STRUCT
                         *tx_queue_suspension_list;
     UINT                tx_queue_suspended_count;
 
+    /* Define the list of wait blocks of threads that wait for this queue among
+       multiple objects.  */
+    struct TX_WAIT_BLOCK_STRUCT
+                        *tx_queue_wait_block_list;
+
     /* Define the created list next and previous pointers.  */
     struct TX_QUEUE_STRUCT
                         *tx_queue_created_next,
                         *tx_queue_created_previous;
 
+    /* Define the flag that is set when the queue is created for a single
+       producer and a single consumer, which the zero-copy services require.  */
+    UINT                tx_queue_spsc;
+
 #ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
 
     /* Define the number of messages sent to this queue.  */
@@ -934,6 +1230,258 @@ typedef struct TX_QUEUE_STRUCT
 } TX_QUEUE;
 
 
+/* Define the byte queue structure utilized by the application.  A byte queue
+   holds messages of any size in one contiguous ring buffer.  Each message is
+   stored as a record made of a ULONG with the message size, followed by the
+   message padded to a whole number of ULONGs.  */
+
+typedef struct TX_BYTE_QUEUE_STRUCT
+{
+
+    /* Define the byte queue ID used for error checking.  */
+    ULONG               tx_byte_queue_id;
+
+    /* Define the byte queue's name.  */
+    CHAR                *tx_byte_queue_name;
+
+    /* Define the number of bytes in the byte queue's ring buffer.  */
+    ULONG               tx_byte_queue_capacity;
+
+    /* Define the current number of messages enqueued and the number of
+       bytes available for records.  */
+    UINT                tx_byte_queue_enqueued;
+    ULONG               tx_byte_queue_available_bytes;
+
+    /* Define pointers that represent the start and end for the byte queue's
+       ring buffer.  */
+    UCHAR               *tx_byte_queue_start;
+    UCHAR               *tx_byte_queue_end;
+
+    /* Define the byte queue read and write pointers.  Send requests use the
+       write pointer while receive requests use the read pointer.  */
+    UCHAR               *tx_byte_queue_read;
+    UCHAR               *tx_byte_queue_write;
+
+    /* Define the byte queue suspension list head along with a count of
+       how many threads are suspended.  */
+    struct TX_THREAD_STRUCT
+                        *tx_byte_queue_suspension_list;
+    UINT                tx_byte_queue_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_BYTE_QUEUE_STRUCT
+                        *tx_byte_queue_created_next,
+                        *tx_byte_queue_created_previous;
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+    /* Define the number of messages sent to this byte queue.  */
+    ULONG               tx_byte_queue_performance_messages_sent_count;
+
+    /* Define the number of messages received from this byte queue.  */
+    ULONG               tx_byte_queue_performance_messages_received_count;
+
+    /* Define the number of empty suspensions on this byte queue.  */
+    ULONG               tx_byte_queue_performance_empty_suspension_count;
+
+    /* Define the number of full suspensions on this byte queue.  */
+    ULONG               tx_byte_queue_performance_full_suspension_count;
+
+    /* Define the number of full non-suspensions on this byte queue. These
+       messages are rejected with an appropriate error code.  */
+    ULONG               tx_byte_queue_performance_full_error_count;
+
+    /* Define the number of byte queue timeouts.  */
+    ULONG               tx_byte_queue_performance_timeout_count;
+#endif
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* Define the application callback routine used to notify the application when
+       the a message is sent to the byte queue.  */
+    VOID                (*tx_byte_queue_send_notify)(struct TX_BYTE_QUEUE_STRUCT *queue_ptr);
+#endif
+
+} TX_BYTE_QUEUE;
+
+
+/* Define the channel structure utilized by the application.  A channel passes
+   fixed-size messages from a single producer, which may be an ISR, to a single
+   consumer thread.  The producer and the consumer each own one index of the
+   ring, so that neither needs to disable interrupts unless the consumer has to
+   wait for a message.  */
+
+typedef struct TX_CHANNEL_STRUCT
+{
+
+    /* Define the channel ID used for error checking.  */
+    ULONG               tx_channel_id;
+
+    /* Define the channel's name.  */
+    CHAR                *tx_channel_name;
+
+    /* Define the message size (in ULONGs) and the number of messages the
+       channel holds, which is a power of two.  */
+    UINT                tx_channel_message_size;
+    UINT                tx_channel_capacity;
+
+    /* Define the start of the channel's message area.  */
+    ULONG               *tx_channel_start;
+
+    /* Define the running counts of messages sent and received, which only the
+       producer and only the consumer update, respectively.  Their difference
+       is the number of messages in the channel.  */
+    ULONG               tx_channel_write_index;
+    ULONG               tx_channel_read_index;
+
+    /* Define the channel suspension list head, which only ever holds the
+       consumer, along with the suspension count.  */
+    struct TX_THREAD_STRUCT
+                        *tx_channel_suspension_list;
+    UINT                tx_channel_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_CHANNEL_STRUCT
+                        *tx_channel_created_next,
+                        *tx_channel_created_previous;
+
+} TX_CHANNEL;
+
+
+/* Define the priority queue structure utilized by the application.  Every
+   message carries a priority from 0, the highest, to
+   TX_PRIORITY_QUEUE_PRIORITIES - 1, and receivers always get the oldest message
+   of the highest priority.  The storage area is divided into slots, each of
+   which is a ULONG link followed by one message.  The slots of each priority
+   form a circular list that is reached through its tail, and a bit map shows
+   which priorities have messages, so that send and receive take constant
+   time.  */
+
+typedef struct TX_PRIORITY_QUEUE_STRUCT
+{
+
+    /* Define the priority queue ID used for error checking.  */
+    ULONG               tx_priority_queue_id;
+
+    /* Define the priority queue's name.  */
+    CHAR                *tx_priority_queue_name;
+
+    /* Define the message size (in ULONGs) and the number of slots.  */
+    UINT                tx_priority_queue_message_size;
+    UINT                tx_priority_queue_capacity;
+
+    /* Define the current number of messages enqueued and the number of
+       free slots.  */
+    UINT                tx_priority_queue_enqueued;
+    UINT                tx_priority_queue_available_storage;
+
+    /* Define the start of the priority queue's slots.  */
+    ULONG               *tx_priority_queue_start;
+
+    /* Define the head of the list of released slots and the index of the
+       first slot that was never used.  */
+    ULONG               tx_priority_queue_free_list;
+    ULONG               tx_priority_queue_unused;
+
+    /* Define the bit map of the priorities with messages, where bit 0 is the
+       highest priority, and the index of the last slot of each priority.  */
+    ULONG               tx_priority_queue_priority_map;
+    ULONG               tx_priority_queue_tail[TX_PRIORITY_QUEUE_PRIORITIES];
+
+    /* Define the priority queue suspension list head along with a count of
+       how many threads are suspended.  */
+    struct TX_THREAD_STRUCT
+                        *tx_priority_queue_suspension_list;
+    UINT                tx_priority_queue_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_PRIORITY_QUEUE_STRUCT
+                        *tx_priority_queue_created_next,
+                        *tx_priority_queue_created_previous;
+
+} TX_PRIORITY_QUEUE;
+
+
+/* Define the broadcast structure utilized by the application.  A broadcast
+   holds one ring of fixed-size messages that every subscriber reads through
+   its own cursor, so that a message published once is received by all the
+   subscribers.  When the slowest subscriber is a full ring behind, the
+   publisher either waits for it (TX_BROADCAST_BLOCK) or overwrites the oldest
+   message, which the subscriber then learns it missed
+   (TX_BROADCAST_OVERWRITE).  */
+
+typedef struct TX_BROADCAST_STRUCT
+{
+
+    /* Define the broadcast ID used for error checking.  */
+    ULONG               tx_broadcast_id;
+
+    /* Define the broadcast's name.  */
+    CHAR                *tx_broadcast_name;
+
+    /* Define the message size (in ULONGs), the number of messages the ring
+       holds, which is a power of two, and the option for a full ring.  */
+    UINT                tx_broadcast_message_size;
+    UINT                tx_broadcast_capacity;
+    UINT                tx_broadcast_overflow_option;
+
+    /* Define the start of the broadcast's message ring.  */
+    ULONG               *tx_broadcast_start;
+
+    /* Define the running count of messages published, and the read index of
+       the slowest subscriber as last found, which is never ahead of the
+       actual one.  */
+    ULONG               tx_broadcast_write_index;
+    ULONG               tx_broadcast_tail_index;
+
+    /* Define the subscriber list head along with the number of subscribers.  */
+    struct TX_BROADCAST_SUBSCRIBER_STRUCT
+                        *tx_broadcast_subscriber_list;
+    UINT                tx_broadcast_subscriber_count;
+
+    /* Define the suspension list head of the subscribers waiting for a
+       message, and that of the publishers waiting for room in the ring,
+       along with how many threads are on each.  */
+    struct TX_THREAD_STRUCT
+                        *tx_broadcast_suspension_list;
+    UINT                tx_broadcast_suspended_count;
+    struct TX_THREAD_STRUCT
+                        *tx_broadcast_publish_suspension_list;
+    UINT                tx_broadcast_publish_suspended_count;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_BROADCAST_STRUCT
+                        *tx_broadcast_created_next,
+                        *tx_broadcast_created_previous;
+
+} TX_BROADCAST;
+
+
+/* Define the broadcast subscriber structure utilized by the application.  A
+   subscriber is read by one thread at a time.  */
+
+typedef struct TX_BROADCAST_SUBSCRIBER_STRUCT
+{
+
+    /* Define the subscriber ID used for error checking.  */
+    ULONG               tx_broadcast_subscriber_id;
+
+    /* Define the broadcast this subscriber reads.  */
+    struct TX_BROADCAST_STRUCT
+                        *tx_broadcast_subscriber_broadcast;
+
+    /* Define the running count of messages this subscriber has read.  */
+    ULONG               tx_broadcast_subscriber_read_index;
+
+    /* Define the next and previous pointers in the subscriber list of the
+       broadcast.  */
+    struct TX_BROADCAST_SUBSCRIBER_STRUCT
+                        *tx_broadcast_subscriber_next,
+                        *tx_broadcast_subscriber_previous;
+
+} TX_BROADCAST_SUBSCRIBER;
+
+
 /* Define the semaphore structure utilized by the application.  */
 
 typedef struct TX_SEMAPHORE_STRUCT
@@ -955,6 +1503,11 @@ typedef struct TX_SEMAPHORE_STRUCT
                         *tx_semaphore_suspension_list;
     UINT                tx_semaphore_suspended_count;
 
+    /* Define the list of wait blocks of threads that wait for this semaphore
+       among multiple objects.  */
+    struct TX_WAIT_BLOCK_STRUCT
+                        *tx_semaphore_wait_block_list;
+
     /* Define the created list next and previous pointers.  */
     struct TX_SEMAPHORE_STRUCT
                         *tx_semaphore_created_next,
@@ -1010,6 +1563,12 @@ typedef struct TX_SEMAPHORE_STRUCT
 #define tx_kernel_enter                             _tx_initialize_kernel_enter
 
 #define tx_block_allocate                           _tx_block_allocate
+#define tx_block_allocate_n                         _tx_block_allocate_n
+#define tx_block_buffer_allocate                    _tx_block_buffer_allocate
+#define tx_block_buffer_receive                     _tx_block_buffer_receive
+#define tx_block_buffer_reference                   _tx_block_buffer_reference
+#define tx_block_buffer_release                     _tx_block_buffer_release
+#define tx_block_buffer_send                        _tx_block_buffer_send
 #define tx_block_pool_create                        _tx_block_pool_create
 #define tx_block_pool_delete                        _tx_block_pool_delete
 #define tx_block_pool_info_get                      _tx_block_pool_info_get
@@ -1017,14 +1576,26 @@ typedef struct TX_SEMAPHORE_STRUCT
 #define tx_block_pool_performance_system_info_get   _tx_block_pool_performance_system_info_get
 #define tx_block_pool_prioritize                    _tx_block_pool_prioritize
 #define tx_block_release                            _tx_block_release
+#define tx_block_release_n                          _tx_block_release_n
+#define tx_block_slab_allocate                      _tx_block_slab_allocate
+#define tx_block_slab_class_info_get                _tx_block_slab_class_info_get
+#define tx_block_slab_create                        _tx_block_slab_create
+#define tx_block_slab_delete                        _tx_block_slab_delete
+#define tx_block_slab_info_get                      _tx_block_slab_info_get
 
 #define tx_byte_allocate                            _tx_byte_allocate
+#define tx_byte_allocate_aligned                    _tx_byte_allocate_aligned
 #define tx_byte_pool_create                         _tx_byte_pool_create
 #define tx_byte_pool_delete                         _tx_byte_pool_delete
+#define tx_byte_pool_fragmentation_info_get         _tx_byte_pool_fragmentation_info_get
 #define tx_byte_pool_info_get                       _tx_byte_pool_info_get
+#define tx_byte_pool_magazine_create                _tx_byte_pool_magazine_create
+#define tx_byte_pool_magazine_delete                _tx_byte_pool_magazine_delete
+#define tx_byte_pool_magazine_info_get              _tx_byte_pool_magazine_info_get
 #define tx_byte_pool_performance_info_get           _tx_byte_pool_performance_info_get
 #define tx_byte_pool_performance_system_info_get    _tx_byte_pool_performance_system_info_get
 #define tx_byte_pool_prioritize                     _tx_byte_pool_prioritize
+#define tx_byte_pool_tlsf_create                    _tx_byte_pool_tlsf_create
 #define tx_byte_release                             _tx_byte_release
 
 #define tx_event_flags_create                       _tx_event_flags_create
@@ -1057,6 +1628,23 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_mutex_prioritize                         _tx_mutex_prioritize
 #define tx_mutex_put                                _tx_mutex_put
 
+#define tx_channel_create                           _tx_channel_create
+#define tx_channel_delete                           _tx_channel_delete
+#define tx_channel_info_get                         _tx_channel_info_get
+#define tx_channel_receive                          _tx_channel_receive
+#define tx_channel_send                             _tx_channel_send
+
+#define tx_byte_queue_create                        _tx_byte_queue_create
+#define tx_byte_queue_delete                        _tx_byte_queue_delete
+#define tx_byte_queue_flush                         _tx_byte_queue_flush
+#define tx_byte_queue_info_get                      _tx_byte_queue_info_get
+#define tx_byte_queue_performance_info_get          _tx_byte_queue_performance_info_get
+#define tx_byte_queue_performance_system_info_get   _tx_byte_queue_performance_system_info_get
+#define tx_byte_queue_prioritize                    _tx_byte_queue_prioritize
+#define tx_byte_queue_receive                       _tx_byte_queue_receive
+#define tx_byte_queue_send                          _tx_byte_queue_send
+#define tx_byte_queue_send_notify                   _tx_byte_queue_send_notify
+
 #define tx_queue_create                             _tx_queue_create
 #define tx_queue_delete                             _tx_queue_delete
 #define tx_queue_flush                              _tx_queue_flush
@@ -1064,11 +1652,33 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_queue_performance_info_get               _tx_queue_performance_info_get
 #define tx_queue_performance_system_info_get        _tx_queue_performance_system_info_get
 #define tx_queue_receive                            _tx_queue_receive
+#define tx_queue_receive_commit                     _tx_queue_receive_commit
+#define tx_queue_receive_n                          _tx_queue_receive_n
+#define tx_queue_receive_peek                       _tx_queue_receive_peek
 #define tx_queue_send                               _tx_queue_send
+#define tx_queue_send_commit                        _tx_queue_send_commit
+#define tx_queue_send_n                             _tx_queue_send_n
 #define tx_queue_send_notify                        _tx_queue_send_notify
+#define tx_queue_send_reserve                       _tx_queue_send_reserve
+#define tx_queue_spsc_create                        _tx_queue_spsc_create
 #define tx_queue_front_send                         _tx_queue_front_send
 #define tx_queue_prioritize                         _tx_queue_prioritize
 
+#define tx_priority_queue_create                    _tx_priority_queue_create
+#define tx_priority_queue_delete                    _tx_priority_queue_delete
+#define tx_priority_queue_flush                     _tx_priority_queue_flush
+#define tx_priority_queue_info_get                  _tx_priority_queue_info_get
+#define tx_priority_queue_receive                   _tx_priority_queue_receive
+#define tx_priority_queue_send                      _tx_priority_queue_send
+
+#define tx_broadcast_create                         _tx_broadcast_create
+#define tx_broadcast_delete                         _tx_broadcast_delete
+#define tx_broadcast_info_get                       _tx_broadcast_info_get
+#define tx_broadcast_publish                        _tx_broadcast_publish
+#define tx_broadcast_receive                        _tx_broadcast_receive
+#define tx_broadcast_subscribe                      _tx_broadcast_subscribe
+#define tx_broadcast_unsubscribe                    _tx_broadcast_unsubscribe
+
 #define tx_semaphore_ceiling_put                    _tx_semaphore_ceiling_put
 #define tx_semaphore_create                         _tx_semaphore_create
 #define tx_semaphore_delete                         _tx_semaphore_delete
@@ -1098,14 +1708,17 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_thread_terminate                         _tx_thread_terminate
 #define tx_thread_time_slice_change                 _tx_thread_time_slice_change
 #define tx_thread_wait_abort                        _tx_thread_wait_abort
+#define tx_thread_wait_multiple                     _tx_thread_wait_multiple
 
 #define tx_time_get                                 _tx_time_get
+#define tx_time_increment                           _tx_time_increment
 #define tx_time_set                                 _tx_time_set
 #define tx_timer_activate                           _tx_timer_activate
 #define tx_timer_change                             _tx_timer_change
 #define tx_timer_create                             _tx_timer_create
 #define tx_timer_deactivate                         _tx_timer_deactivate
 #define tx_timer_delete                             _tx_timer_delete
+#define tx_timer_get_next                           _tx_timer_get_next
 #define tx_timer_info_get                           _tx_timer_info_get
 #define tx_timer_performance_info_get               _tx_timer_performance_info_get
 #define tx_timer_performance_system_info_get        _tx_timer_performance_system_info_get
@@ -1133,6 +1746,12 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 /* Services with MULTI runtime error checking ThreadX.  */
 
 #define tx_block_allocate                           _txr_block_allocate
+#define tx_block_allocate_n                         _txr_block_allocate_n
+#define tx_block_buffer_allocate                    _txr_block_buffer_allocate
+#define tx_block_buffer_receive                     _txr_block_buffer_receive
+#define tx_block_buffer_reference                   _txr_block_buffer_reference
+#define tx_block_buffer_release                     _txr_block_buffer_release
+#define tx_block_buffer_send                        _txr_block_buffer_send
 #define tx_block_pool_create(p,n,b,s,l)             _txr_block_pool_create((p),(n),(b),(s),(l),(sizeof(TX_BLOCK_POOL)))
 #define tx_block_pool_delete                        _txr_block_pool_delete
 #define tx_block_pool_info_get                      _txr_block_pool_info_get
@@ -1140,14 +1759,26 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_block_pool_performance_system_info_get   _tx_block_pool_performance_system_info_get
 #define tx_block_pool_prioritize                    _txr_block_pool_prioritize
 #define tx_block_release                            _txr_block_release
+#define tx_block_release_n                          _txr_block_release_n
+#define tx_block_slab_allocate                      _txr_block_slab_allocate
+#define tx_block_slab_class_info_get                _txr_block_slab_class_info_get
+#define tx_block_slab_create(s,n,b,c,p,l,o)         _txr_block_slab_create((s),(n),(b),(c),(p),(l),(o),(sizeof(TX_BLOCK_SLAB)))
+#define tx_block_slab_delete                        _txr_block_slab_delete
+#define tx_block_slab_info_get                      _txr_block_slab_info_get
 
 #define tx_byte_allocate                            _txr_byte_allocate
+#define tx_byte_allocate_aligned                    _txr_byte_allocate_aligned
 #define tx_byte_pool_create(p,n,s,l)                _txr_byte_pool_create((p),(n),(s),(l),(sizeof(TX_BYTE_POOL)))
 #define tx_byte_pool_delete                         _txr_byte_pool_delete
+#define tx_byte_pool_fragmentation_info_get         _txr_byte_pool_fragmentation_info_get
 #define tx_byte_pool_info_get                       _txr_byte_pool_info_get
+#define tx_byte_pool_magazine_create(p,m,t)         _txr_byte_pool_magazine_create((p),(m),(t),(sizeof(TX_BYTE_POOL_MAGAZINE)))
+#define tx_byte_pool_magazine_delete                _txr_byte_pool_magazine_delete
+#define tx_byte_pool_magazine_info_get              _txr_byte_pool_magazine_info_get
 #define tx_byte_pool_performance_info_get           _tx_byte_pool_performance_info_get
 #define tx_byte_pool_performance_system_info_get    _tx_byte_pool_performance_system_info_get
 #define tx_byte_pool_prioritize                     _txr_byte_pool_prioritize
+#define tx_byte_pool_tlsf_create(p,n,s,l)           _txr_byte_pool_tlsf_create((p),(n),(s),(l),(sizeof(TX_BYTE_POOL)))
 #define tx_byte_release                             _txr_byte_release
 
 #define tx_event_flags_create(g,n)                  _txr_event_flags_create((g),(n),(sizeof(TX_EVENT_FLAGS_GROUP)))
@@ -1180,6 +1811,23 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_mutex_prioritize                         _txr_mutex_prioritize
 #define tx_mutex_put                                _txr_mutex_put
 
+#define tx_channel_create(c,n,m,s,l)                _txr_channel_create((c),(n),(m),(s),(l),(sizeof(TX_CHANNEL)))
+#define tx_channel_delete                           _txr_channel_delete
+#define tx_channel_info_get                         _txr_channel_info_get
+#define tx_channel_receive                          _txr_channel_receive
+#define tx_channel_send                             _txr_channel_send
+
+#define tx_byte_queue_create(q,n,s,l)               _txr_byte_queue_create((q),(n),(s),(l),(sizeof(TX_BYTE_QUEUE)))
+#define tx_byte_queue_delete                        _txr_byte_queue_delete
+#define tx_byte_queue_flush                         _txr_byte_queue_flush
+#define tx_byte_queue_info_get                      _txr_byte_queue_info_get
+#define tx_byte_queue_performance_info_get          _tx_byte_queue_performance_info_get
+#define tx_byte_queue_performance_system_info_get   _tx_byte_queue_performance_system_info_get
+#define tx_byte_queue_prioritize                    _txr_byte_queue_prioritize
+#define tx_byte_queue_receive                       _txr_byte_queue_receive
+#define tx_byte_queue_send                          _txr_byte_queue_send
+#define tx_byte_queue_send_notify                   _txr_byte_queue_send_notify
+
 #define tx_queue_create(q,n,m,s,l)                  _txr_queue_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_delete                             _txr_queue_delete
 #define tx_queue_flush                              _txr_queue_flush
@@ -1187,11 +1835,33 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_queue_performance_info_get               _tx_queue_performance_info_get
 #define tx_queue_performance_system_info_get        _tx_queue_performance_system_info_get
 #define tx_queue_receive                            _txr_queue_receive
+#define tx_queue_receive_commit                     _txr_queue_receive_commit
+#define tx_queue_receive_n                          _txr_queue_receive_n
+#define tx_queue_receive_peek                       _txr_queue_receive_peek
 #define tx_queue_send                               _txr_queue_send
+#define tx_queue_send_commit                        _txr_queue_send_commit
+#define tx_queue_send_n                             _txr_queue_send_n
 #define tx_queue_send_notify                        _txr_queue_send_notify
+#define tx_queue_send_reserve                       _txr_queue_send_reserve
+#define tx_queue_spsc_create(q,n,m,s,l)             _txr_queue_spsc_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_front_send                         _txr_queue_front_send
 #define tx_queue_prioritize                         _txr_queue_prioritize
 
+#define tx_priority_queue_create(q,n,m,s,l)         _txr_priority_queue_create((q),(n),(m),(s),(l),(sizeof(TX_PRIORITY_QUEUE)))
+#define tx_priority_queue_delete                    _txr_priority_queue_delete
+#define tx_priority_queue_flush                     _txr_priority_queue_flush
+#define tx_priority_queue_info_get                  _txr_priority_queue_info_get
+#define tx_priority_queue_receive                   _txr_priority_queue_receive
+#define tx_priority_queue_send                      _txr_priority_queue_send
+
+#define tx_broadcast_create(b,n,m,s,l,o)            _txr_broadcast_create((b),(n),(m),(s),(l),(o),(sizeof(TX_BROADCAST)))
+#define tx_broadcast_delete                         _txr_broadcast_delete
+#define tx_broadcast_info_get                       _txr_broadcast_info_get
+#define tx_broadcast_publish                        _txr_broadcast_publish
+#define tx_broadcast_receive                        _txr_broadcast_receive
+#define tx_broadcast_subscribe                      _txr_broadcast_subscribe
+#define tx_broadcast_unsubscribe                    _txr_broadcast_unsubscribe
+
 #define tx_semaphore_ceiling_put                    _txr_semaphore_ceiling_put
 #define tx_semaphore_create(s,n,i)                  _txr_semaphore_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
 #define tx_semaphore_delete                         _txr_semaphore_delete
@@ -1221,14 +1891,17 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_thread_terminate                         _txr_thread_terminate
 #define tx_thread_time_slice_change                 _txr_thread_time_slice_change
 #define tx_thread_wait_abort                        _txr_thread_wait_abort
+#define tx_thread_wait_multiple                     _txr_thread_wait_multiple
 
 #define tx_time_get                                 _tx_time_get
+#define tx_time_increment                           _tx_time_increment
 #define tx_time_set                                 _tx_time_set
 #define tx_timer_activate                           _txr_timer_activate
 #define tx_timer_change                             _txr_timer_change
 #define tx_timer_create(t,n,e,i,c,r,a)              _txr_timer_create((t),(n),(e),(i),(c),(r),(a),(sizeof(TX_TIMER)))
 #define tx_timer_deactivate                         _txr_timer_deactivate
 #define tx_timer_delete                             _txr_timer_delete
+#define tx_timer_get_next                           _tx_timer_get_next
 #define tx_timer_info_get                           _txr_timer_info_get
 #define tx_timer_performance_info_get               _tx_timer_performance_info_get
 #define tx_timer_performance_system_info_get        _tx_timer_performance_system_info_get
@@ -1245,6 +1918,12 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #else
 
 #define tx_block_allocate                           _txe_block_allocate
+#define tx_block_allocate_n                         _txe_block_allocate_n
+#define tx_block_buffer_allocate                    _txe_block_buffer_allocate
+#define tx_block_buffer_receive                     _txe_block_buffer_receive
+#define tx_block_buffer_reference                   _txe_block_buffer_reference
+#define tx_block_buffer_release                     _txe_block_buffer_release
+#define tx_block_buffer_send                        _txe_block_buffer_send
 #define tx_block_pool_create(p,n,b,s,l)             _txe_block_pool_create((p),(n),(b),(s),(l),(sizeof(TX_BLOCK_POOL)))
 #define tx_block_pool_delete                        _txe_block_pool_delete
 #define tx_block_pool_info_get                      _txe_block_pool_info_get
@@ -1252,14 +1931,26 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_block_pool_performance_system_info_get   _tx_block_pool_performance_system_info_get
 #define tx_block_pool_prioritize                    _txe_block_pool_prioritize
 #define tx_block_release                            _txe_block_release
+#define tx_block_release_n                          _txe_block_release_n
+#define tx_block_slab_allocate                      _txe_block_slab_allocate
+#define tx_block_slab_class_info_get                _txe_block_slab_class_info_get
+#define tx_block_slab_create(s,n,b,c,p,l,o)         _txe_block_slab_create((s),(n),(b),(c),(p),(l),(o),(sizeof(TX_BLOCK_SLAB)))
+#define tx_block_slab_delete                        _txe_block_slab_delete
+#define tx_block_slab_info_get                      _txe_block_slab_info_get
 
 #define tx_byte_allocate                            _txe_byte_allocate
+#define tx_byte_allocate_aligned                    _txe_byte_allocate_aligned
 #define tx_byte_pool_create(p,n,s,l)                _txe_byte_pool_create((p),(n),(s),(l),(sizeof(TX_BYTE_POOL)))
 #define tx_byte_pool_delete                         _txe_byte_pool_delete
+#define tx_byte_pool_fragmentation_info_get         _txe_byte_pool_fragmentation_info_get
 #define tx_byte_pool_info_get                       _txe_byte_pool_info_get
+#define tx_byte_pool_magazine_create(p,m,t)         _txe_byte_pool_magazine_create((p),(m),(t),(sizeof(TX_BYTE_POOL_MAGAZINE)))
+#define tx_byte_pool_magazine_delete                _txe_byte_pool_magazine_delete
+#define tx_byte_pool_magazine_info_get              _txe_byte_pool_magazine_info_get
 #define tx_byte_pool_performance_info_get           _tx_byte_pool_performance_info_get
 #define tx_byte_pool_performance_system_info_get    _tx_byte_pool_performance_system_info_get
 #define tx_byte_pool_prioritize                     _txe_byte_pool_prioritize
+#define tx_byte_pool_tlsf_create(p,n,s,l)           _txe_byte_pool_tlsf_create((p),(n),(s),(l),(sizeof(TX_BYTE_POOL)))
 #define tx_byte_release                             _txe_byte_release
 
 #define tx_event_flags_create(g,n)                  _txe_event_flags_create((g),(n),(sizeof(TX_EVENT_FLAGS_GROUP)))
@@ -1291,6 +1982,23 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_mutex_prioritize                         _txe_mutex_prioritize
 #define tx_mutex_put                                _txe_mutex_put
 
+#define tx_channel_create(c,n,m,s,l)                _txe_channel_create((c),(n),(m),(s),(l),(sizeof(TX_CHANNEL)))
+#define tx_channel_delete                           _txe_channel_delete
+#define tx_channel_info_get                         _txe_channel_info_get
+#define tx_channel_receive                          _txe_channel_receive
+#define tx_channel_send                             _txe_channel_send
+
+#define tx_byte_queue_create(q,n,s,l)               _txe_byte_queue_create((q),(n),(s),(l),(sizeof(TX_BYTE_QUEUE)))
+#define tx_byte_queue_delete                        _txe_byte_queue_delete
+#define tx_byte_queue_flush                         _txe_byte_queue_flush
+#define tx_byte_queue_info_get                      _txe_byte_queue_info_get
+#define tx_byte_queue_performance_info_get          _tx_byte_queue_performance_info_get
+#define tx_byte_queue_performance_system_info_get   _tx_byte_queue_performance_system_info_get
+#define tx_byte_queue_prioritize                    _txe_byte_queue_prioritize
+#define tx_byte_queue_receive                       _txe_byte_queue_receive
+#define tx_byte_queue_send                          _txe_byte_queue_send
+#define tx_byte_queue_send_notify                   _txe_byte_queue_send_notify
+
 #define tx_queue_create(q,n,m,s,l)                  _txe_queue_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_delete                             _txe_queue_delete
 #define tx_queue_flush                              _txe_queue_flush
@@ -1298,11 +2006,33 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_queue_performance_info_get               _tx_queue_performance_info_get
 #define tx_queue_performance_system_info_get        _tx_queue_performance_system_info_get
 #define tx_queue_receive                            _txe_queue_receive
+#define tx_queue_receive_commit                     _txe_queue_receive_commit
+#define tx_queue_receive_n                          _txe_queue_receive_n
+#define tx_queue_receive_peek                       _txe_queue_receive_peek
 #define tx_queue_send                               _txe_queue_send
+#define tx_queue_send_commit                        _txe_queue_send_commit
+#define tx_queue_send_n                             _txe_queue_send_n
 #define tx_queue_send_notify                        _txe_queue_send_notify
+#define tx_queue_send_reserve                       _txe_queue_send_reserve
+#define tx_queue_spsc_create(q,n,m,s,l)             _txe_queue_spsc_create((q),(n),(m),(s),(l),(sizeof(TX_QUEUE)))
 #define tx_queue_front_send                         _txe_queue_front_send
 #define tx_queue_prioritize                         _txe_queue_prioritize
 
+#define tx_priority_queue_create(q,n,m,s,l)         _txe_priority_queue_create((q),(n),(m),(s),(l),(sizeof(TX_PRIORITY_QUEUE)))
+#define tx_priority_queue_delete                    _txe_priority_queue_delete
+#define tx_priority_queue_flush                     _txe_priority_queue_flush
+#define tx_priority_queue_info_get                  _txe_priority_queue_info_get
+#define tx_priority_queue_receive                   _txe_priority_queue_receive
+#define tx_priority_queue_send                      _txe_priority_queue_send
+
+#define tx_broadcast_create(b,n,m,s,l,o)            _txe_broadcast_create((b),(n),(m),(s),(l),(o),(sizeof(TX_BROADCAST)))
+#define tx_broadcast_delete                         _txe_broadcast_delete
+#define tx_broadcast_info_get                       _txe_broadcast_info_get
+#define tx_broadcast_publish                        _txe_broadcast_publish
+#define tx_broadcast_receive                        _txe_broadcast_receive
+#define tx_broadcast_subscribe                      _txe_broadcast_subscribe
+#define tx_broadcast_unsubscribe                    _txe_broadcast_unsubscribe
+
 #define tx_semaphore_ceiling_put                    _txe_semaphore_ceiling_put
 #define tx_semaphore_create(s,n,i)                  _txe_semaphore_create((s),(n),(i),(sizeof(TX_SEMAPHORE)))
 #define tx_semaphore_delete                         _txe_semaphore_delete
@@ -1332,14 +2062,17 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_terminate                         _txe_thread_terminate
 #define tx_thread_time_slice_change                 _txe_thread_time_slice_change
 #define tx_thread_wait_abort                        _txe_thread_wait_abort
+#define tx_thread_wait_multiple                     _txe_thread_wait_multiple
 
 #define tx_time_get                                 _tx_time_get
+#define tx_time_increment                           _tx_time_increment
 #define tx_time_set                                 _tx_time_set
 #define tx_timer_activate                           _txe_timer_activate
 #define tx_timer_change                             _txe_timer_change
 #define tx_timer_create(t,n,e,i,c,r,a)              _txe_timer_create((t),(n),(e),(i),(c),(r),(a),(sizeof(TX_TIMER)))
 #define tx_timer_deactivate                         _txe_timer_deactivate
 #define tx_timer_delete                             _txe_timer_delete
+#define tx_timer_get_next                           _tx_timer_get_next
 #define tx_timer_info_get                           _txe_timer_info_get
 #define tx_timer_performance_info_get               _tx_timer_performance_info_get
 #define tx_timer_performance_system_info_get        _tx_timer_performance_system_info_get
@@ -1370,6 +2103,13 @@ VOID        tx_application_define(VOID *first_unused_memory);
 /* Define block memory pool management function prototypes.  */
 
 UINT        _tx_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option);
+UINT        _tx_block_allocate_n(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, UINT block_count,
+                    UINT *allocated_count, ULONG wait_option);
+UINT        _tx_block_buffer_allocate(TX_BLOCK_POOL *pool_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option);
+UINT        _tx_block_buffer_receive(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option);
+UINT        _tx_block_buffer_reference(TX_BLOCK_BUFFER *buffer_ptr);
+UINT        _tx_block_buffer_release(TX_BLOCK_BUFFER *buffer_ptr);
+UINT        _tx_block_buffer_send(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER *buffer_ptr, ULONG wait_option);
 UINT        _tx_block_pool_create(TX_BLOCK_POOL *pool_ptr, CHAR *name_ptr, ULONG block_size,
                     VOID *pool_start, ULONG pool_size);
 UINT        _tx_block_pool_delete(TX_BLOCK_POOL *pool_ptr);
@@ -1382,12 +2122,28 @@ UINT        _tx_block_pool_performance_system_info_get(ULONG *allocates, ULONG *
                     ULONG *suspensions, ULONG *timeouts);
 UINT        _tx_block_pool_prioritize(TX_BLOCK_POOL *pool_ptr);
 UINT        _tx_block_release(VOID *block_ptr);
+UINT        _tx_block_release_n(VOID **block_ptr, UINT block_count);
+UINT        _tx_block_slab_allocate(TX_BLOCK_SLAB *slab_ptr, VOID **block_ptr, ULONG memory_size, ULONG wait_option);
+UINT        _tx_block_slab_class_info_get(TX_BLOCK_SLAB *slab_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *available_blocks, ULONG *total_blocks, ULONG *spills);
+UINT        _tx_block_slab_create(TX_BLOCK_SLAB *slab_ptr, CHAR *name_ptr, ULONG *block_sizes, UINT class_count,
+                    VOID *pool_start, ULONG pool_size, UINT spill_option);
+UINT        _tx_block_slab_delete(TX_BLOCK_SLAB *slab_ptr);
+UINT        _tx_block_slab_info_get(TX_BLOCK_SLAB *slab_ptr, CHAR **name, ULONG *class_count,
+                    ULONG *spills, TX_BLOCK_SLAB **next_slab);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
    application.  */
 
 UINT        _txe_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option);
+UINT        _txe_block_allocate_n(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, UINT block_count,
+                    UINT *allocated_count, ULONG wait_option);
+UINT        _txe_block_buffer_allocate(TX_BLOCK_POOL *pool_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option);
+UINT        _txe_block_buffer_receive(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option);
+UINT        _txe_block_buffer_reference(TX_BLOCK_BUFFER *buffer_ptr);
+UINT        _txe_block_buffer_release(TX_BLOCK_BUFFER *buffer_ptr);
+UINT        _txe_block_buffer_send(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER *buffer_ptr, ULONG wait_option);
 UINT        _txe_block_pool_create(TX_BLOCK_POOL *pool_ptr, CHAR *name_ptr, ULONG block_size,
                     VOID *pool_start, ULONG pool_size, UINT pool_control_block_size);
 UINT        _txe_block_pool_delete(TX_BLOCK_POOL *pool_ptr);
@@ -1396,8 +2152,24 @@ UINT        _txe_block_pool_info_get(TX_BLOCK_POOL *pool_ptr, CHAR **name, ULONG
                     ULONG *suspended_count, TX_BLOCK_POOL **next_pool);
 UINT        _txe_block_pool_prioritize(TX_BLOCK_POOL *pool_ptr);
 UINT        _txe_block_release(VOID *block_ptr);
+UINT        _txe_block_release_n(VOID **block_ptr, UINT block_count);
+UINT        _txe_block_slab_allocate(TX_BLOCK_SLAB *slab_ptr, VOID **block_ptr, ULONG memory_size, ULONG wait_option);
+UINT        _txe_block_slab_class_info_get(TX_BLOCK_SLAB *slab_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *available_blocks, ULONG *total_blocks, ULONG *spills);
+UINT        _txe_block_slab_create(TX_BLOCK_SLAB *slab_ptr, CHAR *name_ptr, ULONG *block_sizes, UINT class_count,
+                    VOID *pool_start, ULONG pool_size, UINT spill_option, UINT slab_control_block_size);
+UINT        _txe_block_slab_delete(TX_BLOCK_SLAB *slab_ptr);
+UINT        _txe_block_slab_info_get(TX_BLOCK_SLAB *slab_ptr, CHAR **name, ULONG *class_count,
+                    ULONG *spills, TX_BLOCK_SLAB **next_slab);
 #ifdef TX_ENABLE_MULTI_ERROR_CHECKING
 UINT        _txr_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option);
+UINT        _txr_block_allocate_n(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, UINT block_count,
+                    UINT *allocated_count, ULONG wait_option);
+UINT        _txr_block_buffer_allocate(TX_BLOCK_POOL *pool_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option);
+UINT        _txr_block_buffer_receive(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option);
+UINT        _txr_block_buffer_reference(TX_BLOCK_BUFFER *buffer_ptr);
+UINT        _txr_block_buffer_release(TX_BLOCK_BUFFER *buffer_ptr);
+UINT        _txr_block_buffer_send(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER *buffer_ptr, ULONG wait_option);
 UINT        _txr_block_pool_create(TX_BLOCK_POOL *pool_ptr, CHAR *name_ptr, ULONG block_size,
                     VOID *pool_start, ULONG pool_size, UINT pool_control_block_size);
 UINT        _txr_block_pool_delete(TX_BLOCK_POOL *pool_ptr);
@@ -1406,6 +2178,15 @@ UINT        _txr_block_pool_info_get(TX_BLOCK_POOL *pool_ptr, CHAR **name, ULONG
                     ULONG *suspended_count, TX_BLOCK_POOL **next_pool);
 UINT        _txr_block_pool_prioritize(TX_BLOCK_POOL *pool_ptr);
 UINT        _txr_block_release(VOID *block_ptr);
+UINT        _txr_block_release_n(VOID **block_ptr, UINT block_count);
+UINT        _txr_block_slab_allocate(TX_BLOCK_SLAB *slab_ptr, VOID **block_ptr, ULONG memory_size, ULONG wait_option);
+UINT        _txr_block_slab_class_info_get(TX_BLOCK_SLAB *slab_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *available_blocks, ULONG *total_blocks, ULONG *spills);
+UINT        _txr_block_slab_create(TX_BLOCK_SLAB *slab_ptr, CHAR *name_ptr, ULONG *block_sizes, UINT class_count,
+                    VOID *pool_start, ULONG pool_size, UINT spill_option, UINT slab_control_block_size);
+UINT        _txr_block_slab_delete(TX_BLOCK_SLAB *slab_ptr);
+UINT        _txr_block_slab_info_get(TX_BLOCK_SLAB *slab_ptr, CHAR **name, ULONG *class_count,
+                    ULONG *spills, TX_BLOCK_SLAB **next_slab);
 #endif
 
 
@@ -1413,17 +2194,27 @@ UINT        _txr_block_release(VOID *block_ptr);
 
 UINT        _tx_byte_allocate(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
                     ULONG wait_option);
+UINT        _tx_byte_allocate_aligned(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
+                    ULONG alignment, ULONG wait_option);
 UINT        _tx_byte_pool_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
                     ULONG pool_size);
 UINT        _tx_byte_pool_delete(TX_BYTE_POOL *pool_ptr);
+UINT        _tx_byte_pool_fragmentation_info_get(TX_BYTE_POOL *pool_ptr, ULONG *largest_free_bytes,
+                    ULONG *free_histogram, ULONG *allocated_histogram, ULONG *fragmentation_percent);
 UINT        _tx_byte_pool_info_get(TX_BYTE_POOL *pool_ptr, CHAR **name, ULONG *available_bytes,
                     ULONG *fragments, TX_THREAD **first_suspended,
                     ULONG *suspended_count, TX_BYTE_POOL **next_pool);
+UINT        _tx_byte_pool_magazine_create(TX_BYTE_POOL *pool_ptr, TX_BYTE_POOL_MAGAZINE *magazine_ptr,
+                    TX_THREAD *thread_ptr);
+UINT        _tx_byte_pool_magazine_delete(TX_BYTE_POOL_MAGAZINE *magazine_ptr);
+UINT        _tx_byte_pool_magazine_info_get(TX_BYTE_POOL *pool_ptr, ULONG *magazine_hits, ULONG *magazine_misses);
 UINT        _tx_byte_pool_performance_info_get(TX_BYTE_POOL *pool_ptr, ULONG *allocates, ULONG *releases,
                     ULONG *fragments_searched, ULONG *merges, ULONG *splits, ULONG *suspensions, ULONG *timeouts);
 UINT        _tx_byte_pool_performance_system_info_get(ULONG *allocates, ULONG *releases,
                     ULONG *fragments_searched, ULONG *merges, ULONG *splits, ULONG *suspensions, ULONG *timeouts);
 UINT        _tx_byte_pool_prioritize(TX_BYTE_POOL *pool_ptr);
+UINT        _tx_byte_pool_tlsf_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
+                    ULONG pool_size);
 UINT        _tx_byte_release(VOID *memory_ptr);
 
 
@@ -1432,24 +2223,44 @@ UINT        _tx_byte_release(VOID *memory_ptr);
 
 UINT        _txe_byte_allocate(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
                     ULONG wait_option);
+UINT        _txe_byte_allocate_aligned(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
+                    ULONG alignment, ULONG wait_option);
 UINT        _txe_byte_pool_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
                     ULONG pool_size, UINT pool_control_block_size);
 UINT        _txe_byte_pool_delete(TX_BYTE_POOL *pool_ptr);
+UINT        _txe_byte_pool_fragmentation_info_get(TX_BYTE_POOL *pool_ptr, ULONG *largest_free_bytes,
+                    ULONG *free_histogram, ULONG *allocated_histogram, ULONG *fragmentation_percent);
 UINT        _txe_byte_pool_info_get(TX_BYTE_POOL *pool_ptr, CHAR **name, ULONG *available_bytes,
                     ULONG *fragments, TX_THREAD **first_suspended,
                     ULONG *suspended_count, TX_BYTE_POOL **next_pool);
+UINT        _txe_byte_pool_magazine_create(TX_BYTE_POOL *pool_ptr, TX_BYTE_POOL_MAGAZINE *magazine_ptr,
+                    TX_THREAD *thread_ptr, UINT magazine_control_block_size);
+UINT        _txe_byte_pool_magazine_delete(TX_BYTE_POOL_MAGAZINE *magazine_ptr);
+UINT        _txe_byte_pool_magazine_info_get(TX_BYTE_POOL *pool_ptr, ULONG *magazine_hits, ULONG *magazine_misses);
 UINT        _txe_byte_pool_prioritize(TX_BYTE_POOL *pool_ptr);
+UINT        _txe_byte_pool_tlsf_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
+                    ULONG pool_size, UINT pool_control_block_size);
 UINT        _txe_byte_release(VOID *memory_ptr);
 #ifdef TX_ENABLE_MULTI_ERROR_CHECKING
 UINT        _txr_byte_allocate(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
                     ULONG wait_option);
+UINT        _txr_byte_allocate_aligned(TX_BYTE_POOL *pool_ptr, VOID **memory_ptr, ULONG memory_size,
+                    ULONG alignment, ULONG wait_option);
 UINT        _txr_byte_pool_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
                     ULONG pool_size, UINT pool_control_block_size);
 UINT        _txr_byte_pool_delete(TX_BYTE_POOL *pool_ptr);
+UINT        _txr_byte_pool_fragmentation_info_get(TX_BYTE_POOL *pool_ptr, ULONG *largest_free_bytes,
+                    ULONG *free_histogram, ULONG *allocated_histogram, ULONG *fragmentation_percent);
 UINT        _txr_byte_pool_info_get(TX_BYTE_POOL *pool_ptr, CHAR **name, ULONG *available_bytes,
                     ULONG *fragments, TX_THREAD **first_suspended,
                     ULONG *suspended_count, TX_BYTE_POOL **next_pool);
+UINT        _txr_byte_pool_magazine_create(TX_BYTE_POOL *pool_ptr, TX_BYTE_POOL_MAGAZINE *magazine_ptr,
+                    TX_THREAD *thread_ptr, UINT magazine_control_block_size);
+UINT        _txr_byte_pool_magazine_delete(TX_BYTE_POOL_MAGAZINE *magazine_ptr);
+UINT        _txr_byte_pool_magazine_info_get(TX_BYTE_POOL *pool_ptr, ULONG *magazine_hits, ULONG *magazine_misses);
 UINT        _txr_byte_pool_prioritize(TX_BYTE_POOL *pool_ptr);
+UINT        _txr_byte_pool_tlsf_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start,
+                    ULONG pool_size, UINT pool_control_block_size);
 UINT        _txr_byte_release(VOID *memory_ptr);
 #endif
 
@@ -1545,6 +2356,30 @@ UINT        _txr_mutex_put(TX_MUTEX *mutex_ptr);
 
 /* Define queue management function prototypes.  */
 
+UINT        _tx_channel_create(TX_CHANNEL *channel_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *channel_start, ULONG channel_size);
+UINT        _tx_channel_delete(TX_CHANNEL *channel_ptr);
+UINT        _tx_channel_info_get(TX_CHANNEL *channel_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **suspended_thread, TX_CHANNEL **next_channel);
+UINT        _tx_channel_receive(TX_CHANNEL *channel_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _tx_channel_send(TX_CHANNEL *channel_ptr, VOID *source_ptr);
+UINT        _tx_byte_queue_create(TX_BYTE_QUEUE *queue_ptr, CHAR *name_ptr, VOID *queue_start,
+                    ULONG queue_size);
+UINT        _tx_byte_queue_delete(TX_BYTE_QUEUE *queue_ptr);
+UINT        _tx_byte_queue_flush(TX_BYTE_QUEUE *queue_ptr);
+UINT        _tx_byte_queue_info_get(TX_BYTE_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued,
+                    ULONG *available_bytes, TX_THREAD **first_suspended, ULONG *suspended_count,
+                    TX_BYTE_QUEUE **next_queue);
+UINT        _tx_byte_queue_performance_info_get(TX_BYTE_QUEUE *queue_ptr, ULONG *messages_sent,
+                    ULONG *messages_received, ULONG *empty_suspensions, ULONG *full_suspensions,
+                    ULONG *full_errors, ULONG *timeouts);
+UINT        _tx_byte_queue_performance_system_info_get(ULONG *messages_sent, ULONG *messages_received,
+                    ULONG *empty_suspensions, ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts);
+UINT        _tx_byte_queue_prioritize(TX_BYTE_QUEUE *queue_ptr);
+UINT        _tx_byte_queue_receive(TX_BYTE_QUEUE *queue_ptr, VOID *destination_ptr, ULONG destination_size,
+                    ULONG *actual_size, ULONG wait_option);
+UINT        _tx_byte_queue_send(TX_BYTE_QUEUE *queue_ptr, VOID *source_ptr, ULONG size, ULONG wait_option);
+UINT        _tx_byte_queue_send_notify(TX_BYTE_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_BYTE_QUEUE *notify_queue_ptr));
 UINT        _tx_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
                         VOID *queue_start, ULONG queue_size);
 UINT        _tx_queue_delete(TX_QUEUE *queue_ptr);
@@ -1557,14 +2392,61 @@ UINT        _tx_queue_performance_system_info_get(ULONG *messages_sent, ULONG *m
                     ULONG *empty_suspensions, ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts);
 UINT        _tx_queue_prioritize(TX_QUEUE *queue_ptr);
 UINT        _tx_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _tx_queue_receive_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _tx_queue_receive_n(TX_QUEUE *queue_ptr, VOID *destination_ptr, UINT message_count,
+                    UINT *received_count, ULONG wait_option);
+UINT        _tx_queue_receive_peek(TX_QUEUE *queue_ptr, VOID **message_ptr);
 UINT        _tx_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _tx_queue_send_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _tx_queue_send_n(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT message_count,
+                    UINT *sent_count, ULONG wait_option);
 UINT        _tx_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
+UINT        _tx_queue_send_reserve(TX_QUEUE *queue_ptr, VOID **message_ptr);
+UINT        _tx_queue_spsc_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *queue_start, ULONG queue_size);
 UINT        _tx_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _tx_priority_queue_create(TX_PRIORITY_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *queue_start, ULONG queue_size);
+UINT        _tx_priority_queue_delete(TX_PRIORITY_QUEUE *queue_ptr);
+UINT        _tx_priority_queue_flush(TX_PRIORITY_QUEUE *queue_ptr);
+UINT        _tx_priority_queue_info_get(TX_PRIORITY_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_PRIORITY_QUEUE **next_queue);
+UINT        _tx_priority_queue_receive(TX_PRIORITY_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _tx_priority_queue_send(TX_PRIORITY_QUEUE *queue_ptr, VOID *source_ptr, UINT priority, ULONG wait_option);
+UINT        _tx_broadcast_create(TX_BROADCAST *broadcast_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *broadcast_start, ULONG broadcast_size, UINT overflow_option);
+UINT        _tx_broadcast_delete(TX_BROADCAST *broadcast_ptr);
+UINT        _tx_broadcast_info_get(TX_BROADCAST *broadcast_ptr, CHAR **name, ULONG *published, ULONG *subscriber_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BROADCAST **next_broadcast);
+UINT        _tx_broadcast_publish(TX_BROADCAST *broadcast_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _tx_broadcast_receive(TX_BROADCAST_SUBSCRIBER *subscriber_ptr, VOID *destination_ptr, ULONG *missed_count,
+                    ULONG wait_option);
+UINT        _tx_broadcast_subscribe(TX_BROADCAST *broadcast_ptr, TX_BROADCAST_SUBSCRIBER *subscriber_ptr);
+UINT        _tx_broadcast_unsubscribe(TX_BROADCAST_SUBSCRIBER *subscriber_ptr);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
    application.  */
 
+UINT        _txe_channel_create(TX_CHANNEL *channel_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *channel_start, ULONG channel_size, UINT channel_control_block_size);
+UINT        _txe_channel_delete(TX_CHANNEL *channel_ptr);
+UINT        _txe_channel_info_get(TX_CHANNEL *channel_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **suspended_thread, TX_CHANNEL **next_channel);
+UINT        _txe_channel_receive(TX_CHANNEL *channel_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txe_channel_send(TX_CHANNEL *channel_ptr, VOID *source_ptr);
+UINT        _txe_byte_queue_create(TX_BYTE_QUEUE *queue_ptr, CHAR *name_ptr, VOID *queue_start,
+                    ULONG queue_size, UINT queue_control_block_size);
+UINT        _txe_byte_queue_delete(TX_BYTE_QUEUE *queue_ptr);
+UINT        _txe_byte_queue_flush(TX_BYTE_QUEUE *queue_ptr);
+UINT        _txe_byte_queue_info_get(TX_BYTE_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued,
+                    ULONG *available_bytes, TX_THREAD **first_suspended, ULONG *suspended_count,
+                    TX_BYTE_QUEUE **next_queue);
+UINT        _txe_byte_queue_prioritize(TX_BYTE_QUEUE *queue_ptr);
+UINT        _txe_byte_queue_receive(TX_BYTE_QUEUE *queue_ptr, VOID *destination_ptr, ULONG destination_size,
+                    ULONG *actual_size, ULONG wait_option);
+UINT        _txe_byte_queue_send(TX_BYTE_QUEUE *queue_ptr, VOID *source_ptr, ULONG size, ULONG wait_option);
+UINT        _txe_byte_queue_send_notify(TX_BYTE_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_BYTE_QUEUE *notify_queue_ptr));
 UINT        _txe_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
                         VOID *queue_start, ULONG queue_size, UINT queue_control_block_size);
 UINT        _txe_queue_delete(TX_QUEUE *queue_ptr);
@@ -1573,10 +2455,58 @@ UINT        _txe_queue_info_get(TX_QUEUE *queue_ptr, CHAR **name, ULONG *enqueue
                     TX_THREAD **first_suspended, ULONG *suspended_count, TX_QUEUE **next_queue);
 UINT        _txe_queue_prioritize(TX_QUEUE *queue_ptr);
 UINT        _txe_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txe_queue_receive_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _txe_queue_receive_n(TX_QUEUE *queue_ptr, VOID *destination_ptr, UINT message_count,
+                    UINT *received_count, ULONG wait_option);
+UINT        _txe_queue_receive_peek(TX_QUEUE *queue_ptr, VOID **message_ptr);
 UINT        _txe_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txe_queue_send_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _txe_queue_send_n(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT message_count,
+                    UINT *sent_count, ULONG wait_option);
 UINT        _txe_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
+UINT        _txe_queue_send_reserve(TX_QUEUE *queue_ptr, VOID **message_ptr);
+UINT        _txe_queue_spsc_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *queue_start, ULONG queue_size, UINT queue_control_block_size);
 UINT        _txe_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txe_priority_queue_create(TX_PRIORITY_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *queue_start, ULONG queue_size, UINT queue_control_block_size);
+UINT        _txe_priority_queue_delete(TX_PRIORITY_QUEUE *queue_ptr);
+UINT        _txe_priority_queue_flush(TX_PRIORITY_QUEUE *queue_ptr);
+UINT        _txe_priority_queue_info_get(TX_PRIORITY_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_PRIORITY_QUEUE **next_queue);
+UINT        _txe_priority_queue_receive(TX_PRIORITY_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txe_priority_queue_send(TX_PRIORITY_QUEUE *queue_ptr, VOID *source_ptr, UINT priority, ULONG wait_option);
+UINT        _txe_broadcast_create(TX_BROADCAST *broadcast_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *broadcast_start, ULONG broadcast_size, UINT overflow_option,
+                    UINT broadcast_control_block_size);
+UINT        _txe_broadcast_delete(TX_BROADCAST *broadcast_ptr);
+UINT        _txe_broadcast_info_get(TX_BROADCAST *broadcast_ptr, CHAR **name, ULONG *published, ULONG *subscriber_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BROADCAST **next_broadcast);
+UINT        _txe_broadcast_publish(TX_BROADCAST *broadcast_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txe_broadcast_receive(TX_BROADCAST_SUBSCRIBER *subscriber_ptr, VOID *destination_ptr, ULONG *missed_count,
+                    ULONG wait_option);
+UINT        _txe_broadcast_subscribe(TX_BROADCAST *broadcast_ptr, TX_BROADCAST_SUBSCRIBER *subscriber_ptr);
+UINT        _txe_broadcast_unsubscribe(TX_BROADCAST_SUBSCRIBER *subscriber_ptr);
 #ifdef TX_ENABLE_MULTI_ERROR_CHECKING
+UINT        _txr_channel_create(TX_CHANNEL *channel_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *channel_start, ULONG channel_size, UINT channel_control_block_size);
+UINT        _txr_channel_delete(TX_CHANNEL *channel_ptr);
+UINT        _txr_channel_info_get(TX_CHANNEL *channel_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **suspended_thread, TX_CHANNEL **next_channel);
+UINT        _txr_channel_receive(TX_CHANNEL *channel_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txr_channel_send(TX_CHANNEL *channel_ptr, VOID *source_ptr);
+UINT        _txr_byte_queue_create(TX_BYTE_QUEUE *queue_ptr, CHAR *name_ptr, VOID *queue_start,
+                    ULONG queue_size, UINT queue_control_block_size);
+UINT        _txr_byte_queue_delete(TX_BYTE_QUEUE *queue_ptr);
+UINT        _txr_byte_queue_flush(TX_BYTE_QUEUE *queue_ptr);
+UINT        _txr_byte_queue_info_get(TX_BYTE_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued,
+                    ULONG *available_bytes, TX_THREAD **first_suspended, ULONG *suspended_count,
+                    TX_BYTE_QUEUE **next_queue);
+UINT        _txr_byte_queue_prioritize(TX_BYTE_QUEUE *queue_ptr);
+UINT        _txr_byte_queue_receive(TX_BYTE_QUEUE *queue_ptr, VOID *destination_ptr, ULONG destination_size,
+                    ULONG *actual_size, ULONG wait_option);
+UINT        _txr_byte_queue_send(TX_BYTE_QUEUE *queue_ptr, VOID *source_ptr, ULONG size, ULONG wait_option);
+UINT        _txr_byte_queue_send_notify(TX_BYTE_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_BYTE_QUEUE *notify_queue_ptr));
 UINT        _txr_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
                         VOID *queue_start, ULONG queue_size, UINT queue_control_block_size);
 UINT        _txr_queue_delete(TX_QUEUE *queue_ptr);
@@ -1585,9 +2515,38 @@ UINT        _txr_queue_info_get(TX_QUEUE *queue_ptr, CHAR **name, ULONG *enqueue
                     TX_THREAD **first_suspended, ULONG *suspended_count, TX_QUEUE **next_queue);
 UINT        _txr_queue_prioritize(TX_QUEUE *queue_ptr);
 UINT        _txr_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txr_queue_receive_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _txr_queue_receive_n(TX_QUEUE *queue_ptr, VOID *destination_ptr, UINT message_count,
+                    UINT *received_count, ULONG wait_option);
+UINT        _txr_queue_receive_peek(TX_QUEUE *queue_ptr, VOID **message_ptr);
 UINT        _txr_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txr_queue_send_commit(TX_QUEUE *queue_ptr, VOID *message_ptr);
+UINT        _txr_queue_send_n(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT message_count,
+                    UINT *sent_count, ULONG wait_option);
 UINT        _txr_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
+UINT        _txr_queue_send_reserve(TX_QUEUE *queue_ptr, VOID **message_ptr);
+UINT        _txr_queue_spsc_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *queue_start, ULONG queue_size, UINT queue_control_block_size);
 UINT        _txr_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txr_priority_queue_create(TX_PRIORITY_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *queue_start, ULONG queue_size, UINT queue_control_block_size);
+UINT        _txr_priority_queue_delete(TX_PRIORITY_QUEUE *queue_ptr);
+UINT        _txr_priority_queue_flush(TX_PRIORITY_QUEUE *queue_ptr);
+UINT        _txr_priority_queue_info_get(TX_PRIORITY_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_PRIORITY_QUEUE **next_queue);
+UINT        _txr_priority_queue_receive(TX_PRIORITY_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txr_priority_queue_send(TX_PRIORITY_QUEUE *queue_ptr, VOID *source_ptr, UINT priority, ULONG wait_option);
+UINT        _txr_broadcast_create(TX_BROADCAST *broadcast_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *broadcast_start, ULONG broadcast_size, UINT overflow_option,
+                    UINT broadcast_control_block_size);
+UINT        _txr_broadcast_delete(TX_BROADCAST *broadcast_ptr);
+UINT        _txr_broadcast_info_get(TX_BROADCAST *broadcast_ptr, CHAR **name, ULONG *published, ULONG *subscriber_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BROADCAST **next_broadcast);
+UINT        _txr_broadcast_publish(TX_BROADCAST *broadcast_ptr, VOID *source_ptr, ULONG wait_option);
+UINT        _txr_broadcast_receive(TX_BROADCAST_SUBSCRIBER *subscriber_ptr, VOID *destination_ptr, ULONG *missed_count,
+                    ULONG wait_option);
+UINT        _txr_broadcast_subscribe(TX_BROADCAST *broadcast_ptr, TX_BROADCAST_SUBSCRIBER *subscriber_ptr);
+UINT        _txr_broadcast_unsubscribe(TX_BROADCAST_SUBSCRIBER *subscriber_ptr);
 #endif
 
 
@@ -1671,6 +2630,7 @@ UINT        _tx_thread_suspend(TX_THREAD *thread_ptr);
 UINT        _tx_thread_terminate(TX_THREAD *thread_ptr);
 UINT        _tx_thread_time_slice_change(TX_THREAD *thread_ptr, ULONG new_time_slice, ULONG *old_time_slice);
 UINT        _tx_thread_wait_abort(TX_THREAD *thread_ptr);
+UINT        _tx_thread_wait_multiple(TX_WAIT_BLOCK *wait_blocks, UINT count, UINT *ready_index, ULONG wait_option);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -1697,6 +2657,7 @@ UINT        _txe_thread_suspend(TX_THREAD *thread_ptr);
 UINT        _txe_thread_terminate(TX_THREAD *thread_ptr);
 UINT        _txe_thread_time_slice_change(TX_THREAD *thread_ptr, ULONG new_time_slice, ULONG *old_time_slice);
 UINT        _txe_thread_wait_abort(TX_THREAD *thread_ptr);
+UINT        _txe_thread_wait_multiple(TX_WAIT_BLOCK *wait_blocks, UINT count, UINT *ready_index, ULONG wait_option);
 #ifdef TX_ENABLE_MULTI_ERROR_CHECKING
 UINT        _txr_thread_create(TX_THREAD *thread_ptr, CHAR *name_ptr,
                 VOID (*entry_function)(ULONG entry_input), ULONG entry_input,
@@ -1718,6 +2679,7 @@ UINT        _txr_thread_suspend(TX_THREAD *thread_ptr);
 UINT        _txr_thread_terminate(TX_THREAD *thread_ptr);
 UINT        _txr_thread_time_slice_change(TX_THREAD *thread_ptr, ULONG new_time_slice, ULONG *old_time_slice);
 UINT        _txr_thread_wait_abort(TX_THREAD *thread_ptr);
+UINT        _txr_thread_wait_multiple(TX_WAIT_BLOCK *wait_blocks, UINT count, UINT *ready_index, ULONG wait_option);
 #endif
 
 
@@ -1730,6 +2692,7 @@ UINT        _tx_timer_create(TX_TIMER *timer_ptr, CHAR *name_ptr,
                 ULONG initial_ticks, ULONG reschedule_ticks, UINT auto_activate);
 UINT        _tx_timer_deactivate(TX_TIMER *timer_ptr);
 UINT        _tx_timer_delete(TX_TIMER *timer_ptr);
+UINT        _tx_timer_get_next(ULONG *next_timer_tick_ptr);
 UINT        _tx_timer_info_get(TX_TIMER *timer_ptr, CHAR **name, UINT *active, ULONG *remaining_ticks,
                 ULONG *reschedule_ticks, TX_TIMER **next_timer);
 UINT        _tx_timer_performance_info_get(TX_TIMER *timer_ptr, ULONG *activates, ULONG *reactivates,
@@ -1738,6 +2701,7 @@ UINT        _tx_timer_performance_system_info_get(ULONG *activates, ULONG *react
                 ULONG *deactivates, ULONG *expirations, ULONG *expiration_adjusts);
 
 ULONG       _tx_time_get(VOID);
+VOID        _tx_time_increment(ULONG time_increment);
 VOID        _tx_time_set(ULONG new_time);
 
 
@@ -2247,6 +3211,41 @@ void __ghs_rnerr(char *errMsg, int stackLevels, int stackTraceDisplay, void *hex
 #define TX_EL_THREAD_STACK_ERROR_NOTIFY_INSERT
 #define TX_EL_TIMER_PERFORMANCE_INFO_GET_INSERT
 #define TX_EL_TIMER_PERFORMANCE_SYSTEM_INFO_GET_INSERT
+#define TX_EL_BYTE_QUEUE_CREATE_INSERT
+#define TX_EL_BYTE_QUEUE_DELETE_INSERT
+#define TX_EL_BYTE_QUEUE_FLUSH_INSERT
+#define TX_EL_BYTE_QUEUE_INFO_GET_INSERT
+#define TX_EL_BYTE_QUEUE_PERFORMANCE_INFO_GET_INSERT
+#define TX_EL_BYTE_QUEUE_PERFORMANCE_SYSTEM_INFO_GET_INSERT
+#define TX_EL_BYTE_QUEUE_PRIORITIZE_INSERT
+#define TX_EL_BYTE_QUEUE_RECEIVE_INSERT
+#define TX_EL_BYTE_QUEUE_SEND_INSERT
+#define TX_EL_BYTE_QUEUE_SEND_NOTIFY_INSERT
+#define TX_EL_THREAD_WAIT_MULTIPLE_INSERT
+#define TX_EL_BROADCAST_CREATE_INSERT
+#define TX_EL_BROADCAST_DELETE_INSERT
+#define TX_EL_BROADCAST_INFO_GET_INSERT
+#define TX_EL_BROADCAST_PUBLISH_INSERT
+#define TX_EL_BROADCAST_RECEIVE_INSERT
+#define TX_EL_BROADCAST_SUBSCRIBE_INSERT
+#define TX_EL_BROADCAST_UNSUBSCRIBE_INSERT
+#define TX_EL_CHANNEL_CREATE_INSERT
+#define TX_EL_CHANNEL_DELETE_INSERT
+#define TX_EL_CHANNEL_INFO_GET_INSERT
+#define TX_EL_CHANNEL_RECEIVE_INSERT
+#define TX_EL_CHANNEL_SEND_INSERT
+#define TX_EL_BLOCK_SLAB_ALLOCATE_INSERT
+#define TX_EL_BLOCK_SLAB_CLASS_INFO_GET_INSERT
+#define TX_EL_BLOCK_SLAB_CREATE_INSERT
+#define TX_EL_BLOCK_SLAB_DELETE_INSERT
+#define TX_EL_BLOCK_SLAB_INFO_GET_INSERT
+#define TX_EL_BLOCK_BUFFER_ALLOCATE_INSERT
+#define TX_EL_BLOCK_BUFFER_RECEIVE_INSERT
+#define TX_EL_BLOCK_BUFFER_REFERENCE_INSERT
+#define TX_EL_BLOCK_BUFFER_RELEASE_INSERT
+#define TX_EL_BLOCK_BUFFER_SEND_INSERT
+#define TX_EL_QUEUE_SEND_N_INSERT
+#define TX_EL_QUEUE_RECEIVE_N_INSERT
 
 #endif
 
@@ -44,6 +44,13 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            block slabs                 */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            lock-free block pool        */
+/*                                            option                      */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            block buffers               */
 /*                                                                        */
 /**************************************************************************/
 
@@ -54,6 +61,47 @@
 /* Define block memory control specific data definitions.  */
 
 #define TX_BLOCK_POOL_ID                        ((ULONG) 0x424C4F43)
+#define TX_BLOCK_SLAB_ID                        ((ULONG) 0x534C4142)
+#define TX_BLOCK_BUFFER_ID                      ((ULONG) 0x42554646)
+
+
+/* Define the size of the block buffer control block at the start of a block, rounded up
+   so that the data area that follows it is aligned for an ALIGN_TYPE.  */
+
+#define TX_BLOCK_BUFFER_HEADER_SIZE             ((((sizeof(TX_BLOCK_BUFFER)) + (sizeof(ALIGN_TYPE))) - ((ULONG) 1)) & (~((sizeof(ALIGN_TYPE)) - ((ULONG) 1))))
+
+
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+/* Define the layout of the tagged available list head.  The lower half holds the position of
+   the first available block, which is its offset from the start of the pool area in ULONGs
+   plus one, so that zero means that the list is empty.  The upper half holds the tag.  The
+   link of an available block holds the position of the next block as a ULONG.  */
+
+#define TX_BLOCK_POOL_TAGGED_SHIFT              ((sizeof(TX_BLOCK_POOL_TAGGED_HEAD)) * ((UINT) 4))
+#define TX_BLOCK_POOL_TAGGED_POSITION_MASK      ((((TX_BLOCK_POOL_TAGGED_HEAD) 1) << TX_BLOCK_POOL_TAGGED_SHIFT) - ((TX_BLOCK_POOL_TAGGED_HEAD) 1))
+#define TX_BLOCK_POOL_TAGGED_INCREMENT          (((TX_BLOCK_POOL_TAGGED_HEAD) 1) << TX_BLOCK_POOL_TAGGED_SHIFT)
+
+
+/* Define the atomic operations on the available list head, the available count, and the
+   suspended count.  GNU compatible compilers use their atomic built-ins by default, other
+   compilers must have them defined in tx_port.h.  The compare and exchange updates the
+   expected value on failure.  */
+
+#if !defined(TX_BLOCK_POOL_TAGGED_HEAD_CAS) && (defined(__GNUC__) || defined(__clang__))
+#define TX_BLOCK_POOL_TAGGED_HEAD_LOAD(h)       __atomic_load_n((h), __ATOMIC_ACQUIRE)
+#define TX_BLOCK_POOL_TAGGED_HEAD_CAS(h, e, d)  __atomic_compare_exchange_n((h), (e), (d), 0, __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE)
+#define TX_BLOCK_POOL_ATOMIC_LOAD(c)            __atomic_load_n((c), __ATOMIC_SEQ_CST)
+#define TX_BLOCK_POOL_ATOMIC_ADD(c, v)          (VOID) __atomic_fetch_add((c), (v), __ATOMIC_SEQ_CST);
+#define TX_BLOCK_POOL_ATOMIC_SUB(c, v)          (VOID) __atomic_fetch_sub((c), (v), __ATOMIC_SEQ_CST);
+#define TX_BLOCK_POOL_MEMORY_BARRIER            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+
+#ifndef TX_BLOCK_POOL_TAGGED_HEAD_CAS
+#error "tx_port.h: TX_BLOCK_POOL_LOCK_FREE requires the block pool atomic operations."
+#endif
+
+#endif
 
 
 /* Determine if in-line component initialization is supported by the
@@ -67,11 +115,15 @@
 #ifndef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 #define _tx_block_pool_initialize() \
                     _tx_block_pool_created_ptr =                   TX_NULL;     \
-                    _tx_block_pool_created_count =                 TX_EMPTY
+                    _tx_block_pool_created_count =                 TX_EMPTY;    \
+                    _tx_block_slab_created_ptr =                   TX_NULL;     \
+                    _tx_block_slab_created_count =                 TX_EMPTY
 #else
 #define _tx_block_pool_initialize() \
                     _tx_block_pool_created_ptr =                   TX_NULL;     \
                     _tx_block_pool_created_count =                 TX_EMPTY;    \
+                    _tx_block_slab_created_ptr =                   TX_NULL;     \
+                    _tx_block_slab_created_count =                 TX_EMPTY;    \
                     _tx_block_pool_performance_allocate_count =    ((ULONG) 0); \
                     _tx_block_pool_performance_release_count =     ((ULONG) 0); \
                     _tx_block_pool_performance_suspension_count =  ((ULONG) 0); \
@@ -88,6 +140,10 @@ VOID        _tx_block_pool_initialize(VOID);
 /* Define internal block memory pool management function prototypes.  */
 
 VOID        _tx_block_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+UCHAR       *_tx_block_pool_lock_free_pop(TX_BLOCK_POOL *pool_ptr);
+VOID        _tx_block_pool_lock_free_push(TX_BLOCK_POOL *pool_ptr, UCHAR *block_ptr);
+#endif
 
 
 /* Block pool management component data declarations follow.  */
@@ -113,6 +169,16 @@ BLOCK_POOL_DECLARE  TX_BLOCK_POOL *         _tx_block_pool_created_ptr;
 BLOCK_POOL_DECLARE  ULONG                   _tx_block_pool_created_count;
 
 
+/* Define the head pointer of the created block slab list.  */
+
+BLOCK_POOL_DECLARE  TX_BLOCK_SLAB *         _tx_block_slab_created_ptr;
+
+
+/* Define the variable that holds the number of created block slabs. */
+
+BLOCK_POOL_DECLARE  ULONG                   _tx_block_slab_created_count;
+
+
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of block allocates.  */
@@ -44,6 +44,14 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            two-level segregated fit    */
+/*                                            (TLSF) pool definitions,    */
+/*                                            byte pool magazines, and    */
+/*                                            the fragmentation walk      */
+/*                                            block count                 */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            aligned allocation          */
 /*                                                                        */
 /**************************************************************************/
 
@@ -54,6 +62,7 @@
 /* Define byte memory control specific data definitions.  */
 
 #define TX_BYTE_POOL_ID                         ((ULONG) 0x42595445)
+#define TX_BYTE_POOL_MAGAZINE_ID                ((ULONG) 0x4D41475AUL)
 
 #ifndef TX_BYTE_BLOCK_FREE
 #define TX_BYTE_BLOCK_FREE                      ((ULONG) 0xFFFFEEEEUL)
@@ -68,6 +77,157 @@
 #endif
 
 
+/* Define the number of blocks the fragmentation information walk examines before it
+   restores interrupts briefly.  */
+
+#ifndef TX_BYTE_POOL_MULTIPLE_BLOCK_SEARCH
+#define TX_BYTE_POOL_MULTIPLE_BLOCK_SEARCH      ((UINT) 20)
+#endif
+
+
+/* Define the calculation of the leading slack of a free block for an aligned allocation.  The
+   slack is the distance from the block to the header of the first memory area in it that is
+   aligned as requested.  A slack that is not zero is split off as a free block of its own, so it
+   is moved to the next aligned memory area until it is at least the given minimum block size.
+   The alignment must be a power of two.  */
+
+#define TX_BYTE_POOL_ALIGNED_SLACK_CALCULATE(b, a, m, s)    \
+    (s) =  ((ULONG) (((ALIGN_TYPE) (a)) - (TX_POINTER_TO_ALIGN_TYPE_CONVERT(TX_UCHAR_POINTER_ADD((b), ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))))) & (((ALIGN_TYPE) (a)) - ((ALIGN_TYPE) 1))))) & ((a) - ((ULONG) 1)); \
+    while (((s) != ((ULONG) 0)) && ((s) < (m)))            \
+    {                                                       \
+        (s) =  (s) + (a);                                   \
+    }
+
+
+/* Define the two-level segregated fit (TLSF) pool definitions.  A TLSF pool keeps its free
+   blocks on segregated lists, one for each second level range of each power of two (first
+   level) range of block sizes, so that a fitting free block is found with two bit map lookups
+   instead of a walk of the pool.  The number of second level lists per first level range is
+   2^TX_BYTE_POOL_TLSF_SL_LOG2, which must not exceed 32.  Block sizes below
+   TX_BYTE_POOL_TLSF_SMALL_BLOCK are kept on exact lists in the first range.  */
+
+#ifndef TX_BYTE_POOL_TLSF_SL_LOG2
+#define TX_BYTE_POOL_TLSF_SL_LOG2               ((UINT) 4)
+#endif
+
+#define TX_BYTE_POOL_TLSF_SL_COUNT              (((UINT) 1) << TX_BYTE_POOL_TLSF_SL_LOG2)
+#define TX_BYTE_POOL_TLSF_FL_MAX                ((UINT) 32)
+#define TX_BYTE_POOL_TLSF_ALIGN_LOG2            (((sizeof(ALIGN_TYPE)) > ((ULONG) 4)) ? ((UINT) 3) : ((UINT) 2))
+#define TX_BYTE_POOL_TLSF_FL_SHIFT              (TX_BYTE_POOL_TLSF_SL_LOG2 + TX_BYTE_POOL_TLSF_ALIGN_LOG2)
+#define TX_BYTE_POOL_TLSF_SMALL_BLOCK           (((ULONG) 1) << TX_BYTE_POOL_TLSF_FL_SHIFT)
+
+
+/* Each block of a TLSF pool starts with the same "next" pointer and owner fields as the blocks
+   of a first-fit pool, and is preceded by a pointer to the physically previous block, which is
+   TX_NULL for the first block.  This pointer occupies the last word of the previous block, so
+   the overhead of a block is its header plus that word.  A free block keeps its free list links
+   at the start of its memory area, which makes this the smallest memory area of a block.  */
+
+#define TX_BYTE_POOL_TLSF_OVERHEAD              (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))) + (sizeof(UCHAR *)))
+#define TX_BYTE_POOL_TLSF_AREA_MIN              ((sizeof(UCHAR *)) + (sizeof(UCHAR *)))
+#define TX_BYTE_POOL_TLSF_BLOCK_MIN             (TX_BYTE_POOL_TLSF_OVERHEAD + TX_BYTE_POOL_TLSF_AREA_MIN)
+
+#define TX_BYTE_POOL_TLSF_NEXT(b)               (*TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT((b)))
+#define TX_BYTE_POOL_TLSF_PREVIOUS(b)           (*TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(TX_UCHAR_POINTER_SUB((b), (sizeof(UCHAR *)))))
+#define TX_BYTE_POOL_TLSF_OWNER(b)              (*TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(TX_UCHAR_POINTER_ADD((b), (sizeof(UCHAR *)))))
+#define TX_BYTE_POOL_TLSF_OWNER_POOL(b)         (*TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(TX_UCHAR_POINTER_ADD((b), (sizeof(UCHAR *)))))
+#define TX_BYTE_POOL_TLSF_NEXT_FREE(b)          (*TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(TX_UCHAR_POINTER_ADD((b), ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))))))
+#define TX_BYTE_POOL_TLSF_PREVIOUS_FREE(b)      (*TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(TX_UCHAR_POINTER_ADD((b), (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))) + (sizeof(UCHAR *))))))
+
+
+/* Define the highest set bit calculation used to find the first level range of a block size.
+   The compiler's count leading zeros is used where available, unless
+   TX_DISABLE_LOWEST_SET_BIT_INTRINSIC is defined.  The value must not be zero.  */
+
+#if !defined(TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE) && !defined(TX_DISABLE_LOWEST_SET_BIT_INTRINSIC)
+#if defined(__GNUC__) || defined(__clang__)
+#define TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(m, b)   (b) =  ((ULONG) 31) - ((ULONG) __builtin_clz((unsigned int) (m)));
+#endif
+#endif
+
+#ifndef TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE
+#define TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(m, b)   \
+    {                                                       \
+    ULONG   tx_byte_pool_tlsf_bits;                         \
+        tx_byte_pool_tlsf_bits =  (m);                      \
+        (b) =  ((ULONG) 0);                                 \
+        if (tx_byte_pool_tlsf_bits >= ((ULONG) 0x10000))    \
+        {                                                   \
+            tx_byte_pool_tlsf_bits =  tx_byte_pool_tlsf_bits >> ((ULONG) 16); \
+            (b) =  (b) + ((ULONG) 16);                      \
+        }                                                   \
+        if (tx_byte_pool_tlsf_bits >= ((ULONG) 0x100))      \
+        {                                                   \
+            tx_byte_pool_tlsf_bits =  tx_byte_pool_tlsf_bits >> ((ULONG) 8); \
+            (b) =  (b) + ((ULONG) 8);                       \
+        }                                                   \
+        if (tx_byte_pool_tlsf_bits >= ((ULONG) 0x10))       \
+        {                                                   \
+            tx_byte_pool_tlsf_bits =  tx_byte_pool_tlsf_bits >> ((ULONG) 4); \
+            (b) =  (b) + ((ULONG) 4);                       \
+        }                                                   \
+        if (tx_byte_pool_tlsf_bits >= ((ULONG) 4))          \
+        {                                                   \
+            tx_byte_pool_tlsf_bits =  tx_byte_pool_tlsf_bits >> ((ULONG) 2); \
+            (b) =  (b) + ((ULONG) 2);                       \
+        }                                                   \
+        (b) =  (b) + (tx_byte_pool_tlsf_bits >> ((ULONG) 1)); \
+    }
+#endif
+
+
+/* Define the mapping of a block's memory area size to its first and second level list.  */
+
+#define TX_BYTE_POOL_TLSF_MAPPING(s, f, l)                  \
+    if ((s) < TX_BYTE_POOL_TLSF_SMALL_BLOCK)                \
+    {                                                       \
+        (f) =  ((ULONG) 0);                                 \
+        (l) =  (s) >> TX_BYTE_POOL_TLSF_ALIGN_LOG2;         \
+    }                                                       \
+    else                                                    \
+    {                                                       \
+        TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE((s), (f)) \
+        (l) =  ((s) >> ((f) - TX_BYTE_POOL_TLSF_SL_LOG2)) ^ ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT); \
+        (f) =  ((f) - TX_BYTE_POOL_TLSF_FL_SHIFT) + ((ULONG) 1); \
+    }
+
+
+/* Define the mapping of a block's memory area size to its first level range only.  */
+
+#define TX_BYTE_POOL_TLSF_FIRST_LEVEL(s, f)                 \
+    if ((s) < TX_BYTE_POOL_TLSF_SMALL_BLOCK)                \
+    {                                                       \
+        (f) =  ((ULONG) 0);                                 \
+    }                                                       \
+    else                                                    \
+    {                                                       \
+        TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE((s), (f)) \
+        (f) =  ((f) - TX_BYTE_POOL_TLSF_FL_SHIFT) + ((ULONG) 1); \
+    }
+
+
+/* Define the TLSF control structure, which is placed at the start of the pool's memory area.  */
+
+typedef struct TX_BYTE_POOL_TLSF_STRUCT
+{
+
+    /* Define the bit map of the first level ranges that have free blocks.  */
+    ULONG               tx_byte_pool_tlsf_fl_bitmap;
+
+    /* Define the number of first level ranges of the pool.  */
+    UINT                tx_byte_pool_tlsf_fl_count;
+
+    /* Define the bit maps of the second level lists that have free blocks, one for each
+       first level range.  */
+    ULONG               tx_byte_pool_tlsf_sl_bitmap[TX_BYTE_POOL_TLSF_FL_MAX];
+
+    /* Define the free list heads, TX_BYTE_POOL_TLSF_SL_COUNT for each first level range.
+       They follow this structure in the pool's memory area.  */
+    UCHAR               **tx_byte_pool_tlsf_free_list;
+
+} TX_BYTE_POOL_TLSF;
+
+
 /* Determine if in-line component initialization is supported by the
    caller.  */
 
@@ -102,8 +262,15 @@ VOID        _tx_byte_pool_initialize(VOID);
 
 /* Define internal byte memory pool management function prototypes.  */
 
-UCHAR       *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size);
+UCHAR       *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment);
 VOID        _tx_byte_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+UCHAR       *_tx_byte_pool_tlsf_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment);
+VOID        _tx_byte_pool_tlsf_free(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_insert(TX_BYTE_POOL_TLSF *tlsf_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_remove(TX_BYTE_POOL_TLSF *tlsf_ptr, UCHAR *block_ptr);
+UCHAR       *_tx_byte_pool_magazine_allocate(TX_BYTE_POOL *pool_ptr, TX_THREAD *thread_ptr, ULONG memory_size);
+UINT        _tx_byte_pool_magazine_release(TX_THREAD *thread_ptr, VOID *memory_ptr);
+VOID        _tx_byte_pool_magazine_thread_release(TX_THREAD *thread_ptr);
 
 
 /* Byte pool management component data declarations follow.  */
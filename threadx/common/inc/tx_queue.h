@@ -44,6 +44,16 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            message copy routines       */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            byte queues                 */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            channels                    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            priority queues             */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            broadcasts                  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -54,6 +64,11 @@
 /* Define queue control specific data definitions.  */
 
 #define TX_QUEUE_ID                             ((ULONG) 0x51554555)
+#define TX_BYTE_QUEUE_ID                        ((ULONG) 0x42515545)
+#define TX_CHANNEL_ID                           ((ULONG) 0x4348414E)
+#define TX_PRIORITY_QUEUE_ID                    ((ULONG) 0x50525155)
+#define TX_BROADCAST_ID                         ((ULONG) 0x42524443)
+#define TX_BROADCAST_SUBSCRIBER_ID              ((ULONG) 0x42525342)
 
 
 /* Determine if in-line component initialization is supported by the
@@ -66,16 +81,37 @@
 #ifndef TX_QUEUE_ENABLE_PERFORMANCE_INFO
 #define _tx_queue_initialize() \
                     _tx_queue_created_ptr =                          TX_NULL;     \
-                    _tx_queue_created_count =                        TX_EMPTY
+                    _tx_queue_created_count =                        TX_EMPTY;    \
+                    _tx_byte_queue_created_ptr =                     TX_NULL;     \
+                    _tx_byte_queue_created_count =                   TX_EMPTY;    \
+                    _tx_channel_created_ptr =                        TX_NULL;     \
+                    _tx_channel_created_count =                      TX_EMPTY;    \
+                    _tx_priority_queue_created_ptr =                 TX_NULL;     \
+                    _tx_priority_queue_created_count =               TX_EMPTY;    \
+                    _tx_broadcast_created_ptr =                      TX_NULL;     \
+                    _tx_broadcast_created_count =                    TX_EMPTY
 #else
 #define _tx_queue_initialize() \
                     _tx_queue_created_ptr =                          TX_NULL;     \
                     _tx_queue_created_count =                        TX_EMPTY;    \
+                    _tx_byte_queue_created_ptr =                     TX_NULL;     \
+                    _tx_byte_queue_created_count =                   TX_EMPTY;    \
+                    _tx_channel_created_ptr =                        TX_NULL;     \
+                    _tx_channel_created_count =                      TX_EMPTY;    \
+                    _tx_priority_queue_created_ptr =                 TX_NULL;     \
+                    _tx_priority_queue_created_count =               TX_EMPTY;    \
+                    _tx_broadcast_created_ptr =                      TX_NULL;     \
+                    _tx_broadcast_created_count =                    TX_EMPTY;    \
                     _tx_queue_performance_messages_sent_count =      ((ULONG) 0); \
                     _tx_queue_performance__messages_received_count = ((ULONG) 0); \
                     _tx_queue_performance_empty_suspension_count =   ((ULONG) 0); \
                     _tx_queue_performance_full_suspension_count =    ((ULONG) 0); \
-                    _tx_queue_performance_timeout_count =            ((ULONG) 0)
+                    _tx_queue_performance_timeout_count =            ((ULONG) 0); \
+                    _tx_byte_queue_performance_messages_sent_count =      ((ULONG) 0); \
+                    _tx_byte_queue_performance_messages_received_count =  ((ULONG) 0); \
+                    _tx_byte_queue_performance_empty_suspension_count =   ((ULONG) 0); \
+                    _tx_byte_queue_performance_full_suspension_count =    ((ULONG) 0); \
+                    _tx_byte_queue_performance_timeout_count =            ((ULONG) 0)
 #endif
 #define TX_QUEUE_INIT
 #else
@@ -101,9 +137,139 @@ VOID        _tx_queue_initialize(VOID);
 #endif
 
 
+/* Define the macro that copies a message with the copy routine of the queue,
+   so that no loop over the message size is needed.  Single ULONG messages are
+   copied in line, which is cheaper than calling a routine.  Note that the
+   source and destination pointers must be modified since they are used
+   subsequently.  */
+
+#ifndef TX_QUEUE_MESSAGE_ROUTINE_COPY
+#define TX_QUEUE_MESSAGE_ROUTINE_COPY(q, s, d, z)                           \
+                    if ((z) == TX_1_ULONG)                                  \
+                    {                                                       \
+                        *(d)++ =  *(s)++;                                   \
+                    }                                                       \
+                    else                                                    \
+                    {                                                       \
+                        ((q) -> tx_queue_message_copy)((s), (d), (z));      \
+                        (s) =  TX_ULONG_POINTER_ADD((s), (z));              \
+                        (d) =  TX_ULONG_POINTER_ADD((d), (z));              \
+                    }
+#endif
+
+
+/* Define the size of the byte queue record of a message of the specified
+   size, which is a ULONG with the message size followed by the message
+   padded to a whole number of ULONGs.  Since records and the ring buffer
+   are both whole numbers of ULONGs, the message size never wraps around
+   the end of the ring buffer, only the message itself.  */
+
+#define TX_BYTE_QUEUE_RECORD_SIZE(s)            ((((ULONG) (s)) + (((ULONG) (sizeof(ULONG))) * ((ULONG) 2)) - ((ULONG) 1)) & \
+                                                    (~(((ULONG) (sizeof(ULONG))) - ((ULONG) 1))))
+
+
+/* Define the macro that copies the bytes of a byte queue message, if not
+   already defined.  */
+
+#ifndef TX_BYTE_QUEUE_MESSAGE_COPY
+#define TX_BYTE_QUEUE_MESSAGE_COPY(s, d, n)     memcpy((d), (s), (n))
+#endif
+
+
+/* Define the byte queue pointer conversion.  */
+
+#ifndef TX_VOID_TO_BYTE_QUEUE_POINTER_CONVERT
+#define TX_VOID_TO_BYTE_QUEUE_POINTER_CONVERT(a)    ((TX_BYTE_QUEUE *) ((VOID *) (a)))
+#endif
+
+
+/* Define the atomic operations on the indexes and the suspended count of a
+   channel.  The index load acquires and the index store releases, so that a
+   message is copied before its index is published and copied out before its
+   slot is handed back.  The barrier orders a store before a following load.
+   GNU compatible compilers use their atomic built-ins by default, other
+   compilers must have them defined in tx_port.h, otherwise channels are not
+   supported and tx_channel_create returns TX_FEATURE_NOT_ENABLED.  */
+
+#if !defined(TX_CHANNEL_INDEX_LOAD) && (defined(__GNUC__) || defined(__clang__))
+#define TX_CHANNEL_INDEX_LOAD(i)                __atomic_load_n((i), __ATOMIC_ACQUIRE)
+#define TX_CHANNEL_INDEX_STORE(i, v)            __atomic_store_n((i), (v), __ATOMIC_RELEASE);
+#define TX_CHANNEL_SUSPENDED_LOAD(c)            __atomic_load_n((c), __ATOMIC_RELAXED)
+#define TX_CHANNEL_SUSPENDED_STORE(c, v)        __atomic_store_n((c), (v), __ATOMIC_RELAXED);
+#define TX_CHANNEL_MEMORY_BARRIER               __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+
+#ifndef TX_CHANNEL_INDEX_LOAD
+#define TX_CHANNEL_NOT_SUPPORTED
+#define TX_CHANNEL_INDEX_LOAD(i)                (*(i))
+#define TX_CHANNEL_INDEX_STORE(i, v)            *(i) =  (v);
+#define TX_CHANNEL_SUSPENDED_LOAD(c)            (*(c))
+#define TX_CHANNEL_SUSPENDED_STORE(c, v)        *(c) =  (v);
+#define TX_CHANNEL_MEMORY_BARRIER
+#endif
+
+
+/* Define the channel pointer conversion.  */
+
+#ifndef TX_VOID_TO_CHANNEL_POINTER_CONVERT
+#define TX_VOID_TO_CHANNEL_POINTER_CONVERT(a)       ((TX_CHANNEL *) ((VOID *) (a)))
+#endif
+
+
+/* Define the link value that ends the list of released slots of a priority
+   queue, and the macro that calculates the address of a slot from its index.
+   Each slot is a ULONG link followed by the message.  */
+
+#define TX_PRIORITY_QUEUE_NO_SLOT               ((ULONG) 0xFFFFFFFFUL)
+#define TX_PRIORITY_QUEUE_SLOT(q, i)            TX_ULONG_POINTER_ADD((q) -> tx_priority_queue_start, \
+                                                    ((UINT) (i)) * ((q) -> tx_priority_queue_message_size + ((UINT) 1)))
+
+
+/* Define the priority queue pointer conversion.  */
+
+#ifndef TX_VOID_TO_PRIORITY_QUEUE_POINTER_CONVERT
+#define TX_VOID_TO_PRIORITY_QUEUE_POINTER_CONVERT(a)    ((TX_PRIORITY_QUEUE *) ((VOID *) (a)))
+#endif
+
+
+/* Define the macro that calculates the address of the message of a broadcast
+   with the specified running index.  */
+
+#define TX_BROADCAST_MESSAGE(b, i)              TX_ULONG_POINTER_ADD((b) -> tx_broadcast_start, \
+                                                    ((UINT) ((i) & (((ULONG) (b) -> tx_broadcast_capacity) - ((ULONG) 1)))) * \
+                                                    (b) -> tx_broadcast_message_size)
+
+
+/* Define the broadcast and broadcast subscriber pointer conversions.  */
+
+#ifndef TX_VOID_TO_BROADCAST_POINTER_CONVERT
+#define TX_VOID_TO_BROADCAST_POINTER_CONVERT(a)     ((TX_BROADCAST *) ((VOID *) (a)))
+#endif
+
+#ifndef TX_VOID_TO_BROADCAST_SUBSCRIBER_POINTER_CONVERT
+#define TX_VOID_TO_BROADCAST_SUBSCRIBER_POINTER_CONVERT(a)  ((TX_BROADCAST_SUBSCRIBER *) ((VOID *) (a)))
+#endif
+
+
 /* Define internal queue management function prototypes.  */
 
 VOID        _tx_queue_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+VOID        _tx_byte_queue_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+ULONG       _tx_byte_queue_message_read(TX_BYTE_QUEUE *queue_ptr, VOID *destination_ptr);
+VOID        _tx_byte_queue_message_write(TX_BYTE_QUEUE *queue_ptr, VOID *source_ptr, ULONG size);
+VOID        _tx_channel_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+VOID        _tx_priority_queue_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+VOID        _tx_priority_queue_message_read(TX_PRIORITY_QUEUE *queue_ptr, VOID *destination_ptr);
+VOID        _tx_priority_queue_message_write(TX_PRIORITY_QUEUE *queue_ptr, VOID *source_ptr, UINT priority);
+VOID        _tx_broadcast_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+TX_THREAD   *_tx_broadcast_message_write(TX_BROADCAST *broadcast_ptr, VOID *source_ptr);
+VOID        _tx_broadcast_publish_resume(TX_BROADCAST *broadcast_ptr);
+UINT        _tx_broadcast_room_check(TX_BROADCAST *broadcast_ptr);
+VOID        _tx_queue_message_copy(ULONG *source_ptr, ULONG *destination_ptr, UINT size);
+VOID        _tx_queue_message_copy_2_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size);
+VOID        _tx_queue_message_copy_4_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size);
+VOID        _tx_queue_message_copy_8_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size);
+VOID        _tx_queue_message_copy_16_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size);
 
 
 /* Queue management component data declarations follow.  */
@@ -129,6 +295,46 @@ QUEUE_DECLARE  TX_QUEUE *   _tx_queue_created_ptr;
 QUEUE_DECLARE  ULONG        _tx_queue_created_count;
 
 
+/* Define the head pointer of the created byte queue list.  */
+
+QUEUE_DECLARE  TX_BYTE_QUEUE *  _tx_byte_queue_created_ptr;
+
+
+/* Define the variable that holds the number of created byte queues. */
+
+QUEUE_DECLARE  ULONG        _tx_byte_queue_created_count;
+
+
+/* Define the head pointer of the created channel list.  */
+
+QUEUE_DECLARE  TX_CHANNEL *     _tx_channel_created_ptr;
+
+
+/* Define the variable that holds the number of created channels. */
+
+QUEUE_DECLARE  ULONG        _tx_channel_created_count;
+
+
+/* Define the head pointer of the created priority queue list.  */
+
+QUEUE_DECLARE  TX_PRIORITY_QUEUE *  _tx_priority_queue_created_ptr;
+
+
+/* Define the variable that holds the number of created priority queues. */
+
+QUEUE_DECLARE  ULONG        _tx_priority_queue_created_count;
+
+
+/* Define the head pointer of the created broadcast list.  */
+
+QUEUE_DECLARE  TX_BROADCAST *   _tx_broadcast_created_ptr;
+
+
+/* Define the variable that holds the number of created broadcasts. */
+
+QUEUE_DECLARE  ULONG        _tx_broadcast_created_count;
+
+
 #ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of messages sent.  */
@@ -161,6 +367,36 @@ QUEUE_DECLARE  ULONG        _tx_queue_performance_full_error_count;
 QUEUE_DECLARE  ULONG        _tx_queue_performance_timeout_count;
 
 
+/* Define the total number of byte queue messages sent.  */
+
+QUEUE_DECLARE  ULONG        _tx_byte_queue_performance_messages_sent_count;
+
+
+/* Define the total number of byte queue messages received.  */
+
+QUEUE_DECLARE  ULONG        _tx_byte_queue_performance_messages_received_count;
+
+
+/* Define the total number of byte queue empty suspensions.  */
+
+QUEUE_DECLARE  ULONG        _tx_byte_queue_performance_empty_suspension_count;
+
+
+/* Define the total number of byte queue full suspensions.  */
+
+QUEUE_DECLARE  ULONG        _tx_byte_queue_performance_full_suspension_count;
+
+
+/* Define the total number of byte queue full errors.  */
+
+QUEUE_DECLARE  ULONG        _tx_byte_queue_performance_full_error_count;
+
+
+/* Define the total number of byte queue timeouts.  */
+
+QUEUE_DECLARE  ULONG        _tx_byte_queue_performance_timeout_count;
+
+
 #endif
 
 
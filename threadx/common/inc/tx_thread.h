@@ -51,6 +51,14 @@
 /*  10-15-2021     Scott Larson             Modified comment(s), improved */
 /*                                            stack check error handling, */
 /*                                            resulting in version 6.1.9  */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            compiler count trailing     */
+/*                                            zeros for the lowest set    */
+/*                                            bit calculation and the     */
+/*                                            byte pool magazine release  */
+/*                                            function pointer            */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            wait for multiple objects   */
 /*                                                                        */
 /**************************************************************************/
 
@@ -65,6 +73,14 @@
 #define TX_THREAD_EXECUTE_LOG_SIZE              ((UINT) 8)
 
 
+/* Ensure the ready priority bit maps can be found with a single summary word, which has
+   one bit for each group of 32 priorities.  */
+
+#if TX_MAX_PRIORITIES > 1024
+#error "TX_MAX_PRIORITIES must not exceed 1024."
+#endif
+
+
 /* Define the MOD32 bit set macro that is used to set/clear a priority bit within a specific
    priority group.  */
 
@@ -150,7 +166,26 @@
 
 /* Define the lowest bit set macro. Note, that this may be overridden
    by a port specific definition if there is supporting assembly language
-   instructions in the architecture.  */
+   instructions in the architecture.  Otherwise, the count trailing zeros
+   intrinsic of the compiler is used when available, which most
+   architectures implement with a single instruction.  The map is never
+   zero when the macro is used.  Define TX_DISABLE_LOWEST_SET_BIT_INTRINSIC
+   to use the generic bit search instead.  */
+
+#if !defined(TX_LOWEST_SET_BIT_CALCULATE) && !defined(TX_DISABLE_LOWEST_SET_BIT_INTRINSIC)
+#if defined(__GNUC__) || defined(__clang__)
+#define TX_LOWEST_SET_BIT_CALCULATE(m, b)       (b) =  ((ULONG) __builtin_ctz((unsigned int) (m)));
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define TX_LOWEST_SET_BIT_CALCULATE(m, b)       \
+    {                                           \
+    unsigned long   tx_lowest_set_bit;          \
+        _BitScanForward(&tx_lowest_set_bit,     \
+                        (unsigned long) (m));   \
+        (b) =  ((ULONG) tx_lowest_set_bit);     \
+    }
+#endif
+#endif
 
 #ifndef TX_LOWEST_SET_BIT_CALCULATE
 #define TX_LOWEST_SET_BIT_CALCULATE(m, b)       \
@@ -273,6 +308,13 @@
 #endif
 
 
+/* Define the wait block pointer conversion.  */
+
+#ifndef TX_VOID_TO_WAIT_BLOCK_POINTER_CONVERT
+#define TX_VOID_TO_WAIT_BLOCK_POINTER_CONVERT(a)    ((TX_WAIT_BLOCK *) ((VOID *) (a)))
+#endif
+
+
 /* Define internal thread control function prototypes.  */
 
 VOID        _tx_thread_initialize(VOID);
@@ -290,6 +332,8 @@ VOID        _tx_thread_system_suspend(TX_THREAD *thread_ptr);
 VOID        _tx_thread_system_ni_suspend(TX_THREAD *thread_ptr, ULONG wait_option);
 VOID        _tx_thread_time_slice(VOID);
 VOID        _tx_thread_timeout(ULONG timeout_input);
+VOID        _tx_thread_wait_multiple_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+TX_THREAD   *_tx_thread_wait_multiple_complete(TX_WAIT_BLOCK *wait_block, UINT status);
 
 
 /* Thread control component data declarations follow.  */
@@ -405,6 +449,12 @@ THREAD_DECLARE  volatile UINT   _tx_thread_preempt_disable;
 THREAD_DECLARE  VOID            (*_tx_thread_mutex_release)(TX_THREAD *thread_ptr);
 
 
+/* Define the global function pointer for byte pool magazine cleanup on thread completion,
+   reset, or deletion. This pointer is setup when the first magazine is created.  */
+
+THREAD_DECLARE  VOID            (*_tx_thread_byte_pool_magazine_release)(TX_THREAD *thread_ptr);
+
+
 /* Define the global build options variable.  This contains a bit map representing
    how the ThreadX library was built. The following are the bit field definitions:
 
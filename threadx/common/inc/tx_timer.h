@@ -57,6 +57,20 @@
 #define TX_TIMER_ENTRIES                        ((ULONG) 32)
 
 
+/* Define the number of timing wheel levels above the timer list.  Each level
+   has TX_TIMER_ENTRIES entries, and each entry covers TX_TIMER_ENTRIES times
+   the ticks of an entry on the level below.  With the default of 3 levels,
+   timers of up to 32^4 ticks are cascaded down at most once per level; longer
+   timers are parked in the last entry of the top level until they fit.  With
+   0 levels there is no wheel, and timers longer than the timer list are
+   re-inserted each time the list wraps.  The value is tested by the
+   preprocessor, so it must be a plain number.  */
+
+#ifndef TX_TIMER_WHEEL_LEVELS
+#define TX_TIMER_WHEEL_LEVELS                   3
+#endif
+
+
 /* Define internal timer management function prototypes.  */
 
 VOID        _tx_timer_expiration_process(VOID);
@@ -64,6 +78,10 @@ VOID        _tx_timer_initialize(VOID);
 VOID        _tx_timer_system_activate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_system_deactivate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_thread_entry(ULONG timer_thread_input);
+#if TX_TIMER_WHEEL_LEVELS != 0
+VOID        _tx_timer_wheel_cascade(VOID);
+ULONG       _tx_timer_wheel_ticks_get(TX_TIMER_INTERNAL **wheel_list);
+#endif
 
 
 /* Timer management component data declarations follow.  */
@@ -116,6 +134,27 @@ TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_list_end;
 TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_current_ptr;
 
 
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+/* Define the timing wheel.  Timers that do not fit in the timer list are placed on
+   the wheel and moved down a level each time their entry is cascaded.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_wheel[TX_TIMER_WHEEL_LEVELS][TX_TIMER_ENTRIES];
+
+
+/* Define the index of the next entry to cascade on each level of the wheel.  */
+
+TIMER_DECLARE UINT              _tx_timer_wheel_index[TX_TIMER_WHEEL_LEVELS];
+
+
+/* Define the internal wheel timer.  While there are timers on the wheel, it occupies
+   the last entry of the timer list, so the timer list always wraps in the timer
+   expiration processing, which cascades the wheel.  */
+
+TIMER_DECLARE TX_TIMER          _tx_timer_wheel_timer;
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer
    has expired.  */
 
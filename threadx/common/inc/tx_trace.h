@@ -43,6 +43,13 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            trace events for byte       */
+/*                                            queues, multiple queue send */
+/*                                            and receive, wait for       */
+/*                                            multiple objects,           */
+/*                                            broadcasts, channels, block */
+/*                                            slabs and block buffers     */
 /*                                                                        */
 /**************************************************************************/
 
@@ -193,6 +200,10 @@ typedef struct TX_TRACE_HEADER_STRUCT
 #define TX_TRACE_OBJECT_TYPE_EVENT_FLAGS                    ((UCHAR) 6)     /* none                                              */
 #define TX_TRACE_OBJECT_TYPE_BLOCK_POOL                     ((UCHAR) 7)     /* P1 = total blocks, P2 = block size                */
 #define TX_TRACE_OBJECT_TYPE_BYTE_POOL                      ((UCHAR) 8)     /* P1 = total bytes                                  */
+#define TX_TRACE_OBJECT_TYPE_BYTE_QUEUE                     ((UCHAR) 9)     /* P1 = queue size                                   */
+#define TX_TRACE_OBJECT_TYPE_BROADCAST                      ((UCHAR) 10)    /* P1 = capacity, P2 = message size                  */
+#define TX_TRACE_OBJECT_TYPE_CHANNEL                        ((UCHAR) 11)    /* P1 = capacity, P2 = message size                  */
+#define TX_TRACE_OBJECT_TYPE_BLOCK_SLAB                     ((UCHAR) 12)    /* P1 = class count, P2 = spill option               */
 
 
 typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
@@ -311,6 +322,8 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_QUEUE_RECEIVE                              68          /* I1 = queue ptr, I2 = destination ptr, I3 = wait option, I4 = enqueued    */
 #define TX_TRACE_QUEUE_SEND                                 69          /* I1 = queue ptr, I2 = source ptr, I3 = wait option, I4 = enqueued         */
 #define TX_TRACE_QUEUE_SEND_NOTIFY                          70          /* I1 = queue ptr                                                           */
+#define TX_TRACE_QUEUE_SEND_N                               71          /* I1 = queue ptr, I2 = source ptr, I3 = message count, I4 = wait option    */
+#define TX_TRACE_QUEUE_RECEIVE_N                            72          /* I1 = queue ptr, I2 = destination ptr, I3 = message count, I4 = wait opt  */
 #define TX_TRACE_SEMAPHORE_CEILING_PUT                      80          /* I1 = semaphore ptr, I2 = current count, I3 = suspended count,I4 =ceiling */
 #define TX_TRACE_SEMAPHORE_CREATE                           81          /* I1 = semaphore ptr, I2 = initial count, I3 = stack ptr                   */
 #define TX_TRACE_SEMAPHORE_DELETE                           82          /* I1 = semaphore ptr, I2 = stack ptr                                       */
@@ -321,6 +334,16 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_SEMAPHORE_PRIORITIZE                       87          /* I1 = semaphore ptr, I2 = suspended count, I2 = stack ptr                 */
 #define TX_TRACE_SEMAPHORE_PUT                              88          /* I1 = semaphore ptr, I2 = current count, I3 = suspended count,I4=stack ptr*/
 #define TX_TRACE_SEMAPHORE_PUT_NOTIFY                       89          /* I1 = semaphore ptr                                                       */
+#define TX_TRACE_BYTE_QUEUE_CREATE                          90          /* I1 = queue ptr, I2 = queue start, I3 = queue size, I4 = stack ptr        */
+#define TX_TRACE_BYTE_QUEUE_DELETE                          91          /* I1 = queue ptr, I2 = stack ptr                                           */
+#define TX_TRACE_BYTE_QUEUE_FLUSH                           92          /* I1 = queue ptr, I2 = stack ptr                                           */
+#define TX_TRACE_BYTE_QUEUE_INFO_GET                        93          /* I1 = queue ptr                                                           */
+#define TX_TRACE_BYTE_QUEUE_PERFORMANCE_INFO_GET            94          /* I1 = queue ptr                                                           */
+#define TX_TRACE_BYTE_QUEUE_PERFORMANCE_SYSTEM_INFO_GET     95          /* None                                                                     */
+#define TX_TRACE_BYTE_QUEUE_PRIORITIZE                      96          /* I1 = queue ptr, I2 = suspended count, I3 = stack ptr                     */
+#define TX_TRACE_BYTE_QUEUE_RECEIVE                         97          /* I1 = queue ptr, I2 = destination ptr, I3 = wait option, I4 = enqueued    */
+#define TX_TRACE_BYTE_QUEUE_SEND                            98          /* I1 = queue ptr, I2 = source ptr, I3 = size, I4 = wait option             */
+#define TX_TRACE_BYTE_QUEUE_SEND_NOTIFY                     99          /* I1 = queue ptr                                                           */
 #define TX_TRACE_THREAD_CREATE                              100         /* I1 = thread ptr, I2 = priority, I3 = stack ptr, I4 = stack_size          */
 #define TX_TRACE_THREAD_DELETE                              101         /* I1 = thread ptr, I2 = stack ptr                                          */
 #define TX_TRACE_THREAD_ENTRY_EXIT_NOTIFY                   102         /* I1 = thread ptr, I2 = thread state, I3 = stack ptr                       */
@@ -339,6 +362,8 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_THREAD_TERMINATE                           115         /* I1 = thread ptr, I2 = thread state, I3 = stack ptr                       */
 #define TX_TRACE_THREAD_TIME_SLICE_CHANGE                   116         /* I1 = thread ptr, I2 = new timeslice, I3 = old timeslice                  */
 #define TX_TRACE_THREAD_WAIT_ABORT                          117         /* I1 = thread ptr, I2 = thread state, I3 = stack ptr                       */
+#define TX_TRACE_THREAD_WAIT_MULTIPLE                       118         /* I1 = wait blocks ptr, I2 = count, I3 = wait option, I4 = stack ptr       */
+#define TX_TRACE_THREAD_WAIT_MULTIPLE_CLEANUP               119         /* I1 = thread ptr, I2 = wait blocks ptr, I3 = status, I4 = thread state    */
 #define TX_TRACE_TIME_GET                                   120         /* I1 = current time, I2 = stack ptr                                        */
 #define TX_TRACE_TIME_SET                                   121         /* I1 = new time                                                            */
 #define TX_TRACE_TIMER_ACTIVATE                             122         /* I1 = timer ptr                                                           */
@@ -349,6 +374,28 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_TIMER_INFO_GET                             127         /* I1 = timer ptr, I2 = stack ptr                                           */
 #define TX_TRACE_TIMER_PERFORMANCE_INFO_GET                 128         /* I1 = timer ptr                                                           */
 #define TX_TRACE_TIMER_PERFORMANCE_SYSTEM_INFO_GET          129         /* None                                                                     */
+#define TX_TRACE_BROADCAST_CREATE                           130         /* I1 = broadcast ptr, I2 = start ptr, I3 = capacity, I4 = message size     */
+#define TX_TRACE_BROADCAST_DELETE                           131         /* I1 = broadcast ptr, I2 = stack ptr                                       */
+#define TX_TRACE_BROADCAST_INFO_GET                         132         /* I1 = broadcast ptr                                                       */
+#define TX_TRACE_BROADCAST_PUBLISH                          133         /* I1 = broadcast ptr, I2 = source ptr, I3 = wait option, I4 = subscribers  */
+#define TX_TRACE_BROADCAST_RECEIVE                          134         /* I1 = subscriber ptr, I2 = destination ptr, I3 = wait option, I4 = unread */
+#define TX_TRACE_BROADCAST_SUBSCRIBE                        135         /* I1 = broadcast ptr, I2 = subscriber ptr, I3 = subscribers                */
+#define TX_TRACE_BROADCAST_UNSUBSCRIBE                      136         /* I1 = subscriber ptr, I2 = broadcast ptr, I3 = subscribers                */
+#define TX_TRACE_CHANNEL_CREATE                             140         /* I1 = channel ptr, I2 = start ptr, I3 = capacity, I4 = message size       */
+#define TX_TRACE_CHANNEL_DELETE                             141         /* I1 = channel ptr, I2 = stack ptr                                         */
+#define TX_TRACE_CHANNEL_INFO_GET                           142         /* I1 = channel ptr                                                         */
+#define TX_TRACE_CHANNEL_RECEIVE                            143         /* I1 = channel ptr, I2 = destination ptr, I3 = wait option, I4 = enqueued  */
+#define TX_TRACE_CHANNEL_SEND                               144         /* I1 = channel ptr, I2 = source ptr, I3 = enqueued                         */
+#define TX_TRACE_BLOCK_SLAB_ALLOCATE                        150         /* I1 = slab ptr, I2 = memory size, I3 = wait option, I4 = class index      */
+#define TX_TRACE_BLOCK_SLAB_CLASS_INFO_GET                  151         /* I1 = slab ptr, I2 = class index                                          */
+#define TX_TRACE_BLOCK_SLAB_CREATE                          152         /* I1 = slab ptr, I2 = pool start, I3 = pool size, I4 = class count         */
+#define TX_TRACE_BLOCK_SLAB_DELETE                          153         /* I1 = slab ptr, I2 = stack ptr                                            */
+#define TX_TRACE_BLOCK_SLAB_INFO_GET                        154         /* I1 = slab ptr                                                            */
+#define TX_TRACE_BLOCK_BUFFER_ALLOCATE                      160         /* I1 = pool ptr, I2 = wait option, I3 = available blocks                   */
+#define TX_TRACE_BLOCK_BUFFER_RECEIVE                       161         /* I1 = queue ptr, I2 = destination ptr, I3 = wait option, I4 = enqueued    */
+#define TX_TRACE_BLOCK_BUFFER_REFERENCE                     162         /* I1 = buffer ptr, I2 = reference count                                    */
+#define TX_TRACE_BLOCK_BUFFER_RELEASE                       163         /* I1 = buffer ptr, I2 = reference count                                    */
+#define TX_TRACE_BLOCK_BUFFER_SEND                          164         /* I1 = queue ptr, I2 = buffer ptr, I3 = wait option, I4 = reference count  */
 
 
 /* Define the an Trace Buffer Entry.  */
@@ -58,6 +58,11 @@
 /*                                            user-configurable symbol    */
 /*                                            TX_TIMER_TICKS_PER_SECOND   */
 /*                                            resulting in version 6.1.9  */
+/*  10-17-2026      agent                   Added option for the number   */
+/*                                            of timing wheel levels, and */
+/*                                            execution profile option    */
+/*  10-17-2026      agent                   Added lock-free block pool    */
+/*                                            option                      */
 /*                                                                        */
 /**************************************************************************/
 
@@ -148,6 +153,17 @@
 #define TX_REACTIVATE_INLINE
 */
 
+/* Determine the number of timing wheel levels above the 32-entry timer list. Timers longer than
+   the timer list are placed on the wheel and moved down one level at a time, so a long timer is
+   only touched once per level instead of once every 32 ticks. By default, 3 levels are used,
+   which covers timers of up to 32^4 ticks directly; longer timers wait on the top level until
+   they fit. Up to 5 levels may be used, and 0 levels removes the wheel. When the following
+   is defined, the number of levels is changed.  */
+
+/*
+#define TX_TIMER_WHEEL_LEVELS                   3
+*/
+
 /* Determine is stack filling is enabled. By default, ThreadX stack filling is enabled,
    which places an 0xEF pattern in each byte of each thread's stack.  This is used by
    debuggers with ThreadX-awareness and by the ThreadX run-time stack checking feature.  */
@@ -230,6 +246,15 @@
 */
 
 
+/* Determine if the execution profile should be gathered. When the following is defined, the
+   port measures the time spent in each thread, in interrupt processing, and while idle. The
+   times are available through the execution profile kit in utility/execution_profile_kit.  */
+
+/*
+#define TX_EXECUTION_PROFILE_ENABLE
+*/
+
+
 /* Determine if block pool performance gathering is required by the application. When the following is
    defined, ThreadX gathers various block pool performance information. */
 
@@ -298,5 +323,15 @@
 #define TX_BYTE_POOL_DELAY_VALUE              3
 */
 
+/* Determine if block pools keep their available blocks on a lock-free list. When the following is
+   defined, allocating an available block and releasing a block while no thread waits for one are
+   a single atomic compare and exchange of a tagged list head, without disabling interrupts. The
+   kernel lock is only taken when a thread has to wait or is waiting for a block. The atomic
+   operations are taken from the compiler's built-ins, or from tx_port.h.  */
+
+/*
+#define TX_BLOCK_POOL_LOCK_FREE
+*/
+
 #endif
 
@@ -46,7 +46,8 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function allocates a block from the specified memory block     */
-/*    pool.                                                               */
+/*    pool.  When TX_BLOCK_POOL_LOCK_FREE is defined, an available block  */
+/*    is taken without disabling interrupts.                              */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -61,6 +62,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_block_pool_lock_free_pop      Take a block off the available    */
+/*                                        list                            */
 /*    _tx_thread_system_suspend         Suspend thread                    */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*                                                                        */
@@ -75,6 +78,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            lock-free block pool        */
+/*                                            option                      */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_block_allocate(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, ULONG wait_option)
@@ -102,269 +108,375 @@ ULONG                       lower_tbu;
 #endif
 
 
-    /* Disable interrupts to get a block from the pool.  */
-    TX_DISABLE
+#ifdef TX_BLOCK_POOL_LOCK_FREE
 
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 
     /* Increment the total allocations counter.  */
-    _tx_block_pool_performance_allocate_count++;
+    TX_BLOCK_POOL_ATOMIC_ADD(&_tx_block_pool_performance_allocate_count, ((ULONG) 1))
 
     /* Increment the number of allocations on this pool.  */
-    pool_ptr -> tx_block_pool_performance_allocate_count++;
+    TX_BLOCK_POOL_ATOMIC_ADD(&(pool_ptr -> tx_block_pool_performance_allocate_count), ((ULONG) 1))
 #endif
 
+    /* Take the first block off the available list without disabling interrupts.  */
+    work_ptr =  _tx_block_pool_lock_free_pop(pool_ptr);
+    if (work_ptr != TX_NULL)
+    {
+
+        /* Return the block to the caller.  */
+        temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+        return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+        *return_ptr =  temp_ptr;
+
+        /* Save the pool's address in the block for when it is released!  */
+        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+        temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+        *next_block_ptr =  temp_ptr;
+
 #ifdef TX_ENABLE_EVENT_TRACE
 
-    /* If trace is enabled, save the current event pointer.  */
-    entry_ptr =  _tx_trace_buffer_current_ptr;
+        /* Determine if trace is enabled.  */
+        if (_tx_trace_buffer_current_ptr != TX_NULL)
+        {
+
+            /* Yes, disable interrupts only to insert this event into the trace buffer.  */
+            TX_DISABLE
 
-    /* If trace is enabled, insert this event into the trace buffer.  */
-    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_ALLOCATE, pool_ptr, 0, wait_option, pool_ptr -> tx_block_pool_available, TX_TRACE_BLOCK_POOL_EVENTS)
+            /* Insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_ALLOCATE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(*block_ptr), wait_option, pool_ptr -> tx_block_pool_available, TX_TRACE_BLOCK_POOL_EVENTS)
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+#endif
 
-    /* Save the time stamp for later comparison to verify that
-       the event hasn't been overwritten by the time the allocate
-       call succeeds.  */
-    if (entry_ptr != TX_NULL)
+        /* Set status to success.  */
+        status =  TX_SUCCESS;
+    }
+    else
     {
 
-        time_stamp =  entry_ptr -> tx_trace_buffer_entry_time_stamp;
+        /* The pool looks empty, check again with interrupts disabled.  */
+        status =  TX_NOT_DONE;
     }
+#else
+
+    /* The block is allocated with interrupts disabled.  */
+    status =  TX_NOT_DONE;
+#endif
+
+    /* Determine if the block still has to be allocated with interrupts disabled.  */
+    if (status == TX_NOT_DONE)
+    {
+
+        /* Disable interrupts to get a block from the pool.  */
+        TX_DISABLE
+
+#if defined(TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO) && !defined(TX_BLOCK_POOL_LOCK_FREE)
+
+        /* Increment the total allocations counter.  */
+        _tx_block_pool_performance_allocate_count++;
+
+        /* Increment the number of allocations on this pool.  */
+        pool_ptr -> tx_block_pool_performance_allocate_count++;
+#endif
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+        /* If trace is enabled, save the current event pointer.  */
+        entry_ptr =  _tx_trace_buffer_current_ptr;
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_ALLOCATE, pool_ptr, 0, wait_option, pool_ptr -> tx_block_pool_available, TX_TRACE_BLOCK_POOL_EVENTS)
+
+        /* Save the time stamp for later comparison to verify that
+           the event hasn't been overwritten by the time the allocate
+           call succeeds.  */
+        if (entry_ptr != TX_NULL)
+        {
+
+            time_stamp =  entry_ptr -> tx_trace_buffer_entry_time_stamp;
+        }
 #endif
 
 #ifdef TX_ENABLE_EVENT_LOGGING
-    log_entry_ptr =  *(UCHAR **) _tx_el_current_event;
+        log_entry_ptr =  *(UCHAR **) _tx_el_current_event;
 
-    /* Log this kernel call.  */
-    TX_EL_BLOCK_ALLOCATE_INSERT
+        /* Log this kernel call.  */
+        TX_EL_BLOCK_ALLOCATE_INSERT
 
-    /* Store -1 in the third event slot.  */
-    *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_3_OFFSET)) =  (ULONG) -1;
+        /* Store -1 in the third event slot.  */
+        *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_3_OFFSET)) =  (ULONG) -1;
 
-    /* Save the time stamp for later comparison to verify that
-       the event hasn't been overwritten by the time the allocate
-       call succeeds.  */
-    lower_tbu =  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_LOWER_OFFSET));
-    upper_tbu =  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET));
+        /* Save the time stamp for later comparison to verify that
+           the event hasn't been overwritten by the time the allocate
+           call succeeds.  */
+        lower_tbu =  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_LOWER_OFFSET));
+        upper_tbu =  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET));
 #endif
 
-    /* Determine if there is an available block.  */
-    if (pool_ptr -> tx_block_pool_available != ((UINT) 0))
-    {
+#ifdef TX_BLOCK_POOL_LOCK_FREE
 
-        /* Yes, a block is available.  Decrement the available count.  */
-        pool_ptr -> tx_block_pool_available--;
+        /* Count a thread that may wait for a block as suspended before the available
+           list is checked again.  A release that does not see the count has made its
+           block available by then.  */
+        if (wait_option != TX_NO_WAIT)
+        {
 
-        /* Pickup the current block pointer.  */
-        work_ptr =  pool_ptr -> tx_block_pool_available_list;
+            (pool_ptr -> tx_block_pool_suspended_count)++;
+            TX_BLOCK_POOL_MEMORY_BARRIER
+        }
 
-        /* Return the first available block to the caller.  */
-        temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
-        return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
-        *return_ptr =  temp_ptr;
+        /* Take the first block off the available list.  */
+        work_ptr =  _tx_block_pool_lock_free_pop(pool_ptr);
 
-        /* Modify the available list to point at the next block in the pool. */
-        next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
-        pool_ptr -> tx_block_pool_available_list =  *next_block_ptr;
+        /* Determine if there is an available block.  */
+        if (work_ptr != TX_NULL)
+        {
 
-        /* Save the pool's address in the block for when it is released!  */
-        temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
-        *next_block_ptr =  temp_ptr;
+            /* Yes, the thread does not wait after all.  */
+            if (wait_option != TX_NO_WAIT)
+            {
 
-#ifdef TX_ENABLE_EVENT_TRACE
+                (pool_ptr -> tx_block_pool_suspended_count)--;
+            }
+#else
 
-        /* Check that the event time stamp is unchanged.  A different
-           timestamp means that a later event wrote over the byte
-           allocate event.  In that case, do nothing here.  */
-        if (entry_ptr != TX_NULL)
+        /* Determine if there is an available block.  */
+        if (pool_ptr -> tx_block_pool_available != ((UINT) 0))
         {
 
-            /* Is the time stamp the same?  */
-            if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+            /* Yes, a block is available.  Decrement the available count.  */
+            pool_ptr -> tx_block_pool_available--;
+
+            /* Pickup the current block pointer.  */
+            work_ptr =  pool_ptr -> tx_block_pool_available_list;
+#endif
+
+            /* Return the first available block to the caller.  */
+            temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+            return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+            *return_ptr =  temp_ptr;
+
+            /* Modify the available list to point at the next block in the pool. */
+            next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+#ifndef TX_BLOCK_POOL_LOCK_FREE
+            pool_ptr -> tx_block_pool_available_list =  *next_block_ptr;
+#endif
+
+            /* Save the pool's address in the block for when it is released!  */
+            temp_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+            *next_block_ptr =  temp_ptr;
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+            /* Check that the event time stamp is unchanged.  A different
+               timestamp means that a later event wrote over the byte
+               allocate event.  In that case, do nothing here.  */
+            if (entry_ptr != TX_NULL)
             {
 
-                /* Timestamp is the same, update the entry with the address.  */
+                /* Is the time stamp the same?  */
+                if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+                {
+
+                    /* Timestamp is the same, update the entry with the address.  */
 #ifdef TX_MISRA_ENABLE
-                entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+                    entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
 #else
-                entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+                    entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
 #endif
+                }
             }
-        }
 #endif
 
 #ifdef TX_ENABLE_EVENT_LOGGING
-        /* Store the address of the allocated block.  */
-        *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_3_OFFSET)) =  (ULONG) *block_ptr;
+            /* Store the address of the allocated block.  */
+            *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_3_OFFSET)) =  (ULONG) *block_ptr;
 #endif
 
-        /* Set status to success.  */
-        status =  TX_SUCCESS;
-
-        /* Restore interrupts.  */
-        TX_RESTORE
-    }
-    else
-    {
+            /* Set status to success.  */
+            status =  TX_SUCCESS;
 
-        /* Default the return pointer to NULL.  */
-        return_ptr =   TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
-        *return_ptr =  TX_NULL;
-
-        /* Determine if the request specifies suspension.  */
-        if (wait_option != TX_NO_WAIT)
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
         {
 
-            /* Determine if the preempt disable flag is non-zero.  */
-            if (_tx_thread_preempt_disable != ((UINT) 0))
+            /* Default the return pointer to NULL.  */
+            return_ptr =   TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+            *return_ptr =  TX_NULL;
+
+            /* Determine if the request specifies suspension.  */
+            if (wait_option != TX_NO_WAIT)
             {
 
-                /* Suspension is not allowed if the preempt disable flag is non-zero at this point, return error completion.  */
-                status =  TX_NO_MEMORY;
+                /* Determine if the preempt disable flag is non-zero.  */
+                if (_tx_thread_preempt_disable != ((UINT) 0))
+                {
 
-                /* Restore interrupts.  */
-                TX_RESTORE
-            }
-            else
-            {
+                    /* Suspension is not allowed if the preempt disable flag is non-zero at this point, return error completion.  */
+                    status =  TX_NO_MEMORY;
+
+#ifdef TX_BLOCK_POOL_LOCK_FREE
 
-                /* Prepare for suspension of this thread.  */
+                    /* The thread does not wait after all.  */
+                    (pool_ptr -> tx_block_pool_suspended_count)--;
+#endif
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+                }
+                else
+                {
+
+                    /* Prepare for suspension of this thread.  */
 
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 
-                /* Increment the total suspensions counter.  */
-                _tx_block_pool_performance_suspension_count++;
+                    /* Increment the total suspensions counter.  */
+                    _tx_block_pool_performance_suspension_count++;
 
-                /* Increment the number of suspensions on this pool.  */
-                pool_ptr -> tx_block_pool_performance_suspension_count++;
+                    /* Increment the number of suspensions on this pool.  */
+                    pool_ptr -> tx_block_pool_performance_suspension_count++;
 #endif
 
-                /* Pickup thread pointer.  */
-                TX_THREAD_GET_CURRENT(thread_ptr)
+                    /* Pickup thread pointer.  */
+                    TX_THREAD_GET_CURRENT(thread_ptr)
 
-                /* Setup cleanup routine pointer.  */
-                thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_block_pool_cleanup);
+                    /* Setup cleanup routine pointer.  */
+                    thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_block_pool_cleanup);
 
-                /* Setup cleanup information, i.e. this pool control
-                   block.  */
-                thread_ptr -> tx_thread_suspend_control_block =  (VOID *) pool_ptr;
+                    /* Setup cleanup information, i.e. this pool control
+                       block.  */
+                    thread_ptr -> tx_thread_suspend_control_block =  (VOID *) pool_ptr;
 
-                /* Save the return block pointer address as well.  */
-                thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) block_ptr;
+                    /* Save the return block pointer address as well.  */
+                    thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) block_ptr;
 
 #ifndef TX_NOT_INTERRUPTABLE
 
-                /* Increment the suspension sequence number, which is used to identify
-                   this suspension event.  */
-                thread_ptr -> tx_thread_suspension_sequence++;
+                    /* Increment the suspension sequence number, which is used to identify
+                       this suspension event.  */
+                    thread_ptr -> tx_thread_suspension_sequence++;
 #endif
 
-                /* Pickup the number of suspended threads.  */
-                suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
+                    /* Pickup the number of suspended threads.  */
+                    suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
 
-                /* Increment the number of suspended threads.  */
-                (pool_ptr -> tx_block_pool_suspended_count)++;
+#ifdef TX_BLOCK_POOL_LOCK_FREE
 
-                /* Setup suspension list.  */
-                if (suspended_count == TX_NO_SUSPENSIONS)
-                {
+                    /* This thread was counted before the available list was checked.  */
+                    suspended_count--;
+#else
 
-                    /* No other threads are suspended.  Setup the head pointer and
-                       just setup this threads pointers to itself.  */
-                    pool_ptr -> tx_block_pool_suspension_list =     thread_ptr;
-                    thread_ptr -> tx_thread_suspended_next =        thread_ptr;
-                    thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
-                }
-                else
-                {
+                    /* Increment the number of suspended threads.  */
+                    (pool_ptr -> tx_block_pool_suspended_count)++;
+#endif
 
-                    /* This list is not NULL, add current thread to the end. */
-                    next_thread =                                   pool_ptr -> tx_block_pool_suspension_list;
-                    thread_ptr -> tx_thread_suspended_next =        next_thread;
-                    previous_thread =                               next_thread -> tx_thread_suspended_previous;
-                    thread_ptr -> tx_thread_suspended_previous =    previous_thread;
-                    previous_thread -> tx_thread_suspended_next =   thread_ptr;
-                    next_thread -> tx_thread_suspended_previous =   thread_ptr;
-                }
+                    /* Setup suspension list.  */
+                    if (suspended_count == TX_NO_SUSPENSIONS)
+                    {
+
+                        /* No other threads are suspended.  Setup the head pointer and
+                           just setup this threads pointers to itself.  */
+                        pool_ptr -> tx_block_pool_suspension_list =     thread_ptr;
+                        thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                        thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+                    }
+                    else
+                    {
+
+                        /* This list is not NULL, add current thread to the end. */
+                        next_thread =                                   pool_ptr -> tx_block_pool_suspension_list;
+                        thread_ptr -> tx_thread_suspended_next =        next_thread;
+                        previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                        thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                        previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                        next_thread -> tx_thread_suspended_previous =   thread_ptr;
+                    }
 
-                /* Set the state to suspended.  */
-                thread_ptr -> tx_thread_state =       TX_BLOCK_MEMORY;
+                    /* Set the state to suspended.  */
+                    thread_ptr -> tx_thread_state =       TX_BLOCK_MEMORY;
 
 #ifdef TX_NOT_INTERRUPTABLE
 
-                /* Call actual non-interruptable thread suspension routine.  */
-                _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+                    /* Call actual non-interruptable thread suspension routine.  */
+                    _tx_thread_system_ni_suspend(thread_ptr, wait_option);
 
-                /* Restore interrupts.  */
-                TX_RESTORE
+                    /* Restore interrupts.  */
+                    TX_RESTORE
 #else
 
-                /* Set the suspending flag.  */
-                thread_ptr -> tx_thread_suspending =  TX_TRUE;
+                    /* Set the suspending flag.  */
+                    thread_ptr -> tx_thread_suspending =  TX_TRUE;
 
-                /* Setup the timeout period.  */
-                thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+                    /* Setup the timeout period.  */
+                    thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
 
-                /* Temporarily disable preemption.  */
-                _tx_thread_preempt_disable++;
+                    /* Temporarily disable preemption.  */
+                    _tx_thread_preempt_disable++;
 
-                /* Restore interrupts.  */
-                TX_RESTORE
+                    /* Restore interrupts.  */
+                    TX_RESTORE
 
-                /* Call actual thread suspension routine.  */
-                _tx_thread_system_suspend(thread_ptr);
+                    /* Call actual thread suspension routine.  */
+                    _tx_thread_system_suspend(thread_ptr);
 #endif
 
 #ifdef TX_ENABLE_EVENT_TRACE
 
-                /* Check that the event time stamp is unchanged.  A different
-                   timestamp means that a later event wrote over the byte
-                   allocate event.  In that case, do nothing here.  */
-                if (entry_ptr != TX_NULL)
-                {
-
-                    /* Is the time-stamp the same?  */
-                    if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+                    /* Check that the event time stamp is unchanged.  A different
+                       timestamp means that a later event wrote over the byte
+                       allocate event.  In that case, do nothing here.  */
+                    if (entry_ptr != TX_NULL)
                     {
 
-                        /* Timestamp is the same, update the entry with the address.  */
+                        /* Is the time-stamp the same?  */
+                        if (time_stamp == entry_ptr -> tx_trace_buffer_entry_time_stamp)
+                        {
+
+                            /* Timestamp is the same, update the entry with the address.  */
 #ifdef TX_MISRA_ENABLE
-                        entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+                            entry_ptr -> tx_trace_buffer_entry_info_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
 #else
-                        entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
+                            entry_ptr -> tx_trace_buffer_entry_information_field_2 =  TX_POINTER_TO_ULONG_CONVERT(*block_ptr);
 #endif
+                        }
                     }
-                }
 #endif
 
 #ifdef TX_ENABLE_EVENT_LOGGING
-                /* Check that the event time stamp is unchanged and the call is about
-                   to return success.  A different timestamp means that a later event
-                   wrote over the block allocate event.  A return value other than
-                   TX_SUCCESS indicates that no block was available. In those cases,
-                   do nothing here.  */
-                if (lower_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_LOWER_OFFSET)) &&
-                    upper_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET)) &&
-                    ((thread_ptr -> tx_thread_suspend_status) == TX_SUCCESS))
-                {
+                    /* Check that the event time stamp is unchanged and the call is about
+                       to return success.  A different timestamp means that a later event
+                       wrote over the block allocate event.  A return value other than
+                       TX_SUCCESS indicates that no block was available. In those cases,
+                       do nothing here.  */
+                    if (lower_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_LOWER_OFFSET)) &&
+                        upper_tbu ==  *((ULONG *) (log_entry_ptr + TX_EL_EVENT_TIME_UPPER_OFFSET)) &&
+                        ((thread_ptr -> tx_thread_suspend_status) == TX_SUCCESS))
+                    {
 
-                    /* Store the address of the allocated block.  */
-                    *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_3_OFFSET)) =  (ULONG) *block_ptr;
-                }
+                        /* Store the address of the allocated block.  */
+                        *((ULONG *) (log_entry_ptr + TX_EL_EVENT_INFO_3_OFFSET)) =  (ULONG) *block_ptr;
+                    }
 #endif
 
-                /* Return the completion status.  */
-                status =  thread_ptr -> tx_thread_suspend_status;
+                    /* Return the completion status.  */
+                    status =  thread_ptr -> tx_thread_suspend_status;
+                }
             }
-        }
-        else
-        {
+            else
+            {
 
-            /* Immediate return, return error completion.  */
-            status =  TX_NO_MEMORY;
+                /* Immediate return, return error completion.  */
+                status =  TX_NO_MEMORY;
 
-            /* Restore interrupts.  */
-            TX_RESTORE
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
         }
     }
 
@@ -0,0 +1,210 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_allocate_n                                PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates up to the specified number of blocks from   */
+/*    the pool with interrupts disabled only once.  If the pool has fewer */
+/*    blocks available, all of them are returned.  If it has none, the    */
+/*    caller waits for a single block as specified by the wait option.    */
+/*    Since interrupts stay disabled while the blocks are taken, the      */
+/*    number of blocks requested bounds the interrupt latency.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Array to place the allocated      */
+/*                                        block pointers in               */
+/*    block_count                       Number of blocks requested        */
+/*    allocated_count                   Destination for the number of     */
+/*                                        blocks allocated                */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_allocate                Wait for a single block           */
+/*    _tx_block_pool_lock_free_pop      Take a block off the available    */
+/*                                        list                            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_allocate_n(TX_BLOCK_POOL *pool_ptr, VOID **block_ptr, UINT block_count,
+                    UINT *allocated_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UINT                count;
+UINT                requested;
+UCHAR               *work_ptr;
+UCHAR               *temp_ptr;
+UCHAR               **next_block_ptr;
+UCHAR               **return_ptr;
+
+
+    /* Pickup the array to return the blocks in.  */
+    return_ptr =  TX_INDIRECT_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+
+    /* Disable interrupts to get the blocks from the pool.  */
+    TX_DISABLE
+
+    /* Take blocks from the available list until the request is satisfied or
+       the pool is empty.  */
+    count =      ((UINT) 0);
+    requested =  block_count;
+    while (count < requested)
+    {
+
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+        /* Take the first block off the available list.  */
+        work_ptr =  _tx_block_pool_lock_free_pop(pool_ptr);
+#else
+
+        /* Determine if a block is available.  */
+        work_ptr =  TX_NULL;
+        if (pool_ptr -> tx_block_pool_available != ((UINT) 0))
+        {
+
+            /* Yes, decrement the available count.  */
+            pool_ptr -> tx_block_pool_available--;
+
+            /* Pickup the current block pointer.  */
+            work_ptr =  pool_ptr -> tx_block_pool_available_list;
+
+            /* Modify the available list to point at the next block in the pool. */
+            next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            pool_ptr -> tx_block_pool_available_list =  *next_block_ptr;
+        }
+#endif
+
+        /* Determine if the pool is empty.  */
+        if (work_ptr == TX_NULL)
+        {
+
+            /* Yes, return the blocks taken so far.  */
+            requested =  count;
+        }
+        else
+        {
+
+            /* Return the block to the caller.  */
+            temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+            return_ptr[count] =  temp_ptr;
+
+            /* Save the pool's address in the block for when it is released!  */
+            next_block_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            *next_block_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_ALLOCATE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(temp_ptr), wait_option, pool_ptr -> tx_block_pool_available, TX_TRACE_BLOCK_POOL_EVENTS)
+
+            /* Move to the next block.  */
+            count++;
+        }
+    }
+
+#ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+    /* Increment the total allocations counter.  */
+    TX_BLOCK_POOL_ATOMIC_ADD(&_tx_block_pool_performance_allocate_count, ((ULONG) count))
+
+    /* Increment the number of allocations on this pool.  */
+    TX_BLOCK_POOL_ATOMIC_ADD(&(pool_ptr -> tx_block_pool_performance_allocate_count), ((ULONG) count))
+#else
+
+    /* Increment the total allocations counter.  */
+    _tx_block_pool_performance_allocate_count =  _tx_block_pool_performance_allocate_count + ((ULONG) count);
+
+    /* Increment the number of allocations on this pool.  */
+    pool_ptr -> tx_block_pool_performance_allocate_count =  pool_ptr -> tx_block_pool_performance_allocate_count + ((ULONG) count);
+#endif
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if any block was available.  */
+    if (count != ((UINT) 0))
+    {
+
+        /* Yes, return success.  */
+        status =  TX_SUCCESS;
+    }
+    else
+    {
+
+        /* No, wait for a single block as specified by the wait option.  */
+        status =  _tx_block_allocate(pool_ptr, block_ptr, wait_option);
+
+        /* Determine if the block was allocated.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Yes, one block was allocated.  */
+            count =  ((UINT) 1);
+        }
+    }
+
+    /* Return the number of blocks allocated.  */
+    *allocated_count =  count;
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_buffer_allocate                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block from the specified pool and sets it */
+/*    up as a reference counted buffer.  The buffer control block is at   */
+/*    the start of the block and is followed by the data area.  The       */
+/*    caller holds the only reference to the new buffer.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    buffer_ptr                        Pointer to place allocated buffer */
+/*                                        pointer                         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate a memory block           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_buffer_allocate(TX_BLOCK_POOL *pool_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option)
+{
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+UINT                status;
+VOID                *block_ptr;
+TX_BLOCK_BUFFER     *new_buffer;
+
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+
+    /* Disable interrupts only to insert this event into the trace buffer and
+       log this kernel call.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_BUFFER_ALLOCATE, pool_ptr, wait_option, pool_ptr -> tx_block_pool_available, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_BUFFER_ALLOCATE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+
+    /* Allocate the block of the buffer.  */
+    status =  _tx_block_allocate(pool_ptr, &block_ptr, wait_option);
+
+    /* Determine if a block was allocated.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Yes, setup the buffer control block at the start of the block.  */
+        new_buffer =  (TX_BLOCK_BUFFER *) block_ptr;
+        new_buffer -> tx_block_buffer_pool =             pool_ptr;
+        new_buffer -> tx_block_buffer_data =             TX_UCHAR_POINTER_ADD(block_ptr, TX_BLOCK_BUFFER_HEADER_SIZE);
+        new_buffer -> tx_block_buffer_size =             ((ULONG) pool_ptr -> tx_block_pool_block_size) - ((ULONG) TX_BLOCK_BUFFER_HEADER_SIZE);
+        new_buffer -> tx_block_buffer_length =           ((ULONG) 0);
+
+        /* The caller holds the only reference.  */
+        new_buffer -> tx_block_buffer_reference_count =  ((UINT) 1);
+
+        /* Set the buffer ID to indicate the buffer is valid.  */
+        new_buffer -> tx_block_buffer_id =               TX_BLOCK_BUFFER_ID;
+
+        /* Return the buffer.  */
+        *buffer_ptr =  new_buffer;
+    }
+    else
+    {
+
+        /* No buffer was allocated.  */
+        *buffer_ptr =  TX_NULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_buffer_receive                            PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives a buffer sent with tx_block_buffer_send from */
+/*    the specified queue.  The caller then holds the reference the       */
+/*    sender passed with the buffer, and releases it with                 */
+/*    tx_block_buffer_release.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    buffer_ptr                        Pointer to place received buffer  */
+/*                                        pointer                         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_buffer_receive(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER **buffer_ptr, ULONG wait_option)
+{
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+UINT                status;
+
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+
+    /* Disable interrupts only to insert this event into the trace buffer and
+       log this kernel call.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_BUFFER_RECEIVE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(buffer_ptr), wait_option, queue_ptr -> tx_queue_enqueued, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_BUFFER_RECEIVE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+
+    /* Receive the buffer pointer directly into the destination.  */
+    status =  _tx_queue_receive(queue_ptr, (VOID *) buffer_ptr, wait_option);
+
+    /* Determine if a buffer was received.  */
+    if (status != TX_SUCCESS)
+    {
+
+        /* No, clear the destination.  */
+        *buffer_ptr =  TX_NULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
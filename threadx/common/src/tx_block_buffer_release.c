@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_buffer_release                            PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases a reference to the specified buffer.  When   */
+/*    the last reference is released, the buffer is invalidated and its   */
+/*    block is returned to its pool, which may resume a thread waiting    */
+/*    for a block.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    buffer_ptr                        Pointer to buffer control block   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_release                 Release a memory block            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_buffer_release(TX_BLOCK_BUFFER *buffer_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UINT                reference_count;
+
+
+    /* Disable interrupts to update the reference count.  */
+    TX_DISABLE
+
+    /* Remove the reference.  */
+    buffer_ptr -> tx_block_buffer_reference_count--;
+    reference_count =  buffer_ptr -> tx_block_buffer_reference_count;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_BUFFER_RELEASE, buffer_ptr, reference_count, 0, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_BUFFER_RELEASE_INSERT
+
+    /* Determine if this was the last reference.  */
+    if (reference_count == ((UINT) 0))
+    {
+
+        /* Yes, clear the buffer ID to make it invalid.  */
+        buffer_ptr -> tx_block_buffer_id =  TX_CLEAR_ID;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if the block goes back to its pool.  */
+    if (reference_count == ((UINT) 0))
+    {
+
+        /* Yes, release the block of the buffer.  */
+        status =  _tx_block_release((VOID *) buffer_ptr);
+    }
+    else
+    {
+
+        /* Other references remain.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
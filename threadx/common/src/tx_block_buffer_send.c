@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_buffer_send                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends the specified buffer to a queue without copying */
+/*    its data.  The message is the buffer pointer itself, so the queue   */
+/*    must have been created with messages of                             */
+/*    TX_BLOCK_BUFFER_MESSAGE_SIZE.  If the send is successful, the       */
+/*    caller's reference moves to the receiver of the message.            */
+/*    Otherwise, the caller still holds it.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    buffer_ptr                        Pointer to buffer control block   */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_send                    Send message to queue             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_buffer_send(TX_QUEUE *queue_ptr, TX_BLOCK_BUFFER *buffer_ptr, ULONG wait_option)
+{
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+UINT                status;
+
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+
+    /* Disable interrupts only to insert this event into the trace buffer and
+       log this kernel call.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_BUFFER_SEND, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(buffer_ptr), wait_option, buffer_ptr -> tx_block_buffer_reference_count, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_BUFFER_SEND_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+
+    /* Send the buffer pointer as the message.  */
+    status =  _tx_queue_send(queue_ptr, (VOID *) &buffer_ptr, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -72,6 +72,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            lock-free block pool        */
+/*                                            option                      */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_block_pool_create(TX_BLOCK_POOL *pool_ptr, CHAR *name_ptr, ULONG block_size,
@@ -84,8 +87,14 @@ UINT                blocks;
 UINT                status;
 ULONG               total_blocks;
 UCHAR               *block_ptr;
-UCHAR               **block_link_ptr;
 UCHAR               *next_block_ptr;
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+ULONG               *next_position_ptr;
+TX_BLOCK_POOL_TAGGED_HEAD
+                    max_blocks;
+#else
+UCHAR               **block_link_ptr;
+#endif
 TX_BLOCK_POOL       *next_pool;
 TX_BLOCK_POOL       *previous_pool;
 
@@ -110,6 +119,19 @@ TX_BLOCK_POOL       *previous_pool;
     /* Calculate the total number of blocks.  */
     total_blocks =  pool_size/(block_size + (sizeof(UCHAR *)));
 
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+    /* Limit the number of blocks to the positions the available list head can hold.  */
+    max_blocks =  (((TX_BLOCK_POOL_TAGGED_POSITION_MASK - ((TX_BLOCK_POOL_TAGGED_HEAD) 1)) * (sizeof(ULONG))) /
+                        (block_size + (sizeof(UCHAR *)))) + ((TX_BLOCK_POOL_TAGGED_HEAD) 1);
+    if (((TX_BLOCK_POOL_TAGGED_HEAD) total_blocks) > max_blocks)
+    {
+
+        /* Leave the rest of the pool area unused.  */
+        total_blocks =  (ULONG) max_blocks;
+    }
+#endif
+
     /* Walk through the pool area, setting up the available block list.  */
     blocks =            ((UINT) 0);
     block_ptr =         TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
@@ -120,9 +142,17 @@ TX_BLOCK_POOL       *previous_pool;
         /* Yes, we have another block.  Increment the block count.  */
         blocks++;
 
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+        /* Setup the link to the next block, which is its position.  */
+        next_position_ptr =   TX_VOID_TO_ULONG_POINTER_CONVERT(block_ptr);
+        *next_position_ptr =  (TX_UCHAR_POINTER_DIF(next_block_ptr, pool_start) / (sizeof(ULONG))) + ((ULONG) 1);
+#else
+
         /* Setup the link to the next block.  */
         block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
         *block_link_ptr =  next_block_ptr;
+#endif
 
         /* Advance to the next block.  */
         block_ptr =   next_block_ptr;
@@ -142,12 +172,23 @@ TX_BLOCK_POOL       *previous_pool;
         /* Backup to the last block in the pool.  */
         block_ptr =  TX_UCHAR_POINTER_SUB(block_ptr,(block_size + (sizeof(UCHAR *))));
 
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+        /* Set the last block's link to the position of an empty list.  */
+        next_position_ptr =   TX_VOID_TO_ULONG_POINTER_CONVERT(block_ptr);
+        *next_position_ptr =  ((ULONG) 0);
+
+        /* Setup the available list head at the first block, with the first tag.  */
+        pool_ptr -> tx_block_pool_available_list =  ((TX_BLOCK_POOL_TAGGED_HEAD) 1);
+#else
+
         /* Set the last block's forward pointer to NULL.  */
         block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
         *block_link_ptr =  TX_NULL;
 
         /* Setup the starting pool address.  */
         pool_ptr -> tx_block_pool_available_list =  TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+#endif
 
         /* Disable interrupts to place the block pool on the created list.  */
         TX_DISABLE
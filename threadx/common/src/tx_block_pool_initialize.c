@@ -43,6 +43,16 @@ TX_BLOCK_POOL *  _tx_block_pool_created_ptr;
 ULONG            _tx_block_pool_created_count;
 
 
+/* Define the head pointer of the created block slab list.  */
+
+TX_BLOCK_SLAB *  _tx_block_slab_created_ptr;
+
+
+/* Define the variable that holds the number of created block slabs. */
+
+ULONG            _tx_block_slab_created_count;
+
+
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of block allocates.  */
@@ -80,7 +90,7 @@ ULONG            _tx_block_pool_performance_timeout_count;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function initializes the various control data structures for   */
-/*    the block pool component.                                           */
+/*    the block pool component, including the list of block slabs.        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -108,6 +118,8 @@ ULONG            _tx_block_pool_performance_timeout_count;
 /*                                            TX_INLINE_INITIALIZATION is */
 /*                                            defined,                    */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            block slabs                 */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_block_pool_initialize(VOID)
@@ -120,6 +132,11 @@ VOID  _tx_block_pool_initialize(VOID)
     _tx_block_pool_created_ptr =        TX_NULL;
     _tx_block_pool_created_count =      TX_EMPTY;
 
+    /* Initialize the head pointer of the created block slabs list and the
+       number of block slabs created.  */
+    _tx_block_slab_created_ptr =        TX_NULL;
+    _tx_block_slab_created_count =      TX_EMPTY;
+
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 
     /* Initialize block pool performance counters.  */
@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_pop                        PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes the first block off the available list of a     */
+/*    pool that is built with TX_BLOCK_POOL_LOCK_FREE, with a single      */
+/*    compare and exchange of the tagged list head in the common case.    */
+/*    The tag changes with every update of the head, so a head that was   */
+/*    popped and pushed again in the meantime is not mistaken for the one */
+/*    read.  Interrupts need not be disabled.  The link of the block      */
+/*    returned still holds the position of the next block, the caller     */
+/*    stores the pool pointer there.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    work_ptr                          Pointer to the block's link, or   */
+/*                                        NULL if the pool is empty       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate a memory block           */
+/*    _tx_block_allocate_n              Allocate multiple memory blocks   */
+/*    _tx_block_release                 Release a memory block            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+UCHAR  *_tx_block_pool_lock_free_pop(TX_BLOCK_POOL *pool_ptr)
+{
+
+TX_BLOCK_POOL_TAGGED_HEAD   head;
+TX_BLOCK_POOL_TAGGED_HEAD   new_head;
+ULONG                       position;
+ULONG                       *next_position_ptr;
+UCHAR                       *work_ptr;
+UINT                        done;
+
+
+    /* Pickup the current head of the available list.  */
+    head =  TX_BLOCK_POOL_TAGGED_HEAD_LOAD(&(pool_ptr -> tx_block_pool_available_list));
+
+    /* Loop until the list is found empty or the first block is taken.  */
+    do
+    {
+
+        /* Pickup the position of the first available block.  */
+        position =  (ULONG) (head & TX_BLOCK_POOL_TAGGED_POSITION_MASK);
+
+        /* Determine if the list is empty.  */
+        if (position == ((ULONG) 0))
+        {
+
+            /* Yes, there is no block to return.  */
+            work_ptr =  TX_NULL;
+            done =      TX_TRUE;
+        }
+        else
+        {
+
+            /* Calculate the address of the block.  */
+            work_ptr =  TX_UCHAR_POINTER_ADD(pool_ptr -> tx_block_pool_start, ((position - ((ULONG) 1)) * (sizeof(ULONG))));
+
+            /* Build the new head from the next block's position and the next tag.  The
+               block may be taken by someone else at this point, in which case the position
+               read is meaningless but the exchange below fails.  */
+            next_position_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(work_ptr);
+            new_head =           ((head & (~TX_BLOCK_POOL_TAGGED_POSITION_MASK)) + TX_BLOCK_POOL_TAGGED_INCREMENT) |
+                                     ((TX_BLOCK_POOL_TAGGED_HEAD) (*next_position_ptr));
+
+            /* Replace the head if it is unchanged, otherwise retry with the head read.  */
+            if (TX_BLOCK_POOL_TAGGED_HEAD_CAS(&(pool_ptr -> tx_block_pool_available_list), &head, new_head))
+            {
+
+                /* The block is taken.  Decrement the available count.  */
+                TX_BLOCK_POOL_ATOMIC_SUB(&(pool_ptr -> tx_block_pool_available), ((UINT) 1))
+
+                /* The block is the caller's now.  */
+                done =  TX_TRUE;
+            }
+            else
+            {
+
+                /* The head was changed in the meantime, try again.  */
+                done =  TX_FALSE;
+            }
+        }
+    } while (done == TX_FALSE);
+
+    /* Return the block's link.  */
+    return(work_ptr);
+}
+#endif
+
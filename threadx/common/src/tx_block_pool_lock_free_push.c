@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_pool_lock_free_push                       PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a block at the front of the available list of  */
+/*    a pool that is built with TX_BLOCK_POOL_LOCK_FREE, with a single    */
+/*    compare and exchange of the tagged list head in the common case.    */
+/*    Interrupts need not be disabled.  The available count is            */
+/*    incremented before the block is placed on the list, so it never     */
+/*    falls below the number of blocks on the list.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the block's link       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_block_release                 Release a memory block            */
+/*    _tx_block_release_n               Release multiple memory blocks    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+VOID  _tx_block_pool_lock_free_push(TX_BLOCK_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+TX_BLOCK_POOL_TAGGED_HEAD   head;
+TX_BLOCK_POOL_TAGGED_HEAD   new_head;
+ULONG                       position;
+ULONG                       *next_position_ptr;
+UINT                        done;
+
+
+    /* Calculate the position of the block.  */
+    position =  (TX_UCHAR_POINTER_DIF(block_ptr, pool_ptr -> tx_block_pool_start) / (sizeof(ULONG))) + ((ULONG) 1);
+
+    /* Increment the count of available blocks.  */
+    TX_BLOCK_POOL_ATOMIC_ADD(&(pool_ptr -> tx_block_pool_available), ((UINT) 1))
+
+    /* Pickup the current head of the available list.  */
+    next_position_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(block_ptr);
+    head =               TX_BLOCK_POOL_TAGGED_HEAD_LOAD(&(pool_ptr -> tx_block_pool_available_list));
+
+    /* Loop until the block is placed at the front of the list.  */
+    do
+    {
+
+        /* Link the block to the current first block.  */
+        *next_position_ptr =  (ULONG) (head & TX_BLOCK_POOL_TAGGED_POSITION_MASK);
+
+        /* Build the new head from the block's position and the next tag.  */
+        new_head =  ((head & (~TX_BLOCK_POOL_TAGGED_POSITION_MASK)) + TX_BLOCK_POOL_TAGGED_INCREMENT) |
+                        ((TX_BLOCK_POOL_TAGGED_HEAD) position);
+
+        /* Replace the head if it is unchanged, otherwise retry with the head read.  */
+        if (TX_BLOCK_POOL_TAGGED_HEAD_CAS(&(pool_ptr -> tx_block_pool_available_list), &head, new_head))
+        {
+
+            /* The block is on the list.  */
+            done =  TX_TRUE;
+        }
+        else
+        {
+
+            /* The head was changed in the meantime, try again.  */
+            done =  TX_FALSE;
+        }
+    } while (done == TX_FALSE);
+}
+#endif
+
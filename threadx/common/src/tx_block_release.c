@@ -44,7 +44,9 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function returns a previously allocated block to its           */
-/*    associated memory block pool.                                       */
+/*    associated memory block pool.  When TX_BLOCK_POOL_LOCK_FREE is      */
+/*    defined and no thread waits for a block of the pool, the block is   */
+/*    returned without disabling interrupts.                              */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -56,6 +58,10 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_block_pool_lock_free_pop      Take a block off the available    */
+/*                                        list                            */
+/*    _tx_block_pool_lock_free_push     Place a block on the available    */
+/*                                        list                            */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*                                                                        */
@@ -70,6 +76,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            lock-free block pool        */
+/*                                            option                      */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_block_release(VOID *block_ptr)
@@ -85,11 +94,9 @@ UCHAR               **next_block_ptr;
 UINT                suspended_count;
 TX_THREAD           *next_thread;
 TX_THREAD           *previous_thread;
+UINT                status;
 
 
-    /* Disable interrupts to put this block back in the pool.  */
-    TX_DISABLE
-
     /* Pickup the pool pointer which is just previous to the starting
        address of the block that the caller sees.  */
     work_ptr =        TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
@@ -97,110 +104,210 @@ TX_THREAD           *previous_thread;
     next_block_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
     pool_ptr =        TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT((*next_block_ptr));
 
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
 #ifdef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
 
     /* Increment the total releases counter.  */
-    _tx_block_pool_performance_release_count++;
+    TX_BLOCK_POOL_ATOMIC_ADD(&_tx_block_pool_performance_release_count, ((ULONG) 1))
 
     /* Increment the number of releases on this pool.  */
-    pool_ptr -> tx_block_pool_performance_release_count++;
+    TX_BLOCK_POOL_ATOMIC_ADD(&(pool_ptr -> tx_block_pool_performance_release_count), ((ULONG) 1))
 #endif
 
-    /* If trace is enabled, insert this event into the trace buffer.  */
-    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_RELEASE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(block_ptr), pool_ptr -> tx_block_pool_suspended_count, TX_POINTER_TO_ULONG_CONVERT(&work_ptr), TX_TRACE_BLOCK_POOL_EVENTS)
+#ifdef TX_ENABLE_EVENT_TRACE
 
-    /* Log this kernel call.  */
-    TX_EL_BLOCK_RELEASE_INSERT
-
-    /* Determine if there are any threads suspended on the block pool.  */
-    thread_ptr =  pool_ptr -> tx_block_pool_suspension_list;
-    if (thread_ptr != TX_NULL)
+    /* Determine if trace is enabled.  */
+    if (_tx_trace_buffer_current_ptr != TX_NULL)
     {
 
-        /* Remove the suspended thread from the list.  */
+        /* Yes, disable interrupts only to insert this event into the trace buffer.  */
+        TX_DISABLE
 
-        /* Decrement the number of threads suspended.  */
-        (pool_ptr -> tx_block_pool_suspended_count)--;
+        /* Insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_RELEASE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(block_ptr), pool_ptr -> tx_block_pool_suspended_count, TX_POINTER_TO_ULONG_CONVERT(&work_ptr), TX_TRACE_BLOCK_POOL_EVENTS)
 
-        /* Pickup the suspended count.  */
-        suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+#endif
 
-        /* See if this is the only suspended thread on the list.  */
-        if (suspended_count == TX_NO_SUSPENSIONS)
-        {
+    /* Determine if any thread waits for a block of this pool.  */
+    if (TX_BLOCK_POOL_ATOMIC_LOAD(&(pool_ptr -> tx_block_pool_suspended_count)) == TX_NO_SUSPENSIONS)
+    {
+
+        /* No, put the block back in the available list without disabling interrupts.  */
+        _tx_block_pool_lock_free_push(pool_ptr, work_ptr);
 
-            /* Yes, the only suspended thread.  */
+        /* Determine if a thread has started to wait in the meantime.  Such a thread
+           checks the available list again after it is counted, so either the thread
+           or this release sees the block.  */
+        if (TX_BLOCK_POOL_ATOMIC_LOAD(&(pool_ptr -> tx_block_pool_suspended_count)) == TX_NO_SUSPENSIONS)
+        {
 
-            /* Update the head pointer.  */
-            pool_ptr -> tx_block_pool_suspension_list =  TX_NULL;
+            /* No, the block is released.  */
+            status =  TX_SUCCESS;
         }
         else
         {
 
-            /* At least one more thread is on the same expiration list.  */
+            /* Yes, take a block back for the waiting thread.  */
+            work_ptr =  _tx_block_pool_lock_free_pop(pool_ptr);
+            if (work_ptr == TX_NULL)
+            {
+
+                /* The block has been taken by someone else already.  */
+                status =  TX_SUCCESS;
+            }
+            else
+            {
+
+                /* Save the pool's address in the block again and give the block to the
+                   waiting thread with interrupts disabled.  */
+                next_block_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+                *next_block_ptr =  TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+                block_ptr =        TX_UCHAR_TO_VOID_POINTER_CONVERT(TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *))));
+                status =           TX_NOT_DONE;
+            }
+        }
+    }
+    else
+    {
+
+        /* Yes, give the block to the waiting thread with interrupts disabled.  */
+        status =  TX_NOT_DONE;
+    }
+#else
+
+    /* The block is released with interrupts disabled.  */
+    status =  TX_NOT_DONE;
+#endif
+
+    /* Determine if the block still has to be released with interrupts disabled.  */
+    if (status == TX_NOT_DONE)
+    {
 
-            /* Update the list head pointer.  */
-            next_thread =                                thread_ptr -> tx_thread_suspended_next;
-            pool_ptr -> tx_block_pool_suspension_list =  next_thread;
+        /* Disable interrupts to put this block back in the pool.  */
+        TX_DISABLE
 
-            /* Update the links of the adjacent threads.  */
-            previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
-            next_thread -> tx_thread_suspended_previous =  previous_thread;
-            previous_thread -> tx_thread_suspended_next =  next_thread;
-        }
+#if defined(TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO) && !defined(TX_BLOCK_POOL_LOCK_FREE)
 
-        /* Prepare for resumption of the first thread.  */
+        /* Increment the total releases counter.  */
+        _tx_block_pool_performance_release_count++;
 
-        /* Clear cleanup routine to avoid timeout.  */
-        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+        /* Increment the number of releases on this pool.  */
+        pool_ptr -> tx_block_pool_performance_release_count++;
+#endif
+
+#ifndef TX_BLOCK_POOL_LOCK_FREE
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_RELEASE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(block_ptr), pool_ptr -> tx_block_pool_suspended_count, TX_POINTER_TO_ULONG_CONVERT(&work_ptr), TX_TRACE_BLOCK_POOL_EVENTS)
+#endif
+
+        /* Log this kernel call.  */
+        TX_EL_BLOCK_RELEASE_INSERT
+
+        /* Determine if there are any threads suspended on the block pool.  */
+        thread_ptr =  pool_ptr -> tx_block_pool_suspension_list;
+        if (thread_ptr != TX_NULL)
+        {
 
-        /* Return this block pointer to the suspended thread waiting for
-           a block.  */
-        return_block_ptr =  TX_VOID_TO_INDIRECT_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
-        work_ptr =          TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
-        *return_block_ptr =  work_ptr;
+            /* Remove the suspended thread from the list.  */
 
-        /* Put return status into the thread control block.  */
-        thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+            /* Decrement the number of threads suspended.  */
+            (pool_ptr -> tx_block_pool_suspended_count)--;
+
+            /* Pickup the suspended count.  */
+            suspended_count =  (pool_ptr -> tx_block_pool_suspended_count);
+
+            /* See if this is the only suspended thread on the list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                pool_ptr -> tx_block_pool_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same expiration list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                                thread_ptr -> tx_thread_suspended_next;
+                pool_ptr -> tx_block_pool_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+            }
+
+            /* Prepare for resumption of the first thread.  */
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Return this block pointer to the suspended thread waiting for
+               a block.  */
+            return_block_ptr =  TX_VOID_TO_INDIRECT_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            work_ptr =          TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr);
+            *return_block_ptr =  work_ptr;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
 
 #ifdef TX_NOT_INTERRUPTABLE
 
-        /* Resume the thread!  */
-        _tx_thread_system_ni_resume(thread_ptr);
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
 
-        /* Restore interrupts.  */
-        TX_RESTORE
+            /* Restore interrupts.  */
+            TX_RESTORE
 #else
 
-        /* Temporarily disable preemption.  */
-        _tx_thread_preempt_disable++;
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
 
-        /* Restore interrupts.  */
-        TX_RESTORE
+            /* Restore interrupts.  */
+            TX_RESTORE
 
-        /* Resume thread.  */
-        _tx_thread_system_resume(thread_ptr);
+            /* Resume thread.  */
+            _tx_thread_system_resume(thread_ptr);
 #endif
-    }
-    else
-    {
+        }
+        else
+        {
+
+            /* No thread is suspended for a memory block.  */
 
-        /* No thread is suspended for a memory block.  */
+#ifdef TX_BLOCK_POOL_LOCK_FREE
 
-        /* Put the block back in the available list.  */
-        *next_block_ptr =  pool_ptr -> tx_block_pool_available_list;
+            /* Put the block back in the available list.  */
+            _tx_block_pool_lock_free_push(pool_ptr, work_ptr);
+#else
 
-        /* Adjust the head pointer.  */
-        pool_ptr -> tx_block_pool_available_list =  work_ptr;
+            /* Put the block back in the available list.  */
+            *next_block_ptr =  pool_ptr -> tx_block_pool_available_list;
 
-        /* Increment the count of available blocks.  */
-        pool_ptr -> tx_block_pool_available++;
+            /* Adjust the head pointer.  */
+            pool_ptr -> tx_block_pool_available_list =  work_ptr;
 
-        /* Restore interrupts.  */
-        TX_RESTORE
+            /* Increment the count of available blocks.  */
+            pool_ptr -> tx_block_pool_available++;
+#endif
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+
+        /* The block is released.  */
+        status =  TX_SUCCESS;
     }
 
     /* Return successful completion status.  */
-    return(TX_SUCCESS);
+    return(status);
 }
 
@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_slab_allocate                             PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block from the smallest size class of the */
+/*    block slab whose blocks hold the requested number of bytes.  If the */
+/*    class is exhausted and the slab was created with the spill option,  */
+/*    the block is taken from the next larger class that has one          */
+/*    available.  Otherwise, or if no larger class has a block either,    */
+/*    the caller waits on the smallest fitting class as specified by the  */
+/*    wait option.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slab_ptr                          Pointer to slab control block     */
+/*    block_ptr                         Pointer to place allocated block  */
+/*                                        pointer                         */
+/*    memory_size                       Number of bytes requested         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate a block of a class       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_slab_allocate(TX_BLOCK_SLAB *slab_ptr, VOID **block_ptr, ULONG memory_size, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UINT                class_count;
+UINT                class_index;
+UINT                spill_index;
+
+
+    /* Find the smallest class whose blocks hold the requested size.  */
+    class_count =  slab_ptr -> tx_block_slab_class_count;
+    class_index =  ((UINT) 0);
+    while (class_index < class_count)
+    {
+
+        /* Is the block size of this class large enough?  */
+        if (memory_size <= ((ULONG) slab_ptr -> tx_block_slab_pool[class_index].tx_block_pool_block_size))
+        {
+
+            /* Yes, this is the class to allocate from.  */
+            break;
+        }
+
+        /* Move to the next class.  */
+        class_index++;
+    }
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+
+    /* Disable interrupts only to insert this event into the trace buffer and
+       log this kernel call.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_SLAB_ALLOCATE, slab_ptr, memory_size, wait_option, class_index, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_SLAB_ALLOCATE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+
+    /* Determine if any class holds the requested size.  */
+    if (class_index == class_count)
+    {
+
+        /* No, the request is larger than the largest class.  */
+        status =  TX_NO_MEMORY;
+    }
+
+    /* Determine if the slab spills to larger classes.  */
+    else if (slab_ptr -> tx_block_slab_spill == TX_BLOCK_SLAB_NO_SPILL)
+    {
+
+        /* No, simply allocate from the class.  */
+        status =  _tx_block_allocate(&(slab_ptr -> tx_block_slab_pool[class_index]), block_ptr, wait_option);
+    }
+    else
+    {
+
+        /* Try the class and then each larger class without waiting.  */
+        status =       TX_NO_MEMORY;
+        spill_index =  class_index;
+        while (spill_index < class_count)
+        {
+
+            /* Try to allocate from this class.  */
+            status =  _tx_block_allocate(&(slab_ptr -> tx_block_slab_pool[spill_index]), block_ptr, TX_NO_WAIT);
+
+            /* Was a block available?  */
+            if (status == TX_SUCCESS)
+            {
+
+                /* Yes, done.  */
+                break;
+            }
+
+            /* Move to the next class.  */
+            spill_index++;
+        }
+
+        /* Determine if a block was allocated.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Determine if the block was taken from a larger class.  */
+            if (spill_index != class_index)
+            {
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Yes, count the spill of the class.  */
+                slab_ptr -> tx_block_slab_spill_count[class_index]++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+        }
+
+        /* Determine if the caller may wait.  */
+        else if (wait_option != TX_NO_WAIT)
+        {
+
+            /* Yes, wait for a block of the smallest fitting class.  */
+            status =  _tx_block_allocate(&(slab_ptr -> tx_block_slab_pool[class_index]), block_ptr, wait_option);
+        }
+        else
+        {
+
+            /* No block is available, the status is already TX_NO_MEMORY.  */
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
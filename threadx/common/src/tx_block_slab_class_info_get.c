@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_slab_class_info_get                       PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the block size and the occupancy of one     */
+/*    size class of the specified block slab.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slab_ptr                          Pointer to slab control block     */
+/*    class_index                       Index of the size class, 0 being  */
+/*                                        the smallest                    */
+/*    block_size                        Destination for the block size    */
+/*    available_blocks                  Number of free blocks in class    */
+/*    total_blocks                      Total number of blocks in class   */
+/*    spills                            Number of allocations for the     */
+/*                                        class taken from a larger class */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_slab_class_info_get(TX_BLOCK_SLAB *slab_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *available_blocks, ULONG *total_blocks, ULONG *spills)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BLOCK_POOL       *pool_ptr;
+
+
+    /* Pickup the block pool of the class.  */
+    pool_ptr =  &(slab_ptr -> tx_block_slab_pool[class_index]);
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_SLAB_CLASS_INFO_GET, slab_ptr, class_index, 0, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_SLAB_CLASS_INFO_GET_INSERT
+
+    /* Retrieve the block size of the class.  */
+    if (block_size != TX_NULL)
+    {
+
+        *block_size =  (ULONG) pool_ptr -> tx_block_pool_block_size;
+    }
+
+    /* Retrieve the number of available blocks in the class.  */
+    if (available_blocks != TX_NULL)
+    {
+
+        *available_blocks =  (ULONG) pool_ptr -> tx_block_pool_available;
+    }
+
+    /* Retrieve the total number of blocks in the class.  */
+    if (total_blocks != TX_NULL)
+    {
+
+        *total_blocks =  (ULONG) pool_ptr -> tx_block_pool_total;
+    }
+
+    /* Retrieve the number of allocations of the class taken from a larger class.  */
+    if (spills != TX_NULL)
+    {
+
+        *spills =  slab_ptr -> tx_block_slab_spill_count[class_index];
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
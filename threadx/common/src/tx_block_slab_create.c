@@ -0,0 +1,212 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_slab_create                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a block slab, which splits the specified      */
+/*    memory area evenly into one block pool for each size class.  The    */
+/*    block sizes of the classes are taken from the specified array in    */
+/*    ascending order, or, if the array is NULL, start at                 */
+/*    TX_BLOCK_SLAB_MIN_SIZE bytes and double for each class.  Blocks     */
+/*    allocated from the slab are released with tx_block_release.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slab_ptr                          Pointer to slab control block     */
+/*    name_ptr                          Pointer to block slab name        */
+/*    block_sizes                       Block size of each class, or NULL */
+/*                                        for power-of-two classes        */
+/*    class_count                       Number of size classes            */
+/*    pool_start                        Address of beginning of slab area */
+/*    pool_size                         Number of bytes in the block slab */
+/*    spill_option                      Allocate from the next class if a */
+/*                                        class is exhausted              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    status                            Block pool create status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_create             Create the pool of a class        */
+/*    _tx_block_pool_delete             Delete the pool of a class        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_slab_create(TX_BLOCK_SLAB *slab_ptr, CHAR *name_ptr, ULONG *block_sizes, UINT class_count,
+                    VOID *pool_start, ULONG pool_size, UINT spill_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+UINT                i;
+ULONG               block_size;
+ULONG               class_size;
+UCHAR               *class_start;
+TX_BLOCK_SLAB       *next_slab;
+TX_BLOCK_SLAB       *previous_slab;
+
+
+    /* Initialize block slab control block to all zeros.  */
+    TX_MEMSET(slab_ptr, 0, (sizeof(TX_BLOCK_SLAB)));
+
+    /* Setup the basic block slab fields.  */
+    slab_ptr -> tx_block_slab_name =         name_ptr;
+    slab_ptr -> tx_block_slab_class_count =  class_count;
+    slab_ptr -> tx_block_slab_spill =        spill_option;
+
+    /* Split the memory area evenly between the classes, keeping each part
+       evenly divisible by an ALIGN_TYPE.  */
+    class_size =  ((pool_size/((ULONG) class_count))/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+    /* Create the block pool of each class.  */
+    status =       TX_SUCCESS;
+    block_size =   TX_BLOCK_SLAB_MIN_SIZE;
+    class_start =  TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+    i =            ((UINT) 0);
+    while (i < class_count)
+    {
+
+        /* Determine if the block sizes are specified.  */
+        if (block_sizes != TX_NULL)
+        {
+
+            /* Yes, pickup the block size of this class.  */
+            block_size =  block_sizes[i];
+        }
+
+        /* Create the block pool of this class.  */
+        status =  _tx_block_pool_create(&(slab_ptr -> tx_block_slab_pool[i]), name_ptr, block_size,
+                                        class_start, class_size);
+
+        /* Check for an error.  */
+        if (status != TX_SUCCESS)
+        {
+
+            /* The part of the memory area is too small for one block.  */
+            break;
+        }
+
+        /* Move to the next class.  */
+        class_start =  TX_UCHAR_POINTER_ADD(class_start, class_size);
+        block_size =   block_size * ((ULONG) 2);
+        i++;
+    }
+
+    /* Determine if all the classes were created.  */
+    if (status != TX_SUCCESS)
+    {
+
+        /* No, delete the block pools of the classes created so far.  */
+        while (i != ((UINT) 0))
+        {
+
+            i--;
+            _tx_block_pool_delete(&(slab_ptr -> tx_block_slab_pool[i]));
+        }
+    }
+    else
+    {
+
+        /* Disable interrupts to place the block slab on the created list.  */
+        TX_DISABLE
+
+        /* Setup the block slab ID to make it valid.  */
+        slab_ptr -> tx_block_slab_id =  TX_BLOCK_SLAB_ID;
+
+        /* Place the block slab on the list of created block slabs.  First,
+           check for an empty list.  */
+        if (_tx_block_slab_created_count == TX_EMPTY)
+        {
+
+            /* The created block slab list is empty.  Add block slab to empty list.  */
+            _tx_block_slab_created_ptr =                  slab_ptr;
+            slab_ptr -> tx_block_slab_created_next =      slab_ptr;
+            slab_ptr -> tx_block_slab_created_previous =  slab_ptr;
+        }
+        else
+        {
+
+            /* This list is not NULL, add to the end of the list.  */
+            next_slab =      _tx_block_slab_created_ptr;
+            previous_slab =  next_slab -> tx_block_slab_created_previous;
+
+            /* Place the new block slab in the list.  */
+            next_slab -> tx_block_slab_created_previous =  slab_ptr;
+            previous_slab -> tx_block_slab_created_next =  slab_ptr;
+
+            /* Setup this block slab's created links.  */
+            slab_ptr -> tx_block_slab_created_previous =  previous_slab;
+            slab_ptr -> tx_block_slab_created_next =      next_slab;
+        }
+
+        /* Increment the created count.  */
+        _tx_block_slab_created_count++;
+
+        /* If trace is enabled, register this object.  */
+        TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_BLOCK_SLAB, slab_ptr, name_ptr, class_count, spill_option)
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_SLAB_CREATE, slab_ptr, TX_POINTER_TO_ULONG_CONVERT(pool_start), pool_size, class_count, TX_TRACE_BLOCK_POOL_EVENTS)
+
+        /* Log this kernel call.  */
+        TX_EL_BLOCK_SLAB_CREATE_INSERT
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
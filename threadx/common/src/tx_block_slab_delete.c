@@ -0,0 +1,139 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_slab_delete                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified block slab and the block pools  */
+/*    of its size classes.  All threads suspended on one of the classes   */
+/*    are resumed with the TX_DELETED status code.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slab_ptr                          Pointer to slab control block     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_delete             Delete the pool of a class        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_slab_delete(TX_BLOCK_SLAB *slab_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                i;
+TX_BLOCK_SLAB       *next_slab;
+TX_BLOCK_SLAB       *previous_slab;
+
+
+    /* Disable interrupts to remove the block slab from the created list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_SLAB_DELETE, slab_ptr, TX_POINTER_TO_ULONG_CONVERT(&next_slab), 0, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* If trace is enabled, unregister this object.  */
+    TX_TRACE_OBJECT_UNREGISTER(slab_ptr)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_SLAB_DELETE_INSERT
+
+    /* Clear the block slab ID to make it invalid.  */
+    slab_ptr -> tx_block_slab_id =  TX_CLEAR_ID;
+
+    /* Decrement the number of block slabs.  */
+    _tx_block_slab_created_count--;
+
+    /* See if the block slab is the only one on the list.  */
+    if (_tx_block_slab_created_count == TX_EMPTY)
+    {
+
+        /* Only created block slab, just set the created list to NULL.  */
+        _tx_block_slab_created_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_slab =                                    slab_ptr -> tx_block_slab_created_next;
+        previous_slab =                                slab_ptr -> tx_block_slab_created_previous;
+        next_slab -> tx_block_slab_created_previous =  previous_slab;
+        previous_slab -> tx_block_slab_created_next =  next_slab;
+
+        /* See if we have to update the created list head pointer.  */
+        if (_tx_block_slab_created_ptr == slab_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            _tx_block_slab_created_ptr =  next_slab;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Delete the block pool of each class, which resumes the threads
+       suspended on it.  */
+    for (i = ((UINT) 0); i < slab_ptr -> tx_block_slab_class_count; i++)
+    {
+
+        _tx_block_pool_delete(&(slab_ptr -> tx_block_slab_pool[i]));
+    }
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
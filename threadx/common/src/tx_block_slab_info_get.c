@@ -0,0 +1,139 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_block_slab_info_get                             PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified block slab.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slab_ptr                          Pointer to slab control block     */
+/*    name                              Destination for the slab name     */
+/*    class_count                       Number of size classes in slab    */
+/*    spills                            Number of allocations taken from  */
+/*                                        a larger class                  */
+/*    next_slab                         Destination for pointer to next   */
+/*                                        block slab on the created list  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_block_slab_info_get(TX_BLOCK_SLAB *slab_ptr, CHAR **name, ULONG *class_count,
+                    ULONG *spills, TX_BLOCK_SLAB **next_slab)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG               spill_count;
+UINT                i;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BLOCK_SLAB_INFO_GET, slab_ptr, 0, 0, 0, TX_TRACE_BLOCK_POOL_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BLOCK_SLAB_INFO_GET_INSERT
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the name of the block slab.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  slab_ptr -> tx_block_slab_name;
+    }
+
+    /* Retrieve the number of size classes of the block slab.  */
+    if (class_count != TX_NULL)
+    {
+
+        *class_count =  (ULONG) slab_ptr -> tx_block_slab_class_count;
+    }
+
+    /* Retrieve the number of allocations taken from a larger class.  */
+    if (spills != TX_NULL)
+    {
+
+        /* Add up the spills of all classes.  */
+        spill_count =  ((ULONG) 0);
+        for (i = ((UINT) 0); i < slab_ptr -> tx_block_slab_class_count; i++)
+        {
+
+            spill_count =  spill_count + slab_ptr -> tx_block_slab_spill_count[i];
+        }
+        *spills =  spill_count;
+    }
+
+    /* Retrieve the pointer to the next block slab created.  */
+    if (next_slab != TX_NULL)
+    {
+
+        *next_slab =  slab_ptr -> tx_block_slab_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,228 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_cleanup                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes broadcast timeout and thread terminate      */
+/*    actions that require the broadcast data structures to be cleaned    */
+/*    up.  The thread is either a publisher waiting for room or a         */
+/*    subscriber waiting for a message.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to suspended thread's     */
+/*                                        control block                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_timeout                Thread timeout processing         */
+/*    _tx_thread_terminate              Thread terminate processing       */
+/*    _tx_thread_wait_abort             Thread wait abort processing      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_broadcast_cleanup(TX_THREAD  *thread_ptr, ULONG suspension_sequence)
+{
+
+#ifndef TX_NOT_INTERRUPTABLE
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+TX_BROADCAST                *broadcast_ptr;
+TX_BROADCAST_SUBSCRIBER     *subscriber_ptr;
+TX_THREAD                   **suspension_list;
+UINT                        *suspended_count;
+TX_THREAD                   *next_thread;
+TX_THREAD                   *previous_thread;
+
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+    /* Disable interrupts to remove the suspended thread from the broadcast.  */
+    TX_DISABLE
+
+    /* Determine if the cleanup is still required.  */
+    if (thread_ptr -> tx_thread_suspend_cleanup == &(_tx_broadcast_cleanup))
+    {
+
+        /* Check for valid suspension sequence.  */
+        if (suspension_sequence == thread_ptr -> tx_thread_suspension_sequence)
+        {
+#endif
+
+            /* Determine if the thread is a publisher or a subscriber.  */
+            if (thread_ptr -> tx_thread_suspend_option == TX_TRUE)
+            {
+
+                /* A publisher, setup pointer to broadcast control block and its
+                   list of publishers waiting for room.  */
+                broadcast_ptr =    TX_VOID_TO_BROADCAST_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+                suspension_list =  &(broadcast_ptr -> tx_broadcast_publish_suspension_list);
+                suspended_count =  &(broadcast_ptr -> tx_broadcast_publish_suspended_count);
+            }
+            else
+            {
+
+                /* A subscriber, setup pointer to broadcast control block through the
+                   subscriber and its list of subscribers waiting for a message.  */
+                subscriber_ptr =   TX_VOID_TO_BROADCAST_SUBSCRIBER_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+                broadcast_ptr =    subscriber_ptr -> tx_broadcast_subscriber_broadcast;
+                suspension_list =  &(broadcast_ptr -> tx_broadcast_suspension_list);
+                suspended_count =  &(broadcast_ptr -> tx_broadcast_suspended_count);
+            }
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Is the broadcast ID valid?  */
+            if (broadcast_ptr -> tx_broadcast_id == TX_BROADCAST_ID)
+            {
+
+                /* Determine if there are any thread suspensions.  */
+                if (*suspended_count != TX_NO_SUSPENSIONS)
+                {
+#endif
+
+                    /* Yes, we still have thread suspension!  */
+
+                    /* Clear the suspension cleanup flag.  */
+                    thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                    /* Decrement the suspended count.  */
+                    *suspended_count =  *suspended_count - ((UINT) 1);
+
+                    /* Remove the suspended thread from the list.  */
+
+                    /* See if this is the only suspended thread on the list.  */
+                    if (*suspended_count == TX_NO_SUSPENSIONS)
+                    {
+
+                        /* Yes, the only suspended thread.  */
+
+                        /* Update the head pointer.  */
+                        *suspension_list =  TX_NULL;
+                    }
+                    else
+                    {
+
+                        /* At least one more thread is on the same suspension list.  */
+
+                        /* Update the links of the adjacent threads.  */
+                        next_thread =                                   thread_ptr -> tx_thread_suspended_next;
+                        previous_thread =                               thread_ptr -> tx_thread_suspended_previous;
+                        next_thread -> tx_thread_suspended_previous =   previous_thread;
+                        previous_thread -> tx_thread_suspended_next =   next_thread;
+
+                        /* Determine if we need to update the head pointer.  */
+                        if (*suspension_list == thread_ptr)
+                        {
+
+                            /* Update the list head pointer.  */
+                            *suspension_list =  next_thread;
+                        }
+                    }
+
+                    /* Now we need to determine if this cleanup is from a terminate, timeout,
+                       or from a wait abort.  */
+                    if (thread_ptr -> tx_thread_state == TX_QUEUE_SUSP)
+                    {
+
+                        /* Timeout condition and the thread still suspended on the broadcast.
+                           Setup return error status and resume the thread.  */
+
+                        /* Setup return status.  */
+                        if (thread_ptr -> tx_thread_suspend_option == TX_TRUE)
+                        {
+
+                            /* Broadcast full timeout!  */
+                            thread_ptr -> tx_thread_suspend_status =  TX_QUEUE_FULL;
+                        }
+                        else
+                        {
+
+                            /* Broadcast empty timeout!  */
+                            thread_ptr -> tx_thread_suspend_status =  TX_QUEUE_EMPTY;
+                        }
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                        /* Resume the thread!  */
+                        _tx_thread_system_ni_resume(thread_ptr);
+#else
+
+                        /* Temporarily disable preemption.  */
+                        _tx_thread_preempt_disable++;
+
+                        /* Restore interrupts.  */
+                        TX_RESTORE
+
+                        /* Resume the thread!  */
+                        _tx_thread_system_resume(thread_ptr);
+
+                        /* Disable interrupts.  */
+                        TX_DISABLE
+#endif
+                    }
+#ifndef TX_NOT_INTERRUPTABLE
+                }
+            }
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+}
+
@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_create                                PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a broadcast, which holds a ring of messages   */
+/*    of the specified size that is shared by all of its subscribers.     */
+/*    The number of messages in the ring is rounded down to a power of    */
+/*    two.  The overflow option selects what a publish does when the      */
+/*    slowest subscriber is a full ring behind.  The message area must be */
+/*    ULONG aligned.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*    name_ptr                          Pointer to broadcast name         */
+/*    message_size                      Size of each message in ULONGs    */
+/*    broadcast_start                   Starting address of the message   */
+/*                                        area                            */
+/*    broadcast_size                    Number of bytes in the message    */
+/*                                        area                            */
+/*    overflow_option                   TX_BROADCAST_BLOCK to wait for    */
+/*                                        the slowest subscriber, or      */
+/*                                        TX_BROADCAST_OVERWRITE to       */
+/*                                        overwrite its oldest message    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_create(TX_BROADCAST *broadcast_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *broadcast_start, ULONG broadcast_size, UINT overflow_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            capacity;
+ULONG           messages;
+TX_BROADCAST    *next_broadcast;
+TX_BROADCAST    *previous_broadcast;
+
+
+    /* Initialize broadcast control block to all zeros.  */
+    TX_MEMSET(broadcast_ptr, 0, (sizeof(TX_BROADCAST)));
+
+    /* Setup the basic broadcast fields.  */
+    broadcast_ptr -> tx_broadcast_name =             name_ptr;
+    broadcast_ptr -> tx_broadcast_message_size =     message_size;
+    broadcast_ptr -> tx_broadcast_overflow_option =  overflow_option;
+    broadcast_ptr -> tx_broadcast_start =            TX_VOID_TO_ULONG_POINTER_CONVERT(broadcast_start);
+
+    /* Calculate the number of messages that fit in the message area.  */
+    messages =  broadcast_size / (((ULONG) message_size) * ((ULONG) (sizeof(ULONG))));
+
+    /* Round the number of messages down to a power of two.  */
+    capacity =  ((UINT) 1);
+    while ((((ULONG) capacity) * ((ULONG) 2)) <= messages)
+    {
+
+        /* Double the capacity.  */
+        capacity =  capacity * ((UINT) 2);
+    }
+    broadcast_ptr -> tx_broadcast_capacity =  capacity;
+
+    /* Disable interrupts to put the broadcast on the created list.  */
+    TX_DISABLE
+
+    /* Setup the broadcast ID to make it valid.  */
+    broadcast_ptr -> tx_broadcast_id =  TX_BROADCAST_ID;
+
+    /* Place the broadcast on the list of created broadcasts.  First,
+       check for an empty list.  */
+    if (_tx_broadcast_created_count == TX_EMPTY)
+    {
+
+        /* The created broadcast list is empty.  Add broadcast to empty list.  */
+        _tx_broadcast_created_ptr =                       broadcast_ptr;
+        broadcast_ptr -> tx_broadcast_created_next =      broadcast_ptr;
+        broadcast_ptr -> tx_broadcast_created_previous =  broadcast_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_broadcast =      _tx_broadcast_created_ptr;
+        previous_broadcast =  next_broadcast -> tx_broadcast_created_previous;
+
+        /* Place the new broadcast in the list.  */
+        next_broadcast -> tx_broadcast_created_previous =  broadcast_ptr;
+        previous_broadcast -> tx_broadcast_created_next =  broadcast_ptr;
+
+        /* Setup this broadcast's created links.  */
+        broadcast_ptr -> tx_broadcast_created_previous =  previous_broadcast;
+        broadcast_ptr -> tx_broadcast_created_next =      next_broadcast;
+    }
+
+    /* Increment the created broadcast count.  */
+    _tx_broadcast_created_count++;
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_BROADCAST, broadcast_ptr, name_ptr, capacity, message_size)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BROADCAST_CREATE, broadcast_ptr, TX_POINTER_TO_ULONG_CONVERT(broadcast_start), capacity, message_size, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BROADCAST_CREATE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
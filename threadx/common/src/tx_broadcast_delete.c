@@ -0,0 +1,241 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_delete                                PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified broadcast.  Its subscribers are */
+/*    removed, and all threads suspended on the broadcast are resumed     */
+/*    with the TX_DELETED status code.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful broadcast delete       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_delete(TX_BROADCAST *broadcast_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD                   *thread_ptr;
+TX_THREAD                   *next_thread;
+UINT                        suspended_count;
+TX_BROADCAST_SUBSCRIBER     *subscriber_ptr;
+TX_BROADCAST                *next_broadcast;
+TX_BROADCAST                *previous_broadcast;
+UINT                        i;
+
+
+    /* Disable interrupts to remove the broadcast from the created list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BROADCAST_DELETE, broadcast_ptr, TX_POINTER_TO_ULONG_CONVERT(&thread_ptr), 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* If trace is enabled, unregister this object.  */
+    TX_TRACE_OBJECT_UNREGISTER(broadcast_ptr)
+
+    /* Log this kernel call.  */
+    TX_EL_BROADCAST_DELETE_INSERT
+
+    /* Clear the broadcast ID to make it invalid.  */
+    broadcast_ptr -> tx_broadcast_id =  TX_CLEAR_ID;
+
+    /* Decrement the number of created broadcasts.  */
+    _tx_broadcast_created_count--;
+
+    /* See if the broadcast is the only one on the list.  */
+    if (_tx_broadcast_created_count == TX_EMPTY)
+    {
+
+        /* Only created broadcast, just set the created list to NULL.  */
+        _tx_broadcast_created_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_broadcast =                                    broadcast_ptr -> tx_broadcast_created_next;
+        previous_broadcast =                                broadcast_ptr -> tx_broadcast_created_previous;
+        next_broadcast -> tx_broadcast_created_previous =   previous_broadcast;
+        previous_broadcast -> tx_broadcast_created_next =   next_broadcast;
+
+        /* See if we have to update the created list head pointer.  */
+        if (_tx_broadcast_created_ptr == broadcast_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            _tx_broadcast_created_ptr =  next_broadcast;
+        }
+    }
+
+    /* Remove all the subscribers, which makes them invalid.  */
+    subscriber_ptr =  broadcast_ptr -> tx_broadcast_subscriber_list;
+    for (i = ((UINT) 0); i < broadcast_ptr -> tx_broadcast_subscriber_count; i++)
+    {
+
+        /* Clear the subscriber ID and its broadcast.  */
+        subscriber_ptr -> tx_broadcast_subscriber_id =         TX_CLEAR_ID;
+        subscriber_ptr -> tx_broadcast_subscriber_broadcast =  TX_NULL;
+
+        /* Move to the next subscriber.  */
+        subscriber_ptr =  subscriber_ptr -> tx_broadcast_subscriber_next;
+    }
+    broadcast_ptr -> tx_broadcast_subscriber_list =   TX_NULL;
+    broadcast_ptr -> tx_broadcast_subscriber_count =  ((UINT) 0);
+
+    /* Temporarily disable preemption.  */
+    _tx_thread_preempt_disable++;
+
+    /* Pickup the suspension information.  The publishers waiting for room
+       follow the subscribers waiting for a message.  */
+    thread_ptr =       broadcast_ptr -> tx_broadcast_suspension_list;
+    suspended_count =  broadcast_ptr -> tx_broadcast_suspended_count;
+    if (broadcast_ptr -> tx_broadcast_publish_suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Determine if there are subscribers waiting for a message.  */
+        if (suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* No, just start with the first publisher.  */
+            thread_ptr =  broadcast_ptr -> tx_broadcast_publish_suspension_list;
+        }
+        else
+        {
+
+            /* Yes, link the last subscriber to the first publisher.  */
+            (thread_ptr -> tx_thread_suspended_previous) -> tx_thread_suspended_next =
+                                                        broadcast_ptr -> tx_broadcast_publish_suspension_list;
+        }
+        suspended_count =  suspended_count + broadcast_ptr -> tx_broadcast_publish_suspended_count;
+    }
+    broadcast_ptr -> tx_broadcast_suspension_list =          TX_NULL;
+    broadcast_ptr -> tx_broadcast_suspended_count =          TX_NO_SUSPENSIONS;
+    broadcast_ptr -> tx_broadcast_publish_suspension_list =  TX_NULL;
+    broadcast_ptr -> tx_broadcast_publish_suspended_count =  TX_NO_SUSPENSIONS;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Walk through the broadcast lists to resume any and all threads suspended
+       on this broadcast.  */
+    while (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Decrement the suspension count.  */
+        suspended_count--;
+
+        /* Lockout interrupts.  */
+        TX_DISABLE
+
+        /* Clear the cleanup pointer, this prevents the timeout from doing
+           anything.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Set the return status in the thread to TX_DELETED.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_DELETED;
+
+        /* Move the thread pointer ahead.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption again.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+
+        /* Move to next thread.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Release previous preempt disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_info_get                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified broadcast.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*    name                              Destination for the broadcast     */
+/*                                        name                            */
+/*    published                         Destination for the running count */
+/*                                        of messages published           */
+/*    subscriber_count                  Destination for the number of     */
+/*                                        subscribers                     */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on broadcast,  */
+/*                                        subscribers before publishers   */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_broadcast                    Destination for pointer to next   */
+/*                                        broadcast on the created list   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_info_get(TX_BROADCAST *broadcast_ptr, CHAR **name, ULONG *published, ULONG *subscriber_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BROADCAST **next_broadcast)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BROADCAST_INFO_GET, broadcast_ptr, 0, 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BROADCAST_INFO_GET_INSERT
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the name of the broadcast.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  broadcast_ptr -> tx_broadcast_name;
+    }
+
+    /* Retrieve the running count of messages published.  */
+    if (published != TX_NULL)
+    {
+
+        *published =  broadcast_ptr -> tx_broadcast_write_index;
+    }
+
+    /* Retrieve the number of subscribers.  */
+    if (subscriber_count != TX_NULL)
+    {
+
+        *subscriber_count =  (ULONG) broadcast_ptr -> tx_broadcast_subscriber_count;
+    }
+
+    /* Retrieve the first thread suspended on this broadcast.  */
+    if (first_suspended != TX_NULL)
+    {
+
+        /* Determine if there are subscribers waiting for a message.  */
+        if (broadcast_ptr -> tx_broadcast_suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            *first_suspended =  broadcast_ptr -> tx_broadcast_suspension_list;
+        }
+        else
+        {
+
+            *first_suspended =  broadcast_ptr -> tx_broadcast_publish_suspension_list;
+        }
+    }
+
+    /* Retrieve the number of threads suspended on this broadcast.  */
+    if (suspended_count != TX_NULL)
+    {
+
+        *suspended_count =  ((ULONG) broadcast_ptr -> tx_broadcast_suspended_count) +
+                            ((ULONG) broadcast_ptr -> tx_broadcast_publish_suspended_count);
+    }
+
+    /* Retrieve the pointer to the next broadcast created.  */
+    if (next_broadcast != TX_NULL)
+    {
+
+        *next_broadcast =  broadcast_ptr -> tx_broadcast_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_message_write                         PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a message in the next slot of the broadcast    */
+/*    ring and gives it to every subscriber waiting for a message, all of */
+/*    which have read every earlier message.  The waiting threads are     */
+/*    removed from the suspension list in one pass and returned in a list */
+/*    linked through their suspended next pointers, which ends with NULL, */
+/*    for the caller to resume.  This function is called with interrupts  */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*    source_ptr                        Pointer to the message            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    thread_ptr                        List of threads to resume         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_broadcast_publish             Publish a message                 */
+/*    _tx_broadcast_publish_resume      Resume publishers waiting for     */
+/*                                        room                            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+TX_THREAD  *_tx_broadcast_message_write(TX_BROADCAST *broadcast_ptr, VOID *source_ptr)
+{
+
+TX_THREAD                   *thread_ptr;
+TX_THREAD                   *resume_list;
+TX_BROADCAST_SUBSCRIBER     *subscriber_ptr;
+ULONG                       *message;
+ULONG                       *source;
+ULONG                       *destination;
+ULONG                       write_index;
+UINT                        size;
+UINT                        copy_size;
+
+
+    /* Pickup the message size and the running index of the new message.  */
+    size =         broadcast_ptr -> tx_broadcast_message_size;
+    write_index =  broadcast_ptr -> tx_broadcast_write_index;
+
+    /* Copy the message into its slot of the ring.  Note that the source and
+       destination pointers are incremented by the macro.  */
+    message =      TX_BROADCAST_MESSAGE(broadcast_ptr, write_index);
+    source =       TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+    destination =  message;
+    copy_size =    size;
+    TX_QUEUE_MESSAGE_COPY(source, destination, copy_size)
+
+    /* Publish the message.  */
+    write_index++;
+    broadcast_ptr -> tx_broadcast_write_index =  write_index;
+
+    /* Determine if there are subscribers waiting for a message.  */
+    resume_list =  TX_NULL;
+    if (broadcast_ptr -> tx_broadcast_suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Yes, take all of them from the suspension list, which ends with
+           NULL once the last thread no longer points to the first.  */
+        resume_list =                                            broadcast_ptr -> tx_broadcast_suspension_list;
+        thread_ptr =                                             resume_list -> tx_thread_suspended_previous;
+        thread_ptr -> tx_thread_suspended_next =                 TX_NULL;
+        broadcast_ptr -> tx_broadcast_suspension_list =          TX_NULL;
+        broadcast_ptr -> tx_broadcast_suspended_count =          TX_NO_SUSPENSIONS;
+
+        /* Give the message to each waiting subscriber.  */
+        thread_ptr =  resume_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* The subscriber has now read the new message.  */
+            subscriber_ptr =  TX_VOID_TO_BROADCAST_SUBSCRIBER_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+            subscriber_ptr -> tx_broadcast_subscriber_read_index =  write_index;
+
+            /* Copy the message to the thread's destination.  The copy counts
+               down its size, so each copy starts from the message size.  */
+            source =       message;
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            copy_size =    size;
+            TX_QUEUE_MESSAGE_COPY(source, destination, copy_size)
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Move to the next waiting subscriber.  */
+            thread_ptr =  thread_ptr -> tx_thread_suspended_next;
+        }
+    }
+
+    /* Return the list of threads to resume.  */
+    return(resume_list);
+}
+
@@ -0,0 +1,291 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_publish                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function publishes a message to every subscriber of the        */
+/*    broadcast by copying it once into the ring.  All the subscribers    */
+/*    waiting for a message receive it and are resumed in one pass.  If   */
+/*    the broadcast blocks and its slowest subscriber is a full ring      */
+/*    behind, the caller may suspend until there is room.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*    source_ptr                        Pointer to the message            */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_broadcast_message_write       Place message in broadcast ring   */
+/*    _tx_broadcast_room_check          Check for room in broadcast ring  */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_broadcast_publish            Error checking broadcast publish  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_publish(TX_BROADCAST *broadcast_ptr, VOID *source_ptr, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+UINT            suspended_count;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to publish the message.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BROADCAST_PUBLISH, broadcast_ptr, TX_POINTER_TO_ULONG_CONVERT(source_ptr), wait_option, broadcast_ptr -> tx_broadcast_subscriber_count, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BROADCAST_PUBLISH_INSERT
+
+    /* Determine if there is room in the ring.  */
+    if (_tx_broadcast_room_check(broadcast_ptr) == TX_TRUE)
+    {
+
+        /* Place the message in the ring and give it to the waiting subscribers.  */
+        thread_ptr =  _tx_broadcast_message_write(broadcast_ptr, source_ptr);
+
+        /* Determine if there are subscribers to resume.  */
+        if (thread_ptr == TX_NULL)
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* Temporarily disable preemption until all the subscribers are resumed.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Walk through the list of subscribers to resume.  */
+            while (thread_ptr != TX_NULL)
+            {
+
+                /* Get next pointer first.  */
+                next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(thread_ptr);
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#else
+
+                /* Disable preemption again.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupt posture.  */
+                TX_RESTORE
+
+                /* Resume the thread.  */
+                _tx_thread_system_resume(thread_ptr);
+#endif
+
+                /* Move next thread to current.  */
+                thread_ptr =  next_thread;
+            }
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Release thread preemption disable.  */
+            _tx_thread_preempt_disable--;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Check for preemption.  */
+            _tx_thread_system_preempt_check();
+        }
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_QUEUE_FULL;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_broadcast_cleanup);
+
+            /* Setup cleanup information, i.e. this broadcast control block, the
+               source pointer, and the publish flag.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) broadcast_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) source_ptr;
+            thread_ptr -> tx_thread_suspend_info =             ((ULONG) 0);
+            thread_ptr -> tx_thread_suspend_option =           TX_TRUE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Pickup the number of publishers waiting for room.  */
+            suspended_count =  broadcast_ptr -> tx_broadcast_publish_suspended_count;
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                broadcast_ptr -> tx_broadcast_publish_suspension_list =  thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =                 thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =             thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   broadcast_ptr -> tx_broadcast_publish_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            broadcast_ptr -> tx_broadcast_publish_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Otherwise, just return a queue full error message to the caller.  */
+        status =  TX_QUEUE_FULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,198 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_publish_resume                        PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function publishes the messages of the threads waiting for     */
+/*    room in the broadcast ring, in the order they suspended, for as     */
+/*    long as there is room.  Each publisher is resumed along with the    */
+/*    subscribers that were waiting for its message.  It is called with   */
+/*    interrupts enabled after a subscriber has read a message or has     */
+/*    gone away.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_broadcast_message_write       Place message in broadcast ring   */
+/*    _tx_broadcast_room_check          Check for room in broadcast ring  */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_broadcast_receive             Receive a message                 */
+/*    _tx_broadcast_unsubscribe         Remove a subscriber               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_broadcast_publish_resume(TX_BROADCAST *broadcast_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_THREAD       *resume_list;
+UINT            suspended_count;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Temporarily disable preemption until all the threads are resumed.  */
+    _tx_thread_preempt_disable++;
+
+    /* Loop to publish the messages of the waiting publishers while there is room.  */
+    while ((broadcast_ptr -> tx_broadcast_publish_suspended_count != TX_NO_SUSPENSIONS) &&
+           (_tx_broadcast_room_check(broadcast_ptr) == TX_TRUE))
+    {
+
+        /* Pickup the first waiting publisher.  */
+        thread_ptr =  broadcast_ptr -> tx_broadcast_publish_suspension_list;
+
+        /* Remove the thread from the suspension list.  */
+        suspended_count =  broadcast_ptr -> tx_broadcast_publish_suspended_count - ((UINT) 1);
+        if (suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* Yes, the only suspended thread.  */
+
+            /* Update the head pointer.  */
+            broadcast_ptr -> tx_broadcast_publish_suspension_list =  TX_NULL;
+        }
+        else
+        {
+
+            /* At least one more thread is on the same suspension list.  */
+
+            /* Update the list head pointer.  */
+            next_thread =                                             thread_ptr -> tx_thread_suspended_next;
+            broadcast_ptr -> tx_broadcast_publish_suspension_list =  next_thread;
+
+            /* Update the links of the adjacent threads.  */
+            previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+            next_thread -> tx_thread_suspended_previous =  previous_thread;
+            previous_thread -> tx_thread_suspended_next =  next_thread;
+        }
+
+        /* Decrement the suspension count.  */
+        broadcast_ptr -> tx_broadcast_publish_suspended_count =  suspended_count;
+
+        /* Publish the message, which gives it to the subscribers waiting for one.  */
+        resume_list =  _tx_broadcast_message_write(broadcast_ptr, thread_ptr -> tx_thread_additional_suspend_info);
+
+        /* Clear cleanup routine to avoid timeout.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Put return status into the thread control block.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+        /* Place the publisher in front of the subscribers to resume.  */
+        thread_ptr -> tx_thread_suspended_next =  resume_list;
+        resume_list =                             thread_ptr;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Walk through the list of threads to resume.  */
+        thread_ptr =  resume_list;
+        while (thread_ptr != TX_NULL)
+        {
+
+            /* Get next pointer first.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupt posture.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+
+            /* Move next thread to current.  */
+            thread_ptr =  next_thread;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+    }
+
+    /* Release thread preemption disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+}
+
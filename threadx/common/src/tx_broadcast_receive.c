@@ -0,0 +1,287 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_receive                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives the oldest message the subscriber has not    */
+/*    read from the broadcast ring.  If the broadcast overwrites and the  */
+/*    subscriber fell more than a full ring behind, the overwritten       */
+/*    messages are skipped and their number is returned.  If the          */
+/*    subscriber has read every message, the caller may suspend until a   */
+/*    message is published.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    subscriber_ptr                    Pointer to subscriber control     */
+/*                                        block                           */
+/*    destination_ptr                   Pointer to the destination of the */
+/*                                        message                         */
+/*    missed_count                      Destination for the number of     */
+/*                                        messages overwritten before     */
+/*                                        they were read, may be NULL     */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_broadcast_publish_resume      Resume publishers waiting for     */
+/*                                        room                            */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_broadcast_receive            Error checking broadcast receive  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_receive(TX_BROADCAST_SUBSCRIBER *subscriber_ptr, VOID *destination_ptr, ULONG *missed_count,
+                    ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BROADCAST    *broadcast_ptr;
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+ULONG           *source;
+ULONG           *destination;
+ULONG           write_index;
+ULONG           read_index;
+ULONG           missed;
+UINT            size;
+UINT            suspended_count;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS and no missed messages.  */
+    status =  TX_SUCCESS;
+    missed =  ((ULONG) 0);
+
+    /* Disable interrupts to receive message from the broadcast.  */
+    TX_DISABLE
+
+    /* Pickup the broadcast and the running indexes.  */
+    broadcast_ptr =  subscriber_ptr -> tx_broadcast_subscriber_broadcast;
+    write_index =    broadcast_ptr -> tx_broadcast_write_index;
+    read_index =     subscriber_ptr -> tx_broadcast_subscriber_read_index;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BROADCAST_RECEIVE, subscriber_ptr, TX_POINTER_TO_ULONG_CONVERT(destination_ptr), wait_option, (write_index - read_index), TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BROADCAST_RECEIVE_INSERT
+
+    /* Determine if there is a message the subscriber has not read.  */
+    if (write_index != read_index)
+    {
+
+        /* Determine if messages were overwritten before the subscriber read them.  */
+        if ((write_index - read_index) > ((ULONG) broadcast_ptr -> tx_broadcast_capacity))
+        {
+
+            /* Yes, skip to the oldest message in the ring.  */
+            missed =      (write_index - read_index) - ((ULONG) broadcast_ptr -> tx_broadcast_capacity);
+            read_index =  write_index - ((ULONG) broadcast_ptr -> tx_broadcast_capacity);
+        }
+
+        /* Copy the message.  Note that the source and destination pointers are
+           incremented by the macro.  */
+        source =       TX_BROADCAST_MESSAGE(broadcast_ptr, read_index);
+        destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
+        size =         broadcast_ptr -> tx_broadcast_message_size;
+        TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+        /* The subscriber has read the message.  */
+        subscriber_ptr -> tx_broadcast_subscriber_read_index =  read_index + ((ULONG) 1);
+
+        /* Determine if there are publishers waiting for room.  */
+        if (broadcast_ptr -> tx_broadcast_publish_suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* This subscriber may have been the slowest, publish the waiting messages
+               that now fit in the ring.  */
+            _tx_broadcast_publish_resume(broadcast_ptr);
+        }
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_QUEUE_EMPTY;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_broadcast_cleanup);
+
+            /* Setup cleanup information, i.e. the subscriber control block, the
+               destination pointer, and the receive flag.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) subscriber_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) destination_ptr;
+            thread_ptr -> tx_thread_suspend_info =             ((ULONG) 0);
+            thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Pickup the number of subscribers waiting for a message.  */
+            suspended_count =  broadcast_ptr -> tx_broadcast_suspended_count;
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                broadcast_ptr -> tx_broadcast_suspension_list =  thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =         thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =     thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   broadcast_ptr -> tx_broadcast_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            broadcast_ptr -> tx_broadcast_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Immediate return, return error completion.  */
+        status =  TX_QUEUE_EMPTY;
+    }
+
+    /* Determine if the number of missed messages is requested.  */
+    if (missed_count != TX_NULL)
+    {
+
+        /* Return the number of messages overwritten before they were read.  */
+        *missed_count =  missed;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
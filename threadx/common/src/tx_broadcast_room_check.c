@@ -0,0 +1,150 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_room_check                            PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function determines if a message can be published to the       */
+/*    broadcast.  A broadcast that overwrites always has room, otherwise  */
+/*    the slowest subscriber must be less than a full ring behind.  The   */
+/*    subscribers are only examined when the read index of the slowest    */
+/*    subscriber last found is a full ring behind, which updates it.      */
+/*    This function is called with interrupts disabled.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           A message can be published        */
+/*    TX_FALSE                          The ring is full                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_broadcast_publish             Publish a message                 */
+/*    _tx_broadcast_publish_resume      Resume publishers waiting for     */
+/*                                        room                            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_room_check(TX_BROADCAST *broadcast_ptr)
+{
+
+TX_BROADCAST_SUBSCRIBER     *subscriber_ptr;
+ULONG                       write_index;
+ULONG                       backlog;
+ULONG                       largest_backlog;
+UINT                        i;
+UINT                        status;
+
+
+    /* Pickup the running count of messages published.  */
+    write_index =  broadcast_ptr -> tx_broadcast_write_index;
+
+    /* Determine if the oldest message may be overwritten.  */
+    if (broadcast_ptr -> tx_broadcast_overflow_option == TX_BROADCAST_OVERWRITE)
+    {
+
+        /* Yes, there is always room.  */
+        status =  TX_TRUE;
+    }
+
+    /* Determine if the slowest subscriber last found is less than a full ring behind.  */
+    else if ((write_index - broadcast_ptr -> tx_broadcast_tail_index) < ((ULONG) broadcast_ptr -> tx_broadcast_capacity))
+    {
+
+        /* Yes, there is room.  */
+        status =  TX_TRUE;
+    }
+    else
+    {
+
+        /* Find the subscriber with the most unread messages.  */
+        largest_backlog =  ((ULONG) 0);
+        subscriber_ptr =   broadcast_ptr -> tx_broadcast_subscriber_list;
+        for (i = ((UINT) 0); i < broadcast_ptr -> tx_broadcast_subscriber_count; i++)
+        {
+
+            /* Calculate the number of messages this subscriber has not read.  */
+            backlog =  write_index - subscriber_ptr -> tx_broadcast_subscriber_read_index;
+            if (backlog > largest_backlog)
+            {
+
+                /* This is the slowest subscriber so far.  */
+                largest_backlog =  backlog;
+            }
+
+            /* Move to the next subscriber.  */
+            subscriber_ptr =  subscriber_ptr -> tx_broadcast_subscriber_next;
+        }
+
+        /* Remember the read index of the slowest subscriber.  */
+        broadcast_ptr -> tx_broadcast_tail_index =  write_index - largest_backlog;
+
+        /* Determine if the slowest subscriber is less than a full ring behind.  */
+        if (largest_backlog < ((ULONG) broadcast_ptr -> tx_broadcast_capacity))
+        {
+
+            /* Yes, there is room.  */
+            status =  TX_TRUE;
+        }
+        else
+        {
+
+            /* No, the ring is full.  */
+            status =  TX_FALSE;
+        }
+    }
+
+    /* Return the room status.  */
+    return(status);
+}
+
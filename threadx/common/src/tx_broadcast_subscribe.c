@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_subscribe                             PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a subscriber to the broadcast.  The subscriber   */
+/*    receives the messages published from now on.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*    subscriber_ptr                    Pointer to subscriber control     */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_subscribe(TX_BROADCAST *broadcast_ptr, TX_BROADCAST_SUBSCRIBER *subscriber_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BROADCAST_SUBSCRIBER     *next_subscriber;
+TX_BROADCAST_SUBSCRIBER     *previous_subscriber;
+
+
+    /* Disable interrupts to put the subscriber on the subscriber list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BROADCAST_SUBSCRIBE, broadcast_ptr, TX_POINTER_TO_ULONG_CONVERT(subscriber_ptr), broadcast_ptr -> tx_broadcast_subscriber_count, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BROADCAST_SUBSCRIBE_INSERT
+
+    /* Setup the subscriber to read the next message published.  */
+    subscriber_ptr -> tx_broadcast_subscriber_broadcast =   broadcast_ptr;
+    subscriber_ptr -> tx_broadcast_subscriber_read_index =  broadcast_ptr -> tx_broadcast_write_index;
+
+    /* Place the subscriber on the subscriber list of the broadcast.  First,
+       check for an empty list.  */
+    if (broadcast_ptr -> tx_broadcast_subscriber_count == ((UINT) 0))
+    {
+
+        /* The subscriber list is empty.  Add subscriber to empty list.  */
+        broadcast_ptr -> tx_broadcast_subscriber_list =        subscriber_ptr;
+        subscriber_ptr -> tx_broadcast_subscriber_next =       subscriber_ptr;
+        subscriber_ptr -> tx_broadcast_subscriber_previous =   subscriber_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_subscriber =      broadcast_ptr -> tx_broadcast_subscriber_list;
+        previous_subscriber =  next_subscriber -> tx_broadcast_subscriber_previous;
+
+        /* Place the new subscriber in the list.  */
+        next_subscriber -> tx_broadcast_subscriber_previous =  subscriber_ptr;
+        previous_subscriber -> tx_broadcast_subscriber_next =  subscriber_ptr;
+
+        /* Setup this subscriber's links.  */
+        subscriber_ptr -> tx_broadcast_subscriber_previous =  previous_subscriber;
+        subscriber_ptr -> tx_broadcast_subscriber_next =      next_subscriber;
+    }
+
+    /* Increment the number of subscribers.  */
+    broadcast_ptr -> tx_broadcast_subscriber_count++;
+
+    /* Setup the subscriber ID to make it valid.  */
+    subscriber_ptr -> tx_broadcast_subscriber_id =  TX_BROADCAST_SUBSCRIBER_ID;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
@@ -0,0 +1,261 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_broadcast_unsubscribe                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a subscriber from its broadcast.  A thread    */
+/*    waiting for a message on the subscriber is resumed with the         */
+/*    TX_DELETED status code.  Since the subscriber may have been the     */
+/*    slowest, the publishers waiting for room are then given the room    */
+/*    that was freed.                                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    subscriber_ptr                    Pointer to subscriber control     */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_broadcast_publish_resume      Resume publishers waiting for     */
+/*                                        room                            */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_broadcast_unsubscribe(TX_BROADCAST_SUBSCRIBER *subscriber_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BROADCAST                *broadcast_ptr;
+TX_BROADCAST_SUBSCRIBER     *next_subscriber;
+TX_BROADCAST_SUBSCRIBER     *previous_subscriber;
+TX_THREAD                   *thread_ptr;
+TX_THREAD                   *next_thread;
+TX_THREAD                   *previous_thread;
+TX_THREAD                   *resume_list;
+UINT                        suspended_count;
+
+
+    /* Disable interrupts to remove the subscriber from the subscriber list.  */
+    TX_DISABLE
+
+    /* Pickup the broadcast of the subscriber.  */
+    broadcast_ptr =  subscriber_ptr -> tx_broadcast_subscriber_broadcast;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BROADCAST_UNSUBSCRIBE, subscriber_ptr, TX_POINTER_TO_ULONG_CONVERT(broadcast_ptr), broadcast_ptr -> tx_broadcast_subscriber_count, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BROADCAST_UNSUBSCRIBE_INSERT
+
+    /* Clear the subscriber ID and its broadcast to make it invalid.  */
+    subscriber_ptr -> tx_broadcast_subscriber_id =         TX_CLEAR_ID;
+    subscriber_ptr -> tx_broadcast_subscriber_broadcast =  TX_NULL;
+
+    /* Decrement the number of subscribers.  */
+    broadcast_ptr -> tx_broadcast_subscriber_count--;
+
+    /* See if the subscriber is the only one on the list.  */
+    if (broadcast_ptr -> tx_broadcast_subscriber_count == ((UINT) 0))
+    {
+
+        /* Only subscriber, just set the subscriber list to NULL.  */
+        broadcast_ptr -> tx_broadcast_subscriber_list =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_subscriber =                                       subscriber_ptr -> tx_broadcast_subscriber_next;
+        previous_subscriber =                                   subscriber_ptr -> tx_broadcast_subscriber_previous;
+        next_subscriber -> tx_broadcast_subscriber_previous =   previous_subscriber;
+        previous_subscriber -> tx_broadcast_subscriber_next =   next_subscriber;
+
+        /* See if we have to update the subscriber list head pointer.  */
+        if (broadcast_ptr -> tx_broadcast_subscriber_list == subscriber_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            broadcast_ptr -> tx_broadcast_subscriber_list =  next_subscriber;
+        }
+    }
+
+    /* Temporarily disable preemption.  */
+    _tx_thread_preempt_disable++;
+
+    /* Remove the threads waiting for a message on this subscriber from the
+       suspension list, and link them in a list of threads to resume.  */
+    resume_list =      TX_NULL;
+    thread_ptr =       broadcast_ptr -> tx_broadcast_suspension_list;
+    suspended_count =  broadcast_ptr -> tx_broadcast_suspended_count;
+    while (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Decrement the number of threads left to examine.  */
+        suspended_count--;
+
+        /* Get next pointer first.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+        /* Determine if this thread waits on the subscriber.  */
+        if (thread_ptr -> tx_thread_suspend_control_block == (VOID *) subscriber_ptr)
+        {
+
+            /* Yes, remove the thread from the suspension list.  */
+            broadcast_ptr -> tx_broadcast_suspended_count--;
+            if (broadcast_ptr -> tx_broadcast_suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                broadcast_ptr -> tx_broadcast_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+
+                /* Determine if we need to update the head pointer.  */
+                if (broadcast_ptr -> tx_broadcast_suspension_list == thread_ptr)
+                {
+
+                    /* Update the list head pointer.  */
+                    broadcast_ptr -> tx_broadcast_suspension_list =  next_thread;
+                }
+            }
+
+            /* Clear the cleanup pointer, this prevents the timeout from doing
+               anything.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Set the return status in the thread to TX_DELETED.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_DELETED;
+
+            /* Place the thread on the list of threads to resume.  */
+            thread_ptr -> tx_thread_suspended_next =  resume_list;
+            resume_list =                             thread_ptr;
+        }
+
+        /* Move to the next thread.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Walk through the list of threads to resume.  */
+    thread_ptr =  resume_list;
+    while (thread_ptr != TX_NULL)
+    {
+
+        /* Get next pointer first.  */
+        next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Disable preemption again.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupt posture.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+
+        /* Move next thread to current.  */
+        thread_ptr =  next_thread;
+    }
+
+    /* The subscriber may have been the slowest, publish the waiting messages
+       that now fit in the ring.  */
+    _tx_broadcast_publish_resume(broadcast_ptr);
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Release previous preempt disable.  */
+    _tx_thread_preempt_disable--;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Check for preemption.  */
+    _tx_thread_system_preempt_check();
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
@@ -45,7 +45,9 @@
 /*                                                                        */
 /*    This function deletes the specified byte pool.  All threads         */
 /*    suspended on the byte pool are resumed with the TX_DELETED status   */
-/*    code.                                                               */
+/*    code.  The magazines of the byte pool are removed from their        */
+/*    threads and become invalid, the blocks they cache are part of the   */
+/*    deleted pool.                                                       */
 /*                                                                        */
 /*    It is important to note that the byte pool being deleted, or the    */
 /*    memory associated with it should not be in use when this function   */
@@ -76,6 +78,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            byte pool magazines         */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_byte_pool_delete(TX_BYTE_POOL *pool_ptr)
@@ -88,6 +92,8 @@ TX_THREAD       *next_thread;
 UINT            suspended_count;
 TX_BYTE_POOL    *next_pool;
 TX_BYTE_POOL    *previous_pool;
+TX_BYTE_POOL_MAGAZINE   *magazine_ptr;
+TX_BYTE_POOL_MAGAZINE   **link_ptr;
 
 
     /* Disable interrupts to remove the byte pool from the created list.  */
@@ -136,6 +142,42 @@ TX_BYTE_POOL    *previous_pool;
         }
     }
 
+    /* Remove the magazines of the byte pool from their threads.  */
+    magazine_ptr =  pool_ptr -> tx_byte_pool_magazine_list;
+    while (magazine_ptr != TX_NULL)
+    {
+
+        /* Find the magazine on its thread's list.  */
+        link_ptr =  &(magazine_ptr -> tx_byte_pool_magazine_thread -> tx_thread_byte_pool_magazine);
+        while ((*link_ptr) != TX_NULL)
+        {
+
+            /* Is this the magazine?  */
+            if ((*link_ptr) == magazine_ptr)
+            {
+
+                /* Yes, remove it from the list.  */
+                *link_ptr =  magazine_ptr -> tx_byte_pool_magazine_thread_next;
+                break;
+            }
+
+            /* Move to the next magazine of the thread.  */
+            link_ptr =  &((*link_ptr) -> tx_byte_pool_magazine_thread_next);
+        }
+
+        /* Clear the magazine ID to make it invalid.  */
+        magazine_ptr -> tx_byte_pool_magazine_id =  TX_CLEAR_ID;
+
+        /* Move to the next magazine of the pool, until the list wraps around.  */
+        magazine_ptr =  magazine_ptr -> tx_byte_pool_magazine_pool_next;
+        if (magazine_ptr == pool_ptr -> tx_byte_pool_magazine_list)
+        {
+
+            magazine_ptr =  TX_NULL;
+        }
+    }
+    pool_ptr -> tx_byte_pool_magazine_list =  TX_NULL;
+
     /* Temporarily disable preemption.  */
     _tx_thread_preempt_disable++;
 
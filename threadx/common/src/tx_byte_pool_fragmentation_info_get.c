@@ -0,0 +1,337 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_fragmentation_info_get                PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function walks the specified byte pool once and retrieves how  */
+/*    its memory is split into free and allocated blocks: the largest     */
+/*    free block, histograms of the sizes of the free and of the          */
+/*    allocated blocks, and the external fragmentation, which is the      */
+/*    percentage of the free bytes that are not part of the largest free  */
+/*    block.  Adjacent free blocks that are not merged yet count as one   */
+/*    free block, as a search of the pool merges them.  Like the search,  */
+/*    the walk restores interrupts briefly every                          */
+/*    TX_BYTE_POOL_MULTIPLE_BLOCK_SEARCH blocks, and starts over if the   */
+/*    pool was changed in the meantime.  Each histogram has               */
+/*    TX_BYTE_POOL_FRAGMENTATION_BINS entries.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    largest_free_bytes                Destination for the size of the   */
+/*                                        largest free block              */
+/*    free_histogram                    Destination for the free block    */
+/*                                        size histogram                  */
+/*    allocated_histogram               Destination for the allocated     */
+/*                                        block size histogram            */
+/*    fragmentation_percent             Destination for the external      */
+/*                                        fragmentation in percent        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_fragmentation_info_get(TX_BYTE_POOL *pool_ptr, ULONG *largest_free_bytes,
+                    ULONG *free_histogram, ULONG *allocated_histogram, ULONG *fragmentation_percent)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+UCHAR           *current_ptr;
+UCHAR           *next_ptr;
+UCHAR           *free_start_ptr;
+UCHAR           *work_ptr;
+UCHAR           **block_link_ptr;
+ALIGN_TYPE      *free_ptr;
+ULONG           overhead;
+ULONG           memory_size;
+ULONG           largest_free;
+ULONG           total_free;
+ULONG           bin;
+ULONG           free_bins[TX_BYTE_POOL_FRAGMENTATION_BINS];
+ULONG           allocated_bins[TX_BYTE_POOL_FRAGMENTATION_BINS];
+UINT            examine_blocks;
+UINT            finished;
+UINT            i;
+
+
+    /* Determine the header size of the blocks of this pool.  */
+    overhead =  ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+    if (pool_ptr -> tx_byte_pool_tlsf != TX_NULL)
+    {
+
+        /* The blocks of a TLSF pool also end with the previous block pointer of
+           the next block.  */
+        overhead =  TX_BYTE_POOL_TLSF_OVERHEAD;
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Setup ownership of the byte pool.  */
+    pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+    /* Start the walk at the first block.  */
+    current_ptr =  TX_NULL;
+    finished =     TX_FALSE;
+    do
+    {
+
+        /* Determine if the walk starts over.  */
+        if (current_ptr == TX_NULL)
+        {
+
+            /* Yes, clear the results and start at the first block.  */
+            current_ptr =     pool_ptr -> tx_byte_pool_list;
+            free_start_ptr =  TX_NULL;
+            largest_free =    ((ULONG) 0);
+            total_free =      ((ULONG) 0);
+            for (i = ((UINT) 0); i < ((UINT) TX_BYTE_POOL_FRAGMENTATION_BINS); i++)
+            {
+
+                free_bins[i] =       ((ULONG) 0);
+                allocated_bins[i] =  ((ULONG) 0);
+            }
+        }
+
+        /* Examine the next group of blocks with interrupts disabled.  */
+        examine_blocks =  TX_BYTE_POOL_MULTIPLE_BLOCK_SEARCH;
+        while ((examine_blocks != ((UINT) 0)) && (finished == TX_FALSE))
+        {
+
+            /* Pickup the next block's pointer.  */
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+            next_ptr =        *block_link_ptr;
+
+            /* Check to see if this block is free.  */
+            work_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (sizeof(UCHAR *)));
+            free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(work_ptr);
+            if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+            {
+
+                /* Determine if this block starts a free block.  */
+                if (free_start_ptr == TX_NULL)
+                {
+
+                    /* Yes, remember where it starts.  */
+                    free_start_ptr =  current_ptr;
+                }
+            }
+            else
+            {
+
+                /* The block is allocated, determine if it ends a free block.  */
+                if (free_start_ptr != TX_NULL)
+                {
+
+                    /* Yes, calculate the size of the free block.  */
+                    memory_size =  TX_UCHAR_POINTER_DIF(current_ptr, free_start_ptr) - overhead;
+                    total_free =   total_free + memory_size;
+                    if (memory_size > largest_free)
+                    {
+
+                        /* This is the largest free block so far.  */
+                        largest_free =  memory_size;
+                    }
+
+                    /* Count the free block in the bin of its size.  */
+                    bin =  ((ULONG) 0);
+                    if (memory_size >= ((ULONG) 32))
+                    {
+
+                        TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(memory_size, bin)
+                        bin =  bin - ((ULONG) 4);
+                        if (bin >= ((ULONG) TX_BYTE_POOL_FRAGMENTATION_BINS))
+                        {
+
+                            bin =  ((ULONG) TX_BYTE_POOL_FRAGMENTATION_BINS) - ((ULONG) 1);
+                        }
+                    }
+                    free_bins[bin]++;
+
+                    /* The free block has ended.  */
+                    free_start_ptr =  TX_NULL;
+                }
+
+                /* Determine if this is the block at the end of the pool, which is never
+                   free and links back to the first block.  */
+                if (next_ptr > current_ptr)
+                {
+
+                    /* No, calculate the size of the allocated block.  */
+                    memory_size =  TX_UCHAR_POINTER_DIF(next_ptr, current_ptr) - overhead;
+
+                    /* Count the allocated block in the bin of its size.  */
+                    bin =  ((ULONG) 0);
+                    if (memory_size >= ((ULONG) 32))
+                    {
+
+                        TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(memory_size, bin)
+                        bin =  bin - ((ULONG) 4);
+                        if (bin >= ((ULONG) TX_BYTE_POOL_FRAGMENTATION_BINS))
+                        {
+
+                            bin =  ((ULONG) TX_BYTE_POOL_FRAGMENTATION_BINS) - ((ULONG) 1);
+                        }
+                    }
+                    allocated_bins[bin]++;
+                }
+            }
+
+            /* Determine if the walk has reached the end of the pool.  */
+            if (next_ptr > current_ptr)
+            {
+
+                /* No, move to the next block.  */
+                current_ptr =  next_ptr;
+            }
+            else
+            {
+
+                /* Yes, the walk is finished.  */
+                finished =  TX_TRUE;
+            }
+
+            /* Another block has been examined.  */
+            examine_blocks--;
+        }
+
+        /* Determine if the walk continues.  */
+        if (finished == TX_FALSE)
+        {
+
+            /* Restore interrupts temporarily.  */
+            TX_RESTORE
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Determine if anything has changed in terms of pool ownership.  */
+            if (pool_ptr -> tx_byte_pool_owner != thread_ptr)
+            {
+
+                /* Pool changed ownership in the brief period interrupts were
+                   enabled, the blocks may have changed.  Reset the walk.  */
+                current_ptr =  TX_NULL;
+
+                /* Setup our ownership again.  */
+                pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+            }
+        }
+    } while (finished == TX_FALSE);
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Retrieve the size of the largest free block.  */
+    if (largest_free_bytes != TX_NULL)
+    {
+
+        *largest_free_bytes =  largest_free;
+    }
+
+    /* Retrieve the histograms.  */
+    for (i = ((UINT) 0); i < ((UINT) TX_BYTE_POOL_FRAGMENTATION_BINS); i++)
+    {
+
+        if (free_histogram != TX_NULL)
+        {
+
+            free_histogram[i] =  free_bins[i];
+        }
+        if (allocated_histogram != TX_NULL)
+        {
+
+            allocated_histogram[i] =  allocated_bins[i];
+        }
+    }
+
+    /* Retrieve the external fragmentation.  */
+    if (fragmentation_percent != TX_NULL)
+    {
+
+        /* Determine if there is free memory at all.  */
+        if (total_free == ((ULONG) 0))
+        {
+
+            /* No, an exhausted pool is not fragmented.  */
+            *fragmentation_percent =  ((ULONG) 0);
+        }
+
+        /* Determine if the calculation fits in a ULONG.  */
+        else if (total_free < (((ULONG) 0xFFFFFFFFUL) / ((ULONG) 100)))
+        {
+
+            /* Calculate the fragmentation exactly.  */
+            *fragmentation_percent =  ((total_free - largest_free) * ((ULONG) 100)) / total_free;
+        }
+        else
+        {
+
+            /* Calculate the fragmentation in units of one percent of the free bytes.  */
+            *fragmentation_percent =  (total_free - largest_free) / (total_free / ((ULONG) 100));
+        }
+    }
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
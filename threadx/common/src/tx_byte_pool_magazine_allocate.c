@@ -0,0 +1,260 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_allocate                     PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates memory for the current thread from its      */
+/*    magazine for the specified pool.  The request is mapped to the      */
+/*    smallest size class that holds it, and the first cached block of    */
+/*    that class is returned.  If the class is empty, a single search of  */
+/*    the pool allocates one block large enough for half a magazine of    */
+/*    blocks of the class size.  This block is carved into the blocks of  */
+/*    the batch; the first one is returned and the others are cached.     */
+/*    If the pool has no room for the whole batch, a single block of the  */
+/*    class size is allocated instead.  Since the magazine is only used   */
+/*    by its thread, no interrupts are disabled on a hit.  NULL is        */
+/*    returned if the thread has no magazine for the pool, the request    */
+/*    is larger than the largest size class, or the pool has no memory    */
+/*    for the class.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    thread_ptr                        Pointer to current thread         */
+/*    memory_size                       Number of bytes required          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UCHAR *                           Pointer to the allocated memory,  */
+/*                                        if successful.  Otherwise, a    */
+/*                                        NULL is returned                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_magazine_allocate(TX_BYTE_POOL *pool_ptr, TX_THREAD *thread_ptr, ULONG memory_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BYTE_POOL_MAGAZINE   *magazine_ptr;
+UCHAR                   *work_ptr;
+UCHAR                   *block_ptr;
+UCHAR                   *split_ptr;
+UCHAR                   *temp_ptr;
+UCHAR                   **block_link_ptr;
+UCHAR                   **split_link_ptr;
+ULONG                   class_size;
+ULONG                   overhead;
+ULONG                   block_size;
+UINT                    size_class;
+UINT                    i;
+
+
+    /* Default to no memory.  */
+    work_ptr =  TX_NULL;
+
+    /* Find the thread's magazine for this pool.  */
+    magazine_ptr =  thread_ptr -> tx_thread_byte_pool_magazine;
+    while (magazine_ptr != TX_NULL)
+    {
+
+        /* Is this the magazine of the pool?  */
+        if (magazine_ptr -> tx_byte_pool_magazine_pool == pool_ptr)
+        {
+
+            /* Yes, the magazine is found.  */
+            break;
+        }
+
+        /* Move to the next magazine of the thread.  */
+        magazine_ptr =  magazine_ptr -> tx_byte_pool_magazine_thread_next;
+    }
+
+    /* Find the smallest size class that holds the request.  */
+    size_class =  ((UINT) 0);
+    class_size =  TX_BYTE_POOL_MAGAZINE_MIN_SIZE;
+    while ((size_class < ((UINT) TX_BYTE_POOL_MAGAZINE_CLASSES)) && (class_size < memory_size))
+    {
+
+        /* Move to the next size class.  */
+        size_class++;
+        class_size =  class_size << 1;
+    }
+
+    /* Determine if the request can be satisfied by the magazine.  */
+    if ((magazine_ptr != TX_NULL) && (size_class < ((UINT) TX_BYTE_POOL_MAGAZINE_CLASSES)))
+    {
+
+        /* Determine if a block of the size class is cached.  */
+        if (magazine_ptr -> tx_byte_pool_magazine_list[size_class] != TX_NULL)
+        {
+
+            /* Yes, remove the first block from the list.  */
+            work_ptr =        magazine_ptr -> tx_byte_pool_magazine_list[size_class];
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            magazine_ptr -> tx_byte_pool_magazine_list[size_class] =  *block_link_ptr;
+            magazine_ptr -> tx_byte_pool_magazine_count[size_class]--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the number of hits of this magazine.  */
+            magazine_ptr -> tx_byte_pool_magazine_hit_count++;
+#endif
+        }
+        else
+        {
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the number of misses of this magazine.  */
+            magazine_ptr -> tx_byte_pool_magazine_miss_count++;
+#endif
+
+            /* Determine the overhead of each block of this pool.  */
+            overhead =  ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+            if (pool_ptr -> tx_byte_pool_tlsf != TX_NULL)
+            {
+
+                /* The blocks of a TLSF pool also end with the previous block pointer of
+                   the next block.  */
+                overhead =  TX_BYTE_POOL_TLSF_OVERHEAD;
+            }
+
+            /* Refill the size class with half a magazine of blocks.  A single search
+               allocates one block that holds the whole batch, which is then carved into
+               blocks of the class size.  */
+            block_size =  class_size + overhead;
+            work_ptr =    _tx_byte_pool_search(pool_ptr,
+                                    (block_size * ((ULONG) ((TX_BYTE_POOL_MAGAZINE_SIZE + ((UINT) 1)) / ((UINT) 2)))) - overhead,
+                                    ((ULONG) (sizeof(ALIGN_TYPE))));
+
+            /* Determine if the pool has room for the batch.  */
+            if (work_ptr == TX_NULL)
+            {
+
+                /* No, just allocate a block of the class size for the request.  */
+                work_ptr =  _tx_byte_pool_search(pool_ptr, class_size, ((ULONG) (sizeof(ALIGN_TYPE))));
+            }
+            else
+            {
+
+                /* Back off the memory pointer to pickup the block header.  */
+                block_ptr =  TX_UCHAR_POINTER_SUB(work_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+
+                /* Disable interrupts while the block is carved, since other threads
+                   may walk the pool.  */
+                TX_DISABLE
+
+                /* Indicate that this thread is the current owner, so searches in
+                   progress start over.  */
+                pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+                /* Carve the other blocks of the batch off the end of the first one.
+                   The last block keeps any extra bytes of the batch.  */
+                for (i = ((UINT) 1); i < ((TX_BYTE_POOL_MAGAZINE_SIZE + ((UINT) 1)) / ((UINT) 2)); i++)
+                {
+
+                    /* Setup the new block between the block and its next block.  */
+                    split_ptr =        TX_UCHAR_POINTER_ADD(block_ptr, block_size);
+                    block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+                    split_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(split_ptr);
+                    *split_link_ptr =  *block_link_ptr;
+                    *block_link_ptr =  split_ptr;
+
+                    /* Mark the new block as allocated from this pool.  */
+                    temp_ptr =         TX_UCHAR_POINTER_ADD(split_ptr, (sizeof(UCHAR *)));
+                    split_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+                    *split_link_ptr =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+
+                    /* Determine if this pool uses the two-level segregated fit allocator.  */
+                    if (pool_ptr -> tx_byte_pool_tlsf != TX_NULL)
+                    {
+
+                        /* Yes, link the new block to its physically previous block.  */
+                        TX_BYTE_POOL_TLSF_PREVIOUS(split_ptr) =  block_ptr;
+                    }
+
+                    /* Cache the memory of the new block.  */
+                    temp_ptr =         TX_UCHAR_POINTER_ADD(split_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+                    split_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+                    *split_link_ptr =  magazine_ptr -> tx_byte_pool_magazine_list[size_class];
+                    magazine_ptr -> tx_byte_pool_magazine_list[size_class] =  temp_ptr;
+                    magazine_ptr -> tx_byte_pool_magazine_count[size_class]++;
+
+                    /* Move to the new block.  */
+                    block_ptr =  split_ptr;
+                }
+
+                /* Determine if this pool uses the two-level segregated fit allocator.  */
+                if (pool_ptr -> tx_byte_pool_tlsf != TX_NULL)
+                {
+
+                    /* Yes, the next block now follows the last block of the batch.  */
+                    TX_BYTE_POOL_TLSF_PREVIOUS(TX_BYTE_POOL_TLSF_NEXT(block_ptr)) =  block_ptr;
+                }
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments =  pool_ptr -> tx_byte_pool_fragments +
+                                                        (((TX_BYTE_POOL_MAGAZINE_SIZE + ((UINT) 1)) / ((UINT) 2)) - ((UINT) 1));
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+        }
+    }
+
+    /* Return the memory pointer.  */
+    return(work_ptr);
+}
+
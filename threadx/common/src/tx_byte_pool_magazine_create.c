@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_create                       PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a magazine that caches small blocks of the    */
+/*    specified byte pool for the specified thread.  Once created,        */
+/*    allocations of the thread from the pool of up to the largest size   */
+/*    class are taken from the magazine, and such blocks released by the  */
+/*    thread are placed back in it, so that neither interrupts are        */
+/*    disabled nor the pool is searched as long as the magazine has a     */
+/*    block of the needed size class.  The magazine is placed at the      */
+/*    front of the thread's list of magazines and on the pool's list of   */
+/*    magazines.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    magazine_ptr                      Pointer to magazine control block */
+/*    thread_ptr                        Pointer to thread that uses the   */
+/*                                        magazine                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_magazine_create(TX_BYTE_POOL *pool_ptr, TX_BYTE_POOL_MAGAZINE *magazine_ptr, TX_THREAD *thread_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BYTE_POOL_MAGAZINE   *next_magazine;
+TX_BYTE_POOL_MAGAZINE   *previous_magazine;
+
+
+    /* Initialize magazine control block to all zeros.  */
+    TX_MEMSET(magazine_ptr, 0, (sizeof(TX_BYTE_POOL_MAGAZINE)));
+
+    /* Setup the basic magazine fields.  */
+    magazine_ptr -> tx_byte_pool_magazine_pool =    pool_ptr;
+    magazine_ptr -> tx_byte_pool_magazine_thread =  thread_ptr;
+
+    /* Disable interrupts to place the magazine on the thread and pool lists.  */
+    TX_DISABLE
+
+    /* Setup the magazine ID to make it valid.  */
+    magazine_ptr -> tx_byte_pool_magazine_id =  TX_BYTE_POOL_MAGAZINE_ID;
+
+    /* Setup the thread magazine release function pointer.  */
+    _tx_thread_byte_pool_magazine_release =  &(_tx_byte_pool_magazine_thread_release);
+
+    /* Place the magazine at the front of the thread's list.  */
+    magazine_ptr -> tx_byte_pool_magazine_thread_next =  thread_ptr -> tx_thread_byte_pool_magazine;
+    thread_ptr -> tx_thread_byte_pool_magazine =         magazine_ptr;
+
+    /* Place the magazine on the pool's list.  First, check for an empty list.  */
+    next_magazine =  pool_ptr -> tx_byte_pool_magazine_list;
+    if (next_magazine == TX_NULL)
+    {
+
+        /* The list is empty, just setup the head pointer and the magazine's
+           pointers to itself.  */
+        pool_ptr -> tx_byte_pool_magazine_list =                magazine_ptr;
+        magazine_ptr -> tx_byte_pool_magazine_pool_next =       magazine_ptr;
+        magazine_ptr -> tx_byte_pool_magazine_pool_previous =   magazine_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        previous_magazine =  next_magazine -> tx_byte_pool_magazine_pool_previous;
+
+        /* Place the new magazine in the list.  */
+        next_magazine -> tx_byte_pool_magazine_pool_previous =      magazine_ptr;
+        previous_magazine -> tx_byte_pool_magazine_pool_next =      magazine_ptr;
+
+        /* Setup this magazine's pointers.  */
+        magazine_ptr -> tx_byte_pool_magazine_pool_previous =       previous_magazine;
+        magazine_ptr -> tx_byte_pool_magazine_pool_next =           next_magazine;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
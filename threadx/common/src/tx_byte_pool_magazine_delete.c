@@ -0,0 +1,177 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_delete                       PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified byte pool magazine.  The        */
+/*    magazine is removed from the lists of its thread and its pool, and  */
+/*    all the blocks it caches are released to the pool.  The magazine's  */
+/*    hit and miss counts are kept in the pool's performance information. */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    magazine_ptr                      Pointer to magazine control block */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_release                  Release memory to the pool        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _tx_byte_pool_magazine_thread_release                               */
+/*                                      Release magazines of thread       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_magazine_delete(TX_BYTE_POOL_MAGAZINE *magazine_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BYTE_POOL            *pool_ptr;
+TX_THREAD               *thread_ptr;
+TX_BYTE_POOL_MAGAZINE   *next_magazine;
+TX_BYTE_POOL_MAGAZINE   *previous_magazine;
+TX_BYTE_POOL_MAGAZINE   **link_ptr;
+UCHAR                   *block_ptr;
+UCHAR                   **block_link_ptr;
+UINT                    size_class;
+
+
+    /* Disable interrupts to remove the magazine from the thread and pool lists.  */
+    TX_DISABLE
+
+    /* Pickup the pool and the thread of the magazine.  */
+    pool_ptr =    magazine_ptr -> tx_byte_pool_magazine_pool;
+    thread_ptr =  magazine_ptr -> tx_byte_pool_magazine_thread;
+
+    /* Clear the magazine ID to make it invalid.  */
+    magazine_ptr -> tx_byte_pool_magazine_id =  TX_CLEAR_ID;
+
+    /* Find the magazine on the thread's list.  */
+    link_ptr =  &(thread_ptr -> tx_thread_byte_pool_magazine);
+    while ((*link_ptr) != TX_NULL)
+    {
+
+        /* Is this the magazine?  */
+        if ((*link_ptr) == magazine_ptr)
+        {
+
+            /* Yes, remove it from the list.  */
+            *link_ptr =  magazine_ptr -> tx_byte_pool_magazine_thread_next;
+            break;
+        }
+
+        /* Move to the next magazine of the thread.  */
+        link_ptr =  &((*link_ptr) -> tx_byte_pool_magazine_thread_next);
+    }
+
+    /* Remove the magazine from the pool's list.  */
+    next_magazine =  magazine_ptr -> tx_byte_pool_magazine_pool_next;
+    if (next_magazine == magazine_ptr)
+    {
+
+        /* Only magazine, just set the list head to NULL.  */
+        pool_ptr -> tx_byte_pool_magazine_list =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        previous_magazine =                                     magazine_ptr -> tx_byte_pool_magazine_pool_previous;
+        next_magazine -> tx_byte_pool_magazine_pool_previous =  previous_magazine;
+        previous_magazine -> tx_byte_pool_magazine_pool_next =  next_magazine;
+
+        /* See if we have to update the list head pointer.  */
+        if (pool_ptr -> tx_byte_pool_magazine_list == magazine_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            pool_ptr -> tx_byte_pool_magazine_list =  next_magazine;
+        }
+    }
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Keep the hit and miss counts of the magazine in the pool.  */
+    pool_ptr -> tx_byte_pool_performance_magazine_hit_count =
+        pool_ptr -> tx_byte_pool_performance_magazine_hit_count + magazine_ptr -> tx_byte_pool_magazine_hit_count;
+    pool_ptr -> tx_byte_pool_performance_magazine_miss_count =
+        pool_ptr -> tx_byte_pool_performance_magazine_miss_count + magazine_ptr -> tx_byte_pool_magazine_miss_count;
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* The magazine is no longer found by its thread, release the cached blocks
+       of each size class to the pool.  */
+    for (size_class = ((UINT) 0); size_class < ((UINT) TX_BYTE_POOL_MAGAZINE_CLASSES); size_class++)
+    {
+
+        /* Release all the blocks of this size class.  */
+        while (magazine_ptr -> tx_byte_pool_magazine_list[size_class] != TX_NULL)
+        {
+
+            /* Remove the first block from the list.  */
+            block_ptr =       magazine_ptr -> tx_byte_pool_magazine_list[size_class];
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+            magazine_ptr -> tx_byte_pool_magazine_list[size_class] =  *block_link_ptr;
+            magazine_ptr -> tx_byte_pool_magazine_count[size_class]--;
+
+            /* Release the block to the pool.  */
+            (VOID) _tx_byte_release(TX_UCHAR_TO_VOID_POINTER_CONVERT(block_ptr));
+        }
+    }
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
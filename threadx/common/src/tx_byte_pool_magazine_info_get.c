@@ -0,0 +1,168 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_info_get                     PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the number of allocations satisfied by the  */
+/*    magazines of the specified byte pool, and the number that found a   */
+/*    magazine empty.  The counts include those of the pool's current     */
+/*    magazines and of its deleted magazines.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to byte pool control block*/
+/*    magazine_hits                     Destination for number of         */
+/*                                        allocations satisfied by        */
+/*                                        magazines of this byte pool     */
+/*    magazine_misses                   Destination for number of         */
+/*                                        allocations that found a        */
+/*                                        magazine empty                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_byte_pool_magazine_info_get  Error checking magazine           */
+/*                                        information get                 */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_magazine_info_get(TX_BYTE_POOL *pool_ptr, ULONG *magazine_hits, ULONG *magazine_misses)
+{
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BYTE_POOL_MAGAZINE   *magazine_ptr;
+ULONG                   hits;
+ULONG                   misses;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Add the hits and misses of the pool's magazines to those of its deleted magazines.  */
+    hits =          pool_ptr -> tx_byte_pool_performance_magazine_hit_count;
+    misses =        pool_ptr -> tx_byte_pool_performance_magazine_miss_count;
+    magazine_ptr =  pool_ptr -> tx_byte_pool_magazine_list;
+    while (magazine_ptr != TX_NULL)
+    {
+
+        hits =    hits + magazine_ptr -> tx_byte_pool_magazine_hit_count;
+        misses =  misses + magazine_ptr -> tx_byte_pool_magazine_miss_count;
+
+        /* Move to the next magazine, until the list wraps around.  */
+        magazine_ptr =  magazine_ptr -> tx_byte_pool_magazine_pool_next;
+        if (magazine_ptr == pool_ptr -> tx_byte_pool_magazine_list)
+        {
+
+            magazine_ptr =  TX_NULL;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Retrieve the number of magazine hits on this byte pool.  */
+    if (magazine_hits != TX_NULL)
+    {
+
+        *magazine_hits =  hits;
+    }
+
+    /* Retrieve the number of magazine misses on this byte pool.  */
+    if (magazine_misses != TX_NULL)
+    {
+
+        *magazine_misses =  misses;
+    }
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (pool_ptr != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (magazine_hits != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (magazine_misses != TX_NULL)
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Not enabled, return error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
+
@@ -0,0 +1,217 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_release                      PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places memory released by the current thread in its   */
+/*    magazine for the memory's pool.  The block is cached in the largest */
+/*    size class it holds.  If that class is full, half of its blocks are */
+/*    first released to the pool in one batch.  Memory is not cached if   */
+/*    the thread has no magazine for the pool, the block is outside the   */
+/*    range of the size classes, the magazine is returning blocks to the  */
+/*    pool, or threads are suspended on the pool waiting for memory.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to current thread         */
+/*    memory_ptr                        Pointer to allocated memory       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Memory is cached in the magazine  */
+/*    TX_FALSE                          Memory must be released to the    */
+/*                                        pool                            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_release                  Release memory to the pool        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes back to the pool    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_magazine_release(TX_THREAD *thread_ptr, VOID *memory_ptr)
+{
+
+UINT                    cached;
+TX_BYTE_POOL            *pool_ptr;
+TX_BYTE_POOL_MAGAZINE   *magazine_ptr;
+UCHAR                   *work_ptr;
+UCHAR                   *temp_ptr;
+UCHAR                   *next_block_ptr;
+UCHAR                   *block_ptr;
+UCHAR                   **block_link_ptr;
+ALIGN_TYPE              *free_ptr;
+TX_BYTE_POOL            **byte_pool_ptr;
+ULONG                   memory_size;
+ULONG                   class_size;
+UINT                    size_class;
+UINT                    i;
+
+
+    /* Default to a release to the pool.  */
+    cached =  TX_FALSE;
+
+    /* Default to no magazine.  */
+    magazine_ptr =  TX_NULL;
+
+    /* Determine if the memory pointer is valid.  */
+    work_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(memory_ptr);
+    if (work_ptr != TX_NULL)
+    {
+
+        /* Back off the memory pointer to pickup its header.  */
+        work_ptr =  TX_UCHAR_POINTER_SUB(work_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+
+        /* Determine if the block is allocated.  */
+        temp_ptr =  TX_UCHAR_POINTER_ADD(work_ptr, (sizeof(UCHAR *)));
+        free_ptr =  TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(temp_ptr);
+        if ((*free_ptr) != TX_BYTE_BLOCK_FREE)
+        {
+
+            /* Yes, pickup the pool pointer.  */
+            byte_pool_ptr =  TX_UCHAR_TO_INDIRECT_BYTE_POOL_POINTER(temp_ptr);
+            pool_ptr =       *byte_pool_ptr;
+
+            /* Find the thread's magazine for this pool.  */
+            magazine_ptr =  thread_ptr -> tx_thread_byte_pool_magazine;
+            while (magazine_ptr != TX_NULL)
+            {
+
+                /* Is this the magazine of the pool?  */
+                if (magazine_ptr -> tx_byte_pool_magazine_pool == pool_ptr)
+                {
+
+                    /* Yes, the magazine is found.  */
+                    break;
+                }
+
+                /* Move to the next magazine of the thread.  */
+                magazine_ptr =  magazine_ptr -> tx_byte_pool_magazine_thread_next;
+            }
+        }
+    }
+
+    /* Determine if the memory may be cached in the magazine.  */
+    if (magazine_ptr != TX_NULL)
+    {
+
+        /* Do not cache blocks while the magazine returns blocks to the pool, nor
+           while other threads wait for memory of the pool.  */
+        if ((magazine_ptr -> tx_byte_pool_magazine_draining == TX_FALSE) &&
+            ((magazine_ptr -> tx_byte_pool_magazine_pool -> tx_byte_pool_suspended_count) == TX_NO_SUSPENSIONS))
+        {
+
+            /* Calculate the size of the block's memory area.  */
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            next_block_ptr =  *block_link_ptr;
+            memory_size =     TX_UCHAR_POINTER_DIF(next_block_ptr, work_ptr) - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
+
+            /* Determine if this pool uses the two-level segregated fit allocator.  */
+            if (magazine_ptr -> tx_byte_pool_magazine_pool -> tx_byte_pool_tlsf != TX_NULL)
+            {
+
+                /* Yes, the last word of the block is the previous block pointer of the next block.  */
+                memory_size =  TX_UCHAR_POINTER_DIF(next_block_ptr, work_ptr) - TX_BYTE_POOL_TLSF_OVERHEAD;
+            }
+
+            /* Determine if the block is within the range of the size classes.  */
+            if ((memory_size >= TX_BYTE_POOL_MAGAZINE_MIN_SIZE) &&
+                (memory_size < (TX_BYTE_POOL_MAGAZINE_MIN_SIZE << TX_BYTE_POOL_MAGAZINE_CLASSES)))
+            {
+
+                /* Find the largest size class the block holds.  */
+                size_class =  ((UINT) 0);
+                class_size =  TX_BYTE_POOL_MAGAZINE_MIN_SIZE << 1;
+                while (class_size <= memory_size)
+                {
+
+                    /* Move to the next size class.  */
+                    size_class++;
+                    class_size =  class_size << 1;
+                }
+
+                /* Determine if the size class is full.  */
+                if (magazine_ptr -> tx_byte_pool_magazine_count[size_class] >= TX_BYTE_POOL_MAGAZINE_SIZE)
+                {
+
+                    /* Yes, release half of its blocks to the pool.  The flag keeps the
+                       releases from being cached again.  */
+                    magazine_ptr -> tx_byte_pool_magazine_draining =  TX_TRUE;
+                    for (i = ((UINT) 0); i < ((TX_BYTE_POOL_MAGAZINE_SIZE + ((UINT) 1)) / ((UINT) 2)); i++)
+                    {
+
+                        /* Remove the first block from the list.  */
+                        block_ptr =       magazine_ptr -> tx_byte_pool_magazine_list[size_class];
+                        block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+                        magazine_ptr -> tx_byte_pool_magazine_list[size_class] =  *block_link_ptr;
+                        magazine_ptr -> tx_byte_pool_magazine_count[size_class]--;
+
+                        /* Release the block to the pool.  */
+                        (VOID) _tx_byte_release(TX_UCHAR_TO_VOID_POINTER_CONVERT(block_ptr));
+                    }
+                    magazine_ptr -> tx_byte_pool_magazine_draining =  TX_FALSE;
+                }
+
+                /* Place the memory at the front of the size class list.  */
+                block_ptr =       TX_VOID_TO_UCHAR_POINTER_CONVERT(memory_ptr);
+                block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+                *block_link_ptr =  magazine_ptr -> tx_byte_pool_magazine_list[size_class];
+                magazine_ptr -> tx_byte_pool_magazine_list[size_class] =  block_ptr;
+                magazine_ptr -> tx_byte_pool_magazine_count[size_class]++;
+
+                /* The memory is cached.  */
+                cached =  TX_TRUE;
+            }
+        }
+    }
+
+    /* Return the cached flag.  */
+    return(cached);
+}
+
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_thread_release               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes all the byte pool magazines of a thread that  */
+/*    completes, or of a terminated thread that is reset or deleted, so   */
+/*    that the blocks they cache are returned to their pools.  A thread   */
+/*    is not released when it is terminated, since it may have been       */
+/*    preempted in the middle of a magazine allocate or release, which    */
+/*    update the magazine without a lockout.  It is called through a      */
+/*    function pointer that is setup when the first magazine is created.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_delete     Delete byte pool magazine         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_shell_entry            Thread shell function             */
+/*    _tx_thread_delete                 Thread delete function            */
+/*    _tx_thread_reset                  Thread reset function             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_magazine_thread_release(TX_THREAD *thread_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BYTE_POOL_MAGAZINE   *magazine_ptr;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the first magazine of the thread.  */
+    magazine_ptr =  thread_ptr -> tx_thread_byte_pool_magazine;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Loop to delete all the magazines of the thread.  */
+    while (magazine_ptr != TX_NULL)
+    {
+
+        /* Delete the magazine, which removes it from the thread's list.  */
+        (VOID) _tx_byte_pool_magazine_delete(magazine_ptr);
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Pickup the next magazine of the thread.  */
+        magazine_ptr =  thread_ptr -> tx_thread_byte_pool_magazine;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+}
+
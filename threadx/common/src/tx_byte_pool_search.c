@@ -46,6 +46,10 @@
 /*    the requested number of bytes.  Merging of adjacent free blocks     */
 /*    takes place during the search and a split of the block that         */
 /*    satisfies the request may occur before this function returns.       */
+/*    For an alignment greater than that of ALIGN_TYPE, a block is large  */
+/*    enough if it holds the request at an aligned address, and the       */
+/*    leading slack in front of that address is split off as a free block */
+/*    of its own.                                                         */
 /*                                                                        */
 /*    It is assumed that this function is called with interrupts enabled  */
 /*    and with the tx_pool_owner field set to the thread performing the   */
@@ -56,6 +60,8 @@
 /*                                                                        */
 /*    pool_ptr                          Pointer to pool control block     */
 /*    memory_size                       Number of bytes required          */
+/*    alignment                         Required alignment of the memory, */
+/*                                        a power of two                  */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -65,11 +71,12 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*    _tx_byte_allocate_aligned         Allocate aligned bytes of memory  */
+/*    _tx_byte_pool_magazine_allocate   Allocate from thread's magazine   */
 /*    _tx_byte_release                  Release bytes of memory           */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
@@ -82,9 +89,13 @@
 /*  06-02-2021      Scott Larson            Improve possible free bytes   */
 /*                                            calculation,                */
 /*                                            resulting in version 6.1.7  */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            TLSF pool search            */
+/*  10-17-2026      agent                   Modified comment(s), added    */
+/*                                            aligned allocation          */
 /*                                                                        */
 /**************************************************************************/
-UCHAR  *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size)
+UCHAR  *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment)
 {
 
 TX_INTERRUPT_SAVE_AREA
@@ -94,6 +105,7 @@ UCHAR           *next_ptr;
 UCHAR           **this_block_link_ptr;
 UCHAR           **next_block_link_ptr;
 ULONG           available_bytes;
+ULONG           slack_bytes;
 UINT            examine_blocks;
 UINT            first_free_block_found =  TX_FALSE;
 TX_THREAD       *thread_ptr;
@@ -117,6 +129,17 @@ ULONG           total_theoretical_available;
         /* Not enough memory, return a NULL pointer.  */
         current_ptr =  TX_NULL;
     }
+
+    /* Determine if this pool uses the two-level segregated fit allocator.  */
+    else if (pool_ptr -> tx_byte_pool_tlsf != TX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Yes, allocate the memory in constant time instead of walking the pool.  */
+        current_ptr =  _tx_byte_pool_tlsf_search(pool_ptr, memory_size, alignment);
+    }
     else
     {
 
@@ -130,6 +153,7 @@ ULONG           total_theoretical_available;
         current_ptr =      pool_ptr -> tx_byte_pool_search;
         examine_blocks =   pool_ptr -> tx_byte_pool_fragments + ((UINT) 1);
         available_bytes =  ((ULONG) 0);
+        slack_bytes =      ((ULONG) 0);
         do
         {
 
@@ -170,9 +194,17 @@ ULONG           total_theoretical_available;
                 available_bytes =   TX_UCHAR_POINTER_DIF(next_ptr, current_ptr);
                 available_bytes =   available_bytes - ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)));
 
+                /* Determine if the memory must be aligned beyond the alignment of the blocks.  */
+                if (alignment > (sizeof(ALIGN_TYPE)))
+                {
+
+                    /* Yes, calculate the slack in front of the aligned memory in this block.  */
+                    TX_BYTE_POOL_ALIGNED_SLACK_CALCULATE(current_ptr, alignment, ((ULONG) TX_BYTE_BLOCK_MIN), slack_bytes)
+                }
+
                 /* If this is large enough, we are done because our first-fit algorithm
                    has been satisfied!  */
-                if (available_bytes >= memory_size)
+                if ((available_bytes >= slack_bytes) && ((available_bytes - slack_bytes) >= memory_size))
                 {
                     /* Get out of the search loop!  */
                     break;
@@ -279,6 +311,36 @@ ULONG           total_theoretical_available;
         if (available_bytes != ((ULONG) 0))
         {
 
+            /* Determine if the aligned memory starts after the beginning of the block.  */
+            if (slack_bytes != ((ULONG) 0))
+            {
+
+                /* Yes, split off the slack as a free block in front of the aligned block.  */
+                next_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, slack_bytes);
+
+                /* Setup the aligned block, it is marked as allocated below.  */
+                next_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(next_ptr);
+                this_block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(current_ptr);
+                *next_block_link_ptr =  *this_block_link_ptr;
+                *this_block_link_ptr =  next_ptr;
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total split counter.  */
+                _tx_byte_pool_performance_split_count++;
+
+                /* Increment the number of blocks split on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+
+                /* Continue with the aligned block, the slack stays free.  */
+                current_ptr =      next_ptr;
+                available_bytes =  available_bytes - slack_bytes;
+            }
+
             /* Determine if we need to split this block.  */
             if ((available_bytes - memory_size) >= ((ULONG) TX_BYTE_BLOCK_MIN))
             {
@@ -0,0 +1,240 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_create                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a pool of memory bytes in the specified       */
+/*    memory area that is managed with a two-level segregated fit (TLSF)  */
+/*    allocator, so that memory is allocated and released in constant     */
+/*    time regardless of the number of fragments in the pool.  The TLSF   */
+/*    control structure and its free list heads are placed at the start   */
+/*    of the memory area, followed by one large free block and the pre-   */
+/*    allocated block at the end of the pool.  The pool is otherwise used */
+/*    with the same services as any other byte pool.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    name_ptr                          Pointer to byte pool name         */
+/*    pool_start                        Address of beginning of pool area */
+/*    pool_size                         Number of bytes in the byte pool  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_SIZE_ERROR                     Pool is too small for the TLSF    */
+/*                                        control structure               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert         Place free block on its list      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_pool_tlsf_create(TX_BYTE_POOL *pool_ptr, CHAR *name_ptr, VOID *pool_start, ULONG pool_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+TX_BYTE_POOL_TLSF   *tlsf_ptr;
+UCHAR               *block_ptr;
+UCHAR               *end_ptr;
+UCHAR               *temp_ptr;
+TX_BYTE_POOL        *next_pool;
+TX_BYTE_POOL        *previous_pool;
+ULONG               control_size;
+ULONG               first_level;
+ULONG               i;
+
+
+    /* Round the pool size down to something that is evenly divisible by
+       an ULONG.  */
+    pool_size =   (pool_size/(sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+    /* Find the first level range of the pool size, which no block of the pool reaches.  */
+    TX_BYTE_POOL_TLSF_FIRST_LEVEL(pool_size, first_level)
+
+    /* Calculate the size of the TLSF control structure and its free list heads, rounded up
+       to keep the blocks aligned.  */
+    control_size =  ((sizeof(TX_BYTE_POOL_TLSF)) + ((sizeof(ALIGN_TYPE)) - ((ULONG) 1))) / (sizeof(ALIGN_TYPE));
+    control_size =  control_size * (sizeof(ALIGN_TYPE));
+    control_size =  control_size + (((first_level + ((ULONG) 1)) * ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT)) * (sizeof(UCHAR *)));
+    control_size =  ((control_size + ((sizeof(ALIGN_TYPE)) - ((ULONG) 1))) / (sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE));
+
+    /* Determine if the pool has room for the control structure, the previous block pointer of
+       the first block, the smallest free block, and the pre-allocated block at the end.  */
+    if (pool_size < (((control_size + (sizeof(UCHAR *))) + TX_BYTE_POOL_TLSF_BLOCK_MIN) + ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))))
+    {
+
+        /* Pool not big enough, return appropriate error.  */
+        status =  TX_SIZE_ERROR;
+    }
+    else
+    {
+
+        /* Initialize the byte pool control block to all zeros.  */
+        TX_MEMSET(pool_ptr, 0, (sizeof(TX_BYTE_POOL)));
+
+        /* Setup the basic byte pool fields.  */
+        pool_ptr -> tx_byte_pool_name =              name_ptr;
+
+        /* Save the start and size of the pool.  */
+        pool_ptr -> tx_byte_pool_start =   TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+        pool_ptr -> tx_byte_pool_size =    pool_size;
+
+        /* Setup the TLSF control structure at the beginning of the pool, with all the free
+           lists empty.  */
+        temp_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+        TX_MEMSET(temp_ptr, 0, control_size);
+        tlsf_ptr =  (TX_BYTE_POOL_TLSF *) pool_start;
+        tlsf_ptr -> tx_byte_pool_tlsf_fl_count =  (UINT) (first_level + ((ULONG) 1));
+        temp_ptr =  TX_UCHAR_POINTER_ADD(temp_ptr, ((((sizeof(TX_BYTE_POOL_TLSF)) + ((sizeof(ALIGN_TYPE)) - ((ULONG) 1))) / (sizeof(ALIGN_TYPE))) * (sizeof(ALIGN_TYPE))));
+        tlsf_ptr -> tx_byte_pool_tlsf_free_list =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(temp_ptr);
+        for (i = ((ULONG) 0); i < (((ULONG) tlsf_ptr -> tx_byte_pool_tlsf_fl_count) * ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT)); i++)
+        {
+
+            /* Clear the free list head.  */
+            tlsf_ptr -> tx_byte_pool_tlsf_free_list[i] =  TX_NULL;
+        }
+        pool_ptr -> tx_byte_pool_tlsf =  tlsf_ptr;
+
+        /* The first block follows the control structure and its previous block pointer,
+           which is TX_NULL.  */
+        block_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+        block_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, (control_size + (sizeof(UCHAR *))));
+        TX_BYTE_POOL_TLSF_PREVIOUS(block_ptr) =  TX_NULL;
+
+        /* Setup memory list to the first block as well as the search pointer.  */
+        pool_ptr -> tx_byte_pool_list =    block_ptr;
+        pool_ptr -> tx_byte_pool_search =  block_ptr;
+
+        /* Calculate the end of the pool's memory area, and build the pre-allocated block
+           there.  Its "next" pointer wraps to the first block, as in a first-fit pool.  */
+        end_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+        end_ptr =  TX_UCHAR_POINTER_ADD(end_ptr, pool_size);
+        end_ptr =  TX_UCHAR_POINTER_SUB(end_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+        TX_BYTE_POOL_TLSF_NEXT(end_ptr) =        block_ptr;
+        TX_BYTE_POOL_TLSF_OWNER_POOL(end_ptr) =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+        TX_BYTE_POOL_TLSF_PREVIOUS(end_ptr) =    block_ptr;
+
+        /* Now setup the large available block in the pool and place it on its free list.  */
+        TX_BYTE_POOL_TLSF_NEXT(block_ptr) =   end_ptr;
+        TX_BYTE_POOL_TLSF_OWNER(block_ptr) =  TX_BYTE_BLOCK_FREE;
+        _tx_byte_pool_tlsf_insert(tlsf_ptr, block_ptr);
+
+        /* Initially, the pool will have two blocks, the large available block and the
+           pre-allocated block at the end.  Be sure to count the available block's
+           overhead in the available bytes count.  */
+        pool_ptr -> tx_byte_pool_available =   TX_UCHAR_POINTER_DIF(end_ptr, block_ptr);
+        pool_ptr -> tx_byte_pool_fragments =   ((UINT) 2);
+
+        /* Clear the owner id.  */
+        pool_ptr -> tx_byte_pool_owner =  TX_NULL;
+
+        /* Disable interrupts to place the byte pool on the created list.  */
+        TX_DISABLE
+
+        /* Setup the byte pool ID to make it valid.  */
+        pool_ptr -> tx_byte_pool_id =  TX_BYTE_POOL_ID;
+
+        /* Place the byte pool on the list of created byte pools.  First,
+           check for an empty list.  */
+        if (_tx_byte_pool_created_count == TX_EMPTY)
+        {
+
+            /* The created byte pool list is empty.  Add byte pool to empty list.  */
+            _tx_byte_pool_created_ptr =                  pool_ptr;
+            pool_ptr -> tx_byte_pool_created_next =      pool_ptr;
+            pool_ptr -> tx_byte_pool_created_previous =  pool_ptr;
+        }
+        else
+        {
+
+            /* This list is not NULL, add to the end of the list.  */
+            next_pool =      _tx_byte_pool_created_ptr;
+            previous_pool =  next_pool -> tx_byte_pool_created_previous;
+
+            /* Place the new byte pool in the list.  */
+            next_pool -> tx_byte_pool_created_previous =  pool_ptr;
+            previous_pool -> tx_byte_pool_created_next =  pool_ptr;
+
+            /* Setup this byte pool's created links.  */
+            pool_ptr -> tx_byte_pool_created_previous =  previous_pool;
+            pool_ptr -> tx_byte_pool_created_next =      next_pool;
+        }
+
+        /* Increment the number of created byte pools.  */
+        _tx_byte_pool_created_count++;
+
+        /* Optional byte pool create extended processing.  */
+        TX_BYTE_POOL_CREATE_EXTENSION(pool_ptr)
+
+        /* If trace is enabled, register this object.  */
+        TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_BYTE_POOL, pool_ptr, name_ptr, pool_size, 0)
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_POOL_CREATE, pool_ptr, TX_POINTER_TO_ULONG_CONVERT(pool_start), pool_size, TX_POINTER_TO_ULONG_CONVERT(&block_ptr), TX_TRACE_BYTE_POOL_EVENTS)
+
+        /* Log this kernel call.  */
+        TX_EL_BYTE_POOL_CREATE_INSERT
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return TX_SUCCESS.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
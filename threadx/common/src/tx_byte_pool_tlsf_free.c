@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_free                             PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a block of a two-level segregated fit (TLSF)  */
+/*    pool to the pool in constant time.  The block is merged right away  */
+/*    with its physically next and previous blocks, if they are free, and */
+/*    the merged block is placed on the free list for its size.  This     */
+/*    function must be called with interrupts disabled.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to block to free          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert         Place free block on its list      */
+/*    _tx_byte_pool_tlsf_remove         Remove free block from its list   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release byte memory               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_free(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+TX_BYTE_POOL_TLSF   *tlsf_ptr;
+UCHAR               *next_ptr;
+UCHAR               *previous_ptr;
+
+
+    /* Pickup the TLSF control structure.  */
+    tlsf_ptr =  pool_ptr -> tx_byte_pool_tlsf;
+
+    /* Mark the block as free.  */
+    TX_BYTE_POOL_TLSF_OWNER(block_ptr) =  TX_BYTE_BLOCK_FREE;
+
+    /* Update the number of available bytes in the pool.  */
+    next_ptr =  TX_BYTE_POOL_TLSF_NEXT(block_ptr);
+    pool_ptr -> tx_byte_pool_available =
+        pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_ptr, block_ptr);
+
+    /* Determine if the next block is free.  The pre-allocated block at the end of the
+       pool is never free.  */
+    if (TX_BYTE_POOL_TLSF_OWNER(next_ptr) == TX_BYTE_BLOCK_FREE)
+    {
+
+        /* Yes, remove it from its free list and merge it into this block.  */
+        _tx_byte_pool_tlsf_remove(tlsf_ptr, next_ptr);
+        next_ptr =                                  TX_BYTE_POOL_TLSF_NEXT(next_ptr);
+        TX_BYTE_POOL_TLSF_NEXT(block_ptr) =         next_ptr;
+        TX_BYTE_POOL_TLSF_PREVIOUS(next_ptr) =      block_ptr;
+
+        /* Reduce the fragment total.  */
+        pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total merge counter.  */
+        _tx_byte_pool_performance_merge_count++;
+
+        /* Increment the number of blocks merged on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+    }
+
+    /* Determine if the previous block is free.  The first block has no previous block.  */
+    previous_ptr =  TX_BYTE_POOL_TLSF_PREVIOUS(block_ptr);
+    if (previous_ptr != TX_NULL)
+    {
+
+        if (TX_BYTE_POOL_TLSF_OWNER(previous_ptr) == TX_BYTE_BLOCK_FREE)
+        {
+
+            /* Yes, remove it from its free list and merge this block into it.  */
+            _tx_byte_pool_tlsf_remove(tlsf_ptr, previous_ptr);
+            TX_BYTE_POOL_TLSF_NEXT(previous_ptr) =  next_ptr;
+            TX_BYTE_POOL_TLSF_PREVIOUS(next_ptr) =  previous_ptr;
+            block_ptr =                             previous_ptr;
+
+            /* Reduce the fragment total.  */
+            pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total merge counter.  */
+            _tx_byte_pool_performance_merge_count++;
+
+            /* Increment the number of blocks merged on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+        }
+    }
+
+    /* Place the free block on its free list.  */
+    _tx_byte_pool_tlsf_insert(tlsf_ptr, block_ptr);
+}
+
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a free block of a two-level segregated fit     */
+/*    (TLSF) pool at the front of the free list for its size and marks    */
+/*    the list as not empty in the first and second level bit maps.  This */
+/*    function must be called with interrupts disabled.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tlsf_ptr                          Pointer to TLSF control structure */
+/*    block_ptr                         Pointer to free block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_create         Create TLSF byte pool             */
+/*    _tx_byte_pool_tlsf_free           Free TLSF pool memory             */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_insert(TX_BYTE_POOL_TLSF *tlsf_ptr, UCHAR *block_ptr)
+{
+
+ULONG           memory_size;
+ULONG           first_level;
+ULONG           second_level;
+ULONG           list_index;
+UCHAR           *head_ptr;
+
+
+    /* Calculate the size of the block's memory area.  */
+    memory_size =  TX_UCHAR_POINTER_DIF(TX_BYTE_POOL_TLSF_NEXT(block_ptr), block_ptr) - TX_BYTE_POOL_TLSF_OVERHEAD;
+
+    /* Find the list for this size.  */
+    TX_BYTE_POOL_TLSF_MAPPING(memory_size, first_level, second_level)
+    list_index =  (first_level * ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT)) + second_level;
+
+    /* Place the block at the front of the list.  */
+    head_ptr =  tlsf_ptr -> tx_byte_pool_tlsf_free_list[list_index];
+    TX_BYTE_POOL_TLSF_NEXT_FREE(block_ptr) =      head_ptr;
+    TX_BYTE_POOL_TLSF_PREVIOUS_FREE(block_ptr) =  TX_NULL;
+    if (head_ptr != TX_NULL)
+    {
+
+        /* Link the previous head back to the block.  */
+        TX_BYTE_POOL_TLSF_PREVIOUS_FREE(head_ptr) =  block_ptr;
+    }
+    tlsf_ptr -> tx_byte_pool_tlsf_free_list[list_index] =  block_ptr;
+
+    /* Mark the list as not empty.  */
+    tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap =  tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap | (((ULONG) 1) << first_level);
+    tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] =
+        tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] | (((ULONG) 1) << second_level);
+}
+
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_remove                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a free block of a two-level segregated fit    */
+/*    (TLSF) pool from the free list for its size.  If the list becomes   */
+/*    empty, it is marked as empty in the second level bit map, and the   */
+/*    first level range is marked as empty once all of its lists are.     */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tlsf_ptr                          Pointer to TLSF control structure */
+/*    block_ptr                         Pointer to free block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_free           Free TLSF pool memory             */
+/*    _tx_byte_pool_tlsf_search         Search TLSF pool for memory       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_remove(TX_BYTE_POOL_TLSF *tlsf_ptr, UCHAR *block_ptr)
+{
+
+ULONG           memory_size;
+ULONG           first_level;
+ULONG           second_level;
+ULONG           list_index;
+UCHAR           *next_ptr;
+UCHAR           *previous_ptr;
+
+
+    /* Calculate the size of the block's memory area.  */
+    memory_size =  TX_UCHAR_POINTER_DIF(TX_BYTE_POOL_TLSF_NEXT(block_ptr), block_ptr) - TX_BYTE_POOL_TLSF_OVERHEAD;
+
+    /* Find the list for this size.  */
+    TX_BYTE_POOL_TLSF_MAPPING(memory_size, first_level, second_level)
+    list_index =  (first_level * ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT)) + second_level;
+
+    /* Unlink the block from its neighbors on the list.  */
+    next_ptr =      TX_BYTE_POOL_TLSF_NEXT_FREE(block_ptr);
+    previous_ptr =  TX_BYTE_POOL_TLSF_PREVIOUS_FREE(block_ptr);
+    if (next_ptr != TX_NULL)
+    {
+
+        /* Link the next block back to the previous block.  */
+        TX_BYTE_POOL_TLSF_PREVIOUS_FREE(next_ptr) =  previous_ptr;
+    }
+
+    /* Determine if the block is at the front of the list.  */
+    if (previous_ptr != TX_NULL)
+    {
+
+        /* No, link the previous block to the next block.  */
+        TX_BYTE_POOL_TLSF_NEXT_FREE(previous_ptr) =  next_ptr;
+    }
+    else
+    {
+
+        /* Yes, the next block is the new head of the list.  */
+        tlsf_ptr -> tx_byte_pool_tlsf_free_list[list_index] =  next_ptr;
+
+        /* Determine if the list is now empty.  */
+        if (next_ptr == TX_NULL)
+        {
+
+            /* Mark the list as empty.  */
+            tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] =
+                tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] & (~(((ULONG) 1) << second_level));
+
+            /* Determine if all the lists of this first level range are empty.  */
+            if (tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] == ((ULONG) 0))
+            {
+
+                /* Mark the first level range as empty.  */
+                tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap =  tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap & (~(((ULONG) 1) << first_level));
+            }
+        }
+    }
+}
+
@@ -0,0 +1,334 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_search                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates memory from a two-level segregated fit      */
+/*    (TLSF) pool in constant time.  The requested size is rounded up to  */
+/*    the next list boundary, so that any block on the first non-empty    */
+/*    list at or above that list is large enough.  This list is found     */
+/*    with the second level bit map of the size's first level range, or   */
+/*    else with the first level bit map and the second level bit map of   */
+/*    the next non-empty range.  The block is removed from its list, and  */
+/*    the part of it that is not needed is split off and placed back on   */
+/*    the free lists.  If no such list exists, the first block of the     */
+/*    list of the size itself is used if it is large enough, so that the  */
+/*    largest blocks of the pool can still be allocated.  Since the       */
+/*    search is complete with interrupts disabled, the pool's owner never */
+/*    changes during it.  For an alignment greater than that of           */
+/*    ALIGN_TYPE, the search is for a block that holds the request at any */
+/*    address, plus the alignment and a minimum block for the slack in    */
+/*    front of the aligned address.  The slack is split off and placed    */
+/*    back on the free lists as well.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_size                       Number of bytes required          */
+/*    alignment                         Required alignment of the memory, */
+/*                                        a power of two                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UCHAR *                           Pointer to the allocated memory,  */
+/*                                        if successful.  Otherwise, a    */
+/*                                        NULL is returned                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert         Place free block on its list      */
+/*    _tx_byte_pool_tlsf_remove         Remove free block from its list   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_search              Search byte pool for memory       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            aligned allocation          */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_tlsf_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size, ULONG alignment)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_BYTE_POOL_TLSF   *tlsf_ptr;
+TX_THREAD           *thread_ptr;
+UCHAR               *current_ptr;
+UCHAR               *next_ptr;
+ULONG               required_size;
+ULONG               search_size;
+ULONG               slack_bytes;
+ULONG               exact_first_level;
+ULONG               exact_second_level;
+ULONG               available_bytes;
+ULONG               first_level;
+ULONG               second_level;
+ULONG               level_bits;
+ULONG               map;
+
+
+    /* Free blocks keep their free list links in their memory area, make sure the
+       block is large enough to hold them once it is released.  */
+    if (memory_size < TX_BYTE_POOL_TLSF_AREA_MIN)
+    {
+
+        /* Use the smallest memory area.  */
+        memory_size =  TX_BYTE_POOL_TLSF_AREA_MIN;
+    }
+
+    /* Determine if the memory must be aligned beyond the alignment of the blocks.  */
+    required_size =  memory_size;
+    if (alignment > (sizeof(ALIGN_TYPE)))
+    {
+
+        /* Yes, any block that also holds the alignment and a minimum block for the slack
+           holds the memory at an aligned address.  */
+        required_size =  (memory_size + alignment) + TX_BYTE_POOL_TLSF_BLOCK_MIN;
+    }
+
+    /* Find the list of the size itself.  */
+    TX_BYTE_POOL_TLSF_MAPPING(required_size, exact_first_level, exact_second_level)
+
+    /* Round the size up to the next list boundary.  */
+    search_size =  required_size;
+    if (search_size >= TX_BYTE_POOL_TLSF_SMALL_BLOCK)
+    {
+
+        TX_BYTE_POOL_TLSF_HIGHEST_SET_BIT_CALCULATE(search_size, level_bits)
+        search_size =  search_size + ((((ULONG) 1) << (level_bits - TX_BYTE_POOL_TLSF_SL_LOG2)) - ((ULONG) 1));
+    }
+
+    /* Find the list for the rounded size.  */
+    TX_BYTE_POOL_TLSF_MAPPING(search_size, first_level, second_level)
+
+    /* Default to no block found.  */
+    current_ptr =  TX_NULL;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup thread pointer.  */
+    TX_THREAD_GET_CURRENT(thread_ptr)
+
+    /* Setup ownership of the byte pool.  */
+    pool_ptr -> tx_byte_pool_owner =  thread_ptr;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total fragment search counter.  */
+    _tx_byte_pool_performance_search_count++;
+
+    /* Increment the number of fragments searched on this pool.  */
+    pool_ptr -> tx_byte_pool_performance_search_count++;
+#endif
+
+    /* Pickup the TLSF control structure.  */
+    tlsf_ptr =  pool_ptr -> tx_byte_pool_tlsf;
+
+    /* Determine if the size is within the ranges of the pool.  */
+    if (first_level < ((ULONG) tlsf_ptr -> tx_byte_pool_tlsf_fl_count))
+    {
+
+        /* Pickup the non-empty lists of this range at or above the size's list.  */
+        map =  tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] & ((~((ULONG) 0)) << second_level);
+        if (map == ((ULONG) 0))
+        {
+
+            /* None, pickup the non-empty ranges above this one.  */
+            if (first_level < ((ULONG) (TX_BYTE_POOL_TLSF_FL_MAX - ((UINT) 1))))
+            {
+
+                map =  tlsf_ptr -> tx_byte_pool_tlsf_fl_bitmap & ((~((ULONG) 0)) << (first_level + ((ULONG) 1)));
+            }
+
+            /* Determine if there is a non-empty range.  */
+            if (map != ((ULONG) 0))
+            {
+
+                /* Yes, take the lists of the lowest one.  */
+                TX_LOWEST_SET_BIT_CALCULATE(map, first_level)
+                map =  tlsf_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level];
+            }
+        }
+
+        /* Determine if a non-empty list was found.  */
+        if (map != ((ULONG) 0))
+        {
+
+            /* Yes, take the first block of the lowest list.  */
+            TX_LOWEST_SET_BIT_CALCULATE(map, second_level)
+            current_ptr =  tlsf_ptr -> tx_byte_pool_tlsf_free_list[(first_level * ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT)) + second_level];
+        }
+    }
+
+    /* Determine if a block still needs to be found.  */
+    if (current_ptr == TX_NULL)
+    {
+
+        /* Determine if the size's own list is within the ranges of the pool.  */
+        if (exact_first_level < ((ULONG) tlsf_ptr -> tx_byte_pool_tlsf_fl_count))
+        {
+
+            /* Yes, the first block of this list may still be large enough.  */
+            current_ptr =  tlsf_ptr -> tx_byte_pool_tlsf_free_list[(exact_first_level * ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT)) + exact_second_level];
+            if (current_ptr != TX_NULL)
+            {
+
+                /* Determine if the block is too small.  */
+                if ((TX_UCHAR_POINTER_DIF(TX_BYTE_POOL_TLSF_NEXT(current_ptr), current_ptr) - TX_BYTE_POOL_TLSF_OVERHEAD) < required_size)
+                {
+
+                    /* Yes, there is no block for this size.  */
+                    current_ptr =  TX_NULL;
+                }
+            }
+        }
+    }
+
+    /* Determine if a block was found.  */
+    if (current_ptr != TX_NULL)
+    {
+
+        /* Remove the block from its free list.  */
+        _tx_byte_pool_tlsf_remove(tlsf_ptr, current_ptr);
+
+        /* Calculate the size of the block's memory area.  */
+        next_ptr =         TX_BYTE_POOL_TLSF_NEXT(current_ptr);
+        available_bytes =  TX_UCHAR_POINTER_DIF(next_ptr, current_ptr) - TX_BYTE_POOL_TLSF_OVERHEAD;
+
+        /* Determine if the memory must be aligned beyond the alignment of the blocks.  */
+        if (alignment > (sizeof(ALIGN_TYPE)))
+        {
+
+            /* Yes, calculate the slack in front of the aligned memory in this block.  */
+            TX_BYTE_POOL_ALIGNED_SLACK_CALCULATE(current_ptr, alignment, TX_BYTE_POOL_TLSF_BLOCK_MIN, slack_bytes)
+
+            /* Determine if the aligned memory starts after the beginning of the block.  */
+            if (slack_bytes != ((ULONG) 0))
+            {
+
+                /* Yes, split off the slack as a free block in front of the aligned block.  */
+                next_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, slack_bytes);
+
+                /* Setup the aligned block between the slack and the slack's next block.  */
+                TX_BYTE_POOL_TLSF_NEXT(next_ptr) =                                 TX_BYTE_POOL_TLSF_NEXT(current_ptr);
+                TX_BYTE_POOL_TLSF_PREVIOUS(next_ptr) =                             current_ptr;
+                TX_BYTE_POOL_TLSF_PREVIOUS(TX_BYTE_POOL_TLSF_NEXT(next_ptr)) =     next_ptr;
+                TX_BYTE_POOL_TLSF_NEXT(current_ptr) =                              next_ptr;
+
+                /* Place the slack on its free list.  Its physically previous block is
+                   allocated, as free neighbors are always merged.  */
+                _tx_byte_pool_tlsf_insert(tlsf_ptr, current_ptr);
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total split counter.  */
+                _tx_byte_pool_performance_split_count++;
+
+                /* Increment the number of blocks split on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+
+                /* Continue with the aligned block, the slack stays free.  */
+                current_ptr =      next_ptr;
+                next_ptr =         TX_BYTE_POOL_TLSF_NEXT(current_ptr);
+                available_bytes =  available_bytes - slack_bytes;
+            }
+        }
+
+        /* Determine if we need to split this block.  */
+        if ((available_bytes - memory_size) >= TX_BYTE_POOL_TLSF_BLOCK_MIN)
+        {
+
+            /* Split the block.  */
+            next_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (memory_size + TX_BYTE_POOL_TLSF_OVERHEAD));
+
+            /* Setup the new free block between the current block and its next block.  */
+            TX_BYTE_POOL_TLSF_NEXT(next_ptr) =                                 TX_BYTE_POOL_TLSF_NEXT(current_ptr);
+            TX_BYTE_POOL_TLSF_OWNER(next_ptr) =                                TX_BYTE_BLOCK_FREE;
+            TX_BYTE_POOL_TLSF_PREVIOUS(next_ptr) =                             current_ptr;
+            TX_BYTE_POOL_TLSF_PREVIOUS(TX_BYTE_POOL_TLSF_NEXT(next_ptr)) =     next_ptr;
+            TX_BYTE_POOL_TLSF_NEXT(current_ptr) =                              next_ptr;
+
+            /* Place the new free block on its free list.  */
+            _tx_byte_pool_tlsf_insert(tlsf_ptr, next_ptr);
+
+            /* Increase the total fragment counter.  */
+            pool_ptr -> tx_byte_pool_fragments++;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total split counter.  */
+            _tx_byte_pool_performance_split_count++;
+
+            /* Increment the number of blocks split on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+        }
+
+        /* In any case, mark the current block as allocated.  */
+        TX_BYTE_POOL_TLSF_OWNER_POOL(current_ptr) =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+
+        /* Reduce the number of available bytes in the pool.  */
+        pool_ptr -> tx_byte_pool_available =
+            pool_ptr -> tx_byte_pool_available - TX_UCHAR_POINTER_DIF(next_ptr, current_ptr);
+
+        /* Adjust the pointer for the application.  */
+        current_ptr =  TX_UCHAR_POINTER_ADD(current_ptr, (((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))));
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the memory pointer.  */
+    return(current_ptr);
+}
+
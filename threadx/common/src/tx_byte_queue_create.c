@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_queue_create                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a byte queue, which holds messages of any     */
+/*    size in the supplied memory area.  The memory area is used as one   */
+/*    ring buffer of records, each of which is a ULONG with the message   */
+/*    size followed by the message, padded to a whole number of ULONGs.   */
+/*    The memory area must be ULONG aligned, and its size is rounded down */
+/*    to a whole number of ULONGs.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to byte queue control     */
+/*                                        block                           */
+/*    name_ptr                          Pointer to byte queue name        */
+/*    queue_start                       Starting address of the ring      */
+/*                                        buffer                          */
+/*    queue_size                        Number of bytes in the ring       */
+/*                                        buffer                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_queue_create(TX_BYTE_QUEUE *queue_ptr, CHAR *name_ptr, VOID *queue_start, ULONG queue_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           capacity;
+TX_BYTE_QUEUE   *next_queue;
+TX_BYTE_QUEUE   *previous_queue;
+
+
+    /* Initialize byte queue control block to all zeros.  */
+    TX_MEMSET(queue_ptr, 0, (sizeof(TX_BYTE_QUEUE)));
+
+    /* Setup the basic byte queue fields.  */
+    queue_ptr -> tx_byte_queue_name =  name_ptr;
+
+    /* Round the size of the ring buffer down to a whole number of ULONGs, so
+       that every record starts on a ULONG boundary.  */
+    capacity =  queue_size & (~(((ULONG) (sizeof(ULONG))) - ((ULONG) 1)));
+
+    /* Save the starting address and calculate the ending address of
+       the ring buffer.  Note that the ending address is really one past the
+       end!  */
+    queue_ptr -> tx_byte_queue_start =  TX_VOID_TO_UCHAR_POINTER_CONVERT(queue_start);
+    queue_ptr -> tx_byte_queue_end =    TX_UCHAR_POINTER_ADD(queue_ptr -> tx_byte_queue_start, capacity);
+
+    /* Set the read and write pointers to the beginning of the ring buffer.  */
+    queue_ptr -> tx_byte_queue_read =   queue_ptr -> tx_byte_queue_start;
+    queue_ptr -> tx_byte_queue_write =  queue_ptr -> tx_byte_queue_start;
+
+    /* Setup the number of bytes available and the capacity of the byte queue.  */
+    queue_ptr -> tx_byte_queue_available_bytes =  capacity;
+    queue_ptr -> tx_byte_queue_capacity =         capacity;
+
+    /* Disable interrupts to put the byte queue on the created list.  */
+    TX_DISABLE
+
+    /* Setup the byte queue ID to make it valid.  */
+    queue_ptr -> tx_byte_queue_id =  TX_BYTE_QUEUE_ID;
+
+    /* Place the byte queue on the list of created byte queues.  First,
+       check for an empty list.  */
+    if (_tx_byte_queue_created_count == TX_EMPTY)
+    {
+
+        /* The created byte queue list is empty.  Add byte queue to empty list.  */
+        _tx_byte_queue_created_ptr =                   queue_ptr;
+        queue_ptr -> tx_byte_queue_created_next =      queue_ptr;
+        queue_ptr -> tx_byte_queue_created_previous =  queue_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_queue =      _tx_byte_queue_created_ptr;
+        previous_queue =  next_queue -> tx_byte_queue_created_previous;
+
+        /* Place the new byte queue in the list.  */
+        next_queue -> tx_byte_queue_created_previous =  queue_ptr;
+        previous_queue -> tx_byte_queue_created_next =  queue_ptr;
+
+        /* Setup this byte queue's created links.  */
+        queue_ptr -> tx_byte_queue_created_previous =  previous_queue;
+        queue_ptr -> tx_byte_queue_created_next =      next_queue;
+    }
+
+    /* Increment the created byte queue count.  */
+    _tx_byte_queue_created_count++;
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_BYTE_QUEUE, queue_ptr, name_ptr, queue_size, 0)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_QUEUE_CREATE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(queue_start), queue_size, TX_POINTER_TO_ULONG_CONVERT(&next_queue), TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BYTE_QUEUE_CREATE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
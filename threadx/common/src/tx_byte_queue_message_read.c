@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_queue_message_read                         PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the record at the read pointer of the         */
+/*    specified byte queue and copies its message to the destination.  A  */
+/*    message that reaches the end of the ring buffer is copied in two    */
+/*    pieces.  The caller must make sure the byte queue is not empty and  */
+/*    the message fits in the destination.  This function must be called  */
+/*    with interrupts disabled.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to byte queue control     */
+/*                                        block                           */
+/*    destination_ptr                   Pointer to the destination of the */
+/*                                        message                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    size                              Size of the message in bytes      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_queue_receive           Receive a byte queue message       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_byte_queue_message_read(TX_BYTE_QUEUE *queue_ptr, VOID *destination_ptr)
+{
+
+UCHAR           *read_ptr;
+UCHAR           *destination;
+ULONG           *size_ptr;
+ULONG           size;
+ULONG           first_size;
+ULONG           record_size;
+ULONG           offset;
+
+
+    /* Pickup the message size at the read pointer.  */
+    read_ptr =  queue_ptr -> tx_byte_queue_read;
+    size_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(read_ptr);
+    size =      *size_ptr;
+
+    /* Calculate the size of the record of this message.  */
+    record_size =  TX_BYTE_QUEUE_RECORD_SIZE(size);
+
+    /* Move past the message size.  */
+    read_ptr =  TX_UCHAR_POINTER_ADD(read_ptr, (sizeof(ULONG)));
+
+    /* Determine if we are at the end.  */
+    if (read_ptr == queue_ptr -> tx_byte_queue_end)
+    {
+
+        /* Yes, wrap around to the beginning.  */
+        read_ptr =  queue_ptr -> tx_byte_queue_start;
+    }
+
+    /* Determine how much of the message is before the end of the ring buffer.  */
+    first_size =   TX_UCHAR_POINTER_DIF(queue_ptr -> tx_byte_queue_end, read_ptr);
+    destination =  TX_VOID_TO_UCHAR_POINTER_CONVERT(destination_ptr);
+    if (size <= first_size)
+    {
+
+        /* The whole message is there, copy it in one piece.  */
+        TX_BYTE_QUEUE_MESSAGE_COPY(read_ptr, destination, size);
+    }
+    else
+    {
+
+        /* The message wraps around, copy the part up to the end of the ring
+           buffer and then the rest from the beginning.  */
+        TX_BYTE_QUEUE_MESSAGE_COPY(read_ptr, destination, first_size);
+        TX_BYTE_QUEUE_MESSAGE_COPY(queue_ptr -> tx_byte_queue_start, TX_UCHAR_POINTER_ADD(destination, first_size), (size - first_size));
+    }
+
+    /* Increase the number of bytes available.  */
+    queue_ptr -> tx_byte_queue_available_bytes =  queue_ptr -> tx_byte_queue_available_bytes + record_size;
+
+    /* Decrease the enqueued count.  */
+    queue_ptr -> tx_byte_queue_enqueued--;
+
+    /* Determine if the byte queue is now empty.  */
+    if (queue_ptr -> tx_byte_queue_enqueued == TX_NO_MESSAGES)
+    {
+
+        /* Yes, move the read and write pointers back to the beginning so
+           that the next messages are less likely to wrap around.  */
+        queue_ptr -> tx_byte_queue_read =   queue_ptr -> tx_byte_queue_start;
+        queue_ptr -> tx_byte_queue_write =  queue_ptr -> tx_byte_queue_start;
+    }
+    else
+    {
+
+        /* Move the read pointer past the record.  */
+        offset =  TX_UCHAR_POINTER_DIF(queue_ptr -> tx_byte_queue_read, queue_ptr -> tx_byte_queue_start) + record_size;
+        if (offset >= queue_ptr -> tx_byte_queue_capacity)
+        {
+
+            /* Wrap around to the beginning.  */
+            offset =  offset - queue_ptr -> tx_byte_queue_capacity;
+        }
+        queue_ptr -> tx_byte_queue_read =  TX_UCHAR_POINTER_ADD(queue_ptr -> tx_byte_queue_start, offset);
+    }
+
+    /* Return the size of the message.  */
+    return(size);
+}
+
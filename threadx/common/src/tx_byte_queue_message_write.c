@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_queue_message_write                        PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the record of a message at the write pointer   */
+/*    of the specified byte queue.  A message that reaches the end of the */
+/*    ring buffer is copied in two pieces, so no message is ever copied   */
+/*    more than once.  The caller must make sure the record fits.  This   */
+/*    function must be called with interrupts disabled.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to byte queue control     */
+/*                                        block                           */
+/*    source_ptr                        Pointer to the message            */
+/*    size                              Size of the message in bytes      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_queue_send              Send a byte queue message          */
+/*    _tx_byte_queue_receive           Receive a byte queue message       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_queue_message_write(TX_BYTE_QUEUE *queue_ptr, VOID *source_ptr, ULONG size)
+{
+
+UCHAR           *write_ptr;
+UCHAR           *source;
+ULONG           *size_ptr;
+ULONG           first_size;
+ULONG           record_size;
+ULONG           offset;
+
+
+    /* Calculate the size of the record of this message.  */
+    record_size =  TX_BYTE_QUEUE_RECORD_SIZE(size);
+
+    /* Store the message size at the write pointer.  */
+    write_ptr =  queue_ptr -> tx_byte_queue_write;
+    size_ptr =   TX_VOID_TO_ULONG_POINTER_CONVERT(write_ptr);
+    *size_ptr =  size;
+
+    /* Move past the message size.  */
+    write_ptr =  TX_UCHAR_POINTER_ADD(write_ptr, (sizeof(ULONG)));
+
+    /* Determine if we are at the end.  */
+    if (write_ptr == queue_ptr -> tx_byte_queue_end)
+    {
+
+        /* Yes, wrap around to the beginning.  */
+        write_ptr =  queue_ptr -> tx_byte_queue_start;
+    }
+
+    /* Determine how much of the message fits before the end of the ring buffer.  */
+    first_size =  TX_UCHAR_POINTER_DIF(queue_ptr -> tx_byte_queue_end, write_ptr);
+    source =      TX_VOID_TO_UCHAR_POINTER_CONVERT(source_ptr);
+    if (size <= first_size)
+    {
+
+        /* The whole message fits, copy it in one piece.  */
+        TX_BYTE_QUEUE_MESSAGE_COPY(source, write_ptr, size);
+    }
+    else
+    {
+
+        /* The message wraps around, copy the part up to the end of the ring
+           buffer and then the rest to the beginning.  */
+        TX_BYTE_QUEUE_MESSAGE_COPY(source, write_ptr, first_size);
+        TX_BYTE_QUEUE_MESSAGE_COPY(TX_UCHAR_POINTER_ADD(source, first_size), queue_ptr -> tx_byte_queue_start, (size - first_size));
+    }
+
+    /* Move the write pointer past the record.  */
+    offset =  TX_UCHAR_POINTER_DIF(queue_ptr -> tx_byte_queue_write, queue_ptr -> tx_byte_queue_start) + record_size;
+    if (offset >= queue_ptr -> tx_byte_queue_capacity)
+    {
+
+        /* Wrap around to the beginning.  */
+        offset =  offset - queue_ptr -> tx_byte_queue_capacity;
+    }
+    queue_ptr -> tx_byte_queue_write =  TX_UCHAR_POINTER_ADD(queue_ptr -> tx_byte_queue_start, offset);
+
+    /* Reduce the number of bytes available.  */
+    queue_ptr -> tx_byte_queue_available_bytes =  queue_ptr -> tx_byte_queue_available_bytes - record_size;
+
+    /* Increase the enqueued count.  */
+    queue_ptr -> tx_byte_queue_enqueued++;
+}
+
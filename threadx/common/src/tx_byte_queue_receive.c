@@ -0,0 +1,437 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_queue_receive                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the message at the front of the byte queue    */
+/*    and copies it to the destination.  If the message is larger than    */
+/*    the destination, it stays in the byte queue and TX_SIZE_ERROR is    */
+/*    returned along with the size of the message.  After a message is    */
+/*    received, the messages of threads suspended on the full byte queue  */
+/*    are moved into it in order, for as long as their records fit.  If   */
+/*    the byte queue is empty, this function waits for a message          */
+/*    according to the option specified.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to byte queue control     */
+/*                                        block                           */
+/*    destination_ptr                   Pointer to the destination of the */
+/*                                        message                         */
+/*    destination_size                  Size of the destination in bytes  */
+/*    actual_size                       Destination for the size of the   */
+/*                                        message                         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_queue_message_read       Read a message record             */
+/*    _tx_byte_queue_message_write      Write a message record            */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_byte_queue_receive           Error checking byte queue receive */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_queue_receive(TX_BYTE_QUEUE *queue_ptr, VOID *destination_ptr, ULONG destination_size,
+                    ULONG *actual_size, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_THREAD       *resume_list;
+TX_THREAD       *resume_tail;
+ULONG           *size_ptr;
+ULONG           size;
+UINT            suspended_count;
+UINT            resume_count;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Initialize the list of threads to resume.  */
+    resume_list =   TX_NULL;
+    resume_tail =   TX_NULL;
+    resume_count =  ((UINT) 0);
+
+    /* Disable interrupts to receive message from byte queue.  */
+    TX_DISABLE
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total messages received counter.  */
+    _tx_byte_queue_performance_messages_received_count++;
+
+    /* Increment the number of messages received from this byte queue.  */
+    queue_ptr -> tx_byte_queue_performance_messages_received_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_QUEUE_RECEIVE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(destination_ptr), wait_option, queue_ptr -> tx_byte_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BYTE_QUEUE_RECEIVE_INSERT
+
+    /* Determine if there is anything in the byte queue.  */
+    if (queue_ptr -> tx_byte_queue_enqueued != TX_NO_MESSAGES)
+    {
+
+        /* Pickup the size of the message at the front of the byte queue.  */
+        size_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(queue_ptr -> tx_byte_queue_read);
+        size =      *size_ptr;
+
+        /* Determine if the message fits in the destination.  */
+        if (size > destination_size)
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* No, leave the message in the byte queue and return error completion.  */
+            status =  TX_SIZE_ERROR;
+        }
+        else
+        {
+
+            /* Remove the message from the byte queue.  */
+            size =  _tx_byte_queue_message_read(queue_ptr, destination_ptr);
+
+            /* Pickup the thread suspension count.  */
+            suspended_count =  queue_ptr -> tx_byte_queue_suspended_count;
+
+            /* Move the messages of threads suspended on the full byte queue
+               into it, in order, for as long as they fit.  */
+            while (suspended_count != TX_NO_SUSPENSIONS)
+            {
+
+                /* Pickup the head of the suspension list.  */
+                thread_ptr =  queue_ptr -> tx_byte_queue_suspension_list;
+
+                /* Determine if the record of the thread's message fits.  */
+                if (TX_BYTE_QUEUE_RECORD_SIZE(thread_ptr -> tx_thread_suspend_info) > queue_ptr -> tx_byte_queue_available_bytes)
+                {
+
+                    /* No, the thread and all threads after it keep waiting.  */
+                    break;
+                }
+
+                /* Place the thread's message in the byte queue.  */
+                _tx_byte_queue_message_write(queue_ptr, thread_ptr -> tx_thread_additional_suspend_info, thread_ptr -> tx_thread_suspend_info);
+
+                /* Remove the thread from the suspension list.  */
+                suspended_count--;
+                if (suspended_count == TX_NO_SUSPENSIONS)
+                {
+
+                    /* Yes, the only suspended thread.  */
+
+                    /* Update the head pointer.  */
+                    queue_ptr -> tx_byte_queue_suspension_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* At least one more thread is on the same suspension list.  */
+
+                    /* Update the list head pointer.  */
+                    next_thread =                                 thread_ptr -> tx_thread_suspended_next;
+                    queue_ptr -> tx_byte_queue_suspension_list =  next_thread;
+
+                    /* Update the links of the adjacent threads.  */
+                    previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                    next_thread -> tx_thread_suspended_previous =  previous_thread;
+                    previous_thread -> tx_thread_suspended_next =  next_thread;
+                }
+
+                /* Clear cleanup routine to avoid timeout.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+                /* Add the thread to the list of threads to resume.  */
+                if (resume_count == ((UINT) 0))
+                {
+
+                    /* This is the first thread, temporarily disable preemption.  */
+                    _tx_thread_preempt_disable++;
+                    resume_list =  thread_ptr;
+                }
+                else
+                {
+
+                    /* Link the thread after the last one.  */
+                    resume_tail -> tx_thread_suspended_next =  thread_ptr;
+                }
+                resume_tail =  thread_ptr;
+                resume_count++;
+            }
+
+            /* Update the suspension count.  */
+            queue_ptr -> tx_byte_queue_suspended_count =  suspended_count;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the threads whose messages were transferred.  */
+            if (resume_count != ((UINT) 0))
+            {
+
+                /* Pickup the first thread to resume.  */
+                thread_ptr =  resume_list;
+                while (resume_count != ((UINT) 0))
+                {
+
+                    /* Decrement the number of threads to resume.  */
+                    resume_count--;
+
+                    /* Pickup the next thread before this one is resumed.  */
+                    next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                    /* Lockout interrupts.  */
+                    TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                    /* Resume the thread!  */
+                    _tx_thread_system_ni_resume(thread_ptr);
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+#else
+
+                    /* Temporarily disable preemption again.  */
+                    _tx_thread_preempt_disable++;
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+
+                    /* Resume the thread.  */
+                    _tx_thread_system_resume(thread_ptr);
+#endif
+
+                    /* Move to the next thread.  */
+                    thread_ptr =  next_thread;
+                }
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Restore previous preempt posture.  */
+                _tx_thread_preempt_disable--;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Check for preemption.  */
+                _tx_thread_system_preempt_check();
+            }
+        }
+
+        /* Return the size of the message.  */
+        *actual_size =  size;
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_QUEUE_EMPTY;
+
+            /* No message was received.  */
+            *actual_size =  ((ULONG) 0);
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total number of byte queue empty suspensions.  */
+            _tx_byte_queue_performance_empty_suspension_count++;
+
+            /* Increment the number of empty suspensions on this byte queue.  */
+            queue_ptr -> tx_byte_queue_performance_empty_suspension_count++;
+#endif
+
+            /* Pickup the thread suspension count.  */
+            suspended_count =  queue_ptr -> tx_byte_queue_suspended_count;
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_byte_queue_cleanup);
+
+            /* Setup cleanup information, i.e. this byte queue control
+               block, the destination pointer, and the size of the destination.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) queue_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) destination_ptr;
+            thread_ptr -> tx_thread_suspend_info =             destination_size;
+            thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                queue_ptr -> tx_byte_queue_suspension_list =    thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   queue_ptr -> tx_byte_queue_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            queue_ptr -> tx_byte_queue_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+
+            /* Determine if a message was received or was too large.  */
+            if ((status == TX_SUCCESS) || (status == TX_SIZE_ERROR))
+            {
+
+                /* Yes, the sending thread stored the size of the message.  */
+                *actual_size =  thread_ptr -> tx_thread_suspend_info;
+            }
+            else
+            {
+
+                /* No message was received.  */
+                *actual_size =  ((ULONG) 0);
+            }
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Immediate return, return error completion.  */
+        status =  TX_QUEUE_EMPTY;
+
+        /* No message was received.  */
+        *actual_size =  ((ULONG) 0);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,501 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_queue_send                                 PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a message of the specified size into the byte  */
+/*    queue.  If threads are suspended on the empty byte queue, the       */
+/*    message is copied directly to the first one whose destination is    */
+/*    large enough.  Suspended threads ahead of it with a destination     */
+/*    that is too small are resumed with TX_SIZE_ERROR and the size of    */
+/*    the message.  If the record of the message does not fit, or threads */
+/*    are already waiting to send, this function waits for room according */
+/*    to the option specified.  A message whose record is larger than the */
+/*    ring buffer is never accepted.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to byte queue control     */
+/*                                        block                           */
+/*    source_ptr                        Pointer to the message            */
+/*    size                              Size of the message in bytes      */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_queue_message_write      Write a message record            */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_byte_queue_send              Error checking byte queue send    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_byte_queue_send(TX_BYTE_QUEUE *queue_ptr, VOID *source_ptr, ULONG size, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_THREAD       *resume_list;
+TX_THREAD       *resume_tail;
+ULONG           record_size;
+UINT            suspended_count;
+UINT            resume_count;
+UINT            delivered;
+UINT            thread_status;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_BYTE_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Initialize the list of threads to resume.  */
+    resume_list =   TX_NULL;
+    resume_tail =   TX_NULL;
+    resume_count =  ((UINT) 0);
+
+    /* Calculate the size of the record of this message.  */
+    record_size =  TX_BYTE_QUEUE_RECORD_SIZE(size);
+
+    /* Disable interrupts to place message in the byte queue.  */
+    TX_DISABLE
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total messages sent counter.  */
+    _tx_byte_queue_performance_messages_sent_count++;
+
+    /* Increment the number of messages sent to this byte queue.  */
+    queue_ptr -> tx_byte_queue_performance_messages_sent_count++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_BYTE_QUEUE_SEND, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(source_ptr), size, wait_option, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_BYTE_QUEUE_SEND_INSERT
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  queue_ptr -> tx_byte_queue_suspended_count;
+
+    /* Determine if the record can ever fit in the ring buffer.  */
+    if (record_size > queue_ptr -> tx_byte_queue_capacity)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The message is too large for this byte queue, return error completion.  */
+        status =  TX_SIZE_ERROR;
+    }
+
+    /* Determine if there are threads suspended on an empty byte queue.  */
+    else if ((queue_ptr -> tx_byte_queue_enqueued == TX_NO_MESSAGES) && (suspended_count != TX_NO_SUSPENSIONS))
+    {
+
+        /* Give the message to the first suspended thread whose destination is
+           large enough.  */
+        delivered =  TX_FALSE;
+        do
+        {
+
+            /* Pickup the head of the suspension list.  */
+            thread_ptr =  queue_ptr -> tx_byte_queue_suspension_list;
+
+            /* Determine if the message fits in the thread's destination.  */
+            if (size <= thread_ptr -> tx_thread_suspend_info)
+            {
+
+                /* Yes, copy the message to the suspended thread's destination.  */
+                TX_BYTE_QUEUE_MESSAGE_COPY(source_ptr, thread_ptr -> tx_thread_additional_suspend_info, size);
+                thread_status =  TX_SUCCESS;
+                delivered =      TX_TRUE;
+            }
+            else
+            {
+
+                /* No, the thread is resumed with an error so that it can try
+                   again with a larger destination.  */
+                thread_status =  TX_SIZE_ERROR;
+            }
+
+            /* Return the size of the message to the thread.  */
+            thread_ptr -> tx_thread_suspend_info =  size;
+
+            /* Remove the thread from the suspension list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                queue_ptr -> tx_byte_queue_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                                 thread_ptr -> tx_thread_suspended_next;
+                queue_ptr -> tx_byte_queue_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+            }
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  thread_status;
+
+            /* Add the thread to the list of threads to resume.  */
+            if (resume_count == ((UINT) 0))
+            {
+
+                /* This is the first thread, temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_tail -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_tail =  thread_ptr;
+            resume_count++;
+
+        } while ((delivered == TX_FALSE) && (suspended_count != TX_NO_SUSPENSIONS));
+
+        /* Update the suspension count.  */
+        queue_ptr -> tx_byte_queue_suspended_count =  suspended_count;
+
+        /* Determine if no thread could take the message.  */
+        if (delivered == TX_FALSE)
+        {
+
+            /* Place the message in the byte queue, which is empty.  */
+            _tx_byte_queue_message_write(queue_ptr, source_ptr, size);
+        }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Pickup the notify callback routine for this byte queue.  */
+        queue_send_notify =  queue_ptr -> tx_byte_queue_send_notify;
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the threads that were given the message or an error.  */
+        if (resume_count != ((UINT) 0))
+        {
+
+            /* Pickup the first thread to resume.  */
+            thread_ptr =  resume_list;
+            while (resume_count != ((UINT) 0))
+            {
+
+                /* Decrement the number of threads to resume.  */
+                resume_count--;
+
+                /* Pickup the next thread before this one is resumed.  */
+                next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+                /* Lockout interrupts.  */
+                TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(thread_ptr);
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#else
+
+                /* Temporarily disable preemption again.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Resume the thread.  */
+                _tx_thread_system_resume(thread_ptr);
+#endif
+
+                /* Move to the next thread.  */
+                thread_ptr =  next_thread;
+            }
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Restore previous preempt posture.  */
+            _tx_thread_preempt_disable--;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Check for preemption.  */
+            _tx_thread_system_preempt_check();
+        }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if a notify callback is required.  */
+        if (queue_send_notify != TX_NULL)
+        {
+
+            /* Call application byte queue send notification.  */
+            (queue_send_notify)(queue_ptr);
+        }
+#endif
+    }
+
+    /* Determine if the record fits and no other thread is waiting to send.  */
+    else if ((record_size <= queue_ptr -> tx_byte_queue_available_bytes) && (suspended_count == TX_NO_SUSPENSIONS))
+    {
+
+        /* Simply place the message in the byte queue.  */
+        _tx_byte_queue_message_write(queue_ptr, source_ptr, size);
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Pickup the notify callback routine for this byte queue.  */
+        queue_send_notify =  queue_ptr -> tx_byte_queue_send_notify;
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if a notify callback is required.  */
+        if (queue_send_notify != TX_NULL)
+        {
+
+            /* Call application byte queue send notification.  */
+            (queue_send_notify)(queue_ptr);
+        }
+#endif
+    }
+
+    /* At this point, the byte queue is full. Determine if suspension is requested.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_QUEUE_FULL;
+        }
+        else
+        {
+
+            /* Yes, prepare for suspension of this thread.  */
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total number of byte queue full suspensions.  */
+            _tx_byte_queue_performance_full_suspension_count++;
+
+            /* Increment the number of full suspensions on this byte queue.  */
+            queue_ptr -> tx_byte_queue_performance_full_suspension_count++;
+#endif
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_byte_queue_cleanup);
+
+            /* Setup cleanup information, i.e. this byte queue control
+               block, the source pointer, and the message size.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) queue_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) source_ptr;
+            thread_ptr -> tx_thread_suspend_info =             size;
+            thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                queue_ptr -> tx_byte_queue_suspension_list =    thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =        thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =    thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   queue_ptr -> tx_byte_queue_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            queue_ptr -> tx_byte_queue_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Pickup the notify callback routine for this byte queue.  */
+            queue_send_notify =  queue_ptr -> tx_byte_queue_send_notify;
+#endif
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Determine if a notify callback is required.  */
+            if (thread_ptr -> tx_thread_suspend_status == TX_SUCCESS)
+            {
+
+                /* Determine if there is a notify callback.  */
+                if (queue_send_notify != TX_NULL)
+                {
+
+                    /* Call application byte queue send notification.  */
+                    (queue_send_notify)(queue_ptr);
+                }
+            }
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Otherwise, just return a queue full error message to the caller.  */
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the number of full non-suspensions on this byte queue.  */
+        queue_ptr -> tx_byte_queue_performance_full_error_count++;
+
+        /* Increment the total number of full non-suspensions.  */
+        _tx_byte_queue_performance_full_error_count++;
+#endif
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Return error completion.  */
+        status =  TX_QUEUE_FULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
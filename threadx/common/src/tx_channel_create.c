@@ -0,0 +1,177 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_channel_create                                  PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a channel, which passes fixed-size messages   */
+/*    from a single producer, typically an ISR, to a single consumer      */
+/*    thread.  The supplied memory area is divided into as many messages  */
+/*    as fit, rounded down to a power of two so that positions in the     */
+/*    ring are found with a mask.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    channel_ptr                       Pointer to channel control block  */
+/*    name_ptr                          Pointer to channel name           */
+/*    message_size                      Size of each message in ULONGs    */
+/*    channel_start                     Starting address of the message   */
+/*                                        area                            */
+/*    channel_size                      Number of bytes in the message    */
+/*                                        area                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*    TX_FEATURE_NOT_ENABLED            No channel atomic operations      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_channel_create(TX_CHANNEL *channel_ptr, CHAR *name_ptr, UINT message_size,
+                        VOID *channel_start, ULONG channel_size)
+{
+
+#ifdef TX_CHANNEL_NOT_SUPPORTED
+
+    TX_PARAMETER_NOT_USED(channel_ptr);
+    TX_PARAMETER_NOT_USED(name_ptr);
+    TX_PARAMETER_NOT_USED(message_size);
+    TX_PARAMETER_NOT_USED(channel_start);
+    TX_PARAMETER_NOT_USED(channel_size);
+
+    /* The channel atomic operations are not available, return error.  */
+    return(TX_FEATURE_NOT_ENABLED);
+#else
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            capacity;
+ULONG           messages;
+TX_CHANNEL      *next_channel;
+TX_CHANNEL      *previous_channel;
+
+
+    /* Initialize channel control block to all zeros.  */
+    TX_MEMSET(channel_ptr, 0, (sizeof(TX_CHANNEL)));
+
+    /* Setup the basic channel fields.  */
+    channel_ptr -> tx_channel_name =          name_ptr;
+    channel_ptr -> tx_channel_message_size =  message_size;
+    channel_ptr -> tx_channel_start =         TX_VOID_TO_ULONG_POINTER_CONVERT(channel_start);
+
+    /* Calculate the number of messages that fit in the message area.  */
+    messages =  channel_size / (((ULONG) message_size) * ((ULONG) (sizeof(ULONG))));
+
+    /* Round the number of messages down to a power of two.  */
+    capacity =  ((UINT) 1);
+    while ((((ULONG) capacity) * ((ULONG) 2)) <= messages)
+    {
+
+        /* Double the capacity.  */
+        capacity =  capacity * ((UINT) 2);
+    }
+    channel_ptr -> tx_channel_capacity =  capacity;
+
+    /* Disable interrupts to put the channel on the created list.  */
+    TX_DISABLE
+
+    /* Setup the channel ID to make it valid.  */
+    channel_ptr -> tx_channel_id =  TX_CHANNEL_ID;
+
+    /* Place the channel on the list of created channels.  First,
+       check for an empty list.  */
+    if (_tx_channel_created_count == TX_EMPTY)
+    {
+
+        /* The created channel list is empty.  Add channel to empty list.  */
+        _tx_channel_created_ptr =                     channel_ptr;
+        channel_ptr -> tx_channel_created_next =      channel_ptr;
+        channel_ptr -> tx_channel_created_previous =  channel_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_channel =      _tx_channel_created_ptr;
+        previous_channel =  next_channel -> tx_channel_created_previous;
+
+        /* Place the new channel in the list.  */
+        next_channel -> tx_channel_created_previous =  channel_ptr;
+        previous_channel -> tx_channel_created_next =  channel_ptr;
+
+        /* Setup this channel's created links.  */
+        channel_ptr -> tx_channel_created_previous =  previous_channel;
+        channel_ptr -> tx_channel_created_next =      next_channel;
+    }
+
+    /* Increment the created channel count.  */
+    _tx_channel_created_count++;
+
+    /* If trace is enabled, register this object.  */
+    TX_TRACE_OBJECT_REGISTER(TX_TRACE_OBJECT_TYPE_CHANNEL, channel_ptr, name_ptr, capacity, message_size)
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_CHANNEL_CREATE, channel_ptr, TX_POINTER_TO_ULONG_CONVERT(channel_start), capacity, message_size, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_CHANNEL_CREATE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+#endif
+}
+
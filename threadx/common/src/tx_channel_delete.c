@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_channel_delete                                  PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified channel.  If the consumer       */
+/*    thread is suspended on this channel, it is resumed with the         */
+/*    TX_DELETED return status.  The producer must not send to the        */
+/*    channel once it is deleted.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    channel_ptr                       Pointer to channel control block  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_channel_delete               Error checking channel delete     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_channel_delete(TX_CHANNEL *channel_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_CHANNEL      *next_channel;
+TX_CHANNEL      *previous_channel;
+
+
+    /* Disable interrupts to remove the channel from the created list.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_CHANNEL_DELETE, channel_ptr, TX_POINTER_TO_ULONG_CONVERT(&thread_ptr), 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* If trace is enabled, unregister this object.  */
+    TX_TRACE_OBJECT_UNREGISTER(channel_ptr)
+
+    /* Log this kernel call.  */
+    TX_EL_CHANNEL_DELETE_INSERT
+
+    /* Clear the channel ID to make it invalid.  */
+    channel_ptr -> tx_channel_id =  TX_CLEAR_ID;
+
+    /* Decrement the number of created channels.  */
+    _tx_channel_created_count--;
+
+    /* See if the channel is the only one on the list.  */
+    if (_tx_channel_created_count == TX_EMPTY)
+    {
+
+        /* Only created channel, just set the created list to NULL.  */
+        _tx_channel_created_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* Link-up the neighbors.  */
+        next_channel =                                 channel_ptr -> tx_channel_created_next;
+        previous_channel =                             channel_ptr -> tx_channel_created_previous;
+        next_channel -> tx_channel_created_previous =  previous_channel;
+        previous_channel -> tx_channel_created_next =  next_channel;
+
+        /* See if we have to update the created list head pointer.  */
+        if (_tx_channel_created_ptr == channel_ptr)
+        {
+
+            /* Yes, move the head pointer to the next link. */
+            _tx_channel_created_ptr =  next_channel;
+        }
+    }
+
+    /* Pickup the suspended consumer, if any.  */
+    thread_ptr =                                 channel_ptr -> tx_channel_suspension_list;
+    channel_ptr -> tx_channel_suspension_list =  TX_NULL;
+    TX_CHANNEL_SUSPENDED_STORE(&(channel_ptr -> tx_channel_suspended_count), TX_NO_SUSPENSIONS)
+
+    /* Determine if the consumer was suspended on this channel.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Clear the cleanup pointer, this prevents the timeout from doing
+           anything.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Set the return status in the thread to TX_DELETED.  */
+        thread_ptr -> tx_thread_suspend_status =  TX_DELETED;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume the thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
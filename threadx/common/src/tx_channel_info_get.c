@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_channel_info_get                                PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified channel.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    channel_ptr                       Pointer to channel control block  */
+/*    name                              Destination for the channel name  */
+/*    enqueued                          Destination for enqueued count    */
+/*    available_storage                 Destination for available storage */
+/*    suspended_thread                  Destination for pointer of the    */
+/*                                        consumer, if it is suspended    */
+/*    next_channel                      Destination for pointer to next   */
+/*                                        channel on the created list     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_channel_info_get             Error checking channel info get   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_channel_info_get(TX_CHANNEL *channel_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **suspended_thread, TX_CHANNEL **next_channel)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           count;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_CHANNEL_INFO_GET, channel_ptr, 0, 0, 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_CHANNEL_INFO_GET_INSERT
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Calculate the number of messages in the channel.  */
+    count =  TX_CHANNEL_INDEX_LOAD(&(channel_ptr -> tx_channel_write_index)) -
+                TX_CHANNEL_INDEX_LOAD(&(channel_ptr -> tx_channel_read_index));
+
+    /* Retrieve the name of the channel.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  channel_ptr -> tx_channel_name;
+    }
+
+    /* Retrieve the number of messages currently in the channel.  */
+    if (enqueued != TX_NULL)
+    {
+
+        *enqueued =  count;
+    }
+
+    /* Retrieve the number of messages that will still fit in the channel.  */
+    if (available_storage != TX_NULL)
+    {
+
+        *available_storage =  ((ULONG) channel_ptr -> tx_channel_capacity) - count;
+    }
+
+    /* Retrieve the consumer, if it is suspended on the channel.  */
+    if (suspended_thread != TX_NULL)
+    {
+
+        *suspended_thread =  channel_ptr -> tx_channel_suspension_list;
+    }
+
+    /* Retrieve the pointer to the next channel created.  */
+    if (next_channel != TX_NULL)
+    {
+
+        *next_channel =  channel_ptr -> tx_channel_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
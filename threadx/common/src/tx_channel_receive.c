@@ -0,0 +1,251 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_channel_receive                                 PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the oldest message from the channel on        */
+/*    behalf of its single consumer.  When a message is available, it is  */
+/*    copied out without disabling interrupts, unless event trace or      */
+/*    event logging is enabled, and the slot is handed back to the        */
+/*    producer with a release store of the read index.  If the channel    */
+/*    is empty, this function waits for a message according to the        */
+/*    option specified, and is resumed by the producer when the next      */
+/*    message is sent.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    channel_ptr                       Pointer to channel control block  */
+/*    destination_ptr                   Pointer to message destination    */
+/*                                        **** MUST BE LARGE ENOUGH TO    */
+/*                                             HOLD MESSAGE ****          */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_channel_receive              Error checking channel receive    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_channel_receive(TX_CHANNEL *channel_ptr, VOID *destination_ptr, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+ULONG           *source;
+ULONG           *destination;
+ULONG           read_index;
+ULONG           write_index;
+UINT            size;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Pickup the read index, which only the consumer updates, and the write
+       index of the producer.  Acquiring the write index makes the messages
+       it publishes visible.  */
+    read_index =   channel_ptr -> tx_channel_read_index;
+    write_index =  TX_CHANNEL_INDEX_LOAD(&(channel_ptr -> tx_channel_write_index));
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+
+    /* Disable interrupts only to insert this event into the trace buffer and
+       log this kernel call.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_CHANNEL_RECEIVE, channel_ptr, TX_POINTER_TO_ULONG_CONVERT(destination_ptr), wait_option, (write_index - read_index), TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_CHANNEL_RECEIVE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+
+    /* Determine if the channel is empty.  */
+    if (write_index == read_index)
+    {
+
+        /* Determine if the request specifies suspension.  */
+        if (wait_option == TX_NO_WAIT)
+        {
+
+            /* Channel is empty, return error completion.  */
+            status =  TX_QUEUE_EMPTY;
+        }
+        else
+        {
+
+            /* Disable interrupts to prepare for suspension.  */
+            TX_DISABLE
+
+            /* Determine if the preempt disable flag is non-zero.  */
+            if (_tx_thread_preempt_disable != ((UINT) 0))
+            {
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+                status =  TX_QUEUE_EMPTY;
+            }
+            else
+            {
+
+                /* Count the consumer as suspended before checking the channel
+                   again, so that either this check sees a message sent in the
+                   meantime or the producer sees the consumer and resumes it.  */
+                TX_CHANNEL_SUSPENDED_STORE(&(channel_ptr -> tx_channel_suspended_count), ((UINT) 1))
+                TX_CHANNEL_MEMORY_BARRIER
+                write_index =  TX_CHANNEL_INDEX_LOAD(&(channel_ptr -> tx_channel_write_index));
+
+                /* Determine if a message arrived in the meantime.  */
+                if (write_index != read_index)
+                {
+
+                    /* Yes, no suspension is needed.  */
+                    TX_CHANNEL_SUSPENDED_STORE(&(channel_ptr -> tx_channel_suspended_count), TX_NO_SUSPENSIONS)
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+                }
+                else
+                {
+
+                    /* Pickup thread pointer.  */
+                    TX_THREAD_GET_CURRENT(thread_ptr)
+
+                    /* Setup cleanup routine pointer.  */
+                    thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_channel_cleanup);
+
+                    /* Setup cleanup information, i.e. this channel control block.  */
+                    thread_ptr -> tx_thread_suspend_control_block =  (VOID *) channel_ptr;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+                    /* Increment the suspension sequence number, which is used to identify
+                       this suspension event.  */
+                    thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+                    /* Setup the suspension list, which only ever holds the consumer.  */
+                    channel_ptr -> tx_channel_suspension_list =   thread_ptr;
+                    thread_ptr -> tx_thread_suspended_next =      thread_ptr;
+                    thread_ptr -> tx_thread_suspended_previous =  thread_ptr;
+
+                    /* Set the state to suspended.  */
+                    thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                    /* Call actual non-interruptable thread suspension routine.  */
+                    _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+#else
+
+                    /* Set the suspending flag.  */
+                    thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+                    /* Setup the timeout period.  */
+                    thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+                    /* Temporarily disable preemption.  */
+                    _tx_thread_preempt_disable++;
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+
+                    /* Call actual thread suspension routine.  */
+                    _tx_thread_system_suspend(thread_ptr);
+#endif
+
+                    /* Return the completion status.  The producer resumes the
+                       consumer with TX_SUCCESS only after it has published a
+                       message, under the same protection as the resumption.  */
+                    status =  thread_ptr -> tx_thread_suspend_status;
+                }
+            }
+        }
+    }
+
+    /* Determine if a message is available.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Calculate the address of the slot of the oldest message.  */
+        size =    channel_ptr -> tx_channel_message_size;
+        source =  TX_ULONG_POINTER_ADD(channel_ptr -> tx_channel_start,
+                        (read_index & (((ULONG) channel_ptr -> tx_channel_capacity) - ((ULONG) 1))) * ((ULONG) size));
+
+        /* Copy the message out of the slot.  */
+        destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
+        TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+        /* Hand the slot back to the producer.  */
+        TX_CHANNEL_INDEX_STORE(&(channel_ptr -> tx_channel_read_index), read_index + ((ULONG) 1))
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,200 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_channel_send                                    PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a message in the channel on behalf of its      */
+/*    single producer, which may be an ISR.  It is wait-free and does     */
+/*    not disable interrupts: the message is copied to the slot after     */
+/*    the last one sent and published with a release store of the write   */
+/*    index.  Only if the consumer thread is waiting for a message, or    */
+/*    if event trace or event logging is enabled, are interrupts          */
+/*    disabled briefly.  If the channel is full, TX_QUEUE_FULL is         */
+/*    returned.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    channel_ptr                       Pointer to channel control block  */
+/*    source_ptr                        Pointer to message source         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_channel_send                 Error checking channel send       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_channel_send(TX_CHANNEL *channel_ptr, VOID *source_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+ULONG           *source;
+ULONG           *destination;
+ULONG           write_index;
+ULONG           read_index;
+UINT            size;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Pickup the write index, which only the producer updates, and the read
+       index of the consumer.  Acquiring the read index makes sure that the
+       consumer has copied a message out before its slot is reused.  */
+    write_index =  channel_ptr -> tx_channel_write_index;
+    read_index =   TX_CHANNEL_INDEX_LOAD(&(channel_ptr -> tx_channel_read_index));
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+
+    /* Disable interrupts only to insert this event into the trace buffer and
+       log this kernel call.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_CHANNEL_SEND, channel_ptr, TX_POINTER_TO_ULONG_CONVERT(source_ptr), (write_index - read_index), 0, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_CHANNEL_SEND_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+
+    /* Determine if the channel is full.  */
+    if ((write_index - read_index) == ((ULONG) channel_ptr -> tx_channel_capacity))
+    {
+
+        /* Channel is full, return error completion.  */
+        status =  TX_QUEUE_FULL;
+    }
+    else
+    {
+
+        /* Calculate the address of the slot of this message.  */
+        size =         channel_ptr -> tx_channel_message_size;
+        destination =  TX_ULONG_POINTER_ADD(channel_ptr -> tx_channel_start,
+                            (write_index & (((ULONG) channel_ptr -> tx_channel_capacity) - ((ULONG) 1))) * ((ULONG) size));
+
+        /* Copy the message into the slot.  */
+        source =  TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+        TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+        /* Publish the message to the consumer.  */
+        TX_CHANNEL_INDEX_STORE(&(channel_ptr -> tx_channel_write_index), write_index + ((ULONG) 1))
+
+        /* Order the publication before the check for a waiting consumer.  The
+           consumer counts itself as suspended before it checks the channel
+           again, so either it sees this message or this check sees it.  */
+        TX_CHANNEL_MEMORY_BARRIER
+
+        /* Determine if the consumer may be waiting for a message.  */
+        if (TX_CHANNEL_SUSPENDED_LOAD(&(channel_ptr -> tx_channel_suspended_count)) != TX_NO_SUSPENSIONS)
+        {
+
+            /* Disable interrupts to resume the consumer.  */
+            TX_DISABLE
+
+            /* Pickup the suspended consumer, if it is still suspended.  */
+            thread_ptr =  channel_ptr -> tx_channel_suspension_list;
+            if (thread_ptr != TX_NULL)
+            {
+
+                /* Remove the consumer from the suspension list.  */
+                channel_ptr -> tx_channel_suspension_list =  TX_NULL;
+                TX_CHANNEL_SUSPENDED_STORE(&(channel_ptr -> tx_channel_suspended_count), TX_NO_SUSPENSIONS)
+
+                /* Clear cleanup routine to avoid timeout.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(thread_ptr);
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#else
+
+                /* Temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Resume the thread.  */
+                _tx_thread_system_resume(thread_ptr);
+#endif
+            }
+            else
+            {
+
+                /* The consumer found the message itself, restore interrupts.  */
+                TX_RESTORE
+            }
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -63,6 +63,8 @@
 /*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_wait_multiple_complete Complete wait for multiple        */
+/*                                        objects                         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -75,6 +77,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            wait for multiple objects   */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_event_flags_set(TX_EVENT_FLAGS_GROUP *group_ptr, ULONG flags_to_set, UINT set_option)
@@ -89,6 +93,7 @@ TX_THREAD       *previous_thread;
 TX_THREAD       *satisfied_list;
 TX_THREAD       *last_satisfied;
 TX_THREAD       *suspended_list;
+TX_WAIT_BLOCK   *wait_block;
 UINT            suspended_count;
 ULONG           current_event_flags;
 ULONG           requested_flags;
@@ -593,6 +598,104 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
             }
         }
 
+        /* Examine the requests of any threads waiting for this group among multiple
+           objects.  */
+        wait_block =  group_ptr -> tx_event_flags_group_wait_block_list;
+        while (wait_block != TX_NULL)
+        {
+
+            /* Pickup the current event flags.  */
+            current_event_flags =  group_ptr -> tx_event_flags_group_current;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Apply any delayed clear operations.  */
+            current_event_flags =  current_event_flags & (~(group_ptr -> tx_event_flags_group_delayed_clear));
+#endif
+
+            /* Pickup the requested flags and the get option of the wait block.  */
+            requested_flags =  wait_block -> tx_wait_block_requested_flags;
+            get_option =       wait_block -> tx_wait_block_get_option;
+
+            /* Calculate the flags present.  */
+            flags_satisfied =  (current_event_flags & requested_flags);
+
+            /* Isolate the AND selection.  */
+            and_request =  (get_option & TX_AND);
+
+            /* Check for AND condition. All flags must be present to satisfy request.  */
+            if (and_request == TX_AND)
+            {
+
+                /* Determine if they satisfy the AND request.  */
+                if (flags_satisfied != requested_flags)
+                {
+
+                    /* No, not all the requested flags are present. Clear the flags present variable.  */
+                    flags_satisfied =  ((ULONG) 0);
+                }
+            }
+
+            /* Determine if the request is satisfied.  */
+            if (flags_satisfied != ((ULONG) 0))
+            {
+
+                /* Yes, return the actual event flags that satisfied the request.  */
+                wait_block -> tx_wait_block_actual_flags =  current_event_flags;
+
+                /* Pickup the clear bit.  */
+                clear_request =  (get_option & TX_EVENT_FLAGS_CLEAR_MASK);
+
+                /* Determine whether or not clearing needs to take place.  */
+                if (clear_request == TX_TRUE)
+                {
+
+                    /* Yes, clear the flags that satisfied this request.  */
+                    group_ptr -> tx_event_flags_group_current =  group_ptr -> tx_event_flags_group_current & (~requested_flags);
+                }
+
+                /* Complete the wait of the thread, which removes all of its wait blocks.  */
+                thread_ptr =  _tx_thread_wait_multiple_complete(wait_block, TX_SUCCESS);
+
+                /* Set the preempt check flag.  */
+                preempt_check =  TX_TRUE;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(thread_ptr);
+#else
+
+                /* Temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Resume thread.  */
+                _tx_thread_system_resume(thread_ptr);
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+#endif
+
+                /* Start over at the head of the list, which may have changed.  */
+                wait_block =  group_ptr -> tx_event_flags_group_wait_block_list;
+            }
+            else
+            {
+
+                /* Move to the next wait block, and stop at the end of the list.  */
+                wait_block =  wait_block -> tx_wait_block_next;
+                if (wait_block == group_ptr -> tx_event_flags_group_wait_block_list)
+                {
+
+                    /* Back at the head of the list.  */
+                    wait_block =  TX_NULL;
+                }
+            }
+        }
+
         /* Restore interrupts.  */
         TX_RESTORE
 
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_priority_queue_create                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a priority queue, which holds messages of the */
+/*    specified size that each carry a priority.  The memory area is      */
+/*    divided into slots, each of which is a ULONG link followed by one   */
+/*    message.  The slots of the messages of each priority form a         */
+/*    circular list, so that messages of the same priority are received   */
+/*    in the order they were sent.  The memory area must be ULONG         */
+/*    aligned.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to priority queue control */
+/*                                        block                           */
+/*    name_ptr                          Pointer to priority queue name    */
+/*    message_size                      Size of each message in ULONGs    */
+/*    queue_start                       Starting address of the slots     */
+/*    queue_size                        Number of bytes in the slots      */
+/*                                        area                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion status      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_priority_queue_create(TX_PRIORITY_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *queue_start, ULONG queue_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                capacity;
+TX_PRIORITY_QUEUE   *next_queue;
+TX_PRIORITY_QUEUE   *previous_queue;
+
+
+    /* Initialize priority queue control block to all zeros.  */
+    TX_MEMSET(queue_ptr, 0, (sizeof(TX_PRIORITY_QUEUE)));
+
+    /* Setup the basic priority queue fields.  */
+    queue_ptr -> tx_priority_queue_name =          name_ptr;
+    queue_ptr -> tx_priority_queue_message_size =  message_size;
+
+    /* Calculate the number of slots, each of which is a link followed by a
+       message.  */
+    capacity =  (UINT) (queue_size / (((ULONG) (message_size + ((UINT) 1))) * ((ULONG) (sizeof(ULONG)))));
+
+    /* Setup the slots and the number of messages the priority queue holds.  */
+    queue_ptr -> tx_priority_queue_start =              TX_VOID_TO_ULONG_POINTER_CONVERT(queue_start);
+    queue_ptr -> tx_priority_queue_capacity =           capacity;
+    queue_ptr -> tx_priority_queue_available_storage =  capacity;
+
+    /* No slot has been used yet, so the list of released slots is empty.  */
+    queue_ptr -> tx_priority_queue_free_list =  TX_PRIORITY_QUEUE_NO_SLOT;
+    queue_ptr -> tx_priority_queue_unused =     ((ULONG) 0);
+
+    /* Disable interrupts to put the priority queue on the created list.  */
+    TX_DISABLE
+
+    /* Setup the priority queue ID to make it valid.  */
+    queue_ptr -> tx_priority_queue_id =  TX_PRIORITY_QUEUE_ID;
+
+    /* Place the priority queue on the list of created priority queues.  First,
+       check for an empty list.  */
+    if (_tx_priority_queue_created_count == TX_EMPTY)
+    {
+
+        /* The created priority queue list is empty.  Add priority queue to empty list.  */
+        _tx_priority_queue_created_ptr =                   queue_ptr;
+        queue_ptr -> tx_priority_queue_created_next =      queue_ptr;
+        queue_ptr -> tx_priority_queue_created_previous =  queue_ptr;
+    }
+    else
+    {
+
+        /* This list is not NULL, add to the end of the list.  */
+        next_queue =      _tx_priority_queue_created_ptr;
+        previous_queue =  next_queue -> tx_priority_queue_created_previous;
+
+        /* Place the new priority queue in the list.  */
+        next_queue -> tx_priority_queue_created_previous =  queue_ptr;
+        previous_queue -> tx_priority_queue_created_next =  queue_ptr;
+
+        /* Setup this priority queue's created links.  */
+        queue_ptr -> tx_priority_queue_created_previous =  previous_queue;
+        queue_ptr -> tx_priority_queue_created_next =      next_queue;
+    }
+
+    /* Increment the created priority queue count.  */
+    _tx_priority_queue_created_count++;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
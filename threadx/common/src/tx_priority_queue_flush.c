@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_priority_queue_flush                            PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the specified priority queue, discarding all   */
+/*    of its messages.  Any threads suspended on a full priority queue    */
+/*    are resumed with the TX_SUCCESS status code.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to priority queue control */
+/*                                        block                           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful priority queue flush   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_priority_queue_flush(TX_PRIORITY_QUEUE *queue_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *suspension_list;
+UINT            suspended_count;
+TX_THREAD       *thread_ptr;
+
+
+    /* Initialize the suspended count and list.  */
+    suspended_count =  TX_NO_SUSPENSIONS;
+    suspension_list =  TX_NULL;
+
+    /* Disable interrupts to reset various priority queue parameters.  */
+    TX_DISABLE
+
+    /* Determine if there is something on the priority queue.  */
+    if (queue_ptr -> tx_priority_queue_enqueued != TX_NO_MESSAGES)
+    {
+
+        /* Yes, there is something in the priority queue.  */
+
+        /* Reset the priority queue parameters to erase all of the queued messages.
+           All slots become unused again, and the tails of the priorities do not
+           matter once the priority map is clear.  */
+        queue_ptr -> tx_priority_queue_enqueued =           TX_NO_MESSAGES;
+        queue_ptr -> tx_priority_queue_available_storage =  queue_ptr -> tx_priority_queue_capacity;
+        queue_ptr -> tx_priority_queue_free_list =          TX_PRIORITY_QUEUE_NO_SLOT;
+        queue_ptr -> tx_priority_queue_unused =             ((ULONG) 0);
+        queue_ptr -> tx_priority_queue_priority_map =       ((ULONG) 0);
+
+        /* Now determine if there are any threads suspended on a full priority queue.  */
+        if (queue_ptr -> tx_priority_queue_suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* Yes, there are threads suspended on this priority queue, they must be
+               resumed!  */
+
+            /* Copy the information into temporary variables.  */
+            suspension_list =  queue_ptr -> tx_priority_queue_suspension_list;
+            suspended_count =  queue_ptr -> tx_priority_queue_suspended_count;
+
+            /* Clear the priority queue variables.  */
+            queue_ptr -> tx_priority_queue_suspension_list =  TX_NULL;
+            queue_ptr -> tx_priority_queue_suspended_count =  TX_NO_SUSPENSIONS;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Walk through the priority queue list to resume any and all threads suspended
+       on this priority queue.  */
+    if (suspended_count != TX_NO_SUSPENSIONS)
+    {
+
+        /* Pickup the thread to resume.  */
+        thread_ptr =  suspension_list;
+        while (suspended_count != ((ULONG) 0))
+        {
+
+            /* Decrement the suspension count.  */
+            suspended_count--;
+
+            /* Check for a NULL thread pointer.  */
+            if (thread_ptr == TX_NULL)
+            {
+
+                /* Get out of the loop.  */
+                break;
+            }
+
+            /* Resume the next suspended thread.  */
+
+            /* Lockout interrupts.  */
+            TX_DISABLE
+
+            /* Clear the cleanup pointer, this prevents the timeout from doing
+               anything.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Set the return status in the thread to TX_SUCCESS.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Move the thread pointer ahead.  */
+            thread_ptr =  thread_ptr -> tx_thread_suspended_next;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr -> tx_thread_suspended_previous);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr -> tx_thread_suspended_previous);
+#endif
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Restore previous preempt posture.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+
+    /* Return TX_SUCCESS.  */
+    return(TX_SUCCESS);
+}
+
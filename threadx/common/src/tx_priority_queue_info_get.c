@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_priority_queue_info_get                         PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information from the specified priority     */
+/*    queue.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to priority queue control */
+/*                                        block                           */
+/*    name                              Destination for the priority      */
+/*                                        queue name                      */
+/*    enqueued                          Destination for the number of     */
+/*                                        messages enqueued               */
+/*    available_storage                 Destination for the number of     */
+/*                                        messages that still fit         */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on priority    */
+/*                                        queue                           */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_queue                        Destination for pointer to next   */
+/*                                        priority queue on the created   */
+/*                                        list                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_priority_queue_info_get(TX_PRIORITY_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_PRIORITY_QUEUE **next_queue)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Retrieve all the pertinent information and return it in the supplied
+       destinations.  */
+
+    /* Retrieve the name of the priority queue.  */
+    if (name != TX_NULL)
+    {
+
+        *name =  queue_ptr -> tx_priority_queue_name;
+    }
+
+    /* Retrieve the number of messages currently in the priority queue.  */
+    if (enqueued != TX_NULL)
+    {
+
+        *enqueued =  (ULONG) queue_ptr -> tx_priority_queue_enqueued;
+    }
+
+    /* Retrieve the number of messages that still fit in the priority queue.  */
+    if (available_storage != TX_NULL)
+    {
+
+        *available_storage =  queue_ptr -> tx_priority_queue_available_storage;
+    }
+
+    /* Retrieve the first thread suspended on this priority queue.  */
+    if (first_suspended != TX_NULL)
+    {
+
+        *first_suspended =  queue_ptr -> tx_priority_queue_suspension_list;
+    }
+
+    /* Retrieve the number of threads suspended on this priority queue.  */
+    if (suspended_count != TX_NULL)
+    {
+
+        *suspended_count =  (ULONG) queue_ptr -> tx_priority_queue_suspended_count;
+    }
+
+    /* Retrieve the pointer to the next priority queue created.  */
+    if (next_queue != TX_NULL)
+    {
+
+        *next_queue =  queue_ptr -> tx_priority_queue_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(TX_SUCCESS);
+}
+
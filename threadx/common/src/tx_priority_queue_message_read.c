@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_priority_queue_message_read                     PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the oldest message of the highest priority    */
+/*    from the priority queue and copies it to the destination.  The      */
+/*    highest priority is the lowest bit set in the priority map, and the */
+/*    oldest message is the head of the list of that priority, which      */
+/*    follows its tail.  The slot of the message is put on the list of    */
+/*    released slots.  It is called with interrupts disabled and the      */
+/*    caller has made sure that the priority queue is not empty.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to priority queue control */
+/*                                        block                           */
+/*    destination_ptr                   Pointer to the destination of the */
+/*                                        message                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_priority_queue_receive        Receive from priority queue       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_priority_queue_message_read(TX_PRIORITY_QUEUE *queue_ptr, VOID *destination_ptr)
+{
+
+ULONG           *source;
+ULONG           *destination;
+ULONG           *slot_ptr;
+ULONG           *tail_ptr;
+ULONG           slot;
+ULONG           tail;
+ULONG           priority_map;
+ULONG           priority;
+UINT            size;
+
+
+    /* Find the highest priority with messages.  Note that the macro may modify
+       the map.  */
+    priority_map =  queue_ptr -> tx_priority_queue_priority_map;
+    TX_LOWEST_SET_BIT_CALCULATE(priority_map, priority)
+
+    /* Pickup the head of the list of this priority, which follows the tail.  */
+    tail =      queue_ptr -> tx_priority_queue_tail[priority];
+    tail_ptr =  TX_PRIORITY_QUEUE_SLOT(queue_ptr, tail);
+    slot =      *tail_ptr;
+    slot_ptr =  TX_PRIORITY_QUEUE_SLOT(queue_ptr, slot);
+
+    /* Determine if this is the only message of its priority.  */
+    if (slot == tail)
+    {
+
+        /* Yes, the priority has no messages left.  */
+        queue_ptr -> tx_priority_queue_priority_map =  queue_ptr -> tx_priority_queue_priority_map & (~(((ULONG) 1) << priority));
+    }
+    else
+    {
+
+        /* No, the next message becomes the head of the list.  */
+        *tail_ptr =  *slot_ptr;
+    }
+
+    /* Copy the message to the destination.  Note that the source and
+       destination pointers are incremented by the macro.  */
+    source =       TX_ULONG_POINTER_ADD(slot_ptr, 1);
+    destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
+    size =         queue_ptr -> tx_priority_queue_message_size;
+    TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+    /* Put the slot on the list of released slots.  */
+    *slot_ptr =                                 queue_ptr -> tx_priority_queue_free_list;
+    queue_ptr -> tx_priority_queue_free_list =  slot;
+
+    /* Update the number of messages in the priority queue.  */
+    queue_ptr -> tx_priority_queue_available_storage++;
+    queue_ptr -> tx_priority_queue_enqueued--;
+}
+
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_priority_queue_message_write                    PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a message in a free slot of the priority queue */
+/*    and links the slot at the end of the list of its priority.  A       */
+/*    released slot is reused first, otherwise the next slot that was     */
+/*    never used is taken, so that no list of free slots has to be built  */
+/*    when the queue is created or flushed.  It is called with interrupts */
+/*    disabled and the caller has made sure that the priority queue is    */
+/*    not full.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to priority queue control */
+/*                                        block                           */
+/*    source_ptr                        Pointer to the message            */
+/*    priority                          Priority of the message           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_priority_queue_send           Send to priority queue            */
+/*    _tx_priority_queue_receive        Receive from priority queue       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_priority_queue_message_write(TX_PRIORITY_QUEUE *queue_ptr, VOID *source_ptr, UINT priority)
+{
+
+ULONG           *source;
+ULONG           *destination;
+ULONG           *slot_ptr;
+ULONG           *tail_ptr;
+ULONG           slot;
+ULONG           priority_bit;
+UINT            size;
+
+
+    /* Pickup a free slot, preferably one that was released.  */
+    slot =  queue_ptr -> tx_priority_queue_free_list;
+    if (slot != TX_PRIORITY_QUEUE_NO_SLOT)
+    {
+
+        /* Remove the slot from the list of released slots.  */
+        slot_ptr =                                 TX_PRIORITY_QUEUE_SLOT(queue_ptr, slot);
+        queue_ptr -> tx_priority_queue_free_list =  *slot_ptr;
+    }
+    else
+    {
+
+        /* Take the next slot that was never used.  */
+        slot =                                  queue_ptr -> tx_priority_queue_unused;
+        slot_ptr =                              TX_PRIORITY_QUEUE_SLOT(queue_ptr, slot);
+        queue_ptr -> tx_priority_queue_unused =  slot + ((ULONG) 1);
+    }
+
+    /* Copy the message after the link of the slot.  Note that the source and
+       destination pointers are incremented by the macro.  */
+    source =       TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+    destination =  TX_ULONG_POINTER_ADD(slot_ptr, 1);
+    size =         queue_ptr -> tx_priority_queue_message_size;
+    TX_QUEUE_MESSAGE_COPY(source, destination, size)
+
+    /* Determine if there are other messages of this priority.  */
+    priority_bit =  ((ULONG) 1) << priority;
+    if ((queue_ptr -> tx_priority_queue_priority_map & priority_bit) == ((ULONG) 0))
+    {
+
+        /* No, the slot is the only one on the list of its priority, so it is
+           linked to itself.  */
+        *slot_ptr =  slot;
+
+        /* Mark the priority as having messages.  */
+        queue_ptr -> tx_priority_queue_priority_map =  queue_ptr -> tx_priority_queue_priority_map | priority_bit;
+    }
+    else
+    {
+
+        /* Yes, link the slot after the tail of the list, in front of its head.  */
+        tail_ptr =   TX_PRIORITY_QUEUE_SLOT(queue_ptr, queue_ptr -> tx_priority_queue_tail[priority]);
+        *slot_ptr =  *tail_ptr;
+        *tail_ptr =  slot;
+    }
+
+    /* The slot is the new tail of the list of its priority.  */
+    queue_ptr -> tx_priority_queue_tail[priority] =  slot;
+
+    /* Update the number of messages in the priority queue.  */
+    queue_ptr -> tx_priority_queue_available_storage--;
+    queue_ptr -> tx_priority_queue_enqueued++;
+}
+
@@ -0,0 +1,328 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_priority_queue_receive                          PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives the oldest message of the highest priority   */
+/*    from the priority queue.  If a thread is suspended on the full      */
+/*    priority queue with a more urgent message than every queued one,    */
+/*    its message is received directly.  Otherwise its message is placed  */
+/*    in the slot released.  Either way the thread is resumed.  If the    */
+/*    priority queue is empty, the caller may suspend until a message is  */
+/*    sent.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to priority queue control */
+/*                                        block                           */
+/*    destination_ptr                   Pointer to the destination of the */
+/*                                        message                         */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_priority_queue_message_read   Remove message from priority      */
+/*                                        queue                           */
+/*    _tx_priority_queue_message_write  Place message in priority queue   */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_suspend         Suspend thread routine            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_priority_queue_receive       Error checking priority queue     */
+/*                                        receive                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_priority_queue_receive(TX_PRIORITY_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+ULONG           *source;
+ULONG           *destination;
+ULONG           priority_map;
+ULONG           priority;
+UINT            size;
+UINT            suspended_count;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to receive message from priority queue.  */
+    TX_DISABLE
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  queue_ptr -> tx_priority_queue_suspended_count;
+
+    /* Determine if there is anything in the priority queue.  */
+    if (queue_ptr -> tx_priority_queue_enqueued != TX_NO_MESSAGES)
+    {
+
+        /* Determine if there are threads suspended on a full priority queue.  */
+        if (suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* No, remove the most urgent message from the priority queue.  */
+            _tx_priority_queue_message_read(queue_ptr, destination_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* Yes, pickup the first suspended thread, whose message is the most
+               urgent of the suspended messages.  */
+            thread_ptr =  queue_ptr -> tx_priority_queue_suspension_list;
+
+            /* Find the highest priority with messages in the priority queue.  Note
+               that the macro may modify the map.  */
+            priority_map =  queue_ptr -> tx_priority_queue_priority_map;
+            TX_LOWEST_SET_BIT_CALCULATE(priority_map, priority)
+
+            /* Determine if the message of the suspended thread is more urgent than
+               every message in the priority queue.  */
+            if (thread_ptr -> tx_thread_suspend_info < priority)
+            {
+
+                /* Yes, give the message of the suspended thread directly to the
+                   caller.  Note that the source and destination pointers are
+                   incremented by the macro.  */
+                source =       TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
+                size =         queue_ptr -> tx_priority_queue_message_size;
+                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            }
+            else
+            {
+
+                /* No, remove the most urgent message from the priority queue and
+                   place the message of the suspended thread in the slot just
+                   released.  */
+                _tx_priority_queue_message_read(queue_ptr, destination_ptr);
+                _tx_priority_queue_message_write(queue_ptr, thread_ptr -> tx_thread_additional_suspend_info,
+                                                                (UINT) thread_ptr -> tx_thread_suspend_info);
+            }
+
+            /* Remove the thread from the suspension list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                queue_ptr -> tx_priority_queue_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                                     thread_ptr -> tx_thread_suspended_next;
+                queue_ptr -> tx_priority_queue_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+            }
+
+            /* Decrement the suspension count.  */
+            queue_ptr -> tx_priority_queue_suspended_count =  suspended_count;
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+        }
+    }
+
+    /* Determine if the request specifies suspension.  */
+    else if (wait_option != TX_NO_WAIT)
+    {
+
+        /* Determine if the preempt disable flag is non-zero.  */
+        if (_tx_thread_preempt_disable != ((UINT) 0))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Suspension is not allowed if the preempt disable flag is non-zero at this point - return error completion.  */
+            status =  TX_QUEUE_EMPTY;
+        }
+        else
+        {
+
+            /* Prepare for suspension of this thread.  */
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Setup cleanup routine pointer.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_priority_queue_cleanup);
+
+            /* Setup cleanup information, i.e. this priority queue control
+               block, the destination pointer, and no other information.  */
+            thread_ptr -> tx_thread_suspend_control_block =    (VOID *) queue_ptr;
+            thread_ptr -> tx_thread_additional_suspend_info =  (VOID *) destination_ptr;
+            thread_ptr -> tx_thread_suspend_info =             ((ULONG) 0);
+            thread_ptr -> tx_thread_suspend_option =           TX_FALSE;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+            /* Increment the suspension sequence number, which is used to identify
+               this suspension event.  */
+            thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+            /* Setup suspension list.  */
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* No other threads are suspended.  Setup the head pointer and
+                   just setup this threads pointers to itself.  */
+                queue_ptr -> tx_priority_queue_suspension_list =  thread_ptr;
+                thread_ptr -> tx_thread_suspended_next =          thread_ptr;
+                thread_ptr -> tx_thread_suspended_previous =      thread_ptr;
+            }
+            else
+            {
+
+                /* This list is not NULL, add current thread to the end. */
+                next_thread =                                   queue_ptr -> tx_priority_queue_suspension_list;
+                thread_ptr -> tx_thread_suspended_next =        next_thread;
+                previous_thread =                               next_thread -> tx_thread_suspended_previous;
+                thread_ptr -> tx_thread_suspended_previous =    previous_thread;
+                previous_thread -> tx_thread_suspended_next =   thread_ptr;
+                next_thread -> tx_thread_suspended_previous =   thread_ptr;
+            }
+
+            /* Increment the suspended thread count.  */
+            queue_ptr -> tx_priority_queue_suspended_count =  suspended_count + ((UINT) 1);
+
+            /* Set the state to suspended.  */
+            thread_ptr -> tx_thread_state =    TX_QUEUE_SUSP;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Call actual non-interruptable thread suspension routine.  */
+            _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Set the suspending flag.  */
+            thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+            /* Setup the timeout period.  */
+            thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Call actual thread suspension routine.  */
+            _tx_thread_system_suspend(thread_ptr);
+#endif
+
+            /* Return the completion status.  */
+            status =  thread_ptr -> tx_thread_suspend_status;
+        }
+    }
+    else
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Immediate return, return error completion.  */
+        status =  TX_QUEUE_EMPTY;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -72,6 +72,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            message copy routine        */
+/*                                            selection                   */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_create(TX_QUEUE *queue_ptr, CHAR *name_ptr, UINT message_size,
@@ -95,6 +98,39 @@ TX_QUEUE        *previous_queue;
     /* Save the message size in the control block.  */
     queue_ptr -> tx_queue_message_size =  message_size;
 
+    /* Select the routine that copies messages of this size.  */
+    if (message_size == TX_2_ULONG)
+    {
+
+        /* Copy two ULONG messages without a loop.  */
+        queue_ptr -> tx_queue_message_copy =  _tx_queue_message_copy_2_ulong;
+    }
+    else if (message_size == TX_4_ULONG)
+    {
+
+        /* Copy four ULONG messages without a loop.  */
+        queue_ptr -> tx_queue_message_copy =  _tx_queue_message_copy_4_ulong;
+    }
+    else if (message_size == TX_8_ULONG)
+    {
+
+        /* Copy eight ULONG messages without a loop.  */
+        queue_ptr -> tx_queue_message_copy =  _tx_queue_message_copy_8_ulong;
+    }
+    else if (message_size == TX_16_ULONG)
+    {
+
+        /* Copy sixteen ULONG messages without a loop.  */
+        queue_ptr -> tx_queue_message_copy =  _tx_queue_message_copy_16_ulong;
+    }
+    else
+    {
+
+        /* Copy messages of other sizes with a loop.  Single ULONG messages
+           are copied in line and never use the routine.  */
+        queue_ptr -> tx_queue_message_copy =  _tx_queue_message_copy;
+    }
+
     /* Determine how many messages will fit in the queue area and the number
        of ULONGs used.  */
     capacity =    (UINT) (queue_size / ((ULONG) (((ULONG) message_size) * (sizeof(ULONG)))));
@@ -59,6 +59,8 @@
 /*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_wait_multiple_complete Complete wait for multiple        */
+/*                                        objects                         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -71,6 +73,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            wait for multiple objects   */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_delete(TX_QUEUE *queue_ptr)
@@ -187,6 +191,40 @@ TX_QUEUE        *previous_queue;
         thread_ptr =  next_thread;
     }
 
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Resume any and all threads waiting for this queue among multiple objects.
+       Completing the wait of a thread removes all of its wait blocks.  */
+    while (queue_ptr -> tx_queue_wait_block_list != TX_NULL)
+    {
+
+        /* Complete the wait of the thread of the first wait block.  */
+        thread_ptr =  _tx_thread_wait_multiple_complete(queue_ptr -> tx_queue_wait_block_list, TX_DELETED);
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+#else
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume thread.  */
+        _tx_thread_system_resume(thread_ptr);
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+#endif
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
     /* Execute Port-Specific completion processing. If needed, it is typically defined in tx_port.h.  */
     TX_QUEUE_DELETE_PORT_COMPLETION(queue_ptr)
 
@@ -41,6 +41,46 @@ TX_QUEUE *   _tx_queue_created_ptr;
 ULONG        _tx_queue_created_count;
 
 
+/* Define the head pointer of the created byte queue list.  */
+
+TX_BYTE_QUEUE *  _tx_byte_queue_created_ptr;
+
+
+/* Define the variable that holds the number of created byte queues. */
+
+ULONG        _tx_byte_queue_created_count;
+
+
+/* Define the head pointer of the created channel list.  */
+
+TX_CHANNEL *     _tx_channel_created_ptr;
+
+
+/* Define the variable that holds the number of created channels. */
+
+ULONG        _tx_channel_created_count;
+
+
+/* Define the head pointer of the created priority queue list.  */
+
+TX_PRIORITY_QUEUE *  _tx_priority_queue_created_ptr;
+
+
+/* Define the variable that holds the number of created priority queues. */
+
+ULONG        _tx_priority_queue_created_count;
+
+
+/* Define the head pointer of the created broadcast list.  */
+
+TX_BROADCAST *   _tx_broadcast_created_ptr;
+
+
+/* Define the variable that holds the number of created broadcasts. */
+
+ULONG        _tx_broadcast_created_count;
+
+
 #ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of messages sent.  */
@@ -72,6 +112,36 @@ ULONG        _tx_queue_performance_full_error_count;
 
 ULONG        _tx_queue_performance_timeout_count;
 
+
+/* Define the total number of byte queue messages sent.  */
+
+ULONG        _tx_byte_queue_performance_messages_sent_count;
+
+
+/* Define the total number of byte queue messages received.  */
+
+ULONG        _tx_byte_queue_performance_messages_received_count;
+
+
+/* Define the total number of byte queue empty suspensions.  */
+
+ULONG        _tx_byte_queue_performance_empty_suspension_count;
+
+
+/* Define the total number of byte queue full suspensions.  */
+
+ULONG        _tx_byte_queue_performance_full_suspension_count;
+
+
+/* Define the total number of byte queue full errors.  */
+
+ULONG        _tx_byte_queue_performance_full_error_count;
+
+
+/* Define the total number of byte queue timeouts.  */
+
+ULONG        _tx_byte_queue_performance_timeout_count;
+
 #endif
 
 
@@ -88,7 +158,8 @@ ULONG        _tx_queue_performance_timeout_count;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function initializes the various control data structures for   */
-/*    the queue component.                                                */
+/*    the queue component, including the lists of byte queues, channels,  */
+/*    priority queues, and broadcasts.                                    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -116,6 +187,14 @@ ULONG        _tx_queue_performance_timeout_count;
 /*                                            TX_INLINE_INITIALIZATION is */
 /*                                            defined,                    */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            byte queues                 */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            channels                    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            priority queues             */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            broadcasts                  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_queue_initialize(VOID)
@@ -128,6 +207,26 @@ VOID  _tx_queue_initialize(VOID)
     _tx_queue_created_ptr =        TX_NULL;
     _tx_queue_created_count =      TX_EMPTY;
 
+    /* Initialize the head pointer of the created byte queue list and the
+       number of byte queues created.  */
+    _tx_byte_queue_created_ptr =        TX_NULL;
+    _tx_byte_queue_created_count =      TX_EMPTY;
+
+    /* Initialize the head pointer of the created channel list and the
+       number of channels created.  */
+    _tx_channel_created_ptr =        TX_NULL;
+    _tx_channel_created_count =      TX_EMPTY;
+
+    /* Initialize the head pointer of the created priority queue list and the
+       number of priority queues created.  */
+    _tx_priority_queue_created_ptr =        TX_NULL;
+    _tx_priority_queue_created_count =      TX_EMPTY;
+
+    /* Initialize the head pointer of the created broadcast list and the
+       number of broadcasts created.  */
+    _tx_broadcast_created_ptr =        TX_NULL;
+    _tx_broadcast_created_count =      TX_EMPTY;
+
 #ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
 
     /* Initialize the queue performance counters.  */
@@ -136,6 +235,13 @@ VOID  _tx_queue_initialize(VOID)
     _tx_queue_performance_empty_suspension_count =    ((ULONG) 0);
     _tx_queue_performance_full_suspension_count =     ((ULONG) 0);
     _tx_queue_performance_timeout_count =             ((ULONG) 0);
+
+    /* Initialize the byte queue performance counters.  */
+    _tx_byte_queue_performance_messages_sent_count =      ((ULONG) 0);
+    _tx_byte_queue_performance_messages_received_count =  ((ULONG) 0);
+    _tx_byte_queue_performance_empty_suspension_count =   ((ULONG) 0);
+    _tx_byte_queue_performance_full_suspension_count =    ((ULONG) 0);
+    _tx_byte_queue_performance_timeout_count =            ((ULONG) 0);
 #endif
 #endif
 }
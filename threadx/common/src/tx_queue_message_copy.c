@@ -0,0 +1,415 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_message_copy                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message of any size with a loop.  Queues use */
+/*    it for message sizes that have no copy routine of their own.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    source_ptr                        Pointer to message source         */
+/*    destination_ptr                   Pointer to message destination    */
+/*    size                              Size of the message in ULONGs     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_n               Receive messages from queue       */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_n                  Send messages to queue            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_queue_message_copy(ULONG *source_ptr, ULONG *destination_ptr, UINT size)
+{
+
+ULONG           *source;
+ULONG           *destination;
+UINT            words;
+
+
+    /* Setup source and destination pointers.  */
+    source =       source_ptr;
+    destination =  destination_ptr;
+    words =        size;
+
+    /* Copy message. Note that the source and destination pointers are
+       incremented by the macro.  */
+    TX_QUEUE_MESSAGE_COPY(source, destination, words)
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_message_copy_2_ulong                      PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message of 2 ULONGs without a loop.  All     */
+/*    words are loaded before any is stored, which lets the compiler move */
+/*    them with the widest loads and stores the port allows.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    source_ptr                        Pointer to message source         */
+/*    destination_ptr                   Pointer to message destination    */
+/*    size                              Size of the message in ULONGs     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_n               Receive messages from queue       */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_n                  Send messages to queue            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_queue_message_copy_2_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size)
+{
+
+ULONG           word_0;
+ULONG           word_1;
+
+
+    /* The size is always 2 ULONGs.  */
+    TX_PARAMETER_NOT_USED(size);
+
+    /* Load the message.  */
+    word_0 =  source_ptr[0];
+    word_1 =  source_ptr[1];
+
+    /* Store the message.  */
+    destination_ptr[0] =  word_0;
+    destination_ptr[1] =  word_1;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_message_copy_4_ulong                      PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message of 4 ULONGs without a loop.  All     */
+/*    words are loaded before any is stored, which lets the compiler move */
+/*    them with the widest loads and stores the port allows.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    source_ptr                        Pointer to message source         */
+/*    destination_ptr                   Pointer to message destination    */
+/*    size                              Size of the message in ULONGs     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_n               Receive messages from queue       */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_n                  Send messages to queue            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_queue_message_copy_4_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size)
+{
+
+ULONG           word_0;
+ULONG           word_1;
+ULONG           word_2;
+ULONG           word_3;
+
+
+    /* The size is always 4 ULONGs.  */
+    TX_PARAMETER_NOT_USED(size);
+
+    /* Load the message.  */
+    word_0 =  source_ptr[0];
+    word_1 =  source_ptr[1];
+    word_2 =  source_ptr[2];
+    word_3 =  source_ptr[3];
+
+    /* Store the message.  */
+    destination_ptr[0] =  word_0;
+    destination_ptr[1] =  word_1;
+    destination_ptr[2] =  word_2;
+    destination_ptr[3] =  word_3;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_message_copy_8_ulong                      PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message of 8 ULONGs without a loop.  All     */
+/*    words are loaded before any is stored, which lets the compiler move */
+/*    them with the widest loads and stores the port allows.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    source_ptr                        Pointer to message source         */
+/*    destination_ptr                   Pointer to message destination    */
+/*    size                              Size of the message in ULONGs     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_n               Receive messages from queue       */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_n                  Send messages to queue            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_queue_message_copy_8_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size)
+{
+
+ULONG           word_0;
+ULONG           word_1;
+ULONG           word_2;
+ULONG           word_3;
+ULONG           word_4;
+ULONG           word_5;
+ULONG           word_6;
+ULONG           word_7;
+
+
+    /* The size is always 8 ULONGs.  */
+    TX_PARAMETER_NOT_USED(size);
+
+    /* Load the message.  */
+    word_0 =  source_ptr[0];
+    word_1 =  source_ptr[1];
+    word_2 =  source_ptr[2];
+    word_3 =  source_ptr[3];
+    word_4 =  source_ptr[4];
+    word_5 =  source_ptr[5];
+    word_6 =  source_ptr[6];
+    word_7 =  source_ptr[7];
+
+    /* Store the message.  */
+    destination_ptr[0] =  word_0;
+    destination_ptr[1] =  word_1;
+    destination_ptr[2] =  word_2;
+    destination_ptr[3] =  word_3;
+    destination_ptr[4] =  word_4;
+    destination_ptr[5] =  word_5;
+    destination_ptr[6] =  word_6;
+    destination_ptr[7] =  word_7;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_message_copy_16_ulong                     PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a message of 16 ULONGs without a loop.  All    */
+/*    words are loaded before any is stored, which lets the compiler move */
+/*    them with the widest loads and stores the port allows.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    source_ptr                        Pointer to message source         */
+/*    destination_ptr                   Pointer to message destination    */
+/*    size                              Size of the message in ULONGs     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_queue_receive_n               Receive messages from queue       */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_n                  Send messages to queue            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_queue_message_copy_16_ulong(ULONG *source_ptr, ULONG *destination_ptr, UINT size)
+{
+
+ULONG           word_0;
+ULONG           word_1;
+ULONG           word_2;
+ULONG           word_3;
+ULONG           word_4;
+ULONG           word_5;
+ULONG           word_6;
+ULONG           word_7;
+ULONG           word_8;
+ULONG           word_9;
+ULONG           word_10;
+ULONG           word_11;
+ULONG           word_12;
+ULONG           word_13;
+ULONG           word_14;
+ULONG           word_15;
+
+
+    /* The size is always 16 ULONGs.  */
+    TX_PARAMETER_NOT_USED(size);
+
+    /* Load the message.  */
+    word_0 =  source_ptr[0];
+    word_1 =  source_ptr[1];
+    word_2 =  source_ptr[2];
+    word_3 =  source_ptr[3];
+    word_4 =  source_ptr[4];
+    word_5 =  source_ptr[5];
+    word_6 =  source_ptr[6];
+    word_7 =  source_ptr[7];
+    word_8 =  source_ptr[8];
+    word_9 =  source_ptr[9];
+    word_10 =  source_ptr[10];
+    word_11 =  source_ptr[11];
+    word_12 =  source_ptr[12];
+    word_13 =  source_ptr[13];
+    word_14 =  source_ptr[14];
+    word_15 =  source_ptr[15];
+
+    /* Store the message.  */
+    destination_ptr[0] =  word_0;
+    destination_ptr[1] =  word_1;
+    destination_ptr[2] =  word_2;
+    destination_ptr[3] =  word_3;
+    destination_ptr[4] =  word_4;
+    destination_ptr[5] =  word_5;
+    destination_ptr[6] =  word_6;
+    destination_ptr[7] =  word_7;
+    destination_ptr[8] =  word_8;
+    destination_ptr[9] =  word_9;
+    destination_ptr[10] =  word_10;
+    destination_ptr[11] =  word_11;
+    destination_ptr[12] =  word_12;
+    destination_ptr[13] =  word_13;
+    destination_ptr[14] =  word_14;
+    destination_ptr[15] =  word_15;
+}
+
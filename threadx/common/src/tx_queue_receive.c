@@ -77,6 +77,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            message copy routine        */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option)
@@ -136,7 +138,7 @@ UINT            status;
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
 
             /* Determine if we are at the end.  */
             if (source == queue_ptr -> tx_queue_end)
@@ -183,7 +185,7 @@ UINT            status;
 
                 /* Copy message. Note that the source and destination pointers are
                    incremented by the macro.  */
-                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+                TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
 
                 /* Message is now in the caller's destination. See if this is the only suspended thread
                    on the list.  */
@@ -255,7 +257,7 @@ UINT            status;
 
                 /* Copy message. Note that the source and destination pointers are
                    incremented by the macro.  */
-                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+                TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
 
                 /* Determine if we are at the end.  */
                 if (source == queue_ptr -> tx_queue_end)
@@ -293,7 +295,7 @@ UINT            status;
 
                 /* Copy message. Note that the source and destination pointers are
                    incremented by the macro.  */
-                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+                TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
 
                 /* Determine if we are at the end.  */
                 if (destination == queue_ptr -> tx_queue_end)
@@ -0,0 +1,257 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_receive_commit                            PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the message returned by tx_queue_receive_peek */
+/*    from the queue, which must still be the oldest message in its       */
+/*    storage.  If a thread is suspended on the full queue, its message   */
+/*    is moved into the slot that becomes free, at the front of the queue */
+/*    for a front send and at the back otherwise, and the thread is       */
+/*    resumed.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    message_ptr                       Pointer to the message returned   */
+/*                                        by the peek                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_queue_receive_commit         Error checking queue receive      */
+/*                                        commit                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_receive_commit(TX_QUEUE *queue_ptr, VOID *message_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+ULONG           *source;
+ULONG           *destination;
+ULONG           *next_read;
+UINT            size;
+UINT            suspended_count;
+UINT            status;
+
+
+    /* Disable interrupts to remove the message from the queue.  */
+    TX_DISABLE
+
+    /* Determine if the message is still the oldest one in the queue.  */
+    if ((queue_ptr -> tx_queue_enqueued == TX_NO_MESSAGES) ||
+        (TX_VOID_TO_ULONG_POINTER_CONVERT(message_ptr) != queue_ptr -> tx_queue_read))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The message is not at the front of the queue, return error completion.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total messages received counter.  */
+        _tx_queue_performance__messages_received_count++;
+
+        /* Increment the number of messages received from this queue.  */
+        queue_ptr -> tx_queue_performance_messages_received_count++;
+#endif
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_RECEIVE, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(message_ptr), TX_NO_WAIT, queue_ptr -> tx_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+        /* Calculate the read pointer after the message.  */
+        size =       queue_ptr -> tx_queue_message_size;
+        next_read =  TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_read, size);
+        if (next_read == queue_ptr -> tx_queue_end)
+        {
+
+            /* Yes, wrap around to the beginning.  */
+            next_read =  queue_ptr -> tx_queue_start;
+        }
+
+        /* Pickup the thread suspension count.  */
+        suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+        /* Determine if there are any suspensions.  */
+        if (suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* Simply remove the message from the queue.  */
+            queue_ptr -> tx_queue_read =  next_read;
+
+            /* Increase the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage++;
+
+            /* Decrease the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued--;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* At this point we know the queue is full and there are one or more
+               threads suspended trying to send another message to it.  */
+
+            /* Pickup thread suspension list head pointer.  */
+            thread_ptr =  queue_ptr -> tx_queue_suspension_list;
+            source =      TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+
+            /* Is the front suspension flag set?  */
+            if (thread_ptr -> tx_thread_suspend_option == TX_TRUE)
+            {
+
+                /* Yes, the message of the front send replaces the removed message
+                   at the front of the queue.  */
+                destination =  queue_ptr -> tx_queue_read;
+            }
+            else
+            {
+
+                /* No, remove the message and place the thread's message at the
+                   back of the queue.  */
+                queue_ptr -> tx_queue_read =  next_read;
+                destination =                 queue_ptr -> tx_queue_write;
+
+                /* Adjust the write pointer.  */
+                next_read =  TX_ULONG_POINTER_ADD(destination, size);
+                if (next_read == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    next_read =  queue_ptr -> tx_queue_start;
+                }
+                queue_ptr -> tx_queue_write =  next_read;
+            }
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+            /* Remove the thread from the suspension list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                            thread_ptr -> tx_thread_suspended_next;
+                queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+            }
+
+            /* Decrement the suspension count.  */
+            queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+        }
+
+        /* Return successful completion.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
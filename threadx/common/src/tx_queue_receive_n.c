@@ -0,0 +1,385 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_receive_n                                 PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves up to the specified number of messages from */
+/*    the specified queue in a single critical section.  The messages are */
+/*    placed consecutively in the destination, each the size of a message */
+/*    of the queue.  For each message retrieved from a full queue, the    */
+/*    message of the first thread suspended on the full queue is moved    */
+/*    into the queue, or retrieved directly if it was sent to the front   */
+/*    of the queue.  All such threads are resumed after the critical      */
+/*    section.  If the queue is empty, this function waits to receive the */
+/*    first message according to the option specified.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    destination_ptr                   Pointer to the destination of the */
+/*                                        messages                        */
+/*    message_count                     Number of messages to receive     */
+/*    received_count                    Destination for the number of     */
+/*                                        messages received               */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_receive                 Wait to receive a single message  */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_receive_n(TX_QUEUE *queue_ptr, VOID *destination_ptr, UINT message_count,
+                    UINT *received_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_THREAD       *resume_list;
+TX_THREAD       *resume_tail;
+ULONG           *message_ptr;
+ULONG           *source;
+ULONG           *destination;
+UINT            size;
+UINT            suspended_count;
+UINT            resume_count;
+UINT            count;
+UINT            requested;
+UINT            status;
+
+
+    /* Initialize the list of threads to resume.  */
+    resume_list =   TX_NULL;
+    resume_tail =   TX_NULL;
+    resume_count =  ((UINT) 0);
+
+    /* Setup the pointer to the destination of the first message.  */
+    message_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(destination_ptr);
+
+    /* Disable interrupts to receive the messages from the queue.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_RECEIVE_N, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(destination_ptr), message_count, wait_option, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_QUEUE_RECEIVE_N_INSERT
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+    /* Receive messages until the request is satisfied or the queue is empty.  */
+    count =      ((UINT) 0);
+    requested =  message_count;
+    while (count < requested)
+    {
+
+        /* Determine if there is anything in the queue.  */
+        if (queue_ptr -> tx_queue_enqueued == TX_NO_MESSAGES)
+        {
+
+            /* No, return the number of messages received so far.  */
+            requested =  count;
+        }
+        else
+        {
+
+            /* Determine if there is a thread suspended on the full queue.  */
+            thread_ptr =  TX_NULL;
+            if (suspended_count != TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, pickup the first suspended thread.  */
+                thread_ptr =  queue_ptr -> tx_queue_suspension_list;
+            }
+
+            /* Setup the destination pointer.  */
+            destination =  message_ptr;
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Is the first suspended thread sending to the front of the queue?  */
+            if ((thread_ptr != TX_NULL) && (thread_ptr -> tx_thread_suspend_option == TX_TRUE))
+            {
+
+                /* Yes, return the message associated with this suspension.  */
+                source =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+
+                /* Copy message. Note that the source and destination pointers are
+                   incremented by the macro.  */
+                TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+            }
+            else
+            {
+
+                /* Return the message at the front of the queue.  */
+                source =  queue_ptr -> tx_queue_read;
+
+                /* Copy message. Note that the source and destination pointers are
+                   incremented by the macro.  */
+                TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+                /* Determine if we are at the end.  */
+                if (source == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    source =  queue_ptr -> tx_queue_start;
+                }
+
+                /* Setup the queue read pointer.   */
+                queue_ptr -> tx_queue_read =  source;
+
+                /* Determine if a suspended thread has a message for the queue.  */
+                if (thread_ptr != TX_NULL)
+                {
+
+                    /* Yes, move its message into the queue.  */
+                    source =       TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                    destination =  queue_ptr -> tx_queue_write;
+                    size =         queue_ptr -> tx_queue_message_size;
+
+                    /* Copy message. Note that the source and destination pointers are
+                       incremented by the macro.  */
+                    TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+                    /* Determine if we are at the end.  */
+                    if (destination == queue_ptr -> tx_queue_end)
+                    {
+
+                        /* Yes, wrap around to the beginning.  */
+                        destination =  queue_ptr -> tx_queue_start;
+                    }
+
+                    /* Adjust the write pointer.  */
+                    queue_ptr -> tx_queue_write =  destination;
+                }
+                else
+                {
+
+                    /* Increase the amount of available storage.  */
+                    queue_ptr -> tx_queue_available_storage++;
+
+                    /* Decrease the enqueued count.  */
+                    queue_ptr -> tx_queue_enqueued--;
+                }
+            }
+
+            /* Move to the destination of the next message.  */
+            message_ptr =  TX_ULONG_POINTER_ADD(message_ptr, queue_ptr -> tx_queue_message_size);
+
+            /* Determine if a suspended thread's message was transferred.  */
+            if (thread_ptr != TX_NULL)
+            {
+
+                /* Remove the thread from the suspension list.  */
+                suspended_count--;
+                if (suspended_count == TX_NO_SUSPENSIONS)
+                {
+
+                    /* Yes, the only suspended thread.  */
+
+                    /* Update the head pointer.  */
+                    queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+                }
+                else
+                {
+
+                    /* At least one more thread is on the same suspension list.  */
+
+                    /* Update the list head pointer.  */
+                    next_thread =                            thread_ptr -> tx_thread_suspended_next;
+                    queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+                    /* Update the links of the adjacent threads.  */
+                    previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                    next_thread -> tx_thread_suspended_previous =  previous_thread;
+                    previous_thread -> tx_thread_suspended_next =  next_thread;
+                }
+
+                /* Clear cleanup routine to avoid timeout.  */
+                thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                /* Put return status into the thread control block.  */
+                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+                /* Add the thread to the list of threads to resume.  */
+                if (resume_count == ((UINT) 0))
+                {
+
+                    /* This is the first thread, temporarily disable preemption.  */
+                    _tx_thread_preempt_disable++;
+                    resume_list =  thread_ptr;
+                }
+                else
+                {
+
+                    /* Link the thread after the last one.  */
+                    resume_tail -> tx_thread_suspended_next =  thread_ptr;
+                }
+                resume_tail =  thread_ptr;
+                resume_count++;
+            }
+
+            /* Move to the next message.  */
+            count++;
+        }
+    }
+
+    /* Update the suspension count.  */
+    queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total messages received counter.  */
+    _tx_queue_performance__messages_received_count =  _tx_queue_performance__messages_received_count + ((ULONG) count);
+
+    /* Increment the number of messages received from this queue.  */
+    queue_ptr -> tx_queue_performance_messages_received_count =  queue_ptr -> tx_queue_performance_messages_received_count + ((ULONG) count);
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Resume the threads whose messages were transferred.  */
+    if (resume_count != ((UINT) 0))
+    {
+
+        /* Pickup the first thread to resume.  */
+        thread_ptr =  resume_list;
+        while (resume_count != ((UINT) 0))
+        {
+
+            /* Decrement the number of threads to resume.  */
+            resume_count--;
+
+            /* Pickup the next thread before this one is resumed.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Lockout interrupts.  */
+            TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+
+            /* Move to the next thread.  */
+            thread_ptr =  next_thread;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Restore previous preempt posture.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+
+    /* Determine if any message was received.  */
+    if (count != ((UINT) 0))
+    {
+
+        /* Yes, return success.  */
+        status =  TX_SUCCESS;
+    }
+    else
+    {
+
+        /* The queue is empty, wait to receive the first message as specified
+           by the wait option.  */
+        status =  _tx_queue_receive(queue_ptr, destination_ptr, wait_option);
+
+        /* Determine if the message was received.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Yes, one message was received.  */
+            count =  ((UINT) 1);
+        }
+    }
+
+    /* Return the number of messages received.  */
+    *received_count =  count;
+
+    /* Return completion status.  */
+    return(status);
+}
+
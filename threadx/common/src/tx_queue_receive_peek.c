@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_receive_peek                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a pointer to the oldest message in the        */
+/*    storage of the queue, so that it can be used in place instead of    */
+/*    being copied out.  The message stays in the queue until it is       */
+/*    removed with tx_queue_receive_commit.  The queue must be created    */
+/*    with tx_queue_spsc_create, so it has a single producer and a        */
+/*    single consumer, and no message may be sent to the front of the     */
+/*    queue between the peek and the commit.  This function does not      */
+/*    wait; if the queue is empty, TX_QUEUE_EMPTY is returned.            */
+/*                                                                        */
+/*    Interrupts are not locked out.  Only the single consumer moves the  */
+/*    read pointer, and a send can only make the enqueued count larger,   */
+/*    so the message found here stays valid until the commit, which       */
+/*    checks the pointer again with interrupts locked out.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    message_ptr                       Destination for the pointer to    */
+/*                                        the message                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_queue_receive_peek           Error checking queue receive peek */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_receive_peek(TX_QUEUE *queue_ptr, VOID **message_ptr)
+{
+
+UINT            status;
+
+
+    /* Determine if there is anything in the queue.  */
+    if (queue_ptr -> tx_queue_enqueued != TX_NO_MESSAGES)
+    {
+
+        /* Return the slot of the oldest message.  */
+        *message_ptr =  (VOID *) queue_ptr -> tx_queue_read;
+        status =        TX_SUCCESS;
+    }
+    else
+    {
+
+        /* Queue is empty, return error completion.  */
+        *message_ptr =  TX_NULL;
+        status =        TX_QUEUE_EMPTY;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
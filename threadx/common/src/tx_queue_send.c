@@ -63,6 +63,8 @@
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_thread_system_suspend         Suspend thread routine            */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*    _tx_thread_wait_multiple_complete Complete wait for multiple        */
+/*                                        objects                         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -75,6 +77,10 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            message copy routine        */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            wait for multiple objects   */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option)
@@ -89,6 +95,7 @@ UINT            size;
 UINT            suspended_count;
 TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
+TX_WAIT_BLOCK   *wait_block;
 UINT            status;
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
@@ -125,8 +132,63 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
         /* There is room for the message in the queue.  */
 
+        /* Determine if a thread waits for this queue among multiple objects.  */
+        if ((suspended_count == TX_NO_SUSPENSIONS) && (queue_ptr -> tx_queue_wait_block_list != TX_NULL))
+        {
+
+            /* Yes, copy the message to the destination of the thread's first wait
+               block on this queue.  */
+            wait_block =   queue_ptr -> tx_queue_wait_block_list;
+            source =       TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(wait_block -> tx_wait_block_destination);
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+            /* Complete the wait of the thread.  */
+            thread_ptr =  _tx_thread_wait_multiple_complete(wait_block, TX_SUCCESS);
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Pickup the notify callback routine for this queue.  */
+            queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Determine if a notify callback is required.  */
+            if (queue_send_notify != TX_NULL)
+            {
+
+                /* Call application queue send notification.  */
+                (queue_send_notify)(queue_ptr);
+            }
+#endif
+        }
+
         /* Determine if there are suspended on this queue.  */
-        if (suspended_count == TX_NO_SUSPENSIONS)
+        else if (suspended_count == TX_NO_SUSPENSIONS)
         {
 
             /* No suspended threads, simply place the message in the queue.  */
@@ -144,7 +206,7 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
 
             /* Determine if we are at the end.  */
             if (destination == queue_ptr -> tx_queue_end)
@@ -232,7 +294,7 @@ VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
 
             /* Copy message. Note that the source and destination pointers are
                incremented by the macro.  */
-            TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
 
             /* Put return status into the thread control block.  */
             thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
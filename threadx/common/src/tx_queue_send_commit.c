@@ -0,0 +1,290 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_send_commit                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the message built in the slot returned by      */
+/*    tx_queue_send_reserve in the queue, which must still be the free    */
+/*    slot at its back.  If a thread is suspended on the empty queue, the */
+/*    message is copied to the thread's destination and the thread is     */
+/*    resumed instead.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    message_ptr                       Pointer to the slot returned by   */
+/*                                        the reserve                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_wait_multiple_complete Complete wait for multiple        */
+/*                                        objects                         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_queue_send_commit            Error checking queue send commit  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            wait for multiple objects   */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_send_commit(TX_QUEUE *queue_ptr, VOID *message_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_WAIT_BLOCK   *wait_block;
+ULONG           *source;
+ULONG           *destination;
+UINT            size;
+UINT            suspended_count;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Disable interrupts to place the message in the queue.  */
+    TX_DISABLE
+
+    /* Determine if the slot is still the free slot at the back of the queue.  */
+    if ((queue_ptr -> tx_queue_available_storage == TX_NO_MESSAGES) ||
+        (TX_VOID_TO_ULONG_POINTER_CONVERT(message_ptr) != queue_ptr -> tx_queue_write))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The slot is not at the back of the queue, return error completion.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total messages sent counter.  */
+        _tx_queue_performance_messages_sent_count++;
+
+        /* Increment the number of messages sent to this queue.  */
+        queue_ptr -> tx_queue_performance_messages_sent_count++;
+#endif
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_SEND, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(message_ptr), TX_NO_WAIT, queue_ptr -> tx_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Pickup the notify callback routine for this queue.  */
+        queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+
+        /* Pickup the thread suspension count.  */
+        suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+        /* Determine if a thread waits for this queue among multiple objects.  */
+        if ((suspended_count == TX_NO_SUSPENSIONS) && (queue_ptr -> tx_queue_wait_block_list != TX_NULL))
+        {
+
+            /* Yes, copy the message to the destination of the thread's first wait
+               block on this queue.  */
+            wait_block =   queue_ptr -> tx_queue_wait_block_list;
+            source =       TX_VOID_TO_ULONG_POINTER_CONVERT(message_ptr);
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(wait_block -> tx_wait_block_destination);
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+            /* Complete the wait of the thread.  */
+            thread_ptr =  _tx_thread_wait_multiple_complete(wait_block, TX_SUCCESS);
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+        }
+
+        /* Determine if there are any suspensions.  */
+        else if (suspended_count == TX_NO_SUSPENSIONS)
+        {
+
+            /* Simply place the message in the queue.  */
+
+            /* Reduce the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage--;
+
+            /* Increase the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued++;
+
+            /* Adjust the write pointer.  */
+            destination =  TX_ULONG_POINTER_ADD(queue_ptr -> tx_queue_write, queue_ptr -> tx_queue_message_size);
+            if (destination == queue_ptr -> tx_queue_end)
+            {
+
+                /* Yes, wrap around to the beginning.  */
+                destination =  queue_ptr -> tx_queue_start;
+            }
+            queue_ptr -> tx_queue_write =  destination;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* At this point we know the queue is empty and there are one or more
+               threads suspended waiting for a message.  Copy the message to the
+               first suspended thread's destination.  */
+            thread_ptr =   queue_ptr -> tx_queue_suspension_list;
+            source =       TX_VOID_TO_ULONG_POINTER_CONVERT(message_ptr);
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+            /* Remove the thread from the suspension list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                            thread_ptr -> tx_thread_suspended_next;
+                queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+            }
+
+            /* Decrement the suspension count.  */
+            queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+        }
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if a notify callback is required.  */
+        if (queue_send_notify != TX_NULL)
+        {
+
+            /* Call application queue send notification.  */
+            (queue_send_notify)(queue_ptr);
+        }
+#endif
+
+        /* Return successful completion.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
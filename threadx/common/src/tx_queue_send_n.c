@@ -0,0 +1,403 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_send_n                                    PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places up to the specified number of messages into    */
+/*    the specified queue in a single critical section.  The messages are */
+/*    consecutive in the source, each the size of a message of the queue. */
+/*    Messages are given directly to threads suspended on an empty queue  */
+/*    first, and the remaining ones are placed into the queue until it is */
+/*    full.  All threads that received a message are resumed after the    */
+/*    critical section, and the send notify callback is called once for   */
+/*    the batch.  If the queue is full and no message can be sent, this   */
+/*    function waits to send the first message according to the option    */
+/*    specified.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    source_ptr                        Pointer to the messages to send   */
+/*    message_count                     Number of messages to send        */
+/*    sent_count                        Destination for the number of     */
+/*                                        messages sent                   */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_send                    Wait to send a single message     */
+/*    _tx_thread_system_resume          Resume thread routine             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_thread_wait_multiple_complete Complete wait for multiple        */
+/*                                        objects                         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            wait for multiple objects   */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_send_n(TX_QUEUE *queue_ptr, VOID *source_ptr, UINT message_count,
+                    UINT *sent_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+TX_THREAD       *next_thread;
+TX_THREAD       *previous_thread;
+TX_WAIT_BLOCK   *wait_block;
+TX_THREAD       *resume_list;
+TX_THREAD       *resume_tail;
+ULONG           *source;
+ULONG           *destination;
+UINT            size;
+UINT            suspended_count;
+UINT            resume_count;
+UINT            count;
+UINT            requested;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Initialize the list of threads to resume.  */
+    resume_list =   TX_NULL;
+    resume_tail =   TX_NULL;
+    resume_count =  ((UINT) 0);
+
+    /* Setup the source pointer to the first message.  */
+    source =  TX_VOID_TO_ULONG_POINTER_CONVERT(source_ptr);
+
+    /* Disable interrupts to place the messages in the queue.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_SEND_N, queue_ptr, TX_POINTER_TO_ULONG_CONVERT(source_ptr), message_count, wait_option, TX_TRACE_QUEUE_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_QUEUE_SEND_N_INSERT
+
+    /* Pickup the thread suspension count.  */
+    suspended_count =  queue_ptr -> tx_queue_suspended_count;
+
+    /* Send messages until the request is satisfied or the queue is full.  */
+    count =      ((UINT) 0);
+    requested =  message_count;
+    while (count < requested)
+    {
+
+        /* Determine if there is room in the queue.  */
+        if (queue_ptr -> tx_queue_available_storage == TX_NO_MESSAGES)
+        {
+
+            /* No, return the number of messages sent so far.  */
+            requested =  count;
+        }
+
+        /* Determine if there is a thread suspended on an empty queue.  */
+        else if (suspended_count != TX_NO_SUSPENSIONS)
+        {
+
+            /* Yes, copy the message to the suspended thread's destination.  */
+            thread_ptr =   queue_ptr -> tx_queue_suspension_list;
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+            /* Remove the thread from the suspension list.  */
+            suspended_count--;
+            if (suspended_count == TX_NO_SUSPENSIONS)
+            {
+
+                /* Yes, the only suspended thread.  */
+
+                /* Update the head pointer.  */
+                queue_ptr -> tx_queue_suspension_list =  TX_NULL;
+            }
+            else
+            {
+
+                /* At least one more thread is on the same suspension list.  */
+
+                /* Update the list head pointer.  */
+                next_thread =                            thread_ptr -> tx_thread_suspended_next;
+                queue_ptr -> tx_queue_suspension_list =  next_thread;
+
+                /* Update the links of the adjacent threads.  */
+                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                previous_thread -> tx_thread_suspended_next =  next_thread;
+            }
+
+            /* Clear cleanup routine to avoid timeout.  */
+            thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+            /* Put return status into the thread control block.  */
+            thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+
+            /* Add the thread to the list of threads to resume.  */
+            if (resume_count == ((UINT) 0))
+            {
+
+                /* This is the first thread, temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_tail -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_tail =  thread_ptr;
+            resume_count++;
+
+            /* Move to the next message.  */
+            count++;
+        }
+
+        /* Determine if a thread waits for this queue among multiple objects.  */
+        else if (queue_ptr -> tx_queue_wait_block_list != TX_NULL)
+        {
+
+            /* Yes, copy the message to the destination of the thread's first wait
+               block on this queue.  */
+            wait_block =   queue_ptr -> tx_queue_wait_block_list;
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(wait_block -> tx_wait_block_destination);
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+            /* Complete the wait of the thread, which removes all of its wait blocks.  */
+            thread_ptr =  _tx_thread_wait_multiple_complete(wait_block, TX_SUCCESS);
+
+            /* Add the thread to the list of threads to resume.  */
+            if (resume_count == ((UINT) 0))
+            {
+
+                /* This is the first thread, temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+                resume_list =  thread_ptr;
+            }
+            else
+            {
+
+                /* Link the thread after the last one.  */
+                resume_tail -> tx_thread_suspended_next =  thread_ptr;
+            }
+            resume_tail =  thread_ptr;
+            resume_count++;
+
+            /* Move to the next message.  */
+            count++;
+        }
+        else
+        {
+
+            /* Simply place the message in the queue.  */
+
+            /* Reduce the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage--;
+
+            /* Increase the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued++;
+
+            /* Setup destination pointer.  */
+            destination =  queue_ptr -> tx_queue_write;
+            size =         queue_ptr -> tx_queue_message_size;
+
+            /* Copy message. Note that the source and destination pointers are
+               incremented by the macro.  */
+            TX_QUEUE_MESSAGE_ROUTINE_COPY(queue_ptr, source, destination, size)
+
+            /* Determine if we are at the end.  */
+            if (destination == queue_ptr -> tx_queue_end)
+            {
+
+                /* Yes, wrap around to the beginning.  */
+                destination =  queue_ptr -> tx_queue_start;
+            }
+
+            /* Adjust the write pointer.  */
+            queue_ptr -> tx_queue_write =  destination;
+
+            /* Move to the next message.  */
+            count++;
+        }
+    }
+
+    /* Update the suspension count.  */
+    queue_ptr -> tx_queue_suspended_count =  suspended_count;
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+    /* Increment the total messages sent counter.  */
+    _tx_queue_performance_messages_sent_count =  _tx_queue_performance_messages_sent_count + ((ULONG) count);
+
+    /* Increment the number of messages sent to this queue.  */
+    queue_ptr -> tx_queue_performance_messages_sent_count =  queue_ptr -> tx_queue_performance_messages_sent_count + ((ULONG) count);
+#endif
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+    /* Pickup the notify callback routine for this queue.  */
+    queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Resume the threads whose messages were transferred.  */
+    if (resume_count != ((UINT) 0))
+    {
+
+        /* Pickup the first thread to resume.  */
+        thread_ptr =  resume_list;
+        while (resume_count != ((UINT) 0))
+        {
+
+            /* Decrement the number of threads to resume.  */
+            resume_count--;
+
+            /* Pickup the next thread before this one is resumed.  */
+            next_thread =  thread_ptr -> tx_thread_suspended_next;
+
+            /* Lockout interrupts.  */
+            TX_DISABLE
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+            /* Resume the thread!  */
+            _tx_thread_system_ni_resume(thread_ptr);
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+#else
+
+            /* Temporarily disable preemption again.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the thread.  */
+            _tx_thread_system_resume(thread_ptr);
+#endif
+
+            /* Move to the next thread.  */
+            thread_ptr =  next_thread;
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Restore previous preempt posture.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+    }
+
+    /* Determine if any message was sent.  */
+    if (count != ((UINT) 0))
+    {
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if a notify callback is required.  */
+        if (queue_send_notify != TX_NULL)
+        {
+
+            /* Call application queue send notification once for all messages.  */
+            (queue_send_notify)(queue_ptr);
+        }
+#endif
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+    else
+    {
+
+        /* The queue is full, wait to send the first message as specified by
+           the wait option.  */
+        status =  _tx_queue_send(queue_ptr, source_ptr, wait_option);
+
+        /* Determine if the message was sent.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Yes, one message was sent.  */
+            count =  ((UINT) 1);
+        }
+    }
+
+    /* Return the number of messages sent.  */
+    *sent_count =  count;
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_send_reserve                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a pointer to the free slot at the back of     */
+/*    the queue, so that a message can be built in place instead of       */
+/*    being copied in.  The message is placed in the queue with           */
+/*    tx_queue_send_commit.  The queue must be created with               */
+/*    tx_queue_spsc_create, so it has a single producer and a single      */
+/*    consumer, and no message may be sent to the front of the queue      */
+/*    between the reserve and the commit.  This function does not wait;   */
+/*    if the queue is full, TX_QUEUE_FULL is returned.                    */
+/*                                                                        */
+/*    Interrupts are not locked out.  Only the single producer moves the  */
+/*    write pointer, and a receive can only make the available storage    */
+/*    larger, so the slot found here stays free until the commit, which   */
+/*    checks the pointer again with interrupts locked out.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    message_ptr                       Destination for the pointer to    */
+/*                                        the free slot                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_queue_send_reserve           Error checking queue send reserve */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_send_reserve(TX_QUEUE *queue_ptr, VOID **message_ptr)
+{
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+UINT            status;
+
+
+    /* Determine if there is room in the queue.  */
+    if (queue_ptr -> tx_queue_available_storage != TX_NO_MESSAGES)
+    {
+
+        /* Return the free slot at the back of the queue.  */
+        *message_ptr =  (VOID *) queue_ptr -> tx_queue_write;
+        status =        TX_SUCCESS;
+    }
+    else
+    {
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+        /* Disable interrupts to update the performance counters.  */
+        TX_DISABLE
+
+        /* Increment the total number of queue full errors.  */
+        _tx_queue_performance_full_error_count++;
+
+        /* Increment the number of full errors on this queue.  */
+        queue_ptr -> tx_queue_performance_full_error_count++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#endif
+
+        /* Queue is full, return error completion.  */
+        *message_ptr =  TX_NULL;
+        status =        TX_QUEUE_FULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -60,6 +60,8 @@
 /*    _tx_thread_system_resume              Resume thread service         */
 /*    _tx_thread_system_ni_resume           Non-interruptable resume      */
 /*                                            thread                      */
+/*    _tx_thread_wait_multiple_complete Complete wait for multiple        */
+/*                                        objects                         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -72,6 +74,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            wait for multiple objects   */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_semaphore_ceiling_put(TX_SEMAPHORE *semaphore_ptr, ULONG ceiling)
@@ -114,8 +118,53 @@ UINT            status;
     /* Pickup the number of suspended threads.  */
     suspended_count =  semaphore_ptr -> tx_semaphore_suspended_count;
 
+    /* Determine if a thread waits for this semaphore among multiple objects.  */
+    if ((suspended_count == TX_NO_SUSPENSIONS) && (semaphore_ptr -> tx_semaphore_wait_block_list != TX_NULL))
+    {
+
+        /* Yes, give the instance to the thread of the first wait block on this
+           semaphore and complete its wait.  */
+        thread_ptr =  _tx_thread_wait_multiple_complete(semaphore_ptr -> tx_semaphore_wait_block_list, TX_SUCCESS);
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Pickup the application notify function.  */
+        semaphore_put_notify =  semaphore_ptr -> tx_semaphore_put_notify;
+#endif
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+        /* Resume the thread!  */
+        _tx_thread_system_ni_resume(thread_ptr);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Resume thread.  */
+        _tx_thread_system_resume(thread_ptr);
+#endif
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+        /* Determine if notification is required.  */
+        if (semaphore_put_notify != TX_NULL)
+        {
+
+            /* Yes, call the appropriate notify callback function.  */
+            (semaphore_put_notify)(semaphore_ptr);
+        }
+#endif
+    }
+
     /* Determine if there are any threads suspended on the semaphore.  */
-    if (suspended_count == TX_NO_SUSPENSIONS)
+    else if (suspended_count == TX_NO_SUSPENSIONS)
     {
 
         /* Determine if the ceiling has been exceeded.  */
@@ -44,7 +44,9 @@
 /*                                                                        */
 /*    This function handles application delete thread requests.  The      */
 /*    thread to delete must be in a terminated or completed state,        */
-/*    otherwise this function just returns an error code.                 */
+/*    otherwise this function just returns an error code.  The byte pool  */
+/*    magazines of the deleted thread are released here, since the thread */
+/*    can no longer be inside a magazine allocate or release.             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -56,7 +58,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_byte_pool_magazine_thread_release Release magazines of thread   */
+/*                                            (via function pointer)      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -69,6 +72,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), release  */
+/*                                            the byte pool magazines of  */
+/*                                            the deleted thread          */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_thread_delete(TX_THREAD *thread_ptr)
@@ -160,6 +166,14 @@ UINT            status;
 
         /* Restore interrupts.  */
         TX_RESTORE
+
+        /* Determine if the application is using byte pool magazines.  */
+        if (_tx_thread_byte_pool_magazine_release != TX_NULL)
+        {
+
+            /* Yes, return the blocks cached for this thread to their pools.  */
+            (_tx_thread_byte_pool_magazine_release)(thread_ptr);
+        }
     }
 
     /* Return completion status.  */
@@ -139,6 +139,12 @@ volatile UINT   _tx_thread_preempt_disable;
 VOID            (*_tx_thread_mutex_release)(TX_THREAD *thread_ptr);
 
 
+/* Define the global function pointer for byte pool magazine cleanup on thread completion,
+   reset, or deletion. This pointer is setup when the first magazine is created.  */
+
+VOID            (*_tx_thread_byte_pool_magazine_release)(TX_THREAD *thread_ptr);
+
+
 /* Define the global build options variable.  This contains a bit map representing
    how the ThreadX library was built. The following are the bit field definitions:
 
@@ -316,6 +322,8 @@ const CHAR _tx_thread_special_string[] =
 /*  10-15-2021     Yuxin Zhou               Modified comment(s), improved */
 /*                                            stack check error handling, */
 /*                                            resulting in version 6.1.9  */   
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            byte pool magazine release  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_thread_initialize(VOID)
@@ -362,6 +370,9 @@ VOID  _tx_thread_initialize(VOID)
     /* Initialize the thread mutex release function pointer.  */
     _tx_thread_mutex_release =      TX_NULL;
 
+    /* Initialize the thread byte pool magazine release function pointer.  */
+    _tx_thread_byte_pool_magazine_release =  TX_NULL;
+
 #ifdef TX_ENABLE_STACK_CHECKING
 
     /* Clear application registered stack error handler.  */
@@ -45,7 +45,8 @@
 /*    This function prepares the thread to run again from the entry       */
 /*    point specified during thread creation. The application must        */
 /*    call tx_thread_resume after this call completes for the thread      */
-/*    to actually run.                                                    */
+/*    to actually run.  The byte pool magazines of the thread are         */
+/*    released, so the thread starts again without cached blocks.         */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -57,6 +58,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_byte_pool_magazine_thread_release Release magazines of thread   */
+/*                                            (via function pointer)      */
 /*    _tx_thread_stack_build                Build initial thread stack    */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -70,6 +73,9 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), release  */
+/*                                            the byte pool magazines of  */
+/*                                            the thread                  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_thread_reset(TX_THREAD *thread_ptr)
@@ -127,6 +133,14 @@ UINT            status;
         /* Restore interrupts.  */
         TX_RESTORE
 
+        /* Determine if the application is using byte pool magazines.  */
+        if (_tx_thread_byte_pool_magazine_release != TX_NULL)
+        {
+
+            /* Yes, return the blocks cached for this thread to their pools.  */
+            (_tx_thread_byte_pool_magazine_release)(thread_ptr);
+        }
+
 #ifndef TX_DISABLE_STACK_FILLING
 
         /* Set the thread stack to a pattern prior to creating the initial
@@ -71,6 +71,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            byte pool magazine release  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_thread_shell_entry(VOID)
@@ -124,6 +126,14 @@ VOID            (*entry_exit_notify)(TX_THREAD *notify_thread_ptr, UINT type);
         (_tx_thread_mutex_release)(thread_ptr);
     }
 
+    /* Determine if the application is using byte pool magazines.  */
+    if (_tx_thread_byte_pool_magazine_release != TX_NULL)
+    {
+
+        /* Yes, return the blocks cached for this thread to their pools.  */
+        (_tx_thread_byte_pool_magazine_release)(thread_ptr);
+    }
+
     /* Lockout interrupts while the thread state is setup.  */
     TX_DISABLE
 
@@ -0,0 +1,396 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+#include "tx_semaphore.h"
+#include "tx_event_flags.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_wait_multiple                            PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits for the first of several queues, semaphores,    */
+/*    and event flags groups that can satisfy its wait block.  A message  */
+/*    is received from a queue into the destination of its wait block, an */
+/*    instance is obtained from a semaphore, and the requested event      */
+/*    flags are retrieved from an event flags group into the actual flags */
+/*    of its wait block.  The objects are tried in the order of their     */
+/*    wait blocks.  If none is available, the thread suspends once on all */
+/*    of the objects, and the first object that becomes available hands   */
+/*    itself over to the thread directly.  Threads suspended on an object */
+/*    by its own service are served before threads waiting for it among   */
+/*    multiple objects.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_blocks                       Pointer to the array of wait      */
+/*                                        blocks                          */
+/*    count                             Number of wait blocks             */
+/*    ready_index                       Pointer to destination for the    */
+/*                                        index of the wait block that    */
+/*                                        completed the wait              */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_event_flags_get               Get event flags                   */
+/*    _tx_queue_receive                 Receive message from queue        */
+/*    _tx_semaphore_get                 Get instance from semaphore       */
+/*    _tx_thread_system_suspend         Suspend thread service            */
+/*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _txe_thread_wait_multiple         Error checking wait for multiple  */
+/*                                        objects                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_wait_multiple(TX_WAIT_BLOCK *wait_blocks, UINT count, UINT *ready_index, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD               *thread_ptr;
+TX_WAIT_BLOCK           *wait_block;
+TX_WAIT_BLOCK           *next_block;
+TX_WAIT_BLOCK           *previous_block;
+TX_QUEUE                *queue_ptr;
+TX_SEMAPHORE            *semaphore_ptr;
+TX_EVENT_FLAGS_GROUP    *group_ptr;
+ULONG                   current_flags;
+ULONG                   flags_satisfied;
+UINT                    index;
+UINT                    available;
+UINT                    retry;
+UINT                    status;
+
+
+#if defined(TX_ENABLE_EVENT_TRACE) || defined(TX_ENABLE_EVENT_LOGGING)
+
+    /* Disable interrupts only to insert this event into the trace buffer and
+       log this kernel call.  */
+    TX_DISABLE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    TX_TRACE_IN_LINE_INSERT(TX_TRACE_THREAD_WAIT_MULTIPLE, wait_blocks, count, wait_option, TX_POINTER_TO_ULONG_CONVERT(&status), TX_TRACE_THREAD_EVENTS)
+
+    /* Log this kernel call.  */
+    TX_EL_THREAD_WAIT_MULTIPLE_INSERT
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+
+    /* Loop until an object is obtained or the wait is over.  */
+    do
+    {
+
+        /* Clear the retry flag.  */
+        retry =  TX_FALSE;
+
+        /* Try to obtain each object in turn, without suspension.  */
+        status =  TX_NOT_AVAILABLE;
+        index =   ((UINT) 0);
+        while ((status != TX_SUCCESS) && (index < count))
+        {
+
+            /* Pickup the wait block.  */
+            wait_block =  &(wait_blocks[index]);
+
+            /* Determine the type of the object.  */
+            if (wait_block -> tx_wait_block_type == TX_WAIT_QUEUE)
+            {
+
+                /* Receive a message from the queue.  */
+                status =  _tx_queue_receive(TX_VOID_TO_QUEUE_POINTER_CONVERT(wait_block -> tx_wait_block_object),
+                                            wait_block -> tx_wait_block_destination, TX_NO_WAIT);
+            }
+            else if (wait_block -> tx_wait_block_type == TX_WAIT_SEMAPHORE)
+            {
+
+                /* Get an instance from the semaphore.  */
+                status =  _tx_semaphore_get(TX_VOID_TO_SEMAPHORE_POINTER_CONVERT(wait_block -> tx_wait_block_object), TX_NO_WAIT);
+            }
+            else
+            {
+
+                /* Get the requested event flags from the group.  */
+                status =  _tx_event_flags_get(TX_VOID_TO_EVENT_FLAGS_POINTER_CONVERT(wait_block -> tx_wait_block_object),
+                                              wait_block -> tx_wait_block_requested_flags, wait_block -> tx_wait_block_get_option,
+                                              &(wait_block -> tx_wait_block_actual_flags), TX_NO_WAIT);
+            }
+
+            /* Determine if the object was obtained.  */
+            if (status == TX_SUCCESS)
+            {
+
+                /* Yes, return the index of its wait block.  */
+                *ready_index =  index;
+            }
+            else
+            {
+
+                /* Move to the next wait block.  */
+                index++;
+            }
+        }
+
+        /* Determine if none of the objects was obtained.  */
+        if (status != TX_SUCCESS)
+        {
+
+            /* Set the not available status.  */
+            status =  TX_NOT_AVAILABLE;
+
+            /* Determine if suspension is requested.  */
+            if (wait_option != TX_NO_WAIT)
+            {
+
+                /* Disable interrupts to check the objects again and place the
+                   wait blocks on their lists.  */
+                TX_DISABLE
+
+                /* Check each object again, since it may have become available after it
+                   was tried, and setup the head of its wait block list.  */
+                available =  TX_FALSE;
+                for (index = ((UINT) 0); index < count; index++)
+                {
+
+                    /* Pickup the wait block.  */
+                    wait_block =  &(wait_blocks[index]);
+
+                    /* Determine the type of the object.  */
+                    if (wait_block -> tx_wait_block_type == TX_WAIT_QUEUE)
+                    {
+
+                        /* Determine if the queue holds a message.  */
+                        queue_ptr =  TX_VOID_TO_QUEUE_POINTER_CONVERT(wait_block -> tx_wait_block_object);
+                        if (queue_ptr -> tx_queue_enqueued != TX_NO_MESSAGES)
+                        {
+
+                            /* Yes, the queue is available.  */
+                            available =  TX_TRUE;
+                        }
+                        wait_block -> tx_wait_block_list =  &(queue_ptr -> tx_queue_wait_block_list);
+                    }
+                    else if (wait_block -> tx_wait_block_type == TX_WAIT_SEMAPHORE)
+                    {
+
+                        /* Determine if the semaphore has an instance.  */
+                        semaphore_ptr =  TX_VOID_TO_SEMAPHORE_POINTER_CONVERT(wait_block -> tx_wait_block_object);
+                        if (semaphore_ptr -> tx_semaphore_count != ((ULONG) 0))
+                        {
+
+                            /* Yes, the semaphore is available.  */
+                            available =  TX_TRUE;
+                        }
+                        wait_block -> tx_wait_block_list =  &(semaphore_ptr -> tx_semaphore_wait_block_list);
+                    }
+                    else
+                    {
+
+                        /* Pickup the current flags of the group.  */
+                        group_ptr =      TX_VOID_TO_EVENT_FLAGS_POINTER_CONVERT(wait_block -> tx_wait_block_object);
+                        current_flags =  group_ptr -> tx_event_flags_group_current;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+                        /* Apply any delayed clear operations.  */
+                        current_flags =  current_flags & (~(group_ptr -> tx_event_flags_group_delayed_clear));
+#endif
+
+                        /* Calculate the flags present.  */
+                        flags_satisfied =  (current_flags & wait_block -> tx_wait_block_requested_flags);
+
+                        /* Determine if an AND request is not satisfied.  */
+                        if ((wait_block -> tx_wait_block_get_option & TX_AND) == TX_AND)
+                        {
+
+                            /* Determine if all the requested flags are present.  */
+                            if (flags_satisfied != wait_block -> tx_wait_block_requested_flags)
+                            {
+
+                                /* No, clear the flags present variable.  */
+                                flags_satisfied =  ((ULONG) 0);
+                            }
+                        }
+
+                        /* Determine if the request is satisfied.  */
+                        if (flags_satisfied != ((ULONG) 0))
+                        {
+
+                            /* Yes, the event flags group is available.  */
+                            available =  TX_TRUE;
+                        }
+                        wait_block -> tx_wait_block_list =  &(group_ptr -> tx_event_flags_group_wait_block_list);
+                    }
+                }
+
+                /* Determine if an object has become available.  */
+                if (available == TX_TRUE)
+                {
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+
+                    /* Try the objects again.  */
+                    retry =  TX_TRUE;
+                }
+
+                /* Determine if the preempt disable flag is non-zero.  */
+                else if (_tx_thread_preempt_disable != ((UINT) 0))
+                {
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+
+                    /* Suspension is not allowed if the preempt disable flag is non-zero at this point, return
+                       the not available status.  */
+                }
+                else
+                {
+
+                    /* Prepare for suspension of this thread.  */
+
+                    /* Pickup thread pointer.  */
+                    TX_THREAD_GET_CURRENT(thread_ptr)
+
+                    /* Setup cleanup routine pointer.  */
+                    thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_thread_wait_multiple_cleanup);
+
+                    /* Setup cleanup information, i.e. the wait blocks and their number.  */
+                    thread_ptr -> tx_thread_suspend_control_block =  (VOID *) wait_blocks;
+                    thread_ptr -> tx_thread_suspend_info =           (ULONG) count;
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+                    /* Increment the suspension sequence number, which is used to identify
+                       this suspension event.  */
+                    thread_ptr -> tx_thread_suspension_sequence++;
+#endif
+
+                    /* Place each wait block at the end of the wait block list of its object.  */
+                    for (index = ((UINT) 0); index < count; index++)
+                    {
+
+                        /* Pickup the wait block and setup its thread.  */
+                        wait_block =                            &(wait_blocks[index]);
+                        wait_block -> tx_wait_block_thread =    thread_ptr;
+
+                        /* Determine if the list is empty.  */
+                        next_block =  *(wait_block -> tx_wait_block_list);
+                        if (next_block == TX_NULL)
+                        {
+
+                            /* Yes, setup the head pointer and just setup this wait block's
+                               pointers to itself.  */
+                            *(wait_block -> tx_wait_block_list) =   wait_block;
+                            wait_block -> tx_wait_block_next =      wait_block;
+                            wait_block -> tx_wait_block_previous =  wait_block;
+                        }
+                        else
+                        {
+
+                            /* This list is not NULL, add the wait block to the end.  */
+                            previous_block =                        next_block -> tx_wait_block_previous;
+                            wait_block -> tx_wait_block_next =      next_block;
+                            wait_block -> tx_wait_block_previous =  previous_block;
+                            previous_block -> tx_wait_block_next =  wait_block;
+                            next_block -> tx_wait_block_previous =  wait_block;
+                        }
+                    }
+
+                    /* Set the state to suspended.  */
+                    thread_ptr -> tx_thread_state =    TX_MULTIPLE_WAIT;
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                    /* Call actual non-interruptable thread suspension routine.  */
+                    _tx_thread_system_ni_suspend(thread_ptr, wait_option);
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+#else
+
+                    /* Set the suspending flag.  */
+                    thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+                    /* Setup the timeout period.  */
+                    thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+                    /* Temporarily disable preemption.  */
+                    _tx_thread_preempt_disable++;
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+
+                    /* Call actual thread suspension routine.  */
+                    _tx_thread_system_suspend(thread_ptr);
+#endif
+
+                    /* Pickup the completion status.  */
+                    status =  thread_ptr -> tx_thread_suspend_status;
+
+                    /* Determine if an object completed the wait.  */
+                    if ((status == TX_SUCCESS) || (status == TX_DELETED))
+                    {
+
+                        /* Yes, return the index of its wait block.  */
+                        *ready_index =  (UINT) thread_ptr -> tx_thread_suspend_info;
+                    }
+                }
+            }
+        }
+    } while (retry == TX_TRUE);
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_wait_multiple_cleanup                    PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes a timeout, thread terminate, or wait abort  */
+/*    of a thread waiting for multiple objects, and removes its wait      */
+/*    blocks from the wait block lists of their objects.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to suspended thread's     */
+/*                                        control block                   */
+/*    suspension_sequence               Suspension sequence number        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume          Resume thread service             */
+/*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
+/*    _tx_thread_wait_multiple_complete Complete wait for multiple        */
+/*                                        objects                         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_timeout                Thread timeout processing         */
+/*    _tx_thread_terminate              Thread terminate processing       */
+/*    _tx_thread_wait_abort             Thread wait abort processing      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_thread_wait_multiple_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence)
+{
+
+#ifndef TX_NOT_INTERRUPTABLE
+TX_INTERRUPT_SAVE_AREA
+#endif
+
+TX_WAIT_BLOCK       *wait_blocks;
+UINT                status;
+
+
+#ifndef TX_NOT_INTERRUPTABLE
+
+    /* Disable interrupts to remove the wait blocks of the thread.  */
+    TX_DISABLE
+
+    /* Determine if the cleanup is still required.  */
+    if (thread_ptr -> tx_thread_suspend_cleanup == &(_tx_thread_wait_multiple_cleanup))
+    {
+
+        /* Check for valid suspension sequence.  */
+        if (suspension_sequence == thread_ptr -> tx_thread_suspension_sequence)
+        {
+#endif
+
+            /* Determine if this cleanup is from a timeout, or from a terminate or
+               wait abort that has already setup the return status.  */
+            if (thread_ptr -> tx_thread_state == TX_MULTIPLE_WAIT)
+            {
+
+                /* Timeout condition, none of the objects became available.  */
+                status =  TX_NOT_AVAILABLE;
+            }
+            else
+            {
+
+                /* Keep the return status.  */
+                status =  thread_ptr -> tx_thread_suspend_status;
+            }
+
+            /* Pickup the first wait block of the thread.  */
+            wait_blocks =  TX_VOID_TO_WAIT_BLOCK_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_THREAD_WAIT_MULTIPLE_CLEANUP, thread_ptr, TX_POINTER_TO_ULONG_CONVERT(wait_blocks), status, thread_ptr -> tx_thread_state, TX_TRACE_THREAD_EVENTS)
+
+            /* Remove all the wait blocks of the thread through its first wait block.  */
+            thread_ptr =   _tx_thread_wait_multiple_complete(wait_blocks, status);
+
+            /* Determine if the thread is still waiting after a timeout.  */
+            if (thread_ptr -> tx_thread_state == TX_MULTIPLE_WAIT)
+            {
+
+#ifdef TX_NOT_INTERRUPTABLE
+
+                /* Resume the thread!  */
+                _tx_thread_system_ni_resume(thread_ptr);
+#else
+
+                /* Temporarily disable preemption.  */
+                _tx_thread_preempt_disable++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Resume the thread!  */
+                _tx_thread_system_resume(thread_ptr);
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+#endif
+            }
+#ifndef TX_NOT_INTERRUPTABLE
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#endif
+}
+
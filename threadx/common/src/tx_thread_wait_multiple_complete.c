@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_wait_multiple_complete                   PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function completes the wait of a thread for multiple objects   */
+/*    on behalf of the object of the specified wait block.  All of the    */
+/*    thread's wait blocks are removed from the wait block lists of their */
+/*    objects, and the index of the wait block and the completion status  */
+/*    are placed in the thread control block.  The caller hands the       */
+/*    object over to the thread and resumes it.  This function must be    */
+/*    called with interrupts disabled.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_block                        Pointer to the wait block         */
+/*    status                            Completion status of the wait     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    thread_ptr                        Pointer to the waiting thread     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_event_flags_delete            Delete event flags group          */
+/*    _tx_event_flags_set               Set event flags                   */
+/*    _tx_queue_delete                  Delete queue                      */
+/*    _tx_queue_front_send              Send message to queue front       */
+/*    _tx_queue_send                    Send message to queue             */
+/*    _tx_queue_send_commit             Commit reserved queue message     */
+/*    _tx_queue_send_n                  Send multiple messages to queue   */
+/*    _tx_semaphore_ceiling_put         Put instance with ceiling         */
+/*    _tx_semaphore_delete              Delete semaphore                  */
+/*    _tx_semaphore_put                 Put instance in semaphore         */
+/*    _tx_thread_wait_multiple_cleanup  Wait for multiple objects         */
+/*                                        cleanup                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+TX_THREAD  *_tx_thread_wait_multiple_complete(TX_WAIT_BLOCK *wait_block, UINT status)
+{
+
+TX_THREAD       *thread_ptr;
+TX_WAIT_BLOCK   *wait_blocks;
+TX_WAIT_BLOCK   *block_ptr;
+TX_WAIT_BLOCK   *next_block;
+TX_WAIT_BLOCK   *previous_block;
+TX_WAIT_BLOCK   **wait_block_list;
+ULONG           count;
+ULONG           index;
+ULONG           ready_index;
+
+
+    /* Pickup the waiting thread, its wait blocks, and their number.  */
+    thread_ptr =   wait_block -> tx_wait_block_thread;
+    wait_blocks =  TX_VOID_TO_WAIT_BLOCK_POINTER_CONVERT(thread_ptr -> tx_thread_suspend_control_block);
+    count =        thread_ptr -> tx_thread_suspend_info;
+
+    /* Remove each wait block from the wait block list of its object.  */
+    ready_index =  ((ULONG) 0);
+    for (index = ((ULONG) 0); index < count; index++)
+    {
+
+        /* Pickup the wait block and the head of its list.  */
+        block_ptr =        &(wait_blocks[index]);
+        wait_block_list =  block_ptr -> tx_wait_block_list;
+
+        /* Determine if this is the wait block that completes the wait.  */
+        if (block_ptr == wait_block)
+        {
+
+            /* Yes, remember its index.  */
+            ready_index =  index;
+        }
+
+        /* See if this is the only wait block on the list.  */
+        next_block =  block_ptr -> tx_wait_block_next;
+        if (next_block == block_ptr)
+        {
+
+            /* Yes, the only wait block.  */
+
+            /* Update the head pointer.  */
+            *wait_block_list =  TX_NULL;
+        }
+        else
+        {
+
+            /* At least one more wait block is on the same list.  */
+
+            /* Update the links of the adjacent wait blocks.  */
+            previous_block =                          block_ptr -> tx_wait_block_previous;
+            next_block -> tx_wait_block_previous =    previous_block;
+            previous_block -> tx_wait_block_next =    next_block;
+
+            /* Determine if we need to update the head pointer.  */
+            if (*wait_block_list == block_ptr)
+            {
+
+                /* Update the list head pointer.  */
+                *wait_block_list =  next_block;
+            }
+        }
+    }
+
+    /* Return the index of the wait block in the suspend information.  */
+    thread_ptr -> tx_thread_suspend_info =  ready_index;
+
+    /* Clear cleanup routine to avoid timeout.  */
+    thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+    /* Put return status into the thread control block.  */
+    thread_ptr -> tx_thread_suspend_status =  status;
+
+    /* Return the thread to resume.  */
+    return(thread_ptr);
+}
+
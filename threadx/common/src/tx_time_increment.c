@@ -0,0 +1,420 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_time_increment                                  PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function advances the system clock by the specified number of  */
+/*    ticks at once.  It is called in place of the timer interrupt        */
+/*    processing after the periodic tick has been stopped, typically for  */
+/*    the number of ticks returned by _tx_timer_get_next or the ticks     */
+/*    that actually elapsed while the system was idle.  The ticks before  */
+/*    the last one only move the timers on the timer list entries that    */
+/*    they pass over, and the timers on the timing wheel, closer to       */
+/*    their expiration.  The last tick is processed just like the timer   */
+/*    interrupt, including the timer expiration and time-slice            */
+/*    processing.  Timers that would have expired earlier within the      */
+/*    increment expire on the last tick, and a periodic timer that would  */
+/*    have expired several times expires only once.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    time_increment                        Number of ticks to advance    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_time_slice                 Time slice interrupted thread */
+/*    _tx_timer_expiration_process          Timer expiration processing   */
+/*    _tx_timer_system_activate             Timer activate                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Port timer interrupt processing                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_time_increment(ULONG time_increment)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           **timer_list;
+TX_TIMER_INTERNAL           *active_timers;
+TX_TIMER_INTERNAL           *current_timer;
+TX_TIMER_INTERNAL           *next_timer;
+TX_TIMER_INTERNAL           *previous_timer;
+ULONG                       entry_ticks;
+ULONG                       expiration_ticks;
+ULONG                       skipped_ticks;
+ULONG                       delta;
+#if TX_TIMER_WHEEL_LEVELS != 0
+TX_TIMER_INTERNAL           *list_head;
+ULONG                       cascade_ticks;
+ULONG                       cascades;
+UINT                        level;
+UINT                        index;
+UINT                        entry;
+UINT                        wheel_active;
+#endif
+
+
+    /* Determine if there is anything to advance.  */
+    if (time_increment != ((ULONG) 0))
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Advance the system clock.  */
+        _tx_timer_system_clock =  _tx_timer_system_clock + time_increment;
+
+        /* Test for time-slice expiration.  */
+        if (_tx_timer_time_slice != ((ULONG) 0))
+        {
+
+            /* Determine if the time-slice runs out within the increment.  */
+            if (_tx_timer_time_slice > time_increment)
+            {
+
+                /* No, just use up the ticks.  */
+                _tx_timer_time_slice =  _tx_timer_time_slice - time_increment;
+            }
+            else
+            {
+
+                /* Set the time-slice expired flag.  */
+                _tx_timer_time_slice =          ((ULONG) 0);
+                _tx_timer_expired_time_slice =  TX_TRUE;
+            }
+        }
+
+        /* Calculate the ticks that are skipped before the last one.  */
+        skipped_ticks =  time_increment - ((ULONG) 1);
+        if (skipped_ticks != ((ULONG) 0))
+        {
+
+            /* Remove the timers on the entries of the timer list that the skipped ticks
+               pass over, starting with the entry processed on the next tick, and
+               calculate the ticks they have left after the skipped ticks.  The timers
+               on the later entries keep their place, the current timer pointer is
+               simply moved closer to them.  */
+            active_timers =  TX_NULL;
+            timer_list =     _tx_timer_current_ptr;
+#if TX_TIMER_WHEEL_LEVELS != 0
+            wheel_active =   TX_FALSE;
+            if (_tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_list_head != TX_NULL)
+            {
+
+                /* Remember that there are timers on the timing wheel before the wheel
+                   timer is possibly removed below.  */
+                wheel_active =  TX_TRUE;
+            }
+#endif
+            for (entry_ticks = ((ULONG) 1); (entry_ticks <= skipped_ticks) && (entry_ticks <= TX_TIMER_ENTRIES); entry_ticks++)
+            {
+
+                /* Remove all the timers on this entry, empty entries are skipped.  */
+                while (*timer_list != TX_NULL)
+                {
+
+                    /* Pickup the first timer on this entry.  */
+                    current_timer =  *timer_list;
+                    next_timer =     current_timer -> tx_timer_internal_active_next;
+
+                    /* Determine if this is the only timer.  */
+                    if (current_timer == next_timer)
+                    {
+
+                        /* Yes, the entry is now empty.  */
+                        *timer_list =  TX_NULL;
+                    }
+                    else
+                    {
+
+                        /* No, unlink the timer and make the next timer the head.  */
+                        previous_timer =                                   current_timer -> tx_timer_internal_active_previous;
+                        next_timer -> tx_timer_internal_active_previous =  previous_timer;
+                        previous_timer -> tx_timer_internal_active_next =  next_timer;
+                        *timer_list =                                      next_timer;
+                    }
+
+                    /* Calculate the ticks until this timer expires.  */
+                    expiration_ticks =  entry_ticks;
+                    if (current_timer -> tx_timer_internal_remaining_ticks > TX_TIMER_ENTRIES)
+                    {
+
+                        expiration_ticks =  expiration_ticks + (current_timer -> tx_timer_internal_remaining_ticks - TX_TIMER_ENTRIES);
+                    }
+
+                    /* Calculate the ticks left after the skipped ticks.  A timer that is
+                       already due is processed on the last tick.  */
+                    if (expiration_ticks > skipped_ticks)
+                    {
+
+                        current_timer -> tx_timer_internal_remaining_ticks =  expiration_ticks - skipped_ticks;
+                    }
+                    else
+                    {
+
+                        current_timer -> tx_timer_internal_remaining_ticks =  ((ULONG) 1);
+                    }
+
+                    /* Place the timer on the local list of timers to re-activate.  The
+                       wheel timer is re-activated by the timers placed on the wheel.  */
+                    current_timer -> tx_timer_internal_list_head =    TX_NULL;
+#if TX_TIMER_WHEEL_LEVELS != 0
+                    if (current_timer != &(_tx_timer_wheel_timer.tx_timer_internal))
+#endif
+                    {
+
+                        current_timer -> tx_timer_internal_active_next =  active_timers;
+                        active_timers =                                   current_timer;
+                    }
+                }
+
+                /* Move to the next entry, wrapping at the end of the list.  */
+                timer_list =  TX_TIMER_POINTER_ADD(timer_list, 1);
+                if (timer_list == _tx_timer_list_end)
+                {
+
+                    timer_list =  _tx_timer_list_start;
+                }
+            }
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+            /* Remove the timers on the entries of the timing wheel that are cascaded
+               within the skipped ticks.  The wheel is only cascaded while the wheel
+               timer is active, which is whenever there are timers on the wheel.  */
+            if (wheel_active == TX_TRUE)
+            {
+
+                /* The next entry of the first level is cascaded when the timer list
+                   wraps.  */
+                cascade_ticks =  TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+                entry_ticks =    TX_TIMER_ENTRIES;
+                for (level = ((UINT) 0); level < TX_TIMER_WHEEL_LEVELS; level++)
+                {
+
+                    /* Calculate how many entries of this level are cascaded within the
+                       skipped ticks.  */
+                    cascades =  ((ULONG) 0);
+                    if (cascade_ticks <= skipped_ticks)
+                    {
+
+                        cascades =  ((skipped_ticks - cascade_ticks) / entry_ticks) + ((ULONG) 1);
+                    }
+
+                    /* Remove the timers on the cascaded entries.  Every entry of the level
+                       is cascaded at most once.  */
+                    index =  _tx_timer_wheel_index[level];
+                    for (entry = ((UINT) 0); (((ULONG) entry) < cascades) && (((ULONG) entry) < TX_TIMER_ENTRIES); entry++)
+                    {
+
+                        /* Determine if there are timers on this entry.  */
+                        timer_list =  &_tx_timer_wheel[level][(index + entry) % ((UINT) TX_TIMER_ENTRIES)];
+                        list_head =   *timer_list;
+                        if (list_head != TX_NULL)
+                        {
+
+                            /* Remove all the timers on this entry.  */
+                            current_timer =  list_head;
+                            do
+                            {
+
+                                /* Pickup the next timer before the links are rebuilt.  */
+                                next_timer =  current_timer -> tx_timer_internal_active_next;
+
+                                /* Calculate the ticks left after the skipped ticks.  A timer on
+                                   the wheel expires its remaining ticks after its entry is
+                                   cascaded.  */
+                                expiration_ticks =  cascade_ticks + (entry_ticks * ((ULONG) entry)) + current_timer -> tx_timer_internal_remaining_ticks;
+                                if (expiration_ticks > skipped_ticks)
+                                {
+
+                                    current_timer -> tx_timer_internal_remaining_ticks =  expiration_ticks - skipped_ticks;
+                                }
+                                else
+                                {
+
+                                    current_timer -> tx_timer_internal_remaining_ticks =  ((ULONG) 1);
+                                }
+
+                                /* Place the timer on the local list of timers to re-activate.  */
+                                current_timer -> tx_timer_internal_list_head =    TX_NULL;
+                                current_timer -> tx_timer_internal_active_next =  active_timers;
+                                active_timers =                                   current_timer;
+
+                                /* Move to the next timer on this entry.  */
+                                current_timer =  next_timer;
+                            } while (current_timer != list_head);
+
+                            /* This entry is now empty.  */
+                            *timer_list =  TX_NULL;
+                        }
+                    }
+
+                    /* The next entry of the level above is cascaded when this level wraps.  */
+                    cascade_ticks =  cascade_ticks + (entry_ticks * ((TX_TIMER_ENTRIES - ((ULONG) index)) % TX_TIMER_ENTRIES));
+                    entry_ticks =    entry_ticks * TX_TIMER_ENTRIES;
+
+                    /* Move the level past its cascaded entries.  */
+                    _tx_timer_wheel_index[level] =  (UINT) ((((ULONG) index) + cascades) % TX_TIMER_ENTRIES);
+                }
+            }
+#endif
+
+            /* Move the current timer pointer over the skipped ticks.  */
+            delta =  skipped_ticks % TX_TIMER_ENTRIES;
+            timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, delta);
+            if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(timer_list) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+            {
+
+                /* Wrap from the beginning of the list.  */
+                delta =       TX_TIMER_POINTER_DIF(timer_list, _tx_timer_list_end);
+                timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
+            }
+            _tx_timer_current_ptr =  timer_list;
+
+            /* Re-activate the timers relative to the new position in the timer list.  */
+            while (active_timers != TX_NULL)
+            {
+
+                /* Pickup the next timer before the links are rebuilt.  */
+                current_timer =  active_timers;
+                active_timers =  current_timer -> tx_timer_internal_active_next;
+
+                /* Put the timer back on the timer list.  */
+                _tx_timer_system_activate(current_timer);
+            }
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+            /* Determine if the wheel timer has been removed while timers are left on
+               the wheel, and none of the re-activated timers has been placed on it.  */
+            if ((wheel_active == TX_TRUE) &&
+                (_tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_list_head == TX_NULL))
+            {
+
+                /* Look for timers that are left on the wheel.  */
+                wheel_active =  TX_FALSE;
+                for (level = ((UINT) 0); (level < TX_TIMER_WHEEL_LEVELS) && (wheel_active == TX_FALSE); level++)
+                {
+
+                    for (entry = ((UINT) 0); entry < ((UINT) TX_TIMER_ENTRIES); entry++)
+                    {
+
+                        if (_tx_timer_wheel[level][entry] != TX_NULL)
+                        {
+
+                            wheel_active =  TX_TRUE;
+                        }
+                    }
+                }
+
+                /* Determine if timers are left on the wheel.  */
+                if (wheel_active == TX_TRUE)
+                {
+
+                    /* Activate the wheel timer on the last entry of the timer list.  */
+                    _tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_remaining_ticks =
+                                        TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+                    _tx_timer_system_activate(&(_tx_timer_wheel_timer.tx_timer_internal));
+                }
+            }
+#endif
+        }
+
+        /* Now process the last tick like the timer interrupt.  Test for timer
+           expiration.  */
+        if (*_tx_timer_current_ptr != TX_NULL)
+        {
+
+            /* Set expiration flag.  */
+            _tx_timer_expired =  TX_TRUE;
+        }
+        else
+        {
+
+            /* No timer expired, increment the timer pointer.  */
+            _tx_timer_current_ptr =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, 1);
+
+            /* Check for wrap-around.  */
+            if (_tx_timer_current_ptr == _tx_timer_list_end)
+            {
+
+                /* Wrap to beginning of list.  */
+                _tx_timer_current_ptr =  _tx_timer_list_start;
+            }
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Did a timer expire?  */
+        if (_tx_timer_expired != TX_FALSE)
+        {
+
+            /* Process timer expiration.  */
+            _tx_timer_expiration_process();
+        }
+
+        /* Did time slice expire?  */
+        if (_tx_timer_expired_time_slice != TX_FALSE)
+        {
+
+            /* Time slice interrupted thread.  */
+            _tx_thread_time_slice();
+        }
+    }
+}
+
+#endif
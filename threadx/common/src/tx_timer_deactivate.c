@@ -54,7 +54,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_ticks_get         Get wheel entry cascade ticks     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -67,6 +67,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_timer_deactivate(TX_TIMER *timer_ptr)
@@ -170,9 +172,28 @@ UINT                active_timer_list;
         }
         else
         {
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+            /* Calculate the ticks until the timer's entry is cascaded, if the timer
+               is on the timing wheel.  */
+            ticks_left =  _tx_timer_wheel_ticks_get(list_head);
+
+            /* Determine if the timer is on the timing wheel.  */
+            if (ticks_left != ((ULONG) 0))
+            {
+
+                /* The timer expires its remaining ticks after the cascade.  */
+                internal_ptr -> tx_timer_internal_remaining_ticks =
+                                        internal_ptr -> tx_timer_internal_remaining_ticks + ticks_left;
+            }
+
+            /* Determine if this is timer has just expired.  */
+            else if (_tx_timer_expired_timer_ptr != internal_ptr)
+#else
 
             /* Determine if this is timer has just expired.  */
             if (_tx_timer_expired_timer_ptr != internal_ptr)
+#endif
             {
 
                 /* No, it hasn't expired. Now check for remaining time greater than the list
@@ -62,6 +62,7 @@
 /*    _tx_thread_system_resume          Thread resume processing          */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_timer_system_activate         Timer reactivate processing       */
+/*    _tx_timer_wheel_cascade           Timing wheel cascade              */
 /*    Timer Expiration Function                                           */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -77,6 +78,8 @@
 /*                                            opt out of function when    */
 /*                                            TX_NO_TIMER is defined,     */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_timer_expiration_process(VOID)
@@ -184,6 +187,11 @@ TX_TIMER                    *timer_ptr;
                 {
 
                     _tx_timer_current_ptr =  _tx_timer_list_start;
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+                    /* The timer list wrapped, cascade the timing wheel.  */
+                    _tx_timer_wheel_cascade();
+#endif
                 }
 
                 /* Clear the expired flag.  */
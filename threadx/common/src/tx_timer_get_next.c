@@ -0,0 +1,248 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_get_next                                  PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of timer ticks until the next      */
+/*    timer or time-slice expiration.  Timers longer than the timer list  */
+/*    and timers on the timing wheel are accounted for with their         */
+/*    remaining ticks, so the result is the real expiration and not just  */
+/*    the next timer list entry or wheel cascade.  Together with          */
+/*    _tx_time_increment, this allows a port to stop the periodic tick    */
+/*    while the system is idle and program a single wakeup instead.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    next_timer_tick_ptr                   Destination for the ticks     */
+/*                                            until the next expiration   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                               An expiration is pending      */
+/*    TX_FALSE                              Nothing is going to expire    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    Port idle processing                                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_timer_get_next(ULONG *next_timer_tick_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           **timer_list;
+TX_TIMER_INTERNAL           *list_head;
+TX_TIMER_INTERNAL           *current_timer;
+ULONG                       entry_ticks;
+ULONG                       expiration_ticks;
+ULONG                       next_ticks;
+#if TX_TIMER_WHEEL_LEVELS != 0
+ULONG                       cascade_ticks;
+ULONG                       entry_cascade_ticks;
+#endif
+UINT                        status;
+#if TX_TIMER_WHEEL_LEVELS != 0
+UINT                        level;
+UINT                        index;
+UINT                        entry;
+#endif
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Default to no expiration.  */
+    next_ticks =  TX_WAIT_FOREVER;
+
+    /* An active time-slice expires when its remaining ticks are used up.  */
+    if (_tx_timer_time_slice != ((ULONG) 0))
+    {
+
+        next_ticks =  _tx_timer_time_slice;
+    }
+
+    /* Walk the timer list, starting with the entry processed on the next tick.  Any timer
+       on a later entry expires later, so the walk stops once the entries are beyond the
+       earliest expiration found.  */
+    timer_list =  _tx_timer_current_ptr;
+    for (entry_ticks = ((ULONG) 1); (entry_ticks <= TX_TIMER_ENTRIES) && (entry_ticks < next_ticks); entry_ticks++)
+    {
+
+        /* Pickup the timers on this entry.  */
+        list_head =  *timer_list;
+        if (list_head != TX_NULL)
+        {
+
+            /* Examine each timer on this entry.  */
+            current_timer =  list_head;
+            do
+            {
+
+                /* A timer bigger than the timer list is re-inserted when this entry is
+                   processed, and expires its remaining ticks beyond the list later.  */
+                expiration_ticks =  entry_ticks;
+                if (current_timer -> tx_timer_internal_remaining_ticks > TX_TIMER_ENTRIES)
+                {
+
+                    expiration_ticks =  expiration_ticks + (current_timer -> tx_timer_internal_remaining_ticks - TX_TIMER_ENTRIES);
+                }
+
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+                /* Remember the earliest expiration.  The wheel timer does not expire
+                   anything by itself.  */
+                if ((expiration_ticks < next_ticks) && (current_timer != &(_tx_timer_wheel_timer.tx_timer_internal)))
+#else
+
+                /* Remember the earliest expiration.  */
+                if (expiration_ticks < next_ticks)
+#endif
+                {
+
+                    next_ticks =  expiration_ticks;
+                }
+
+                /* Move to the next timer on this entry.  */
+                current_timer =  current_timer -> tx_timer_internal_active_next;
+            } while (current_timer != list_head);
+        }
+
+        /* Move to the next entry, wrapping at the end of the list.  */
+        timer_list =  TX_TIMER_POINTER_ADD(timer_list, 1);
+        if (timer_list == _tx_timer_list_end)
+        {
+
+            timer_list =  _tx_timer_list_start;
+        }
+    }
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+    /* Walk each level of the timing wheel in the order its entries are cascaded.  A timer
+       on the wheel expires its remaining ticks after its entry is cascaded, which is no
+       later than the cascade of the next entry, except for the timers beyond the top
+       level.  So the walk of a level stops at the first entry that is cascaded after the
+       earliest expiration found, typically right after its first entry with timers.  */
+    cascade_ticks =  TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+    entry_ticks =    TX_TIMER_ENTRIES;
+    for (level = ((UINT) 0); level < TX_TIMER_WHEEL_LEVELS; level++)
+    {
+
+        /* Examine the entries of this level, starting with the next one cascaded.  */
+        index =  _tx_timer_wheel_index[level];
+        for (entry = ((UINT) 0); entry < ((UINT) TX_TIMER_ENTRIES); entry++)
+        {
+
+            /* Stop if this entry is cascaded after the earliest expiration found.  */
+            entry_cascade_ticks =  cascade_ticks + (entry_ticks * ((ULONG) entry));
+            if (entry_cascade_ticks >= next_ticks)
+            {
+
+                break;
+            }
+
+            /* Pickup the timers on this entry.  */
+            list_head =  _tx_timer_wheel[level][(index + entry) % ((UINT) TX_TIMER_ENTRIES)];
+            if (list_head != TX_NULL)
+            {
+
+                /* Examine each timer on this entry.  */
+                current_timer =  list_head;
+                do
+                {
+
+                    /* Remember the earliest expiration.  */
+                    expiration_ticks =  entry_cascade_ticks + current_timer -> tx_timer_internal_remaining_ticks;
+                    if (expiration_ticks < next_ticks)
+                    {
+
+                        next_ticks =  expiration_ticks;
+                    }
+
+                    /* Move to the next timer on this entry.  */
+                    current_timer =  current_timer -> tx_timer_internal_active_next;
+                } while (current_timer != list_head);
+            }
+        }
+
+        /* The next entry of the level above is cascaded when this level wraps.  */
+        cascade_ticks =  cascade_ticks + (entry_ticks * ((TX_TIMER_ENTRIES - ((ULONG) index)) % TX_TIMER_ENTRIES));
+        entry_ticks =    entry_ticks * TX_TIMER_ENTRIES;
+    }
+#endif
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the ticks until the next expiration.  */
+    *next_timer_tick_ptr =  next_ticks;
+
+    /* Determine if anything is going to expire.  */
+    if (next_ticks == TX_WAIT_FOREVER)
+    {
+
+        status =  TX_FALSE;
+    }
+    else
+    {
+
+        status =  TX_TRUE;
+    }
+
+    /* Return status to the caller.  */
+    return(status);
+}
+
+#endif
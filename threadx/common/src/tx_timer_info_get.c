@@ -61,7 +61,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_ticks_get         Get wheel entry cascade ticks     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -74,6 +74,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
 /*                                                                        */
 /**************************************************************************/
 UINT  _tx_timer_info_get(TX_TIMER *timer_ptr, CHAR **name, UINT *active, ULONG *remaining_ticks,
@@ -179,12 +181,34 @@ UINT                active_timer_list;
         }
         else
         {
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+            /* Calculate the ticks until the timer's entry is cascaded, if the timer
+               is on the timing wheel.  */
+            list_head =  internal_ptr -> tx_timer_internal_list_head;
+            ticks_left =  _tx_timer_wheel_ticks_get(list_head);
+
+            /* Determine if the timer is on the timing wheel.  */
+            if (ticks_left != ((ULONG) 0))
+            {
+
+                /* The timer expires its remaining ticks after the cascade.  */
+                ticks_left =  ticks_left + internal_ptr -> tx_timer_internal_remaining_ticks;
+            }
+
+            /* The timer is not on the actual timer list or the wheel so it must either be being
+               processed or on a temporary list to be processed.   */
+
+            /* Check to see if this timer is the timer currently being processed.  */
+            else if (_tx_timer_expired_timer_ptr == internal_ptr)
+#else
 
             /* The timer is not on the actual timer list so it must either be being processed
                or on a temporary list to be processed.   */
 
             /* Check to see if this timer is the timer currently being processed.  */
             if (_tx_timer_expired_timer_ptr == internal_ptr)
+#endif
             {
 
                 /* Timer dispatch routine is executing, waiting to execute, or just finishing. No more remaining ticks for this expiration.  */
@@ -197,7 +221,7 @@ UINT                active_timer_list;
                    waiting to be processed.  */
 
                 /* Calculate the remaining ticks for a timer in the process of expiring.  */
-                if (ticks_left > TX_TIMER_ENTRIES)
+                if (internal_ptr -> tx_timer_internal_remaining_ticks > TX_TIMER_ENTRIES)
                 {
 
                     /* Calculate the number of ticks remaining.  */
@@ -67,6 +67,27 @@ TX_TIMER_INTERNAL   **_tx_timer_list_end;
 TX_TIMER_INTERNAL   **_tx_timer_current_ptr;
 
 
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+/* Define the timing wheel.  Timers that do not fit in the timer list are placed on
+   the wheel and moved down a level each time their entry is cascaded.  */
+
+TX_TIMER_INTERNAL   *_tx_timer_wheel[TX_TIMER_WHEEL_LEVELS][TX_TIMER_ENTRIES];
+
+
+/* Define the index of the next entry to cascade on each level of the wheel.  */
+
+UINT                _tx_timer_wheel_index[TX_TIMER_WHEEL_LEVELS];
+
+
+/* Define the internal wheel timer.  While there are timers on the wheel, it occupies
+   the last entry of the timer list, so the timer list always wraps in the timer
+   expiration processing, which cascades the wheel.  */
+
+TX_TIMER            _tx_timer_wheel_timer;
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer
    has expired.  */
 
@@ -200,6 +221,8 @@ ULONG               _tx_timer_time_slice;
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_timer_initialize(VOID)
@@ -228,6 +251,16 @@ UINT    status;
 
     /* First, initialize the timer list.  */
     TX_MEMSET(&_tx_timer_list[0], 0, (sizeof(_tx_timer_list)));
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+    /* Clear the timing wheel and its cascade indices.  */
+    TX_MEMSET(&_tx_timer_wheel[0][0], 0, (sizeof(_tx_timer_wheel)));
+    TX_MEMSET(&_tx_timer_wheel_index[0], 0, (sizeof(_tx_timer_wheel_index)));
+
+    /* Clear the wheel timer.  It never expires, the wheel cascade moves it back to the
+       last entry of the timer list each time the list wraps.  */
+    TX_MEMSET(&_tx_timer_wheel_timer, 0, (sizeof(TX_TIMER)));
+#endif
 #endif
 
     /* Initialize all of the list pointers.  */
@@ -43,8 +43,10 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function places the specified internal timer in the proper     */
-/*    place in the timer expiration list.  If the timer is already active */
-/*    this function does nothing.                                         */
+/*    place in the timer expiration list.  Timers that do not fit in the  */
+/*    list are placed on the timing wheel level that covers them, and the */
+/*    wheel timer is activated if necessary.  If the timer is             */
+/*    already active this function does nothing.                          */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -56,7 +58,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_system_activate         Activate the wheel timer          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -64,6 +66,8 @@
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*    _tx_timer_thread_entry            Timer thread processing           */
 /*    _tx_timer_activate                Application timer activate        */
+/*    _tx_timer_wheel_cascade           Timing wheel cascade              */
+/*    _tx_time_increment                Advance the system clock          */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -74,6 +78,8 @@
 /*                                            opt out of function when    */
 /*                                            TX_NO_TIMER is defined,     */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
 /*                                                                        */
 /**************************************************************************/
 VOID  _tx_timer_system_activate(TX_TIMER_INTERNAL *timer_ptr)
@@ -85,6 +91,12 @@ TX_TIMER_INTERNAL           *previous_timer;
 ULONG                       delta;
 ULONG                       remaining_ticks;
 ULONG                       expiration_time;
+#if TX_TIMER_WHEEL_LEVELS != 0
+ULONG                       cascade_ticks;
+ULONG                       entry_ticks;
+ULONG                       entry;
+UINT                        level;
+#endif
 
 
     /* Pickup the remaining ticks.  */
@@ -110,8 +122,44 @@ ULONG                       expiration_time;
                 if (remaining_ticks > TX_TIMER_ENTRIES)
                 {
 
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+                    /* The timer does not fit in the timer list, place it on the timing
+                       wheel.  The next entry of the first level is cascaded when the
+                       timer list wraps.  */
+                    cascade_ticks =  TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+                    entry_ticks =    TX_TIMER_ENTRIES;
+                    level =          ((UINT) 0);
+                    entry =          (remaining_ticks - cascade_ticks - ((ULONG) 1)) / entry_ticks;
+
+                    /* Move up the wheel until a level covers the timer.  The next entry
+                       of a level is cascaded when the level below wraps.  */
+                    while ((entry >= TX_TIMER_ENTRIES) && (level < (TX_TIMER_WHEEL_LEVELS - ((UINT) 1))))
+                    {
+
+                        cascade_ticks =  cascade_ticks + (entry_ticks * ((TX_TIMER_ENTRIES - ((ULONG) _tx_timer_wheel_index[level])) % TX_TIMER_ENTRIES));
+                        entry_ticks =    entry_ticks * TX_TIMER_ENTRIES;
+                        level++;
+                        entry =          (remaining_ticks - cascade_ticks - ((ULONG) 1)) / entry_ticks;
+                    }
+
+                    /* A timer beyond the top level waits on its last entry.  */
+                    if (entry >= TX_TIMER_ENTRIES)
+                    {
+
+                        entry =  TX_TIMER_ENTRIES - ((ULONG) 1);
+                    }
+
+                    /* Keep the ticks the timer has left once its entry is cascaded.  */
+                    timer_ptr -> tx_timer_internal_remaining_ticks =  remaining_ticks - (cascade_ticks + (entry_ticks * entry));
+
+                    /* Calculate the proper wheel entry for the timer.  */
+                    timer_list =  &_tx_timer_wheel[level][(((ULONG) _tx_timer_wheel_index[level]) + entry) % TX_TIMER_ENTRIES];
+#else
+
                     /* Set expiration time to the maximum number of entries.  */
                     expiration_time =  TX_TIMER_ENTRIES - ((ULONG) 1);
+#endif
                 }
                 else
                 {
@@ -122,17 +170,25 @@ ULONG                       expiration_time;
                     expiration_time =  (remaining_ticks - ((ULONG) 1));
                 }
 
-                /* At this point, we are ready to put the timer on one of
-                   the timer lists.  */
+#if TX_TIMER_WHEEL_LEVELS != 0
 
-                /* Calculate the proper place for the timer.  */
-                timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, expiration_time);
-                if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(timer_list) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+                /* Determine if the timer goes on the timer list.  */
+                if (remaining_ticks <= TX_TIMER_ENTRIES)
+#endif
                 {
 
-                    /* Wrap from the beginning of the list.  */
-                    delta =  TX_TIMER_POINTER_DIF(timer_list, _tx_timer_list_end);
-                    timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
+                    /* At this point, we are ready to put the timer on one of
+                       the timer lists.  */
+
+                    /* Calculate the proper place for the timer.  */
+                    timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, expiration_time);
+                    if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(timer_list) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+                    {
+
+                        /* Wrap from the beginning of the list.  */
+                        delta =  TX_TIMER_POINTER_DIF(timer_list, _tx_timer_list_end);
+                        timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
+                    }
                 }
 
                 /* Now put the timer on this list.  */
@@ -162,6 +218,20 @@ ULONG                       expiration_time;
 
                 /* Setup list head pointer.  */
                 timer_ptr -> tx_timer_internal_list_head =  timer_list;
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+                /* Determine if the timer was placed on the wheel while the wheel
+                   timer is inactive.  */
+                if ((remaining_ticks > TX_TIMER_ENTRIES) &&
+                    (_tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_list_head == TX_NULL))
+                {
+
+                    /* Activate the wheel timer on the last entry of the timer list.  */
+                    _tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_remaining_ticks =
+                                        TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+                    _tx_timer_system_activate(&(_tx_timer_wheel_timer.tx_timer_internal));
+                }
+#endif
             }
         }
     }
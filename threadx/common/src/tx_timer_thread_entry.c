@@ -59,6 +59,7 @@
 /*    _tx_thread_system_suspend         Thread suspension                 */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*    _tx_timer_system_activate         Timer reactivate processing       */
+/*    _tx_timer_wheel_cascade           Timing wheel cascade              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -71,6 +72,8 @@
 /*  05-19-2020     William E. Lamie         Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-17-2026     agent                    Modified comment(s), added    */
+/*                                            timing wheel                */
 /*                                                                        */
 /**************************************************************************/
 #ifndef TX_TIMER_PROCESS_IN_ISR
@@ -134,6 +137,11 @@ TX_TIMER                    *timer_ptr;
             {
 
                 _tx_timer_current_ptr =  _tx_timer_list_start;
+#if TX_TIMER_WHEEL_LEVELS != 0
+
+                /* The timer list wrapped, cascade the timing wheel.  */
+                _tx_timer_wheel_cascade();
+#endif
             }
 
             /* Clear the expired flag.  */
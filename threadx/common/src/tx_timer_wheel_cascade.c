@@ -0,0 +1,222 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_cascade                             PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function cascades the timing wheel each time the timer list    */
+/*    wraps.  It removes the timers on the next entry of the first wheel  */
+/*    level, and on the next entry of each higher level whose lower level */
+/*    wraps at the same time, and places them on the timer list or a      */
+/*    lower wheel level with their remaining ticks.  A timer is therefore */
+/*    moved at most once per wheel level rather than once per pass        */
+/*    through the timer list.  The wheel timer, which keeps the last      */
+/*    timer list entry occupied while there are timers on the wheel, is   */
+/*    moved back to that entry as long as the wheel is not empty.  This   */
+/*    function must be called with interrupts disabled, right after the   */
+/*    timer list wrapped.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_system_activate             Timer activate function       */
+/*    _tx_timer_system_deactivate           Timer deactivate function     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_expiration_process     Timer expiration processing        */
+/*    _tx_timer_thread_entry           Timer thread processing            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#if TX_TIMER_WHEEL_LEVELS != 0
+VOID  _tx_timer_wheel_cascade(VOID)
+{
+
+TX_TIMER_INTERNAL           *cascade_timers;
+TX_TIMER_INTERNAL           *list_head;
+TX_TIMER_INTERNAL           *current_timer;
+TX_TIMER_INTERNAL           *next_timer;
+UINT                        level;
+UINT                        index;
+UINT                        entry;
+UINT                        wheel_empty;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+TX_TIMER                    *timer_ptr;
+#endif
+
+
+    /* Determine if there are timers on the wheel.  The wheel timer is active whenever
+       there are.  */
+    if (_tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_list_head != TX_NULL)
+    {
+
+        /* The wheel timer was on the last entry of the timer list, which has just been
+           removed for expiration processing.  Take it off that list, it is re-activated
+           below while there are still timers on the wheel.  */
+        _tx_timer_system_deactivate(&(_tx_timer_wheel_timer.tx_timer_internal));
+
+        /* Remove the timers on the next entry of the first level.  When this entry is the
+           first entry of its level, the level wraps and the next entry of the level above
+           is removed as well.  */
+        cascade_timers =  TX_NULL;
+        level =           ((UINT) 0);
+        do
+        {
+
+            /* Pickup the next entry of this level.  */
+            index =      _tx_timer_wheel_index[level];
+            list_head =  _tx_timer_wheel[level][index];
+
+            /* Move the timers of this entry onto the local cascade list.  */
+            if (list_head != TX_NULL)
+            {
+
+                current_timer =  list_head;
+                do
+                {
+
+                    /* Pickup the next timer before the links are rebuilt.  */
+                    next_timer =  current_timer -> tx_timer_internal_active_next;
+
+                    /* Place the timer on the cascade list.  */
+                    current_timer -> tx_timer_internal_list_head =    TX_NULL;
+                    current_timer -> tx_timer_internal_active_next =  cascade_timers;
+                    cascade_timers =                                  current_timer;
+
+                    /* Move to the next timer on this entry.  */
+                    current_timer =  next_timer;
+                } while (current_timer != list_head);
+
+                /* This entry is now empty.  */
+                _tx_timer_wheel[level][index] =  TX_NULL;
+            }
+
+            /* Move the level to its next entry.  */
+            _tx_timer_wheel_index[level] =  (index + ((UINT) 1)) % ((UINT) TX_TIMER_ENTRIES);
+
+            /* Move to the level above.  */
+            level++;
+        } while ((index == ((UINT) 0)) && (level < TX_TIMER_WHEEL_LEVELS));
+
+        /* Place the removed timers according to their remaining ticks.  */
+        while (cascade_timers != TX_NULL)
+        {
+
+            /* Pickup the next timer before the links are rebuilt.  */
+            current_timer =   cascade_timers;
+            cascade_timers =  current_timer -> tx_timer_internal_active_next;
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total expiration adjustments counter.  */
+            _tx_timer_performance__expiration_adjust_count++;
+
+            /* Determine if this is an application timer.  */
+            if (current_timer -> tx_timer_internal_timeout_function != &_tx_thread_timeout)
+            {
+
+                /* Derive the application timer pointer.  */
+
+                /* Pickup the application timer pointer.  */
+                TX_USER_TIMER_POINTER_GET(current_timer, timer_ptr)
+
+                /* Increment the number of expiration adjustments on this timer.  */
+                if (timer_ptr -> tx_timer_id == TX_TIMER_ID)
+                {
+
+                    timer_ptr -> tx_timer_performance__expiration_adjust_count++;
+                }
+            }
+#endif
+
+            /* Activate the timer.  */
+            _tx_timer_system_activate(current_timer);
+        }
+
+        /* Determine if the wheel timer needs to be re-activated, which is the case if
+           timers are left on the wheel and none of them has been placed by this cascade.  */
+        if (_tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_list_head == TX_NULL)
+        {
+
+            /* Look for timers that are left on the wheel.  */
+            wheel_empty =  TX_TRUE;
+            for (level = ((UINT) 0); (level < TX_TIMER_WHEEL_LEVELS) && (wheel_empty == TX_TRUE); level++)
+            {
+
+                for (entry = ((UINT) 0); entry < ((UINT) TX_TIMER_ENTRIES); entry++)
+                {
+
+                    if (_tx_timer_wheel[level][entry] != TX_NULL)
+                    {
+
+                        wheel_empty =  TX_FALSE;
+                    }
+                }
+            }
+
+            /* Determine if timers are left on the wheel.  */
+            if (wheel_empty == TX_FALSE)
+            {
+
+                /* Activate the wheel timer on the last entry of the timer list.  */
+                _tx_timer_wheel_timer.tx_timer_internal.tx_timer_internal_remaining_ticks =  TX_TIMER_ENTRIES;
+                _tx_timer_system_activate(&(_tx_timer_wheel_timer.tx_timer_internal));
+            }
+        }
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_ticks_get                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of ticks until the specified       */
+/*    timing wheel entry is cascaded.  A timer on the entry expires its   */
+/*    remaining ticks after that.  This function must be called with      */
+/*    interrupts disabled.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wheel_list                        Pointer to a timing wheel entry   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    ticks                             Ticks until the entry is          */
+/*                                        cascaded, zero if the pointer   */
+/*                                        is not a timing wheel entry     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_deactivate             Application timer deactivate       */
+/*    _tx_timer_info_get               Get timer information              */
+/*    _tx_timer_get_next               Get next timer expiration          */
+/*    _tx_time_increment               Advance the system clock           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#if TX_TIMER_WHEEL_LEVELS != 0
+ULONG  _tx_timer_wheel_ticks_get(TX_TIMER_INTERNAL **wheel_list)
+{
+
+ULONG                       cascade_ticks;
+ULONG                       entry_ticks;
+ULONG                       entry;
+ULONG                       ticks;
+UINT                        level;
+
+
+    /* Default to not a wheel entry.  */
+    ticks =  ((ULONG) 0);
+
+    /* The next entry of the first level is cascaded when the timer list wraps.  */
+    cascade_ticks =  TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+    entry_ticks =    TX_TIMER_ENTRIES;
+
+    /* Find the level of the entry.  */
+    for (level = ((UINT) 0); level < TX_TIMER_WHEEL_LEVELS; level++)
+    {
+
+        /* Determine if the entry is on this level.  */
+        if ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(wheel_list) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(&_tx_timer_wheel[level][0])) &&
+            (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(wheel_list) <= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(&_tx_timer_wheel[level][TX_TIMER_ENTRIES - ((ULONG) 1)])))
+        {
+
+            /* Yes, calculate how many entries of this level are cascaded before it.  */
+            entry =  (TX_TIMER_POINTER_DIF(wheel_list, &_tx_timer_wheel[level][0]) + TX_TIMER_ENTRIES - ((ULONG) _tx_timer_wheel_index[level])) % TX_TIMER_ENTRIES;
+
+            /* Calculate the ticks until the entry is cascaded.  */
+            ticks =  cascade_ticks + (entry_ticks * entry);
+
+            /* Stop the search.  */
+            break;
+        }
+
+        /* The next entry of the level above is cascaded when this level wraps.  */
+        cascade_ticks =  cascade_ticks + (entry_ticks * ((TX_TIMER_ENTRIES - ((ULONG) _tx_timer_wheel_index[level])) % TX_TIMER_ENTRIES));
+        entry_ticks =    entry_ticks * TX_TIMER_ENTRIES;
+    }
+
+    /* Return the ticks until the entry is cascaded.  */
+    return(ticks);
+}
+#endif
+
+#endif
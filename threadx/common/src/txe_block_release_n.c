@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_block_release_n                                PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the release multiple blocks      */
+/*    function call.  No block is released unless all of them are valid.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    block_ptr                         Array of pointers to the blocks   */
+/*    block_count                       Number of blocks to release       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_PTR_ERROR                      Invalid block pointer             */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_release_n               Actual release blocks function    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_block_release_n(VOID **block_ptr, UINT block_count)
+{
+
+UINT                status;
+UINT                i;
+TX_BLOCK_POOL       *pool_ptr;
+UCHAR               **indirect_ptr;
+UCHAR               *work_ptr;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* First check the supplied array pointer.  */
+    if (block_ptr == TX_NULL)
+    {
+
+        /* The array pointer is invalid, return appropriate status.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Check each block pointer.  */
+        for (i = ((UINT) 0); i < block_count; i++)
+        {
+
+            /* Check the supplied block pointer.  */
+            if (block_ptr[i] == TX_NULL)
+            {
+
+                /* The block pointer is invalid, return appropriate status.  */
+                status =  TX_PTR_ERROR;
+                break;
+            }
+
+            /* Pickup the pool pointer which is just previous to the starting
+               address of block that the caller sees.  */
+            work_ptr =      TX_VOID_TO_UCHAR_POINTER_CONVERT(block_ptr[i]);
+            work_ptr =      TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+            indirect_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+            work_ptr =      *indirect_ptr;
+            pool_ptr =      TX_UCHAR_TO_BLOCK_POOL_POINTER_CONVERT(work_ptr);
+
+            /* Check for an invalid pool pointer.  */
+            if (pool_ptr == TX_NULL)
+            {
+
+                /* Pool pointer is invalid, return appropriate error code.  */
+                status =  TX_PTR_ERROR;
+                break;
+            }
+
+            /* Now check for invalid pool ID.  */
+            if (pool_ptr -> tx_block_pool_id != TX_BLOCK_POOL_ID)
+            {
+
+                /* Pool pointer is invalid, return appropriate error code.  */
+                status =  TX_PTR_ERROR;
+                break;
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual release blocks function.  */
+        status =  _tx_block_release_n(block_ptr, block_count);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_block_slab_class_info_get                      PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the block slab class information */
+/*    get service.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slab_ptr                          Pointer to slab control block     */
+/*    class_index                       Index of the size class, 0 being  */
+/*                                        the smallest                    */
+/*    block_size                        Destination for the block size    */
+/*    available_blocks                  Number of free blocks in class    */
+/*    total_blocks                      Total number of blocks in class   */
+/*    spills                            Number of allocations for the     */
+/*                                        class taken from a larger class */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_POOL_ERROR                     Invalid block slab pointer        */
+/*    TX_SIZE_ERROR                     Invalid class index               */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_slab_class_info_get     Actual block slab class info get  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_block_slab_class_info_get(TX_BLOCK_SLAB *slab_ptr, UINT class_index, ULONG *block_size,
+                    ULONG *available_blocks, ULONG *total_blocks, ULONG *spills)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid block slab pointer.  */
+    if (slab_ptr == TX_NULL)
+    {
+
+        /* Block slab pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Now check the slab ID.  */
+    else if (slab_ptr -> tx_block_slab_id != TX_BLOCK_SLAB_ID)
+    {
+
+        /* Block slab pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Check for an invalid class index.  */
+    else if (class_index >= slab_ptr -> tx_block_slab_class_count)
+    {
+
+        /* Class index is invalid, return appropriate error code.  */
+        status =  TX_SIZE_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual block slab class information get service.  */
+        status =  _tx_block_slab_class_info_get(slab_ptr, class_index, block_size,
+                        available_blocks, total_blocks, spills);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
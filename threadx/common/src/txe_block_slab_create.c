@@ -0,0 +1,303 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Block Pool                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#include "tx_block_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_block_slab_create                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the create block slab function   */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slab_ptr                          Pointer to slab control block     */
+/*    name_ptr                          Pointer to block slab name        */
+/*    block_sizes                       Block size of each class, or NULL */
+/*                                        for power-of-two classes        */
+/*    class_count                       Number of size classes            */
+/*    pool_start                        Address of beginning of slab area */
+/*    pool_size                         Number of bytes in the block slab */
+/*    spill_option                      Allocate from the next class if a */
+/*                                        class is exhausted              */
+/*    slab_control_block_size           Size of block slab control block  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_POOL_ERROR                     Invalid slab pointer              */
+/*    TX_PTR_ERROR                      Invalid starting address          */
+/*    TX_SIZE_ERROR                     Invalid class count, block sizes, */
+/*                                        or slab size                    */
+/*    TX_OPTION_ERROR                   Invalid spill option              */
+/*    TX_CALLER_ERROR                   Invalid caller of slab create     */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_slab_create             Actual block slab create function */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_block_slab_create(TX_BLOCK_SLAB *slab_ptr, CHAR *name_ptr, ULONG *block_sizes, UINT class_count,
+                    VOID *pool_start, ULONG pool_size, UINT spill_option, UINT slab_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+ULONG           i;
+ULONG           block_size;
+ULONG           class_size;
+TX_BLOCK_SLAB   *next_slab;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD       *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid slab pointer.  */
+    if (slab_ptr == TX_NULL)
+    {
+
+        /* Slab pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Check for invalid control block size.  */
+    else if (slab_control_block_size != (sizeof(TX_BLOCK_SLAB)))
+    {
+
+        /* Slab pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_slab =   _tx_block_slab_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_block_slab_created_count; i++)
+        {
+
+            /* Determine if this block slab matches the slab in the list.  */
+            if (slab_ptr == next_slab)
+            {
+
+                break;
+            }
+            else
+            {
+                /* Move to the next slab.  */
+                next_slab =  next_slab -> tx_block_slab_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* At this point, check to see if there is a duplicate slab.  */
+        if (slab_ptr == next_slab)
+        {
+
+            /* Slab is already created, return appropriate error code.  */
+            status =  TX_POOL_ERROR;
+        }
+
+        /* Check for an invalid starting address.  */
+        else if (pool_start == TX_NULL)
+        {
+
+            /* Null starting address pointer, return appropriate error.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check for an invalid number of classes.  */
+        else if ((class_count == ((UINT) 0)) || (class_count > ((UINT) TX_BLOCK_SLAB_MAX_CLASSES)))
+        {
+
+            /* Invalid number of classes, return appropriate error.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for an invalid spill option.  */
+        else if (spill_option > TX_BLOCK_SLAB_SPILL)
+        {
+
+            /* Invalid spill option, return appropriate error.  */
+            status =  TX_OPTION_ERROR;
+        }
+        else
+        {
+
+            /* Calculate the part of the memory area of each class.  */
+            class_size =  ((pool_size/((ULONG) class_count))/(sizeof(void *))) * (sizeof(void *));
+
+            /* Check the block size of each class.  Specified block sizes must be
+               ascending and not zero.  */
+            if (block_sizes != TX_NULL)
+            {
+
+                /* Start with the smallest valid block size.  */
+                block_size =  ((ULONG) 1);
+            }
+            else
+            {
+
+                /* Start with the default smallest class.  */
+                block_size =  TX_BLOCK_SLAB_MIN_SIZE;
+            }
+            for (i = ((ULONG) 0); i < ((ULONG) class_count); i++)
+            {
+
+                /* Determine if the block sizes are specified.  */
+                if (block_sizes != TX_NULL)
+                {
+
+                    /* Make sure the block sizes are ascending.  */
+                    if (block_sizes[i] < block_size)
+                    {
+
+                        /* Invalid block size, return appropriate error.  */
+                        status =  TX_SIZE_ERROR;
+                        break;
+                    }
+
+                    /* Pickup the block size of this class.  */
+                    block_size =  block_sizes[i];
+                }
+
+                /* Check for enough memory for one block of this class.  */
+                if ((((block_size/(sizeof(void *)))*(sizeof(void *))) + (sizeof(void *))) > class_size)
+                {
+
+                    /* Not enough memory for one block, return appropriate error.  */
+                    status =  TX_SIZE_ERROR;
+                    break;
+                }
+
+                /* Move to the next class, whose block size must be larger.  */
+                if (block_sizes != TX_NULL)
+                {
+
+                    block_size =  block_size + ((ULONG) 1);
+                }
+                else
+                {
+
+                    block_size =  block_size * ((ULONG) 2);
+                }
+            }
+
+            /* Determine if the sizes are okay.  */
+            if (status == TX_SUCCESS)
+            {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+                /* Pickup thread pointer.  */
+                TX_THREAD_GET_CURRENT(thread_ptr)
+
+                /* Check for invalid caller of this function.  First check for a calling thread.  */
+                if (thread_ptr == &_tx_timer_thread)
+                {
+
+                    /* Invalid caller of this function, return appropriate error code.  */
+                    status =  TX_CALLER_ERROR;
+                }
+#endif
+
+                /* Check for interrupt call.  */
+                if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+                {
+
+                    /* Now, make sure the call is from an interrupt and not initialization.  */
+                    if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+                    {
+
+                        /* Invalid caller of this function, return appropriate error code.  */
+                        status =  TX_CALLER_ERROR;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual block slab create function.  */
+        status =  _tx_block_slab_create(slab_ptr, name_ptr, block_sizes, class_count, pool_start, pool_size, spill_option);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,257 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_broadcast_create               PORTABLE C                      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the broadcast create function    */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*    name_ptr                          Pointer to broadcast name         */
+/*    message_size                      Size of each message in ULONGs    */
+/*    broadcast_start                   Starting address of the message   */
+/*                                        area                            */
+/*    broadcast_size                    Number of bytes in the message    */
+/*                                        area                            */
+/*    overflow_option                   Overflow option                   */
+/*    broadcast_control_block_size      Size of broadcast control block   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid broadcast pointer         */
+/*    TX_PTR_ERROR                      Invalid starting address of the   */
+/*                                        message area                    */
+/*    TX_SIZE_ERROR                     Invalid message size or size of   */
+/*                                        the message area                */
+/*    TX_OPTION_ERROR                   Invalid overflow option           */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_preempt_check   Check for preemption              */
+/*    _tx_broadcast_create              Actual broadcast create           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_broadcast_create(TX_BROADCAST *broadcast_ptr, CHAR *name_ptr, UINT message_size,
+                    VOID *broadcast_start, ULONG broadcast_size, UINT overflow_option,
+                    UINT broadcast_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+ULONG           i;
+TX_BROADCAST    *next_broadcast;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD       *thread_ptr;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid broadcast pointer.  */
+    if (broadcast_ptr == TX_NULL)
+    {
+
+        /* Broadcast pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid control block size.  */
+    else if (broadcast_control_block_size != (sizeof(TX_BROADCAST)))
+    {
+
+        /* Broadcast pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Increment the preempt disable flag.  */
+        _tx_thread_preempt_disable++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Next see if it is already in the created list.  */
+        next_broadcast =   _tx_broadcast_created_ptr;
+        for (i = ((ULONG) 0); i < _tx_broadcast_created_count; i++)
+        {
+
+            /* Determine if this broadcast matches the broadcast in the list.  */
+            if (broadcast_ptr == next_broadcast)
+            {
+
+                break;
+            }
+            else
+            {
+
+                /* Move to the next broadcast.  */
+                next_broadcast =  next_broadcast -> tx_broadcast_created_next;
+            }
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Decrement the preempt disable flag.  */
+        _tx_thread_preempt_disable--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Check for preemption.  */
+        _tx_thread_system_preempt_check();
+
+        /* At this point, check to see if there is a duplicate broadcast.  */
+        if (broadcast_ptr == next_broadcast)
+        {
+
+            /* Broadcast is already created, return appropriate error code.  */
+            status =  TX_QUEUE_ERROR;
+        }
+
+        /* Check the starting address of the message area.  */
+        else if (broadcast_start == TX_NULL)
+        {
+
+            /* Invalid starting address of the message area.  */
+            status =  TX_PTR_ERROR;
+        }
+
+        /* Check for an invalid message size - less than 1.  */
+        else if (message_size < TX_1_ULONG)
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for an invalid message size - greater than 16.  */
+        else if (message_size > TX_16_ULONG)
+        {
+
+            /* Invalid message size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check on the message area size, which must hold at least one message.  */
+        else if ((broadcast_size/(sizeof(ULONG))) < message_size)
+        {
+
+            /* Invalid message area size specified.  */
+            status =  TX_SIZE_ERROR;
+        }
+
+        /* Check for an invalid overflow option.  */
+        else if (overflow_option > TX_BROADCAST_OVERWRITE)
+        {
+
+            /* Invalid overflow option specified.  */
+            status =  TX_OPTION_ERROR;
+        }
+        else
+        {
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+            /* Pickup thread pointer.  */
+            TX_THREAD_GET_CURRENT(thread_ptr)
+
+            /* Check for invalid caller of this function.  First check for a calling thread.  */
+            if (thread_ptr == &_tx_timer_thread)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+#endif
+
+            /* Check for interrupt call.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+            {
+
+                /* Now, make sure the call is from an interrupt and not initialization.  */
+                if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+                {
+
+                    /* Invalid caller of this function, return appropriate error code.  */
+                    status =  TX_CALLER_ERROR;
+                }
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual broadcast create function.  */
+        status =  _tx_broadcast_create(broadcast_ptr, name_ptr, message_size, broadcast_start, broadcast_size,
+                                                                    overflow_option);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
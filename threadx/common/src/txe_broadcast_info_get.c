@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_broadcast_info_get             PORTABLE C                      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the broadcast information get    */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    broadcast_ptr                     Pointer to broadcast control      */
+/*                                        block                           */
+/*    name                              Destination for the broadcast     */
+/*                                        name                            */
+/*    published                         Destination for the running count */
+/*                                        of messages published           */
+/*    subscriber_count                  Destination for the number of     */
+/*                                        subscribers                     */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on broadcast   */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_broadcast                    Destination for pointer to next   */
+/*                                        broadcast on the created list   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid broadcast pointer         */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_broadcast_info_get            Retrieve broadcast information    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_broadcast_info_get(TX_BROADCAST *broadcast_ptr, CHAR **name, ULONG *published, ULONG *subscriber_count,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BROADCAST **next_broadcast)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid broadcast pointer.  */
+    if (broadcast_ptr == TX_NULL)
+    {
+
+        /* Broadcast pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid broadcast ID.  */
+    else if (broadcast_ptr -> tx_broadcast_id != TX_BROADCAST_ID)
+    {
+
+        /* Broadcast pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual broadcast information get service.  */
+        status =  _tx_broadcast_info_get(broadcast_ptr, name, published, subscriber_count, first_suspended,
+                                                                    suspended_count, next_broadcast);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,221 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Memory                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#include "tx_byte_pool.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_byte_pool_magazine_create                      PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the create byte pool magazine    */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    magazine_ptr                      Pointer to magazine control block */
+/*    thread_ptr                        Pointer to thread that uses the   */
+/*                                        magazine                        */
+/*    magazine_control_block_size       Size of magazine control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_POOL_ERROR                     Invalid byte pool pointer         */
+/*    TX_PTR_ERROR                      Invalid magazine pointer, or the  */
+/*                                        magazine is already created     */
+/*    TX_THREAD_ERROR                   Invalid thread pointer, or the    */
+/*                                        thread already has a magazine   */
+/*                                        for the pool                    */
+/*    TX_CALLER_ERROR                   Invalid caller of this function   */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_magazine_create     Actual magazine create function   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_byte_pool_magazine_create(TX_BYTE_POOL *pool_ptr, TX_BYTE_POOL_MAGAZINE *magazine_ptr,
+                                     TX_THREAD *thread_ptr, UINT magazine_control_block_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                    status;
+TX_BYTE_POOL_MAGAZINE   *next_magazine;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD               *current_thread;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid byte pool pointer.  */
+    if (pool_ptr == TX_NULL)
+    {
+
+        /* Byte pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Now check the pool ID.  */
+    else if (pool_ptr -> tx_byte_pool_id != TX_BYTE_POOL_ID)
+    {
+
+        /* Byte pool pointer is invalid, return appropriate error code.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Check for an invalid magazine pointer.  */
+    else if (magazine_ptr == TX_NULL)
+    {
+
+        /* Magazine pointer is invalid, return appropriate error code.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Now see if the magazine control block size is valid.  */
+    else if (magazine_control_block_size != (sizeof(TX_BYTE_POOL_MAGAZINE)))
+    {
+
+        /* Magazine pointer is invalid, return appropriate error code.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Check for an already created magazine.  */
+    else if (magazine_ptr -> tx_byte_pool_magazine_id == TX_BYTE_POOL_MAGAZINE_ID)
+    {
+
+        /* Magazine is already created, return appropriate error code.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Check for an invalid thread pointer.  */
+    else if (thread_ptr == TX_NULL)
+    {
+
+        /* Thread pointer is invalid, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+
+    /* Now check the thread ID.  */
+    else if (thread_ptr -> tx_thread_id != TX_THREAD_ID)
+    {
+
+        /* Thread pointer is invalid, return appropriate error code.  */
+        status =  TX_THREAD_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Determine if the thread already has a magazine for this pool.  */
+        next_magazine =  thread_ptr -> tx_thread_byte_pool_magazine;
+        while (next_magazine != TX_NULL)
+        {
+
+            /* Is this a magazine of the pool?  */
+            if (next_magazine -> tx_byte_pool_magazine_pool == pool_ptr)
+            {
+
+                /* Yes, the thread may only have one magazine for each pool.  */
+                status =  TX_THREAD_ERROR;
+                break;
+            }
+
+            /* Move to the next magazine of the thread.  */
+            next_magazine =  next_magazine -> tx_byte_pool_magazine_thread_next;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+        /* Pickup thread pointer.  */
+        TX_THREAD_GET_CURRENT(current_thread)
+
+        /* Check for invalid caller of this function.  First check for a calling thread.  */
+        if (current_thread == &_tx_timer_thread)
+        {
+
+            /* Invalid caller of this function, return appropriate error code.  */
+            status =  TX_CALLER_ERROR;
+        }
+#endif
+
+        /* Check for interrupt call.  */
+        if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+        {
+
+            /* Now, make sure the call is from an interrupt and not initialization.  */
+            if (TX_THREAD_GET_SYSTEM_STATE() < TX_INITIALIZE_IN_PROGRESS)
+            {
+
+                /* Invalid caller of this function, return appropriate error code.  */
+                status =  TX_CALLER_ERROR;
+            }
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual byte pool magazine create function.  */
+        status =  _tx_byte_pool_magazine_create(pool_ptr, magazine_ptr, thread_ptr);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_byte_queue_info_get                            PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the byte queue information get   */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to byte queue control     */
+/*                                        block                           */
+/*    name                              Destination for the byte queue    */
+/*                                        name                            */
+/*    enqueued                          Destination for the number of     */
+/*                                        messages enqueued               */
+/*    available_bytes                   Destination for the number of     */
+/*                                        bytes available for records     */
+/*    first_suspended                   Destination for pointer of first  */
+/*                                        thread suspended on byte queue  */
+/*    suspended_count                   Destination for suspended count   */
+/*    next_queue                        Destination for pointer to next   */
+/*                                        byte queue on the created list  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid byte queue pointer        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_queue_info_get           Retrieve byte queue information   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_byte_queue_info_get(TX_BYTE_QUEUE *queue_ptr, CHAR **name, ULONG *enqueued, ULONG *available_bytes,
+                    TX_THREAD **first_suspended, ULONG *suspended_count, TX_BYTE_QUEUE **next_queue)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid byte queue pointer.  */
+    if (queue_ptr == TX_NULL)
+    {
+
+        /* Byte queue pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid byte queue ID.  */
+    else if (queue_ptr -> tx_byte_queue_id != TX_BYTE_QUEUE_ID)
+    {
+
+        /* Byte queue pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual byte queue information get service.  */
+        status =  _tx_byte_queue_info_get(queue_ptr, name, enqueued, available_bytes, first_suspended,
+                                                                    suspended_count, next_queue);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Queue                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_channel_info_get                               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the channel information get      */
+/*    service.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    channel_ptr                       Pointer to channel control block  */
+/*    name                              Destination for the channel name  */
+/*    enqueued                          Destination for enqueued count    */
+/*    available_storage                 Destination for available storage */
+/*    suspended_thread                  Destination for pointer of the    */
+/*                                        consumer, if it is suspended    */
+/*    next_channel                      Destination for pointer to next   */
+/*                                        channel on the created list     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_QUEUE_ERROR                    Invalid channel pointer           */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_channel_info_get              Actual channel info get service   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_channel_info_get(TX_CHANNEL *channel_ptr, CHAR **name, ULONG *enqueued, ULONG *available_storage,
+                    TX_THREAD **suspended_thread, TX_CHANNEL **next_channel)
+{
+
+UINT    status;
+
+
+    /* Check for an invalid channel pointer.  */
+    if (channel_ptr == TX_NULL)
+    {
+
+        /* Channel pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+
+    /* Now check for a valid channel ID.  */
+    else if (channel_ptr -> tx_channel_id != TX_CHANNEL_ID)
+    {
+
+        /* Channel pointer is invalid, return appropriate error code.  */
+        status =  TX_QUEUE_ERROR;
+    }
+    else
+    {
+
+        /* Otherwise, call the actual channel information get service.  */
+        status =  _tx_channel_info_get(channel_ptr, name, enqueued, available_storage, suspended_thread, next_channel);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
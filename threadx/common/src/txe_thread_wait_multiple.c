@@ -0,0 +1,276 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#include "tx_queue.h"
+#include "tx_semaphore.h"
+#include "tx_event_flags.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _txe_thread_wait_multiple                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the wait for multiple objects    */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    wait_blocks                       Pointer to the array of wait      */
+/*                                        blocks                          */
+/*    count                             Number of wait blocks             */
+/*    ready_index                       Pointer to destination for the    */
+/*                                        index of the wait block that    */
+/*                                        completed the wait              */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_PTR_ERROR                      Invalid pointer                   */
+/*    TX_SIZE_ERROR                     Invalid number of wait blocks     */
+/*    TX_OPTION_ERROR                   Invalid object type or get option */
+/*    TX_QUEUE_ERROR                    Invalid queue pointer             */
+/*    TX_SEMAPHORE_ERROR                Invalid semaphore pointer         */
+/*    TX_GROUP_ERROR                    Invalid event flags group pointer */
+/*    TX_WAIT_ERROR                     Invalid wait option               */
+/*    status                            Actual completion status          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_wait_multiple          Actual wait for multiple objects  */
+/*                                        function                        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _txe_thread_wait_multiple(TX_WAIT_BLOCK *wait_blocks, UINT count, UINT *ready_index, ULONG wait_option)
+{
+
+UINT                    status;
+UINT                    index;
+TX_WAIT_BLOCK           *wait_block;
+TX_QUEUE                *queue_ptr;
+TX_SEMAPHORE            *semaphore_ptr;
+TX_EVENT_FLAGS_GROUP    *group_ptr;
+#ifndef TX_TIMER_PROCESS_IN_ISR
+TX_THREAD               *current_thread;
+#endif
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check for an invalid wait block array or index destination.  */
+    if ((wait_blocks == TX_NULL) || (ready_index == TX_NULL))
+    {
+
+        /* Null pointer, return appropriate error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Check for an empty wait block array.  */
+    else if (count == ((UINT) 0))
+    {
+
+        /* Invalid number of wait blocks, return appropriate error.  */
+        status =  TX_SIZE_ERROR;
+    }
+    else
+    {
+
+        /* Check each wait block.  */
+        index =  ((UINT) 0);
+        while ((status == TX_SUCCESS) && (index < count))
+        {
+
+            /* Pickup the wait block.  */
+            wait_block =  &(wait_blocks[index]);
+
+            /* Determine the type of the object.  */
+            if (wait_block -> tx_wait_block_type == TX_WAIT_QUEUE)
+            {
+
+                /* Check for an invalid queue pointer or ID.  */
+                queue_ptr =  TX_VOID_TO_QUEUE_POINTER_CONVERT(wait_block -> tx_wait_block_object);
+                if (queue_ptr == TX_NULL)
+                {
+
+                    /* Queue pointer is invalid, return appropriate error code.  */
+                    status =  TX_QUEUE_ERROR;
+                }
+                else if (queue_ptr -> tx_queue_id != TX_QUEUE_ID)
+                {
+
+                    /* Queue pointer is invalid, return appropriate error code.  */
+                    status =  TX_QUEUE_ERROR;
+                }
+
+                /* Check for an invalid destination for the message.  */
+                else if (wait_block -> tx_wait_block_destination == TX_NULL)
+                {
+
+                    /* Null destination pointer, return appropriate error.  */
+                    status =  TX_PTR_ERROR;
+                }
+                else
+                {
+
+                    /* Move to the next wait block.  */
+                    index++;
+                }
+            }
+            else if (wait_block -> tx_wait_block_type == TX_WAIT_SEMAPHORE)
+            {
+
+                /* Check for an invalid semaphore pointer or ID.  */
+                semaphore_ptr =  TX_VOID_TO_SEMAPHORE_POINTER_CONVERT(wait_block -> tx_wait_block_object);
+                if (semaphore_ptr == TX_NULL)
+                {
+
+                    /* Semaphore pointer is invalid, return appropriate error code.  */
+                    status =  TX_SEMAPHORE_ERROR;
+                }
+                else if (semaphore_ptr -> tx_semaphore_id != TX_SEMAPHORE_ID)
+                {
+
+                    /* Semaphore pointer is invalid, return appropriate error code.  */
+                    status =  TX_SEMAPHORE_ERROR;
+                }
+                else
+                {
+
+                    /* Move to the next wait block.  */
+                    index++;
+                }
+            }
+            else if (wait_block -> tx_wait_block_type == TX_WAIT_EVENT_FLAGS)
+            {
+
+                /* Check for an invalid event flags group pointer or ID.  */
+                group_ptr =  TX_VOID_TO_EVENT_FLAGS_POINTER_CONVERT(wait_block -> tx_wait_block_object);
+                if (group_ptr == TX_NULL)
+                {
+
+                    /* Event flags group pointer is invalid, return appropriate error code.  */
+                    status =  TX_GROUP_ERROR;
+                }
+                else if (group_ptr -> tx_event_flags_group_id != TX_EVENT_FLAGS_ID)
+                {
+
+                    /* Event flags group pointer is invalid, return appropriate error code.  */
+                    status =  TX_GROUP_ERROR;
+                }
+
+                /* Check for invalid get option.  */
+                else if (wait_block -> tx_wait_block_get_option > TX_AND_CLEAR)
+                {
+
+                    /* Invalid get events option, return appropriate error.  */
+                    status =  TX_OPTION_ERROR;
+                }
+                else
+                {
+
+                    /* Move to the next wait block.  */
+                    index++;
+                }
+            }
+            else
+            {
+
+                /* Invalid object type, return appropriate error.  */
+                status =  TX_OPTION_ERROR;
+            }
+        }
+    }
+
+    /* Check for a wait option error.  Only threads are allowed any form of
+       suspension.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Determine if suspension is requested.  */
+        if (wait_option != TX_NO_WAIT)
+        {
+
+            /* Is the call from an ISR or Initialization?  */
+            if (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0))
+            {
+
+                /* A non-thread is trying to suspend, return appropriate error code.  */
+                status =  TX_WAIT_ERROR;
+            }
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+            else
+            {
+
+                /* Pickup thread pointer.  */
+                TX_THREAD_GET_CURRENT(current_thread)
+
+                /* Is the current thread the timer thread?  */
+                if (current_thread == &_tx_timer_thread)
+                {
+
+                    /* A non-thread is trying to suspend, return appropriate error code.  */
+                    status =  TX_WAIT_ERROR;
+                }
+            }
+#endif
+        }
+    }
+
+    /* Determine if everything is okay.  */
+    if (status == TX_SUCCESS)
+    {
+
+        /* Call actual wait for multiple objects function.  */
+        status =  _tx_thread_wait_multiple(wait_blocks, count, ready_index, wait_option);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,532 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Port Specific                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  PORT SPECIFIC C INFORMATION                            RELEASE        */
+/*                                                                        */
+/*    tx_port.h                                           Linux/GNU       */
+/*                                                                        */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file contains data type definitions that make the ThreadX      */
+/*    real-time kernel function identically on a variety of different     */
+/*    processor architectures.  For example, the size or number of bits   */
+/*    in an "int" data type vary between microprocessor architectures and */
+/*    even C compilers for the same microprocessor.  ThreadX does not     */
+/*    directly use native C data types.  Instead, ThreadX creates its     */
+/*    own special types that can be mapped to actual data types by this   */
+/*    file to guarantee consistency in the interface and functionality.   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_PORT_H
+#define TX_PORT_H
+
+
+/* Determine if the optional ThreadX user define file should be used.  */
+
+#ifdef TX_INCLUDE_USER_DEFINE_FILE
+
+
+/* Yes, include the user defines in tx_user.h. The defines in this file may
+   alternately be defined on the command line.  */
+
+#include "tx_user.h"
+#endif
+
+
+/* Define compiler library include files.  */
+
+#include <stdlib.h>
+#include <string.h>
+
+
+/* Define performance metric symbols.  */
+
+#ifndef TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+#define TX_BLOCK_POOL_ENABLE_PERFORMANCE_INFO
+#endif
+
+#ifndef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+#define TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+#endif
+
+#ifndef TX_EVENT_FLAGS_ENABLE_PERFORMANCE_INFO
+#define TX_EVENT_FLAGS_ENABLE_PERFORMANCE_INFO
+#endif
+
+#ifndef TX_MUTEX_ENABLE_PERFORMANCE_INFO
+#define TX_MUTEX_ENABLE_PERFORMANCE_INFO
+#endif
+
+#ifndef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+#define TX_QUEUE_ENABLE_PERFORMANCE_INFO
+#endif
+
+#ifndef TX_SEMAPHORE_ENABLE_PERFORMANCE_INFO
+#define TX_SEMAPHORE_ENABLE_PERFORMANCE_INFO
+#endif
+
+#ifndef TX_THREAD_ENABLE_PERFORMANCE_INFO
+#define TX_THREAD_ENABLE_PERFORMANCE_INFO
+#endif
+
+#ifndef TX_TIMER_ENABLE_PERFORMANCE_INFO
+#define TX_TIMER_ENABLE_PERFORMANCE_INFO
+#endif
+
+
+/* Enable trace info.  */
+
+#ifndef TX_ENABLE_EVENT_TRACE
+#define TX_ENABLE_EVENT_TRACE
+#endif
+
+
+/* Define ThreadX basic types for this port.  ULONG is 32 bits wide regardless
+   of whether the host is a 32-bit or 64-bit Linux system.  */
+
+#define VOID                                    void
+typedef char                                    CHAR;
+typedef unsigned char                           UCHAR;
+typedef int                                     INT;
+typedef unsigned int                            UINT;
+typedef int                                     LONG;
+typedef unsigned int                            ULONG;
+typedef unsigned long long                      ULONG64;
+typedef short                                   SHORT;
+typedef unsigned short                          USHORT;
+#define ULONG64_DEFINED
+
+
+/* Override the alignment type so that it is large enough to hold a host pointer.  */
+
+#define ALIGN_TYPE_DEFINED
+typedef unsigned long                           ALIGN_TYPE;
+
+
+/* Override the free block marker for byte pools to be a pointer-sized constant.  */
+
+#define TX_BYTE_BLOCK_FREE                      ((ALIGN_TYPE) 0xFFFFEEEEFFFFEEEEUL)
+
+
+/* Add Linux debug insert prototype.  */
+
+void    _tx_linux_debug_entry_insert(char *action, char *file, unsigned long line);
+
+#ifndef TX_LINUX_DEBUG_ENABLE
+
+/* If Linux debug is not enabled, turn logging into white-space.  */
+
+#define _tx_linux_debug_entry_insert(a, b, c)
+
+#endif
+
+
+/* Define the TX_MEMSET macro to remove library reference.  */
+
+#define TX_MEMSET(a,b,c)                        {                                       \
+                                                UCHAR *ptr;                             \
+                                                UCHAR value;                            \
+                                                UINT  i, size;                          \
+                                                    ptr =    (UCHAR *) ((VOID *) a);    \
+                                                    value =  (UCHAR) b;                 \
+                                                    size =   (UINT) c;                  \
+                                                    for (i = 0; i < size; i++)          \
+                                                    {                                   \
+                                                        *ptr++ =  value;                \
+                                                    }                                   \
+                                                }
+
+
+/* Include POSIX include files.  */
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <time.h>
+
+
+/* Define the priority levels for ThreadX.  Legal values range
+   from 32 to 1024 and MUST be evenly divisible by 32.  */
+
+#ifndef TX_MAX_PRIORITIES
+#define TX_MAX_PRIORITIES                       32
+#endif
+
+
+/* Define the minimum stack for a ThreadX thread on this processor. If the size supplied during
+   thread creation is less than this value, the thread create call will return an error.  */
+
+#ifndef TX_MINIMUM_STACK
+#define TX_MINIMUM_STACK                        200         /* Minimum stack size for this port */
+#endif
+
+
+/* Define the system timer thread's default stack size and priority.  These are only applicable
+   if TX_TIMER_PROCESS_IN_ISR is not defined.  */
+
+#ifndef TX_TIMER_THREAD_STACK_SIZE
+#define TX_TIMER_THREAD_STACK_SIZE              400         /* Default timer thread stack size - Not used in Linux port!  */
+#endif
+
+#ifndef TX_TIMER_THREAD_PRIORITY
+#define TX_TIMER_THREAD_PRIORITY                0           /* Default timer thread priority    */
+#endif
+
+
+/* Define various constants for the ThreadX  port.  */
+
+#define TX_INT_DISABLE                          1           /* Disable interrupts               */
+#define TX_INT_ENABLE                           0           /* Enable interrupts                */
+
+
+/* Define the clock source for trace event entry time stamp. The following two item are port specific.
+   For example, if the time source is at the address 0x0a800024 and is 16-bits in size, the clock
+   source constants would be:
+
+#define TX_TRACE_TIME_SOURCE                    *((ULONG *) 0x0a800024)
+#define TX_TRACE_TIME_MASK                      0x0000FFFFUL
+
+*/
+
+#ifndef TX_TRACE_TIME_SOURCE
+#define TX_TRACE_TIME_SOURCE                    ((ULONG) (_tx_linux_time_stamp.tv_nsec));
+#endif
+#ifndef TX_TRACE_TIME_MASK
+#define TX_TRACE_TIME_MASK                      0xFFFFFFFFUL
+#endif
+
+
+/* Define the port-specific trace extension to pickup the Linux monotonic clock.  */
+
+#define TX_TRACE_PORT_EXTENSION                 clock_gettime(CLOCK_MONOTONIC, &_tx_linux_time_stamp);
+
+
+/* Define the time source of the execution profile kit, the nanoseconds of the Linux
+   monotonic clock.  */
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+#ifndef TX_EXECUTION_TIME_SOURCE
+#define TX_EXECUTION_64BIT_TIME_SOURCE
+#define TX_EXECUTION_TIME_SOURCE                _tx_linux_execution_time_source()
+#define TX_EXECUTION_MAX_TIME_SOURCE            0xFFFFFFFFFFFFFFFFULL
+#endif
+unsigned long long  _tx_linux_execution_time_source(void);
+#endif
+
+
+/* Define the execution change functions called by the scheduler and by the context save
+   and restore processing.  */
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+void    _tx_execution_thread_enter(void);
+void    _tx_execution_thread_exit(void);
+void    _tx_execution_isr_enter(void);
+void    _tx_execution_isr_exit(void);
+#endif
+
+
+/* Define the port specific options for the _tx_build_options variable. This variable indicates
+   how the ThreadX library was built.  */
+
+#define TX_PORT_SPECIFIC_BUILD_OPTIONS          0
+
+
+/* Define the in-line initialization constant so that modules with in-line
+   initialization capabilities can prevent their initialization from being
+   a function call.  */
+
+#define TX_INLINE_INITIALIZATION
+
+
+/* Define the Linux-specific initialization code that is expanded in the generic source.  */
+
+void    _tx_initialize_start_interrupts(void);
+
+#define TX_PORT_SPECIFIC_PRE_SCHEDULER_INITIALIZATION                       _tx_initialize_start_interrupts();
+
+
+/* Determine whether or not stack checking is enabled. By default, ThreadX stack checking is
+   disabled. When the following is defined, ThreadX thread stack checking is enabled.  If stack
+   checking is enabled (TX_ENABLE_STACK_CHECKING is defined), the TX_DISABLE_STACK_FILLING
+   define is negated, thereby forcing the stack fill which is necessary for the stack checking
+   logic.  */
+
+#ifdef TX_ENABLE_STACK_CHECKING
+#undef TX_DISABLE_STACK_FILLING
+#endif
+
+
+/* Define the TX_THREAD control block extensions for this port. The main reason
+   for the multiple macros is so that backward compatibility can be maintained with
+   existing ThreadX kernel awareness modules.  */
+
+#define TX_THREAD_EXTENSION_0                                               pthread_t     tx_thread_linux_thread_id; \
+                                                                            sem_t         tx_thread_linux_thread_run_semaphore; \
+                                                                            UINT          tx_thread_linux_suspension_type; \
+                                                                            UINT          tx_thread_linux_int_disabled_flag; \
+                                                                            volatile UINT tx_thread_linux_resume_flag;
+#define TX_THREAD_EXTENSION_1
+#define TX_THREAD_EXTENSION_2
+#define TX_THREAD_EXTENSION_3
+
+
+/* Define the port extensions of the remaining ThreadX objects.  */
+
+#define TX_BLOCK_POOL_EXTENSION
+#define TX_BYTE_POOL_EXTENSION
+#define TX_EVENT_FLAGS_GROUP_EXTENSION
+#define TX_MUTEX_EXTENSION
+#define TX_QUEUE_EXTENSION
+#define TX_SEMAPHORE_EXTENSION
+#define TX_TIMER_EXTENSION
+
+
+/* Define the internal timer extension to also hold the thread pointer such that _tx_thread_timeout
+   can figure out what thread timeout to process. A ULONG timeout parameter cannot hold a host
+   pointer on a 64-bit Linux system.  */
+
+#define TX_TIMER_INTERNAL_EXTENSION             VOID    *tx_timer_internal_extension_ptr;
+
+
+/* Define the thread timeout setup logic in _tx_thread_create.  */
+
+#define TX_THREAD_CREATE_TIMEOUT_SETUP(t)    (t) -> tx_thread_timer.tx_timer_internal_timeout_function =  &(_tx_thread_timeout);            \
+                                             (t) -> tx_thread_timer.tx_timer_internal_timeout_param =     0;                                \
+                                             (t) -> tx_thread_timer.tx_timer_internal_extension_ptr =     (VOID *) (t);
+
+
+/* Define the thread timeout pointer setup in _tx_thread_timeout.  */
+
+#define TX_THREAD_TIMEOUT_POINTER_SETUP(t)   (t) =  (TX_THREAD *) _tx_timer_expired_timer_ptr -> tx_timer_internal_extension_ptr;
+
+
+/* Define the user extension field of the thread control block.  Nothing
+   additional is needed for this port so it is defined as white space.  */
+
+#ifndef TX_THREAD_USER_EXTENSION
+#define TX_THREAD_USER_EXTENSION
+#endif
+
+
+/* Define the macros for processing extensions in tx_thread_create, tx_thread_delete,
+   tx_thread_shell_entry, and tx_thread_terminate.  */
+
+
+#define TX_THREAD_CREATE_EXTENSION(thread_ptr)
+#define TX_THREAD_DELETE_EXTENSION(thread_ptr)
+#define TX_THREAD_COMPLETED_EXTENSION(thread_ptr)
+#define TX_THREAD_TERMINATED_EXTENSION(thread_ptr)
+
+
+/* Define the ThreadX object creation extensions for the remaining objects.  */
+
+#define TX_BLOCK_POOL_CREATE_EXTENSION(pool_ptr)
+#define TX_BYTE_POOL_CREATE_EXTENSION(pool_ptr)
+#define TX_EVENT_FLAGS_GROUP_CREATE_EXTENSION(group_ptr)
+#define TX_MUTEX_CREATE_EXTENSION(mutex_ptr)
+#define TX_QUEUE_CREATE_EXTENSION(queue_ptr)
+#define TX_SEMAPHORE_CREATE_EXTENSION(semaphore_ptr)
+#define TX_TIMER_CREATE_EXTENSION(timer_ptr)
+
+
+/* Define the ThreadX object deletion extensions for the remaining objects.  */
+
+#define TX_BLOCK_POOL_DELETE_EXTENSION(pool_ptr)
+#define TX_BYTE_POOL_DELETE_EXTENSION(pool_ptr)
+#define TX_EVENT_FLAGS_GROUP_DELETE_EXTENSION(group_ptr)
+#define TX_MUTEX_DELETE_EXTENSION(mutex_ptr)
+#define TX_QUEUE_DELETE_EXTENSION(queue_ptr)
+#define TX_SEMAPHORE_DELETE_EXTENSION(semaphore_ptr)
+#define TX_TIMER_DELETE_EXTENSION(timer_ptr)
+
+
+struct TX_THREAD_STRUCT;
+
+/* Define the Linux critical section data structure. The owner word holds the Linux
+   thread id of the owner, or zero when free, and is used directly as a futex. The
+   top bit of the owner word is set while other threads may be waiting. Define
+   TX_LINUX_CRITICAL_SECTION_MUTEX to use a pthread mutex instead.  */
+
+#ifdef TX_LINUX_CRITICAL_SECTION_MUTEX
+
+typedef struct TX_LINUX_CRITICAL_SECTION_STRUCT
+{
+    pthread_mutex_t                             tx_linux_critical_section_mutex;
+    pthread_t                                   tx_linux_critical_section_owner;
+    ULONG                                       tx_linux_critical_section_nested_count;
+} TX_LINUX_CRITICAL_SECTION;
+
+#else
+
+typedef struct TX_LINUX_CRITICAL_SECTION_STRUCT
+{
+    volatile UINT                               tx_linux_critical_section_owner;
+    ULONG                                       tx_linux_critical_section_nested_count;
+} TX_LINUX_CRITICAL_SECTION;
+
+#define TX_LINUX_CRITICAL_SECTION_WAITERS       ((UINT) 0x80000000)
+#endif
+
+
+/* Define Linux-specific critical section APIs.  */
+
+void  _tx_linux_critical_section_obtain(TX_LINUX_CRITICAL_SECTION *critical_section);
+void  _tx_linux_critical_section_release(TX_LINUX_CRITICAL_SECTION *critical_section);
+void  _tx_linux_critical_section_release_all(TX_LINUX_CRITICAL_SECTION *critical_section);
+#ifndef TX_LINUX_CRITICAL_SECTION_MUTEX
+void  _tx_linux_futex_wait(volatile UINT *address, UINT value);
+void  _tx_linux_futex_wake(volatile UINT *address);
+#endif
+
+
+/* Define Linux-specific thread control APIs. Suspension and resumption of a running
+   thread are simulated with signals, since POSIX has no equivalent of SuspendThread.  */
+
+#ifndef TX_LINUX_SUSPEND_SIGNAL
+#define TX_LINUX_SUSPEND_SIGNAL                 SIGUSR1
+#endif
+
+#ifndef TX_LINUX_RESUME_SIGNAL
+#define TX_LINUX_RESUME_SIGNAL                  SIGUSR2
+#endif
+
+void  _tx_linux_thread_suspend(struct TX_THREAD_STRUCT *thread_ptr);
+void  _tx_linux_thread_resume(struct TX_THREAD_STRUCT *thread_ptr);
+void  _tx_linux_thread_exit_wait(struct TX_THREAD_STRUCT *thread_ptr);
+void  _tx_linux_semaphore_wait(sem_t *semaphore);
+
+
+/* Define post completion processing for tx_thread_delete, so that the Linux thread resources are properly removed.  */
+
+#define TX_THREAD_DELETE_PORT_COMPLETION(thread_ptr)                            \
+{                                                                               \
+    _tx_thread_interrupt_restore(tx_saved_posture);                             \
+    _tx_linux_thread_exit_wait(thread_ptr);                                     \
+    tx_saved_posture =   _tx_thread_interrupt_disable();                        \
+}
+
+
+/* Define post completion processing for tx_thread_reset, so that the Linux thread resources are properly removed.  */
+
+#define TX_THREAD_RESET_PORT_COMPLETION(thread_ptr)                             \
+{                                                                               \
+    _tx_thread_interrupt_restore(tx_saved_posture);                             \
+    _tx_linux_thread_exit_wait(thread_ptr);                                     \
+    tx_saved_posture =   _tx_thread_interrupt_disable();                        \
+}
+
+
+/* Define ThreadX interrupt lockout and restore macros for protection on
+   access of critical kernel information.  The restore interrupt macro must
+   restore the interrupt posture of the running thread prior to the value
+   present prior to the disable macro.  In most cases, the save area macro
+   is used to define a local function save area for the disable and restore
+   macros.  */
+
+UINT   _tx_thread_interrupt_disable(void);
+VOID   _tx_thread_interrupt_restore(UINT previous_posture);
+
+#define TX_INTERRUPT_SAVE_AREA UINT             tx_saved_posture;
+
+#define TX_DISABLE                              tx_saved_posture =   _tx_thread_interrupt_disable();
+
+#define TX_RESTORE                              _tx_thread_interrupt_restore(tx_saved_posture);
+
+
+/* Define the interrupt lockout macros for each ThreadX object.  */
+
+#define TX_BLOCK_POOL_DISABLE                   TX_DISABLE
+#define TX_BYTE_POOL_DISABLE                    TX_DISABLE
+#define TX_EVENT_FLAGS_GROUP_DISABLE            TX_DISABLE
+#define TX_MUTEX_DISABLE                        TX_DISABLE
+#define TX_QUEUE_DISABLE                        TX_DISABLE
+#define TX_SEMAPHORE_DISABLE                    TX_DISABLE
+
+
+/* Define the version ID of ThreadX.  This may be utilized by the application.  */
+
+#ifdef TX_THREAD_INIT
+CHAR                            _tx_version_id[] =
+                                    "Copyright (c) Microsoft Corporation. All rights reserved.  *  ThreadX Linux/GNU Version 6.1.10 *";
+#else
+extern  CHAR                    _tx_version_id[];
+#endif
+
+
+/* Define externals for the Linux port of ThreadX.  */
+
+extern TX_LINUX_CRITICAL_SECTION                _tx_linux_critical_section;
+extern sem_t                                    _tx_linux_scheduler_semaphore;
+extern UINT                                     _tx_linux_scheduler_idle;
+extern pthread_t                                _tx_linux_scheduler_id;
+extern ULONG                                    _tx_linux_global_int_disabled_flag;
+extern struct timespec                          _tx_linux_time_stamp;
+extern ULONG                                    _tx_linux_system_error;
+extern pthread_t                                _tx_linux_timer_id;
+extern __thread struct TX_THREAD_STRUCT        *_tx_linux_thread_self;
+#ifndef TX_LINUX_CRITICAL_SECTION_MUTEX
+extern __thread volatile UINT * volatile        _tx_linux_critical_section_wake_pending;
+#endif
+
+
+#ifndef TX_LINUX_MEMORY_SIZE
+#define TX_LINUX_MEMORY_SIZE                    64000
+#endif
+
+/* Define the period of the simulated timer interrupt, in milliseconds.  */
+
+#ifndef TX_TIMER_PERIODIC
+#define TX_TIMER_PERIODIC                       10
+#endif
+
+
+/* Define TX_LINUX_TICKLESS to stop the periodic timer interrupt while every thread is
+   suspended. The timer thread then sleeps until the next timer or time-slice expiration,
+   or until a simulated interrupt makes a thread ready, and processes the ticks that
+   elapsed at once.  */
+
+#ifdef TX_LINUX_TICKLESS
+extern sem_t                                    _tx_linux_timer_semaphore;
+extern UINT                                     _tx_linux_timer_tickless;
+#endif
+
+
+/* Define TX_LINUX_VIRTUAL_TIME to run the system on virtual time. The periodic timer
+   interrupt is not started. Instead, whenever every thread is suspended, the scheduler
+   advances the system clock straight to the next timer or time-slice expiration.  */
+
+#endif
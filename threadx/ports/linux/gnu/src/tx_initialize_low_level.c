@@ -0,0 +1,593 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Initialize                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+#define _GNU_SOURCE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sched.h>
+
+
+/* Define various Linux objects used by the ThreadX port.  */
+
+TX_LINUX_CRITICAL_SECTION       _tx_linux_critical_section;
+sem_t                           _tx_linux_scheduler_semaphore;
+UINT                            _tx_linux_scheduler_idle;
+pthread_t                       _tx_linux_scheduler_id;
+ULONG                           _tx_linux_global_int_disabled_flag;
+struct timespec                 _tx_linux_time_stamp;
+ULONG                           _tx_linux_system_error;
+__thread TX_THREAD              *_tx_linux_thread_self;
+#ifndef TX_LINUX_CRITICAL_SECTION_MUTEX
+__thread volatile UINT * volatile
+                                _tx_linux_critical_section_wake_pending;
+#endif
+extern TX_THREAD                *_tx_thread_current_ptr;
+
+
+/* Define the semaphore used by a thread to acknowledge a suspend request. Only
+   the owner of the critical section sends suspend requests, so one semaphore
+   is enough for the whole system.  */
+
+sem_t                           _tx_linux_thread_suspend_semaphore;
+
+
+#ifdef TX_LINUX_TICKLESS
+
+/* Define the semaphore the timer interrupt waits on while the periodic tick is
+   stopped, and the flag indicating that it does.  */
+
+sem_t                           _tx_linux_timer_semaphore;
+UINT                            _tx_linux_timer_tickless;
+#endif
+
+
+/* Define simulated timer interrupt.  This is done inside a thread, which is
+   how other interrupts may be defined as well.  See code below for an
+   example.  */
+
+pthread_t                       _tx_linux_timer_id;
+void                            *_tx_linux_timer_interrupt(void *p);
+
+
+#ifdef TX_LINUX_DEBUG_ENABLE
+
+extern ULONG                    _tx_thread_system_state;
+extern UINT                     _tx_thread_preempt_disable;
+extern TX_THREAD                *_tx_thread_current_ptr;
+extern TX_THREAD                *_tx_thread_execute_ptr;
+
+
+/* Define the maximum size of the Linux debug array.  */
+
+#ifndef TX_LINUX_DEBUG_EVENT_SIZE
+#define TX_LINUX_DEBUG_EVENT_SIZE           400
+#endif
+
+
+/* Define debug log in order to debug Linux issues with this port.  */
+
+typedef struct TX_LINUX_DEBUG_ENTRY_STRUCT
+{
+    char                                    *tx_linux_debug_entry_action;
+    struct timespec                         tx_linux_debug_entry_timestamp;
+    char                                    *tx_linux_debug_entry_file;
+    unsigned long                           tx_linux_debug_entry_line;
+    ULONG                                   tx_linux_debug_entry_nested_count;
+    unsigned long                           tx_linux_debug_entry_int_disabled_flag;
+    ULONG                                   tx_linux_debug_entry_system_state;
+    UINT                                    tx_linux_debug_entry_preempt_disable;
+    TX_THREAD                               *tx_linux_debug_entry_current_thread;
+    TX_THREAD                               *tx_linux_debug_entry_execute_thread;
+    pthread_t                               tx_linux_debug_entry_running_id;
+} TX_LINUX_DEBUG_ENTRY;
+
+
+/* Define the circular array of Linux debug entries.  */
+
+TX_LINUX_DEBUG_ENTRY    _tx_linux_debug_entry_array[TX_LINUX_DEBUG_EVENT_SIZE];
+
+
+/* Define the Linux debug index.  */
+
+unsigned long           _tx_linux_debug_entry_index =  0;
+
+
+/* Now define the debug entry function.  */
+void    _tx_linux_debug_entry_insert(char *action, char *file, unsigned long line)
+{
+
+
+    /* Get the time stamp.  */
+    clock_gettime(CLOCK_MONOTONIC, &_tx_linux_time_stamp);
+
+    /* Setup the debug entry.  */
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_action =             action;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_timestamp =          _tx_linux_time_stamp;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_file =               file;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_line =               line;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_nested_count =       _tx_linux_critical_section.tx_linux_critical_section_nested_count;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_int_disabled_flag =  _tx_linux_global_int_disabled_flag;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_system_state =       _tx_thread_system_state;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_preempt_disable =    _tx_thread_preempt_disable;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_current_thread =     _tx_thread_current_ptr;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_execute_thread =     _tx_thread_execute_ptr;
+    _tx_linux_debug_entry_array[_tx_linux_debug_entry_index].tx_linux_debug_entry_running_id =         pthread_self();
+
+    /* Now move to the next entry.  */
+    _tx_linux_debug_entry_index++;
+
+    /* Determine if we need to wrap the list.  */
+    if (_tx_linux_debug_entry_index >= TX_LINUX_DEBUG_EVENT_SIZE)
+    {
+
+        /* Yes, wrap the list!  */
+        _tx_linux_debug_entry_index =  0;
+    }
+}
+
+#endif
+
+
+/* Define the ThreadX timer interrupt handler.  */
+
+void            _tx_timer_interrupt(void);
+
+
+/* Define other external function references.  */
+
+VOID            _tx_initialize_low_level(VOID);
+VOID            _tx_thread_context_save(VOID);
+VOID            _tx_thread_context_restore(VOID);
+
+
+/* Define the signal handlers used to simulate thread suspension.  */
+
+static void     _tx_linux_thread_suspend_handler(int sig);
+static void     _tx_linux_thread_resume_handler(int sig);
+
+
+/* Define other external variable references.  */
+
+extern VOID     *_tx_initialize_unused_memory;
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_initialize_low_level                          Linux/GNU         */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is responsible for any low-level processor            */
+/*    initialization, including setting up interrupt vectors, setting     */
+/*    up a periodic timer interrupt source, saving the system stack       */
+/*    pointer for use in ISR processing later, and finding the first      */
+/*    available RAM memory address for tx_application_define.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    pthread_mutex_init                    Linux create mutex            */
+/*    pthread_self                          Linux get current thread ID   */
+/*    sched_setaffinity                     Linux process affinity set    */
+/*    sem_init                              Linux create semaphore        */
+/*    sigaction                             Linux install signal handler  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter           ThreadX entry function        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_initialize_low_level(VOID)
+{
+
+struct sigaction    action;
+#ifndef TX_LINUX_BYPASS_AFFINITY_SETUP
+cpu_set_t           cpu_set;
+int                 cpu;
+#endif
+
+
+#ifndef TX_LINUX_BYPASS_AFFINITY_SETUP
+
+    /* Limit this ThreadX simulation on Linux to a single core, the first one
+       the process is allowed to run on.  */
+    cpu =  CPU_SETSIZE;
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0)
+    {
+
+        for (cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+
+            if (CPU_ISSET(cpu, &cpu_set))
+            {
+                break;
+            }
+        }
+
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+    }
+
+    if ((cpu == CPU_SETSIZE) || (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0))
+    {
+
+        /* Error restricting the process to one core.  */
+        printf("ThreadX Linux error restricting the process to one core!\n");
+        while(1)
+        {
+        }
+    }
+#endif
+
+    /* Pickup the first available memory address.  */
+
+    /* Save the first available memory address.  */
+    _tx_initialize_unused_memory =  malloc(TX_LINUX_MEMORY_SIZE);
+
+    /* Pickup the unique Id of the current thread, which will also be the Id of the scheduler.  */
+    _tx_linux_scheduler_id =        pthread_self();
+
+    /* Initialize the system critical section. This is used by the system to block all other access,
+       analogous to an interrupt lockout on an embedded target.  */
+#ifdef TX_LINUX_CRITICAL_SECTION_MUTEX
+    pthread_mutex_init(&_tx_linux_critical_section.tx_linux_critical_section_mutex, NULL);
+#endif
+    _tx_linux_critical_section.tx_linux_critical_section_nested_count =  0;
+    _tx_linux_critical_section.tx_linux_critical_section_owner =         0;
+
+    /* Create the semaphore that regulates when the scheduler executes.  */
+    sem_init(&_tx_linux_scheduler_semaphore, 0, 0);
+
+    /* Create the semaphore that acknowledges thread suspension requests.  */
+    sem_init(&_tx_linux_thread_suspend_semaphore, 0, 0);
+
+#ifdef TX_LINUX_TICKLESS
+
+    /* Create the semaphore that ends the timer interrupt's tickless wait.  */
+    sem_init(&_tx_linux_timer_semaphore, 0, 0);
+    _tx_linux_timer_tickless =  TX_FALSE;
+#endif
+
+    /* Initialize the global interrupt disabled flag.  */
+    _tx_linux_global_int_disabled_flag =  TX_FALSE;
+
+    /* Install the signal handlers used to suspend and resume running threads. The
+       resume signal is blocked while the suspend handler runs, so it can only be
+       delivered inside the handler's wait.  */
+    memset(&action, 0, sizeof(action));
+    action.sa_flags =    SA_RESTART;
+    action.sa_handler =  _tx_linux_thread_suspend_handler;
+    sigemptyset(&action.sa_mask);
+    sigaddset(&action.sa_mask, TX_LINUX_RESUME_SIGNAL);
+    sigaction(TX_LINUX_SUSPEND_SIGNAL, &action, NULL);
+
+    action.sa_handler =  _tx_linux_thread_resume_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(TX_LINUX_RESUME_SIGNAL, &action, NULL);
+
+    /* Done, return to caller.  */
+}
+
+
+/* This routine is called after initialization is complete in order to start
+   all interrupt threads.  Interrupt threads in addition to the timer may
+   be added to this routine as well.  */
+
+void    _tx_initialize_start_interrupts(void)
+{
+
+sigset_t    signal_set;
+sigset_t    previous_set;
+
+
+    /* Interrupt threads never receive the thread suspension signals.  */
+    sigemptyset(&signal_set);
+    sigaddset(&signal_set, TX_LINUX_SUSPEND_SIGNAL);
+    sigaddset(&signal_set, TX_LINUX_RESUME_SIGNAL);
+    pthread_sigmask(SIG_BLOCK, &signal_set, &previous_set);
+
+#ifndef TX_LINUX_VIRTUAL_TIME
+
+    /* Kick the timer thread off to generate the ThreadX periodic interrupt
+       source. With virtual time, the scheduler advances the clock instead.  */
+    if (pthread_create(&_tx_linux_timer_id, NULL, _tx_linux_timer_interrupt, NULL))
+    {
+
+        /* Error creating the timer interrupt.  */
+        printf("ThreadX Linux error creating timer interrupt thread!\n");
+        while(1)
+        {
+        }
+    }
+#endif
+
+    pthread_sigmask(SIG_SETMASK, &previous_set, NULL);
+}
+
+
+/* Advance a time by a number of timer periods.  */
+
+static void     _tx_linux_timer_period_add(struct timespec *time, ULONG ticks)
+{
+
+unsigned long long  nanoseconds;
+
+
+    nanoseconds =    ((unsigned long long) ticks) * (TX_TIMER_PERIODIC * 1000000ULL) + (unsigned long long) time -> tv_nsec;
+    time -> tv_sec =   time -> tv_sec + (time_t) (nanoseconds / 1000000000ULL);
+    time -> tv_nsec =  (long) (nanoseconds % 1000000000ULL);
+}
+
+
+/* Define the ThreadX system timer interrupt.  Other interrupts may be simulated
+   in a similar way.  */
+
+
+void    *_tx_linux_timer_interrupt(void *p)
+{
+
+struct timespec     last_tick;
+struct timespec     next_tick;
+ULONG               ticks;
+#ifdef TX_LINUX_TICKLESS
+struct timespec     now;
+long long           elapsed;
+int                 status;
+#endif
+
+
+    clock_gettime(CLOCK_MONOTONIC, &last_tick);
+    while(1)
+    {
+
+        /* By default, the next interrupt is one period after the last.  */
+        ticks =  1;
+
+#ifdef TX_LINUX_TICKLESS
+
+        /* While the scheduler is idle, nothing needs the periodic tick before the
+           next timer or time-slice expiration.  */
+        _tx_linux_critical_section_obtain(&_tx_linux_critical_section);
+        if (_tx_linux_scheduler_idle)
+        {
+
+            /* Zero ticks means there is nothing to wait for.  */
+            if (_tx_timer_get_next(&ticks) == TX_FALSE)
+            {
+                ticks =  0;
+            }
+            _tx_linux_timer_tickless =  TX_TRUE;
+        }
+        _tx_linux_critical_section_release(&_tx_linux_critical_section);
+
+        if (ticks != 1)
+        {
+
+            /* Sleep until that expiration, unless a simulated interrupt makes a thread
+               ready earlier.  */
+            next_tick =  last_tick;
+            _tx_linux_timer_period_add(&next_tick, ticks);
+            do
+            {
+                if (ticks)
+                {
+                    status =  sem_clockwait(&_tx_linux_timer_semaphore, CLOCK_MONOTONIC, &next_tick);
+                }
+                else
+                {
+                    status =  sem_wait(&_tx_linux_timer_semaphore);
+                }
+            } while ((status != 0) && (errno == EINTR));
+
+            _tx_linux_critical_section_obtain(&_tx_linux_critical_section);
+            _tx_linux_timer_tickless =  TX_FALSE;
+            _tx_linux_critical_section_release(&_tx_linux_critical_section);
+
+            /* If woken early, only the periods that elapsed so far are processed.  */
+            if (status == 0)
+            {
+
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                elapsed =  ((long long) (now.tv_sec - last_tick.tv_sec)) * 1000000000LL + (now.tv_nsec - last_tick.tv_nsec);
+                ticks =    (ULONG) (elapsed / (TX_TIMER_PERIODIC * 1000000LL));
+            }
+        }
+        else
+#endif
+        {
+
+            /* Sleep until the next period. An absolute deadline keeps the tick from
+               drifting with the time spent in the interrupt processing.  */
+            next_tick =  last_tick;
+            _tx_linux_timer_period_add(&next_tick, ticks);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_tick, NULL) == EINTR)
+            {
+            }
+        }
+
+        /* Determine if any period has elapsed.  */
+        if (ticks)
+        {
+
+            /* The next deadlines are relative to the last period that elapsed.  */
+            _tx_linux_timer_period_add(&last_tick, ticks);
+
+            /* Call ThreadX context save for interrupt preparation.  */
+            _tx_thread_context_save();
+
+            /* Call the ThreadX system timer interrupt processing, or advance the clock
+               by all the periods at once after a tickless wait.  */
+            if (ticks == 1)
+            {
+                _tx_timer_interrupt();
+            }
+            else
+            {
+                _tx_time_increment(ticks);
+            }
+
+            /* Call ThreadX context restore for interrupt completion.  */
+            _tx_thread_context_restore();
+        }
+    }
+}
+
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+/* Return the time source of the execution profile kit, the nanoseconds of the Linux
+   monotonic clock.  */
+
+unsigned long long  _tx_linux_execution_time_source(void)
+{
+
+struct timespec     now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((((unsigned long long) now.tv_sec) * 1000000000ULL) + ((unsigned long long) now.tv_nsec));
+}
+#endif
+
+
+/* Wait on a Linux semaphore, riding through signal interruptions.  */
+
+void    _tx_linux_semaphore_wait(sem_t *semaphore)
+{
+
+    while (sem_wait(semaphore) != 0)
+    {
+    }
+}
+
+
+/* Suspend the Linux thread of a running ThreadX thread to simulate preemption. This
+   is only called with the critical section held, and does not return until the
+   target thread has stopped inside its suspend signal handler.  */
+
+void    _tx_linux_thread_suspend(TX_THREAD *thread_ptr)
+{
+
+    pthread_kill(thread_ptr -> tx_thread_linux_thread_id, TX_LINUX_SUSPEND_SIGNAL);
+    _tx_linux_semaphore_wait(&_tx_linux_thread_suspend_semaphore);
+}
+
+
+/* Resume the Linux thread of a ThreadX thread suspended by _tx_linux_thread_suspend.  */
+
+void    _tx_linux_thread_resume(TX_THREAD *thread_ptr)
+{
+
+    __atomic_store_n(&thread_ptr -> tx_thread_linux_resume_flag, TX_TRUE, __ATOMIC_RELEASE);
+    pthread_kill(thread_ptr -> tx_thread_linux_thread_id, TX_LINUX_RESUME_SIGNAL);
+}
+
+
+/* Wake the Linux thread of a terminated or completed ThreadX thread, wherever it is
+   parked, and wait for it to exit. Called with interrupts enabled.  */
+
+void    _tx_linux_thread_exit_wait(TX_THREAD *thread_ptr)
+{
+
+    _tx_linux_thread_resume(thread_ptr);
+    sem_post(&thread_ptr -> tx_thread_linux_thread_run_semaphore);
+    pthread_join(thread_ptr -> tx_thread_linux_thread_id, NULL);
+    sem_destroy(&thread_ptr -> tx_thread_linux_thread_run_semaphore);
+}
+
+
+static void     _tx_linux_thread_suspend_handler(int sig)
+{
+
+TX_THREAD   *thread_ptr;
+sigset_t    wait_set;
+int         saved_errno;
+
+
+    saved_errno =  errno;
+    thread_ptr =   _tx_linux_thread_self;
+
+#ifndef TX_LINUX_CRITICAL_SECTION_MUTEX
+    /* Complete the wakeup of a critical section waiter if the thread was interrupted
+       between releasing the critical section and waking the waiter.  */
+    if (_tx_linux_critical_section_wake_pending)
+    {
+        _tx_linux_futex_wake(_tx_linux_critical_section_wake_pending);
+    }
+#endif
+
+    /* Acknowledge the suspension to the interrupt that requested it.  */
+    sem_post(&_tx_linux_thread_suspend_semaphore);
+
+    /* Wait for the resume signal.  */
+    sigfillset(&wait_set);
+    sigdelset(&wait_set, TX_LINUX_RESUME_SIGNAL);
+    while (__atomic_load_n(&thread_ptr -> tx_thread_linux_resume_flag, __ATOMIC_ACQUIRE) == TX_FALSE)
+    {
+        sigsuspend(&wait_set);
+    }
+    thread_ptr -> tx_thread_linux_resume_flag =  TX_FALSE;
+
+    /* Determine if the thread was terminated while it was suspended. If so, it is only
+       being resumed in order to cleanup its resources.  */
+    if (_tx_thread_current_ptr != thread_ptr)
+    {
+
+        pthread_exit(NULL);
+    }
+
+    errno =  saved_errno;
+}
+
+
+static void     _tx_linux_thread_resume_handler(int sig)
+{
+
+    /* Nothing to do, the signal only ends the wait in the suspend handler.  */
+}
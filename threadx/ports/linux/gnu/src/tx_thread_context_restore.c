@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_context_restore                        Linux/GNU         */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function restores the interrupt context if it is processing a  */
+/*    nested interrupt.  If not, it returns to the interrupt thread if no */
+/*    preemption is necessary.  Otherwise, if preemption is necessary or  */
+/*    if no thread was running, the function returns to the scheduler.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sem_post                              Linux release semaphore       */
+/*    _tx_linux_thread_resume               Resume Linux thread           */
+/*    _tx_linux_critical_section_obtain     Obtain critical section       */
+/*    _tx_linux_critical_section_release    Release critical section      */
+/*    _tx_execution_isr_exit                Execution profile ISR exit    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ISRs                                  Interrupt Service Routines    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_context_restore(VOID)
+{
+
+    /* Enter critical section to ensure other threads are not playing with
+       the core ThreadX data structures.  */
+    _tx_linux_critical_section_obtain(&_tx_linux_critical_section);
+
+    /* Debug entry.  */
+    _tx_linux_debug_entry_insert("CONTEXT_RESTORE", __FILE__, __LINE__);
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+    /* Call the ISR execution exit function to indicate an ISR is complete.  */
+    _tx_execution_isr_exit();
+#endif
+
+    /* Decrement the nested interrupt count.  */
+    _tx_thread_system_state--;
+
+    /* Determine if this is the first nested interrupt and if a ThreadX
+       application thread was running at the time.  */
+    if ((!_tx_thread_system_state) && (_tx_thread_current_ptr))
+    {
+
+        /* Yes, this is the first and last interrupt processed.  */
+
+        /* Check to see if preemption is required.  */
+        if ((_tx_thread_preempt_disable == 0) && (_tx_thread_current_ptr != _tx_thread_execute_ptr))
+        {
+
+            /* Preempt the running application thread.  We don't need to suspend the
+               application thread since that is done in the context save processing.  */
+
+            /* Indicate that this thread was suspended asynchronously.  */
+            _tx_thread_current_ptr -> tx_thread_linux_suspension_type =  1;
+
+            /* Save the remaining time-slice and disable it.  */
+            if (_tx_timer_time_slice)
+            {
+
+                _tx_thread_current_ptr -> tx_thread_time_slice =  _tx_timer_time_slice;
+                _tx_timer_time_slice =  0;
+            }
+
+            /* Clear the current thread pointer.  */
+            _tx_thread_current_ptr =  TX_NULL;
+
+            /* Wakeup the system thread by setting the system semaphore.  */
+            sem_post(&_tx_linux_scheduler_semaphore);
+        }
+        else
+        {
+
+            /* Since preemption is not required, resume the interrupted thread.  */
+            _tx_linux_thread_resume(_tx_thread_current_ptr);
+        }
+    }
+    else if ((!_tx_thread_system_state) && (_tx_linux_scheduler_idle) && (_tx_thread_execute_ptr))
+    {
+
+        /* The scheduler is idle and a thread is now ready, wake it up.  */
+        _tx_linux_scheduler_idle =  TX_FALSE;
+        sem_post(&_tx_linux_scheduler_semaphore);
+
+#ifdef TX_LINUX_TICKLESS
+
+        /* The thread may need the periodic tick, wake up the timer interrupt if
+           it is waiting for the next expiration.  */
+        if (_tx_linux_timer_tickless)
+        {
+
+            _tx_linux_timer_tickless =  TX_FALSE;
+            sem_post(&_tx_linux_timer_semaphore);
+        }
+#endif
+    }
+
+    /* Leave Linux critical section.  */
+    _tx_linux_critical_section_release_all(&_tx_linux_critical_section);
+}
+
@@ -0,0 +1,472 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#ifndef TX_LINUX_CRITICAL_SECTION_MUTEX
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_schedule                               Linux/GNU         */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits for a thread control block pointer to appear in */
+/*    the _tx_thread_execute_ptr variable.  Once a thread pointer appears */
+/*    in the variable, the corresponding thread is resumed.  While there  */
+/*    is nothing to run, the scheduler blocks on its semaphore until a    */
+/*    simulated ISR makes a thread ready, or with virtual time, advances  */
+/*    the clock to the next timer or time-slice expiration.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sem_post                              Linux release semaphore       */
+/*    _tx_linux_semaphore_wait              Wait on a semaphore           */
+/*    _tx_linux_thread_resume               Resume a suspended thread     */
+/*    _tx_linux_critical_section_obtain     Obtain critical section       */
+/*    _tx_linux_critical_section_release    Release critical section      */
+/*    _tx_timer_get_next                    Get next timer expiration     */
+/*    _tx_time_increment                    Advance the system clock      */
+/*    _tx_execution_thread_enter            Execution profile thread entry*/
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter          ThreadX entry function         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_schedule(VOID)
+{
+
+#ifdef TX_LINUX_VIRTUAL_TIME
+ULONG       ticks;
+#endif
+
+
+    /* Loop forever.  */
+    while(1)
+    {
+
+        /* Wait for a thread to execute and all ISRs to complete.  */
+        while(1)
+        {
+
+
+            /* Enter Linux critical section.  */
+            _tx_linux_critical_section_obtain(&_tx_linux_critical_section);
+
+            /* Debug entry.  */
+            _tx_linux_debug_entry_insert("SCHEDULE-wake_up", __FILE__, __LINE__);
+
+            /* Determine if there is a thread ready to execute AND all ISRs
+               are complete.  */
+            if ((_tx_thread_execute_ptr != TX_NULL) && (_tx_thread_system_state == 0))
+            {
+
+                /* Get out of this loop and schedule the thread!  */
+                break;
+            }
+#ifdef TX_LINUX_VIRTUAL_TIME
+
+            /* Nothing is ready, so nothing can happen before the next timer or
+               time-slice expiration.  */
+            ticks =  0;
+            if (_tx_thread_system_state == 0)
+            {
+                _tx_timer_get_next(&ticks);
+            }
+
+            if ((ticks != 0) && (ticks != TX_WAIT_FOREVER))
+            {
+
+                /* Leave the critical section.  */
+                _tx_linux_critical_section_release(&_tx_linux_critical_section);
+
+                /* Debug entry.  */
+                _tx_linux_debug_entry_insert("SCHEDULE-virtual_time", __FILE__, __LINE__);
+
+                /* Advance the clock to that expiration right away.  */
+                _tx_thread_context_save();
+                _tx_time_increment(ticks);
+                _tx_thread_context_restore();
+            }
+            else
+#endif
+            {
+
+                /* Indicate the scheduler is idle so the last ISR to complete
+                   wakes it up once a thread is ready.  */
+                _tx_linux_scheduler_idle =  TX_TRUE;
+
+                /* Leave the critical section.  */
+                _tx_linux_critical_section_release(&_tx_linux_critical_section);
+
+                /* Debug entry.  */
+                _tx_linux_debug_entry_insert("SCHEDULE-idle_wait", __FILE__, __LINE__);
+
+                /* Now wait until there is something to schedule.  */
+                _tx_linux_semaphore_wait(&_tx_linux_scheduler_semaphore);
+            }
+        }
+
+        /* Yes! We have a thread to execute. Note that the critical section is already
+           active from the scheduling loop above.  */
+
+        /* Setup the current thread pointer.  */
+        _tx_thread_current_ptr =  _tx_thread_execute_ptr;
+
+        /* Increment the run count for this thread.  */
+        _tx_thread_current_ptr -> tx_thread_run_count++;
+
+        /* Setup time-slice, if present.  */
+        _tx_timer_time_slice =  _tx_thread_current_ptr -> tx_thread_time_slice;
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+        /* Call the thread entry function to indicate the thread is executing.  */
+        _tx_execution_thread_enter();
+#endif
+
+        /* Determine how the thread was suspended.  */
+        if (_tx_thread_current_ptr -> tx_thread_linux_suspension_type)
+        {
+
+            /* Debug entry.  */
+            _tx_linux_debug_entry_insert("SCHEDULE-resume_thread", __FILE__, __LINE__);
+
+            /* Pseudo interrupt suspension.  The thread is not waiting on
+               its run semaphore.  */
+            _tx_linux_thread_resume(_tx_thread_current_ptr);
+        }
+        else
+        {
+
+            /* Debug entry.  */
+            _tx_linux_debug_entry_insert("SCHEDULE-release_sem", __FILE__, __LINE__);
+
+            /* Let the thread run again by releasing its run semaphore.  */
+            sem_post(&_tx_thread_current_ptr -> tx_thread_linux_thread_run_semaphore);
+        }
+
+        /* Debug entry.  */
+        _tx_linux_debug_entry_insert("SCHEDULE-self_suspend_sem", __FILE__, __LINE__);
+
+        /* Exit Linux critical section.  */
+        _tx_linux_critical_section_release(&_tx_linux_critical_section);
+
+        /* Now suspend the main thread so the application thread can run.  */
+        _tx_linux_semaphore_wait(&_tx_linux_scheduler_semaphore);
+    }
+}
+
+
+#ifdef TX_LINUX_CRITICAL_SECTION_MUTEX
+
+/* Define the Linux critical section as a pthread mutex, with the owner and the
+   nesting tracked beside it.  */
+
+void    _tx_linux_critical_section_obtain(TX_LINUX_CRITICAL_SECTION *critical_section)
+{
+
+pthread_t   self;
+
+
+    self =  pthread_self();
+
+    /* Is the protection owned?  */
+    if ((critical_section -> tx_linux_critical_section_nested_count) &&
+        (pthread_equal(critical_section -> tx_linux_critical_section_owner, self)))
+    {
+
+        /* Simply increment the nested counter.  */
+        critical_section -> tx_linux_critical_section_nested_count++;
+    }
+    else
+    {
+
+        /* Get the Linux critical section.  */
+        pthread_mutex_lock(&critical_section -> tx_linux_critical_section_mutex);
+
+        /* At this point we have the mutex.  */
+
+        /* Remember the owner.  */
+        critical_section -> tx_linux_critical_section_owner =  self;
+
+        /* Increment the nesting counter.  */
+        critical_section -> tx_linux_critical_section_nested_count =  1;
+    }
+}
+
+
+void    _tx_linux_critical_section_release(TX_LINUX_CRITICAL_SECTION *critical_section)
+{
+
+
+    /* Ensure the caller is the mutex owner.  */
+    if ((critical_section -> tx_linux_critical_section_nested_count) &&
+        (pthread_equal(critical_section -> tx_linux_critical_section_owner, pthread_self())))
+    {
+
+        /* Decrement the nesting counter.  */
+        critical_section -> tx_linux_critical_section_nested_count--;
+
+        /* Determine if the critical section is now being released.  */
+        if (critical_section -> tx_linux_critical_section_nested_count == 0)
+        {
+
+            /* Yes, it is being released, release the mutex.  */
+            if (pthread_mutex_unlock(&critical_section -> tx_linux_critical_section_mutex))
+            {
+
+                /* Increment the system error counter.  */
+                _tx_linux_system_error++;
+            }
+        }
+    }
+    else
+    {
+
+        /* Increment the system error counter.  */
+        _tx_linux_system_error++;
+    }
+}
+
+
+void    _tx_linux_critical_section_release_all(TX_LINUX_CRITICAL_SECTION *critical_section)
+{
+
+    /* Ensure the caller is the mutex owner.  */
+    if ((critical_section -> tx_linux_critical_section_nested_count) &&
+        (pthread_equal(critical_section -> tx_linux_critical_section_owner, pthread_self())))
+    {
+
+        /* Clear the nesting counter.  */
+        critical_section -> tx_linux_critical_section_nested_count =  0;
+
+        /* Finally, release the mutex.  */
+        if (pthread_mutex_unlock(&critical_section -> tx_linux_critical_section_mutex))
+        {
+
+            /* Increment the system error counter.  */
+            _tx_linux_system_error++;
+        }
+    }
+    else
+    {
+
+        /* Increment the system error counter.  */
+        _tx_linux_system_error++;
+    }
+}
+
+#else
+
+/* Define the Linux critical section. Ownership is claimed with a compare-and-swap
+   of the caller's Linux thread id into the owner word, so the uncontended path
+   never enters the kernel. Contended callers sleep on the owner word with the
+   futex system call.  */
+
+static __thread UINT    _tx_linux_thread_tid;
+
+
+void    _tx_linux_critical_section_obtain(TX_LINUX_CRITICAL_SECTION *critical_section)
+{
+
+UINT    self;
+UINT    owner;
+UINT    desired;
+
+
+    /* Pickup the Linux thread id of the caller, reading it from the kernel on first use.  */
+    self =  _tx_linux_thread_tid;
+    if (self == 0)
+    {
+
+        self =  (UINT) syscall(SYS_gettid);
+        _tx_linux_thread_tid =  self;
+    }
+
+    /* Is the protection owned?  Only the owner stores its own id, so a relaxed load is sufficient.  */
+    owner =  __atomic_load_n(&critical_section -> tx_linux_critical_section_owner, __ATOMIC_RELAXED);
+    if ((owner & ~TX_LINUX_CRITICAL_SECTION_WAITERS) == self)
+    {
+
+        /* Simply increment the nested counter.  */
+        critical_section -> tx_linux_critical_section_nested_count++;
+    }
+    else
+    {
+
+        /* Try to claim the free critical section.  */
+        owner =    0;
+        desired =  self;
+        while (!__atomic_compare_exchange_n(&critical_section -> tx_linux_critical_section_owner, &owner, desired,
+                                            0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+
+            /* Another thread owns the critical section. Make sure the waiters bit is set
+               so the owner wakes us, then sleep until the owner word changes.  */
+            if (owner != 0)
+            {
+
+                if ((owner & TX_LINUX_CRITICAL_SECTION_WAITERS) ||
+                    (__atomic_compare_exchange_n(&critical_section -> tx_linux_critical_section_owner, &owner,
+                                                 owner | TX_LINUX_CRITICAL_SECTION_WAITERS,
+                                                 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+                {
+
+                    _tx_linux_futex_wait(&critical_section -> tx_linux_critical_section_owner,
+                                         owner | TX_LINUX_CRITICAL_SECTION_WAITERS);
+                }
+            }
+
+            /* Other threads may still be waiting, so claim the critical section with the
+               waiters bit set from now on.  */
+            owner =    0;
+            desired =  self | TX_LINUX_CRITICAL_SECTION_WAITERS;
+        }
+
+        /* At this point we own the critical section.  */
+
+        /* Set the nesting counter.  */
+        critical_section -> tx_linux_critical_section_nested_count =  1;
+    }
+}
+
+
+void    _tx_linux_critical_section_release(TX_LINUX_CRITICAL_SECTION *critical_section)
+{
+
+UINT    owner;
+
+
+    /* Ensure the caller is the owner.  */
+    owner =  __atomic_load_n(&critical_section -> tx_linux_critical_section_owner, __ATOMIC_RELAXED);
+    if ((critical_section -> tx_linux_critical_section_nested_count) && (owner != 0) &&
+        ((owner & ~TX_LINUX_CRITICAL_SECTION_WAITERS) == _tx_linux_thread_tid))
+    {
+
+        /* Decrement the nesting counter.  */
+        critical_section -> tx_linux_critical_section_nested_count--;
+
+        /* Determine if the critical section is now being released.  */
+        if (critical_section -> tx_linux_critical_section_nested_count == 0)
+        {
+
+            /* Yes, it is being released, release the owner word.  */
+            _tx_linux_critical_section_release_all(critical_section);
+        }
+    }
+    else
+    {
+
+        /* Increment the system error counter.  */
+        _tx_linux_system_error++;
+    }
+}
+
+
+void    _tx_linux_critical_section_release_all(TX_LINUX_CRITICAL_SECTION *critical_section)
+{
+
+UINT    owner;
+
+
+    /* Ensure the caller is the owner. The nesting counter is already zero when called
+       from the release function above.  */
+    owner =  __atomic_load_n(&critical_section -> tx_linux_critical_section_owner, __ATOMIC_RELAXED);
+    if ((owner != 0) && ((owner & ~TX_LINUX_CRITICAL_SECTION_WAITERS) == _tx_linux_thread_tid))
+    {
+
+        /* Clear the nesting counter.  */
+        critical_section -> tx_linux_critical_section_nested_count =  0;
+
+        /* Remember the pending wakeup, so the suspend signal handler can complete it if
+           this thread is suspended before waking the waiter.  */
+        _tx_linux_critical_section_wake_pending =  &critical_section -> tx_linux_critical_section_owner;
+
+        /* Finally, clear the owner word and wake one waiter if there are any.  */
+        owner =  __atomic_exchange_n(&critical_section -> tx_linux_critical_section_owner, 0, __ATOMIC_RELEASE);
+        if (owner & TX_LINUX_CRITICAL_SECTION_WAITERS)
+        {
+
+            _tx_linux_futex_wake(&critical_section -> tx_linux_critical_section_owner);
+        }
+
+        _tx_linux_critical_section_wake_pending =  TX_NULL;
+    }
+    else
+    {
+
+        /* Increment the system error counter.  */
+        _tx_linux_system_error++;
+    }
+}
+
+
+void    _tx_linux_futex_wait(volatile UINT *address, UINT value)
+{
+
+    /* Sleep while the word still holds the expected value. Interruption by a signal or
+       a changed value simply returns, the caller re-examines the word.  */
+    syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+
+void    _tx_linux_futex_wake(volatile UINT *address)
+{
+
+    /* Wake one thread sleeping on the word.  */
+    syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+#endif
@@ -0,0 +1,180 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include <stdio.h>
+#include <pthread.h>
+#include <signal.h>
+
+
+/* Prototype for new thread entry function.  */
+
+static void    *_tx_linux_thread_entry(void *p);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_build                            Linux/GNU         */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds a stack frame on the supplied thread's stack.  */
+/*    The stack frame results in a fake interrupt return to the supplied  */
+/*    function pointer.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                            Pointer to thread control blk */
+/*    function_ptr                          Pointer to return function    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    pthread_create                        Linux create thread           */
+/*    pthread_sigmask                       Linux set thread signal mask  */
+/*    sem_init                              Linux create semaphore        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_create                     Create thread service         */
+/*    _tx_thread_reset                      Reset thread service          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_stack_build(TX_THREAD *thread_ptr, VOID (*function_ptr)(VOID))
+{
+
+sigset_t    signal_set;
+sigset_t    previous_set;
+
+
+    /* Create the run semaphore for the thread.  This will allow the scheduler
+       control over when the thread actually runs.  */
+    if (sem_init(&thread_ptr -> tx_thread_linux_thread_run_semaphore, 0, 0))
+    {
+
+        /* Display an error message.  */
+        printf("ThreadX Linux error creating thread running semaphore!\n");
+        while(1)
+        {
+        }
+    }
+
+    /* Setup the thread suspension type to solicited thread suspension.
+       Pseudo interrupt handlers will suspend with this field set to 1.  */
+    thread_ptr -> tx_thread_linux_suspension_type =  0;
+
+    /* Clear the disabled count that will keep track of the
+       tx_interrupt_control nesting.  */
+    thread_ptr -> tx_thread_linux_int_disabled_flag =  0;
+
+    /* Clear the resume request used by simulated preemption.  */
+    thread_ptr -> tx_thread_linux_resume_flag =  TX_FALSE;
+
+    /* Setup a fake thread stack pointer.   */
+    thread_ptr -> tx_thread_stack_ptr =  (VOID *) (((CHAR *) thread_ptr -> tx_thread_stack_end) - 8);
+
+    /* Clear the first word of the stack.  */
+    *(((ULONG *) thread_ptr -> tx_thread_stack_ptr) - 1) =  0;
+
+    /* Create the Linux thread with the suspension signals blocked. The new thread
+       unblocks them once it knows which ThreadX thread it is.  */
+    sigemptyset(&signal_set);
+    sigaddset(&signal_set, TX_LINUX_SUSPEND_SIGNAL);
+    sigaddset(&signal_set, TX_LINUX_RESUME_SIGNAL);
+    pthread_sigmask(SIG_BLOCK, &signal_set, &previous_set);
+
+    /* Create a Linux thread for the application thread. It runs to the initial
+       wait on its run semaphore.  */
+    if (pthread_create(&thread_ptr -> tx_thread_linux_thread_id, NULL, _tx_linux_thread_entry, (void *) thread_ptr))
+    {
+
+        /* Display an error message.  */
+        printf("ThreadX Linux error creating thread!\n");
+        while(1)
+        {
+        }
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previous_set, NULL);
+}
+
+
+static void    *_tx_linux_thread_entry(void *ptr)
+{
+
+TX_THREAD   *thread_ptr;
+sigset_t    signal_set;
+
+
+    /* Pickup the current thread pointer.  */
+    thread_ptr =  (TX_THREAD *) ptr;
+
+    /* Remember which ThreadX thread this Linux thread runs, then allow the
+       suspension signals.  */
+    _tx_linux_thread_self =  thread_ptr;
+    sigemptyset(&signal_set);
+    sigaddset(&signal_set, TX_LINUX_SUSPEND_SIGNAL);
+    sigaddset(&signal_set, TX_LINUX_RESUME_SIGNAL);
+    pthread_sigmask(SIG_UNBLOCK, &signal_set, NULL);
+
+    /* Now suspend the thread initially.  If the thread has already
+       been scheduled, this will return immediately.  */
+    _tx_linux_semaphore_wait(&thread_ptr -> tx_thread_linux_thread_run_semaphore);
+
+    /* Determine if the thread was deleted or reset before it ever ran.  */
+    _tx_linux_critical_section_obtain(&_tx_linux_critical_section);
+    if (_tx_thread_current_ptr != thread_ptr)
+    {
+
+        /* Yes, simply exit.  */
+        _tx_linux_critical_section_release_all(&_tx_linux_critical_section);
+        return(NULL);
+    }
+    _tx_linux_critical_section_release(&_tx_linux_critical_section);
+
+    /* Call ThreadX thread entry point.  */
+    _tx_thread_shell_entry();
+
+    return(NULL);
+}
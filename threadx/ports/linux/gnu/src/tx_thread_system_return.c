@@ -0,0 +1,201 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define    TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#include <stdio.h>
+#include <pthread.h>
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_system_return                          Linux/GNU         */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is target processor specific.  It is used to transfer */
+/*    control from a thread back to the system.  Only a minimal context   */
+/*    is saved since the compiler assumes temp registers are going to get */
+/*    slicked by a function call anyway.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_critical_section_obtain     Obtain critical section       */
+/*    _tx_linux_critical_section_release    Release critical section      */
+/*    _tx_linux_critical_section_release_all                              */
+/*                                          Release critical section      */
+/*    pthread_exit                          Linux thread exit             */
+/*    sem_post                              Linux release semaphore       */
+/*    _tx_linux_semaphore_wait              Wait on a semaphore           */
+/*    _tx_execution_thread_exit             Execution profile thread exit */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX components                                                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_system_return(VOID)
+{
+
+TX_THREAD   *temp_thread_ptr;
+sem_t       *temp_run_semaphore;
+UINT        temp_thread_state;
+
+
+    /* Enter Linux critical section.  */
+    _tx_linux_critical_section_obtain(&_tx_linux_critical_section);
+
+    /* Debug entry.  */
+    _tx_linux_debug_entry_insert("SYSTEM_RETURN", __FILE__, __LINE__);
+
+    /* First, determine if the thread was terminated.  */
+
+    /* Pickup the current thread pointer.  */
+    temp_thread_ptr =  _tx_thread_current_ptr;
+
+    /* Determine if this thread does not match the current thread pointer.  */
+    if (_tx_linux_thread_self != temp_thread_ptr)
+    {
+
+        /* This indicates the Linux thread was actually terminated by ThreadX and is only
+           being allowed to run in order to cleanup its resources.  */
+
+        /* Release critical section.  */
+        _tx_linux_critical_section_release_all(&_tx_linux_critical_section);
+
+        /* Exit thread.  */
+        pthread_exit(NULL);
+    }
+
+    /* Determine if the time-slice is active.  */
+    if (_tx_timer_time_slice)
+    {
+
+        /* Preserve current remaining time-slice for the thread and clear the current time-slice.  */
+        temp_thread_ptr -> tx_thread_time_slice =  _tx_timer_time_slice;
+        _tx_timer_time_slice =  0;
+    }
+
+    /* Save the run semaphore into a temporary variable as well.  */
+    temp_run_semaphore =  &temp_thread_ptr -> tx_thread_linux_thread_run_semaphore;
+
+    /* Pickup the current thread state.  */
+    temp_thread_state =  temp_thread_ptr -> tx_thread_state;
+
+    /* Setup the suspension type for this thread.  */
+    temp_thread_ptr -> tx_thread_linux_suspension_type  =  0;
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+    /* Call the thread exit function to indicate the thread is no longer executing.  */
+    _tx_execution_thread_exit();
+#endif
+
+    /* Set the current thread pointer to NULL.  */
+    _tx_thread_current_ptr =  TX_NULL;
+
+    /* Debug entry.  */
+    _tx_linux_debug_entry_insert("SYSTEM_RETURN-release_sem", __FILE__, __LINE__);
+
+    /* Release the semaphore that the main scheduling thread is waiting
+       on.  Note that the main scheduling algorithm will take care of
+       setting the current thread pointer to NULL.  */
+    sem_post(&_tx_linux_scheduler_semaphore);
+
+    /* Leave Linux critical section.  */
+    _tx_linux_critical_section_release_all(&_tx_linux_critical_section);
+
+    /* Determine if the thread was self-terminating.  */
+    if (temp_thread_state ==  TX_TERMINATED)
+    {
+
+        /* Exit the thread instead of waiting on the semaphore!  */
+        pthread_exit(NULL);
+    }
+
+    /* Wait on the run semaphore for this thread.  This won't get set again
+       until the thread is scheduled.  */
+    _tx_linux_semaphore_wait(temp_run_semaphore);
+
+    /* Enter Linux critical section.  */
+    _tx_linux_critical_section_obtain(&_tx_linux_critical_section);
+
+    /* Debug entry.  */
+    _tx_linux_debug_entry_insert("SYSTEM_RETURN-wake_up", __FILE__, __LINE__);
+
+    /* Determine if the thread was terminated.  */
+
+    /* Pickup the current thread pointer.  */
+    temp_thread_ptr =  _tx_thread_current_ptr;
+
+    /* Determine if this thread does not match the current thread pointer.  */
+    if (_tx_linux_thread_self != temp_thread_ptr)
+    {
+
+        /* Leave Linux critical section.  */
+        _tx_linux_critical_section_release_all(&_tx_linux_critical_section);
+
+        /* This indicates the Linux thread was actually terminated by ThreadX and is only
+           being allowed to run in order to cleanup its resources.  */
+        pthread_exit(NULL);
+    }
+
+    /* Now determine if the application thread last had interrupts disabled.  */
+
+    /* Debug entry.  */
+    _tx_linux_debug_entry_insert("SYSTEM_RETURN-finish", __FILE__, __LINE__);
+
+    /* Determine if this thread had interrupts disabled.  */
+    if (!_tx_thread_current_ptr -> tx_thread_linux_int_disabled_flag)
+    {
+
+        /* Leave Linux critical section.  */
+        _tx_linux_critical_section_release(&_tx_linux_critical_section);
+    }
+}
+
@@ -0,0 +1,302 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Initialize                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+
+/* Define various Linux objects used by the ThreadX port.  */
+
+TX_LINUX_CONTEXT                _tx_linux_scheduler_context;
+UINT                            _tx_linux_interrupt_posture;
+volatile UINT                   _tx_linux_interrupt_pending;
+struct timespec                 _tx_linux_time_stamp;
+
+
+/* Define simulated timer interrupt.  The timer signal only records that a tick
+   is due, the tick itself is processed at the next safe point.  */
+
+static void     _tx_linux_timer_signal_handler(int sig);
+
+
+/* Define the ThreadX timer interrupt handler.  */
+
+void            _tx_timer_interrupt(void);
+
+
+/* Define other external variable references.  */
+
+extern VOID     *_tx_initialize_unused_memory;
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_initialize_low_level                          Linux/ucontext    */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is responsible for any low-level processor            */
+/*    initialization, including setting up interrupt vectors, setting up  */
+/*    a periodic timer interrupt source, saving the system stack pointer  */
+/*    for use in ISR processing later, and finding the first available    */
+/*    RAM memory address for tx_application_define.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    malloc                                Linux allocate memory         */
+/*    sigaction                             Linux install signal handler  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter           ThreadX entry function        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_initialize_low_level(VOID)
+{
+
+struct sigaction    action;
+
+
+    /* Pickup the first available memory address.  */
+
+    /* Save the first available memory address.  */
+    _tx_initialize_unused_memory =  malloc(TX_LINUX_MEMORY_SIZE);
+
+    /* Simulated interrupts are taken once the scheduler starts.  */
+    _tx_linux_interrupt_posture =  TX_INT_ENABLE;
+    _tx_linux_interrupt_pending =  0;
+
+    /* Install the timer signal handler.  System calls interrupted by the signal
+       are restarted, so application code calling the C library is unaffected.  */
+    memset(&action, 0, sizeof(action));
+    action.sa_flags =    SA_RESTART;
+    action.sa_handler =  _tx_linux_timer_signal_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(TX_LINUX_TIMER_SIGNAL, &action, NULL);
+
+    /* Done, return to caller.  */
+}
+
+
+/* This routine is called after initialization is complete in order to start
+   the periodic timer signal. There is no periodic timer with virtual time.  */
+
+void    _tx_initialize_start_interrupts(void)
+{
+
+#ifndef TX_LINUX_VIRTUAL_TIME
+struct itimerval    timer;
+
+
+    /* Start the periodic timer that generates the ThreadX tick.  */
+    timer.it_interval.tv_sec =   TX_TIMER_PERIODIC / 1000;
+    timer.it_interval.tv_usec =  (TX_TIMER_PERIODIC % 1000) * 1000;
+    timer.it_value =             timer.it_interval;
+    if (setitimer(ITIMER_REAL, &timer, NULL))
+    {
+
+        /* Error starting the timer interrupt.  */
+        printf("ThreadX Linux error starting the timer interrupt!\n");
+        while(1)
+        {
+        }
+    }
+#endif
+}
+
+
+/* Process the simulated interrupts that are due. This is called at the safe points
+   of the port, which are the places interrupts are enabled and the scheduler's
+   idle loop. Simulated interrupts are not nested, so nothing is done while an
+   interrupt or the initialization is in progress.  */
+
+void    _tx_linux_interrupt_dispatch(void)
+{
+
+UINT    ticks;
+
+
+    /* Determine if interrupts can be taken.  */
+    if ((_tx_linux_interrupt_posture == TX_INT_ENABLE) && (_tx_thread_system_state == 0))
+    {
+
+        /* Pickup and clear the ticks that are due.  */
+        ticks =  __atomic_exchange_n(&_tx_linux_interrupt_pending, 0, __ATOMIC_RELAXED);
+        if (ticks)
+        {
+
+            /* Call ThreadX context save for interrupt preparation.  */
+            _tx_thread_context_save();
+
+            /* Call the ThreadX system timer interrupt processing, or advance the clock
+               by all the ticks at once if several became due.  */
+            if (ticks == 1)
+            {
+                _tx_timer_interrupt();
+            }
+            else
+            {
+                _tx_time_increment(ticks);
+            }
+
+            /* Call ThreadX context restore for interrupt completion.  */
+            _tx_thread_context_restore();
+        }
+    }
+}
+
+
+#ifdef TX_LINUX_TICKLESS
+
+/* Wait in the scheduler's idle loop without the periodic tick. The timer is
+   reprogrammed to fire at the next timer or time-slice expiration, and all the
+   ticks that elapsed until the wakeup are made due together. The periodic tick
+   then resumes in phase with the ticks before the wait.  */
+
+void    _tx_linux_timer_tickless_wait(sigset_t *wait_set)
+{
+
+struct itimerval    timer;
+struct timespec     start;
+struct timespec     now;
+ULONG               ticks;
+long long           period;
+long long           first_tick;
+long long           elapsed;
+long long           next_tick;
+
+
+    /* An expiration on the next tick needs no reprogramming.  */
+    if ((_tx_timer_get_next(&ticks) == TX_TRUE) && (ticks == 1))
+    {
+
+        sigsuspend(wait_set);
+    }
+    else
+    {
+
+        /* Pickup the time until the next periodic tick.  */
+        period =  TX_TIMER_PERIODIC * 1000000LL;
+        getitimer(ITIMER_REAL, &timer);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        first_tick =  ((long long) timer.it_value.tv_sec) * 1000000000LL + ((long long) timer.it_value.tv_usec) * 1000LL;
+
+        /* Fire at the expiration, or never if nothing is going to expire.  */
+        if (ticks == TX_WAIT_FOREVER)
+        {
+
+            timer.it_value.tv_sec =   0;
+            timer.it_value.tv_usec =  0;
+        }
+        else
+        {
+
+            next_tick =  first_tick + ((long long) (ticks - 1)) * period;
+            timer.it_value.tv_sec =   (time_t) (next_tick / 1000000000LL);
+            timer.it_value.tv_usec =  (suseconds_t) ((next_tick % 1000000000LL) / 1000LL);
+        }
+        setitimer(ITIMER_REAL, &timer, NULL);
+
+        /* Sleep until the timer or another signal.  */
+        sigsuspend(wait_set);
+
+        /* Calculate the ticks that elapsed. The timer signal itself only counted one.  */
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        elapsed =  ((long long) (now.tv_sec - start.tv_sec)) * 1000000000LL + (now.tv_nsec - start.tv_nsec);
+        ticks =    0;
+        if (elapsed >= first_tick)
+        {
+            ticks =  (ULONG) (((elapsed - first_tick) / period) + 1);
+        }
+        if (ticks > _tx_linux_interrupt_pending)
+        {
+            _tx_linux_interrupt_pending =  ticks;
+        }
+
+        /* Resume the periodic tick at the next period boundary.  */
+        next_tick =  first_tick + ((long long) ticks) * period - elapsed;
+        if (next_tick < 1000LL)
+        {
+            next_tick =  1000LL;
+        }
+        timer.it_interval.tv_sec =   TX_TIMER_PERIODIC / 1000;
+        timer.it_interval.tv_usec =  (TX_TIMER_PERIODIC % 1000) * 1000;
+        timer.it_value.tv_sec =      (time_t) (next_tick / 1000000000LL);
+        timer.it_value.tv_usec =     (suseconds_t) ((next_tick % 1000000000LL) / 1000LL);
+        setitimer(ITIMER_REAL, &timer, NULL);
+    }
+}
+#endif
+
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+/* Return the time source of the execution profile kit, the nanoseconds of the Linux
+   monotonic clock.  */
+
+unsigned long long  _tx_linux_execution_time_source(void)
+{
+
+struct timespec     now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((((unsigned long long) now.tv_sec) * 1000000000ULL) + ((unsigned long long) now.tv_nsec));
+}
+#endif
+
+
+static void     _tx_linux_timer_signal_handler(int sig)
+{
+
+    /* Record the tick, it is processed at the next safe point.  */
+    __atomic_fetch_add(&_tx_linux_interrupt_pending, 1, __ATOMIC_RELAXED);
+}
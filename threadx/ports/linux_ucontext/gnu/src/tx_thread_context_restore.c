@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_context_restore                        Linux/ucontext    */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function restores the interrupt context if it is processing a  */
+/*    nested interrupt.  If not, it returns to the interrupted thread if  */
+/*    no preemption is necessary.  Otherwise, if preemption is necessary, */
+/*    the interrupted thread is switched out and control returns to the   */
+/*    scheduler.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_thread_switch_to_scheduler  Save thread context           */
+/*    _tx_execution_isr_exit                Execution profile ISR exit    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ISRs                                  Interrupt Service Routines    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_context_restore(VOID)
+{
+
+TX_THREAD   *thread_ptr;
+
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+    /* Call the ISR execution exit function to indicate an ISR is complete.  */
+    _tx_execution_isr_exit();
+#endif
+
+    /* Decrement the nested interrupt count.  */
+    _tx_thread_system_state--;
+
+    /* Determine if this is the first nested interrupt and if a ThreadX
+       application thread was running at the time.  */
+    if ((!_tx_thread_system_state) && (_tx_thread_current_ptr))
+    {
+
+        /* Yes, this is the first and last interrupt processed.  */
+
+        /* Check to see if preemption is required.  */
+        if ((_tx_thread_preempt_disable == 0) && (_tx_thread_current_ptr != _tx_thread_execute_ptr))
+        {
+
+            /* Preempt the running application thread.  */
+            thread_ptr =  _tx_thread_current_ptr;
+
+            /* Save the remaining time-slice and disable it.  */
+            if (_tx_timer_time_slice)
+            {
+
+                thread_ptr -> tx_thread_time_slice =  _tx_timer_time_slice;
+                _tx_timer_time_slice =  0;
+            }
+
+            /* Clear the current thread pointer.  */
+            _tx_thread_current_ptr =  TX_NULL;
+
+            /* Return to the scheduler. The interrupt processing is finished when
+               the thread is scheduled again.  */
+            _tx_linux_thread_switch_to_scheduler(thread_ptr);
+        }
+    }
+
+    /* Re-enable interrupts once the outermost interrupt is complete.  */
+    if (!_tx_thread_system_state)
+    {
+        _tx_linux_interrupt_posture =  TX_INT_ENABLE;
+    }
+}
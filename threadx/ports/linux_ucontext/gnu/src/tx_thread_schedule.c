@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_schedule                               Linux/ucontext    */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits for a thread control block pointer to appear in */
+/*    the _tx_thread_execute_ptr variable.  Once a thread pointer appears */
+/*    in the variable, the corresponding thread is resumed by switching   */
+/*    to its context.  While there is nothing to run, the scheduler       */
+/*    sleeps until the next simulated interrupt is due, or with virtual   */
+/*    time, advances the clock to the next timer or time-slice            */
+/*    expiration.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sigprocmask                           Linux block signals           */
+/*    sigsuspend                            Linux wait for signal         */
+/*    _tx_linux_context_switch              Switch to thread context      */
+/*    _tx_linux_interrupt_dispatch          Process simulated interrupts  */
+/*    _tx_linux_timer_tickless_wait         Wait without periodic tick    */
+/*    _tx_timer_get_next                    Get next timer expiration     */
+/*    _tx_execution_thread_enter            Execution profile thread entry*/
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter          ThreadX entry function         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_schedule(VOID)
+{
+
+sigset_t    timer_set;
+sigset_t    previous_set;
+#ifdef TX_LINUX_VIRTUAL_TIME
+ULONG       ticks;
+#endif
+
+
+    sigemptyset(&timer_set);
+    sigaddset(&timer_set, TX_LINUX_TIMER_SIGNAL);
+
+    /* Loop forever.  */
+    while(1)
+    {
+
+        /* The scheduler always runs with interrupts enabled.  */
+        _tx_linux_interrupt_posture =  TX_INT_ENABLE;
+
+        /* Wait for a thread to execute.  */
+        while(1)
+        {
+
+            /* Process any simulated interrupts that are due.  */
+            _tx_linux_interrupt_dispatch();
+
+            /* Determine if there is a thread ready to execute.  */
+            if (_tx_thread_execute_ptr != TX_NULL)
+            {
+
+                /* Get out of this loop and schedule the thread!  */
+                break;
+            }
+
+#ifdef TX_LINUX_VIRTUAL_TIME
+
+            /* Nothing is ready, so nothing can happen before the next timer or
+               time-slice expiration. Make the ticks up to it due right away.  */
+            if (_tx_timer_get_next(&ticks) == TX_TRUE)
+            {
+
+                __atomic_fetch_add(&_tx_linux_interrupt_pending, ticks, __ATOMIC_RELAXED);
+                continue;
+            }
+#endif
+
+            /* Nothing is ready, sleep until the next simulated interrupt. The timer
+               signal is blocked while checking for a pending interrupt so that it
+               cannot slip in before the wait.  */
+            sigprocmask(SIG_BLOCK, &timer_set, &previous_set);
+            if (_tx_linux_interrupt_pending == 0)
+            {
+#ifdef TX_LINUX_TICKLESS
+                _tx_linux_timer_tickless_wait(&previous_set);
+#else
+                sigsuspend(&previous_set);
+#endif
+            }
+            sigprocmask(SIG_SETMASK, &previous_set, NULL);
+        }
+
+        /* Yes! We have a thread to execute.  */
+
+        /* Setup the current thread pointer.  */
+        _tx_thread_current_ptr =  _tx_thread_execute_ptr;
+
+        /* Increment the run count for this thread.  */
+        _tx_thread_current_ptr -> tx_thread_run_count++;
+
+        /* Setup time-slice, if present.  */
+        _tx_timer_time_slice =  _tx_thread_current_ptr -> tx_thread_time_slice;
+
+#if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE)
+
+        /* Call the thread entry function to indicate the thread is executing.  */
+        _tx_execution_thread_enter();
+#endif
+
+        /* Switch to the thread. This returns when the thread gives control back
+           to the scheduler.  */
+        _tx_linux_context_switch(&_tx_linux_scheduler_context, &_tx_thread_current_ptr -> tx_thread_linux_context);
+    }
+}
@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* Prototype for the thread entry function that runs on the new host stack.  */
+
+static VOID _tx_linux_thread_entry(VOID);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_build                            Linux/ucontext    */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds a stack frame on the supplied thread's stack.  */
+/*    The thread actually runs on a host stack of                         */
+/*    TX_LINUX_THREAD_STACK_SIZE bytes, since the stack supplied by the   */
+/*    application is normally too small for calls into the host C         */
+/*    library. The initial frame is laid out so that the first context    */
+/*    switch to the thread enters _tx_linux_thread_entry.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                            Pointer to thread control blk */
+/*    function_ptr                          Pointer to return function    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    malloc                                Linux allocate memory         */
+/*    getcontext                            Linux get user context        */
+/*    makecontext                           Linux make user context       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_create                     Create thread service         */
+/*    _tx_thread_reset                      Reset thread service          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-16-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_stack_build(TX_THREAD *thread_ptr, VOID (*function_ptr)(VOID))
+{
+
+CHAR        *stack_memory;
+#ifndef TX_LINUX_USE_UCONTEXT
+ALIGN_TYPE  *frame_ptr;
+UINT        i;
+#endif
+
+
+    /* Allocate the host stack for the thread.  */
+    stack_memory =  (CHAR *) malloc(TX_LINUX_THREAD_STACK_SIZE);
+    if (stack_memory == TX_NULL)
+    {
+
+        /* Display an error message.  */
+        printf("ThreadX Linux error allocating thread stack!\n");
+        while(1)
+        {
+        }
+    }
+    thread_ptr -> tx_thread_linux_stack_memory =  (VOID *) stack_memory;
+
+    /* A thread starts with interrupts enabled.  */
+    thread_ptr -> tx_thread_linux_int_posture =  TX_INT_ENABLE;
+
+    /* Setup a fake thread stack pointer inside the application supplied stack.   */
+    thread_ptr -> tx_thread_stack_ptr =  (VOID *) (((CHAR *) thread_ptr -> tx_thread_stack_end) - 8);
+
+    /* Clear the first word of the stack.  */
+    *(((ULONG *) thread_ptr -> tx_thread_stack_ptr) - 1) =  0;
+
+#ifdef TX_LINUX_USE_UCONTEXT
+
+    /* Build a user context that starts the thread entry function on the host stack.  */
+    getcontext(&thread_ptr -> tx_thread_linux_context);
+    thread_ptr -> tx_thread_linux_context.uc_stack.ss_sp =    (VOID *) stack_memory;
+    thread_ptr -> tx_thread_linux_context.uc_stack.ss_size =  TX_LINUX_THREAD_STACK_SIZE;
+    thread_ptr -> tx_thread_linux_context.uc_link =           TX_NULL;
+    makecontext(&thread_ptr -> tx_thread_linux_context, _tx_linux_thread_entry, 0);
+#else
+
+    /* Build the frame popped by _tx_linux_context_switch at the 16-byte aligned top of
+       the host stack. From the top down it holds a null return address for the thread
+       entry function, the entry function itself as the return address of the switch,
+       the six callee-saved registers, and the initial MXCSR and x87 control word.  */
+    frame_ptr =  (ALIGN_TYPE *) (((ALIGN_TYPE) (stack_memory + TX_LINUX_THREAD_STACK_SIZE)) & ~((ALIGN_TYPE) 15));
+    *(--frame_ptr) =  0;
+    *(--frame_ptr) =  (ALIGN_TYPE) _tx_linux_thread_entry;
+    for (i = 0; i < 6; i++)
+    {
+        *(--frame_ptr) =  0;
+    }
+    *(--frame_ptr) =  (ALIGN_TYPE) 0x0000037F00001F80UL;
+
+    /* Save the initial stack pointer of the thread.  */
+    thread_ptr -> tx_thread_linux_context =  (VOID *) frame_ptr;
+#endif
+}
+
+
+static VOID _tx_linux_thread_entry(VOID)
+{
+
+    /* The thread has been switched to by the scheduler. Restore its interrupt posture.  */
+    _tx_linux_interrupt_posture =  _tx_thread_current_ptr -> tx_thread_linux_int_posture;
+
+    /* Call ThreadX thread entry point. This never returns.  */
+    _tx_thread_shell_entry();
+}
+
+
+#ifdef TX_LINUX_USE_UCONTEXT
+
+/* Define the context switch in terms of the C library's user contexts.  */
+
+void    _tx_linux_context_switch(TX_LINUX_CONTEXT *save_context, TX_LINUX_CONTEXT *restore_context)
+{
+
+    swapcontext(save_context, restore_context);
+}
+#endif
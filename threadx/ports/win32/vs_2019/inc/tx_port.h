@@ -429,6 +429,7 @@ extern  CHAR                    _tx_version_id[];
 
 extern TX_WIN32_CRITICAL_SECTION                _tx_win32_critical_section;
 extern HANDLE                                   _tx_win32_scheduler_semaphore;
+extern UINT                                     _tx_win32_scheduler_idle;
 extern DWORD                                    _tx_win32_scheduler_id;
 extern ULONG                                    _tx_win32_global_int_disabled_flag;
 extern LARGE_INTEGER                            _tx_win32_time_stamp;
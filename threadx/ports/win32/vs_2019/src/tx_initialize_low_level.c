@@ -36,6 +36,7 @@
 
 TX_WIN32_CRITICAL_SECTION       _tx_win32_critical_section;
 HANDLE                          _tx_win32_scheduler_semaphore;
+UINT                            _tx_win32_scheduler_idle;
 DWORD                           _tx_win32_scheduler_id;
 ULONG                           _tx_win32_global_int_disabled_flag;
 LARGE_INTEGER                   _tx_win32_time_stamp;
@@ -72,6 +72,9 @@
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  09-30-2020     William E. Lamie         Initial Version 6.1           */
+/*  10-16-2026     agent                    Modified comment(s), wake up  */
+/*                                            the idle scheduler when a   */
+/*                                            thread becomes ready        */
 /*                                                                        */
 /**************************************************************************/
 VOID   _tx_thread_context_restore(VOID)
@@ -125,6 +128,13 @@ VOID   _tx_thread_context_restore(VOID)
             ResumeThread(_tx_thread_current_ptr -> tx_thread_win32_thread_handle);
         }
     }
+    else if ((!_tx_thread_system_state) && (_tx_win32_scheduler_idle) && (_tx_thread_execute_ptr))
+    {
+
+        /* The scheduler is idle and a thread is now ready, wake it up.  */
+        _tx_win32_scheduler_idle =  TX_FALSE;
+        ReleaseSemaphore(_tx_win32_scheduler_semaphore, 1, NULL);
+    }
 
     /* Leave Win32 critical section.  */
     _tx_win32_critical_section_release_all(&_tx_win32_critical_section);
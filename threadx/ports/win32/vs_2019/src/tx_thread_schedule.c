@@ -45,7 +45,9 @@
 /*                                                                        */ 
 /*    This function waits for a thread control block pointer to appear in */ 
 /*    the _tx_thread_execute_ptr variable.  Once a thread pointer appears */ 
-/*    in the variable, the corresponding thread is resumed.               */ 
+/*    in the variable, the corresponding thread is resumed.  While there  */
+/*    is nothing to run, the scheduler blocks on its semaphore until a    */
+/*    simulated ISR makes a thread ready.                                 */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -59,7 +61,6 @@
 /*                                                                        */ 
 /*    ReleaseSemaphore                      Win32 release semaphore       */ 
 /*    ResumeThread                          Win32 resume thread           */ 
-/*    Sleep                                 Win32 thread sleep            */ 
 /*    WaitForSingleObject                   Win32 wait on a semaphore     */ 
 /*    _tx_win32_critical_section_obtain     Obtain critical section       */ 
 /*    _tx_win32_critical_section_release    Release critical section      */ 
@@ -73,6 +74,9 @@
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  09-30-2020     William E. Lamie         Initial Version 6.1           */
+/*  10-16-2026     agent                    Modified comment(s), replaced */
+/*                                            idle polling with a wait on */
+/*                                            the scheduler semaphore     */
 /*                                                                        */
 /**************************************************************************/
 VOID   _tx_thread_schedule(VOID)
@@ -105,11 +109,18 @@ VOID   _tx_thread_schedule(VOID)
             else
             {
 
+                /* Indicate the scheduler is idle so the last ISR to complete
+                   wakes it up once a thread is ready.  */
+                _tx_win32_scheduler_idle =  TX_TRUE;
+
                 /* Leave the critical section.  */
                 _tx_win32_critical_section_release(&_tx_win32_critical_section);
 
-                /* Now sleep so we don't block forever.  */
-                Sleep(2);
+                /* Debug entry.  */
+                _tx_win32_debug_entry_insert("SCHEDULE-idle_wait", __FILE__, __LINE__);
+
+                /* Now wait until there is something to schedule.  */
+                WaitForSingleObject(_tx_win32_scheduler_semaphore, INFINITE);
             }
         }
         
@@ -0,0 +1,217 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Block Batch Benchmark                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the cost per block of taking a burst of     */
+/*    blocks from a block pool and giving them back, at burst sizes of    */
+/*    1, 8, 32, and 128 blocks. Each burst is moved once with one         */
+/*    tx_block_allocate and tx_block_release call per block, and once     */
+/*    with a single tx_block_allocate_n and tx_block_release_n call,      */
+/*    which disable interrupts only once for the whole burst. The times   */
+/*    are the best of several rounds.                                     */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_BLOCKS            100000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_MAX_BURST         128
+#define BENCHMARK_BLOCK_SIZE        64
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the burst sizes.  */
+
+UINT            benchmark_bursts[] =  { 1, 8, 32, 128 };
+
+
+/* Define the benchmark thread, the pool, and the blocks of a burst.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_BLOCK_POOL   benchmark_pool;
+ALIGN_TYPE      benchmark_pool_memory[(BENCHMARK_MAX_BURST * (BENCHMARK_BLOCK_SIZE + sizeof(VOID *))) / sizeof(ALIGN_TYPE)];
+VOID            *benchmark_blocks[BENCHMARK_MAX_BURST];
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+double  benchmark_bursts_run(UINT burst, UINT batched, double *release_ns);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the pool, which holds exactly one burst of the largest size.  */
+    tx_block_pool_create(&benchmark_pool, "benchmark pool", BENCHMARK_BLOCK_SIZE,
+                         benchmark_pool_memory, sizeof(benchmark_pool_memory));
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+double  allocate_ns;
+double  release_ns;
+double  allocate_n_ns;
+double  release_n_ns;
+ULONG   i;
+
+
+    printf("ThreadX block batch benchmark, %d blocks of %d bytes per round, best of %d rounds\n\n",
+           BENCHMARK_BLOCKS, BENCHMARK_BLOCK_SIZE, BENCHMARK_ROUNDS);
+    printf("%-12s %18s %18s %18s %18s\n", "burst", "allocate ns/block", "release ns/block",
+           "allocate_n", "release_n");
+
+    for (i = 0; i < (sizeof(benchmark_bursts) / sizeof(benchmark_bursts[0])); i++)
+    {
+
+        allocate_ns =    benchmark_bursts_run(benchmark_bursts[i], TX_FALSE, &release_ns);
+        allocate_n_ns =  benchmark_bursts_run(benchmark_bursts[i], TX_TRUE, &release_n_ns);
+
+        printf("%-12u %18.1f %18.1f %18.1f %18.1f\n", benchmark_bursts[i],
+               allocate_ns, release_ns, allocate_n_ns, release_n_ns);
+    }
+
+    exit(0);
+}
+
+
+/* Move BENCHMARK_BLOCKS blocks through the pool in bursts of the given size, and return
+   the best allocate and release times per block.  */
+
+double  benchmark_bursts_run(UINT burst, UINT batched, double *release_ns)
+{
+
+struct timespec     start;
+struct timespec     middle;
+struct timespec     end;
+double              allocate_total;
+double              release_total;
+double              allocate_best;
+double              release_best;
+UINT                round;
+UINT                allocated;
+UINT                j;
+ULONG               i;
+
+
+    allocate_best =  0;
+    release_best =   0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        allocate_total =  0;
+        release_total =   0;
+        for (i = 0; i < BENCHMARK_BLOCKS; i = i + burst)
+        {
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            if (batched == TX_TRUE)
+            {
+                tx_block_allocate_n(&benchmark_pool, benchmark_blocks, burst, &allocated, TX_NO_WAIT);
+            }
+            else
+            {
+                for (j = 0; j < burst; j++)
+                {
+                    tx_block_allocate(&benchmark_pool, &benchmark_blocks[j], TX_NO_WAIT);
+                }
+                allocated =  burst;
+            }
+            clock_gettime(CLOCK_MONOTONIC, &middle);
+            if (batched == TX_TRUE)
+            {
+                tx_block_release_n(benchmark_blocks, allocated);
+            }
+            else
+            {
+                for (j = 0; j < burst; j++)
+                {
+                    tx_block_release(benchmark_blocks[j]);
+                }
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            /* Make sure the whole burst was allocated.  */
+            if (allocated != burst)
+            {
+
+                printf("Unexpected allocation count %u\n", allocated);
+                exit(1);
+            }
+
+            allocate_total =  allocate_total + benchmark_elapsed_ns(&start, &middle);
+            release_total =   release_total + benchmark_elapsed_ns(&middle, &end);
+        }
+
+        if ((round == 0) || (allocate_total < allocate_best))
+        {
+            allocate_best =  allocate_total;
+        }
+        if ((round == 0) || (release_total < release_best))
+        {
+            release_best =  release_total;
+        }
+    }
+
+    *release_ns =  release_best / BENCHMARK_BLOCKS;
+    return(allocate_best / BENCHMARK_BLOCKS);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
@@ -0,0 +1,244 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Block Lock-Free Benchmark                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the cost of a tx_block_allocate with        */
+/*    TX_NO_WAIT followed by a tx_block_release, from a ThreadX thread.   */
+/*    Build once with and once without TX_BLOCK_POOL_LOCK_FREE to compare */
+/*    the lock-free available list with the one protected by disabling   */
+/*    interrupts. With TX_BLOCK_POOL_LOCK_FREE, the same pairs are also   */
+/*    run from 1, 2, 4, and 8 host threads outside of ThreadX at once,    */
+/*    which is only possible because the fast path never takes the        */
+/*    kernel lock. The times are the best of several rounds.              */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_PAIRS             1000000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_HOLD              4
+#define BENCHMARK_MAX_HOST_THREADS  8
+#define BENCHMARK_POOL_BLOCKS       (BENCHMARK_HOLD * BENCHMARK_MAX_HOST_THREADS)
+#define BENCHMARK_BLOCK_SIZE        64
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the host thread counts.  */
+
+UINT            benchmark_host_threads[] =  { 1, 2, 4, 8 };
+
+
+/* Define the benchmark thread and the pool, which has enough blocks for every host
+   thread to hold BENCHMARK_HOLD blocks at once.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_BLOCK_POOL   benchmark_pool;
+ALIGN_TYPE      benchmark_pool_memory[(BENCHMARK_POOL_BLOCKS * (BENCHMARK_BLOCK_SIZE + sizeof(VOID *))) / sizeof(ALIGN_TYPE)];
+
+
+/* Define the number of allocations that failed, which must stay zero.  */
+
+volatile ULONG  benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_pairs_run(ULONG pairs);
+void    *benchmark_host_thread_entry(void *host_input);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the pool.  */
+    tx_block_pool_create(&benchmark_pool, "benchmark pool", BENCHMARK_BLOCK_SIZE,
+                         benchmark_pool_memory, sizeof(benchmark_pool_memory));
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+UINT                round;
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+pthread_t           host_threads[BENCHMARK_MAX_HOST_THREADS];
+UINT                threads;
+UINT                i;
+UINT                j;
+#endif
+
+
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+    printf("ThreadX block lock-free benchmark, lock-free available list, %d pairs per thread, best of %d rounds\n\n",
+           BENCHMARK_PAIRS, BENCHMARK_ROUNDS);
+#else
+    printf("ThreadX block lock-free benchmark, interrupts disabled, %d pairs per thread, best of %d rounds\n\n",
+           BENCHMARK_PAIRS, BENCHMARK_ROUNDS);
+#endif
+
+    /* Time the pairs from the ThreadX thread.  */
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        benchmark_pairs_run(BENCHMARK_PAIRS);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_PAIRS;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+    printf("%-32s %12.1f ns/pair\n", "ThreadX thread", best);
+
+#ifdef TX_BLOCK_POOL_LOCK_FREE
+
+    /* Time the pairs from several host threads at once.  The time per pair is the
+       elapsed time divided by the pairs of all threads.  */
+    for (i = 0; i < (sizeof(benchmark_host_threads) / sizeof(benchmark_host_threads[0])); i++)
+    {
+
+        threads =  benchmark_host_threads[i];
+        best =     0;
+        for (round = 0; round < BENCHMARK_ROUNDS; round++)
+        {
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (j = 0; j < threads; j++)
+            {
+                pthread_create(&host_threads[j], NULL, benchmark_host_thread_entry, NULL);
+            }
+            for (j = 0; j < threads; j++)
+            {
+                pthread_join(host_threads[j], NULL);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            ns =  benchmark_elapsed_ns(&start, &end) / ((double) BENCHMARK_PAIRS * threads);
+            if ((round == 0) || (ns < best))
+            {
+                best =  ns;
+            }
+        }
+        printf("%u %-30s %12.1f ns/pair\n", threads, (threads == 1) ? "host thread" : "host threads", best);
+    }
+#endif
+
+    /* Make sure no allocation failed and every block is back in the pool.  */
+    if ((benchmark_failures != 0) || (benchmark_pool.tx_block_pool_available != benchmark_pool.tx_block_pool_total))
+    {
+
+        printf("Unexpected pool state, %lu failures, %u of %u blocks available\n", (unsigned long) benchmark_failures,
+               benchmark_pool.tx_block_pool_available, benchmark_pool.tx_block_pool_total);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Allocate and release BENCHMARK_HOLD blocks at a time until the given number of pairs is done.  */
+
+void    benchmark_pairs_run(ULONG pairs)
+{
+
+VOID    *blocks[BENCHMARK_HOLD];
+ULONG   i;
+UINT    j;
+
+
+    for (i = 0; i < pairs; i = i + BENCHMARK_HOLD)
+    {
+
+        for (j = 0; j < BENCHMARK_HOLD; j++)
+        {
+            if (tx_block_allocate(&benchmark_pool, &blocks[j], TX_NO_WAIT) != TX_SUCCESS)
+            {
+                benchmark_failures++;
+                blocks[j] =  TX_NULL;
+            }
+        }
+        for (j = 0; j < BENCHMARK_HOLD; j++)
+        {
+            if (blocks[j] != TX_NULL)
+            {
+                tx_block_release(blocks[j]);
+            }
+        }
+    }
+}
+
+
+/* Define the host threads, which run the pairs outside of ThreadX.  */
+
+void    *benchmark_host_thread_entry(void *host_input)
+{
+
+    benchmark_pairs_run(BENCHMARK_PAIRS);
+    return(NULL);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
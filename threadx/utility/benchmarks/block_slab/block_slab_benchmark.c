@@ -0,0 +1,347 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Block Slab Benchmark                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark replays allocation traces against a two-level        */
+/*    segregated fit (TLSF) byte pool created with                        */
+/*    tx_byte_pool_tlsf_create and against a block slab created with      */
+/*    tx_block_slab_create in the same memory. Each trace is a fixed      */
+/*    sequence of allocations and releases over a set of slots, generated */
+/*    with a fixed seed, so both see exactly the same requests. Every     */
+/*    allocate and release call is timed on its own, which gives the      */
+/*    average and the worst case time of each, together with the number  */
+/*    of failed requests. The slab spills to the next larger class once a */
+/*    class is exhausted, and the number of spilled allocations is        */
+/*    reported as well, as returned by tx_block_slab_info_get.            */
+/*    The times include the cost of reading the host clock, and the       */
+/*    worst cases include host scheduling noise.                          */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_POOL_SIZE         (4 * 1024 * 1024)
+#define BENCHMARK_OPERATIONS        200000
+#define BENCHMARK_MAX_SLOTS         8000
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define a trace.  Each operation allocates the slot's memory if the slot is empty,
+   and releases it otherwise.  The slab of the trace has one class for each of its
+   block sizes.  */
+
+typedef struct BENCHMARK_TRACE_STRUCT
+{
+    const char      *benchmark_trace_name;
+    ULONG           benchmark_trace_slots;
+    ULONG           benchmark_trace_min_size;
+    ULONG           benchmark_trace_max_size;
+    ULONG           *benchmark_trace_slab_sizes;
+    UINT            benchmark_trace_slab_classes;
+} BENCHMARK_TRACE;
+
+ULONG           benchmark_small_slab_sizes[] =  { 32, 64, 128, 256 };
+ULONG           benchmark_mixed_slab_sizes[] =  { 64, 256, 1024, 4096, 16384 };
+
+BENCHMARK_TRACE benchmark_traces[] =
+{
+    { "small objects",  BENCHMARK_MAX_SLOTS,   16,   256, benchmark_small_slab_sizes, 4 },
+    { "mixed sizes",    2000,                  16, 16384, benchmark_mixed_slab_sizes, 5 },
+};
+
+
+/* Define the generated trace operations.  */
+
+ULONG           benchmark_slot[BENCHMARK_OPERATIONS];
+ULONG           benchmark_size[BENCHMARK_OPERATIONS];
+
+
+/* Define the benchmark thread, the pool, the slab, and the memory held by each slot.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_BYTE_POOL    benchmark_pool;
+TX_BLOCK_SLAB   benchmark_slab;
+ALIGN_TYPE      benchmark_pool_memory[BENCHMARK_POOL_SIZE / sizeof(ALIGN_TYPE)];
+VOID            *benchmark_memory[BENCHMARK_MAX_SLOTS];
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_trace_generate(BENCHMARK_TRACE *trace);
+void    benchmark_trace_replay(const char *back_end, ULONG slots, TX_BLOCK_SLAB *slab_ptr);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+ULONG   i;
+UINT    status;
+
+
+    printf("ThreadX block slab benchmark, %d operations per trace in %d bytes\n\n",
+           BENCHMARK_OPERATIONS, BENCHMARK_POOL_SIZE);
+    printf("%-28s %12s %12s %12s %12s %8s %8s\n", "", "ns/allocate", "max ns", "ns/release", "max ns",
+           "failed", "spilled");
+
+    for (i = 0; i < (sizeof(benchmark_traces) / sizeof(benchmark_traces[0])); i++)
+    {
+
+        benchmark_trace_generate(&benchmark_traces[i]);
+        printf("%s, %lu slots of %lu to %lu bytes\n", benchmark_traces[i].benchmark_trace_name,
+               (unsigned long) benchmark_traces[i].benchmark_trace_slots,
+               (unsigned long) benchmark_traces[i].benchmark_trace_min_size,
+               (unsigned long) benchmark_traces[i].benchmark_trace_max_size);
+
+        /* Replay the trace against a TLSF pool.  */
+        status =  tx_byte_pool_tlsf_create(&benchmark_pool, "benchmark pool", benchmark_pool_memory,
+                                           sizeof(benchmark_pool_memory));
+        if (status != TX_SUCCESS)
+        {
+            printf("tx_byte_pool_tlsf_create failed, status %u\n", status);
+            exit(1);
+        }
+        benchmark_trace_replay("  TLSF byte pool", benchmark_traces[i].benchmark_trace_slots, TX_NULL);
+        tx_byte_pool_delete(&benchmark_pool);
+
+        /* Replay the same trace against a block slab in the same memory, which spills
+           to the next larger class once a class is exhausted.  */
+        status =  tx_block_slab_create(&benchmark_slab, "benchmark slab", benchmark_traces[i].benchmark_trace_slab_sizes,
+                                       benchmark_traces[i].benchmark_trace_slab_classes,
+                                       benchmark_pool_memory, sizeof(benchmark_pool_memory), TX_BLOCK_SLAB_SPILL);
+        if (status != TX_SUCCESS)
+        {
+            printf("tx_block_slab_create failed, status %u\n", status);
+            exit(1);
+        }
+        benchmark_trace_replay("  block slab", benchmark_traces[i].benchmark_trace_slots, &benchmark_slab);
+        tx_block_slab_delete(&benchmark_slab);
+    }
+
+    exit(0);
+}
+
+
+/* Generate a trace with a fixed seed.  Sizes are spread evenly over the powers of two
+   between the minimum and the maximum size, so small requests are the most common.  */
+
+void    benchmark_trace_generate(BENCHMARK_TRACE *trace)
+{
+
+ULONG   i;
+ULONG   size;
+ULONG   limit;
+
+
+    srand(1);
+    for (i = 0; i < BENCHMARK_OPERATIONS; i++)
+    {
+
+        benchmark_slot[i] =  ((ULONG) rand()) % trace -> benchmark_trace_slots;
+
+        /* Pick a power of two range, then a size within it.  */
+        limit =  trace -> benchmark_trace_min_size;
+        while ((limit < trace -> benchmark_trace_max_size) && ((rand() % 2) == 0))
+        {
+            limit =  limit * 2;
+        }
+        if (limit > trace -> benchmark_trace_max_size)
+        {
+            limit =  trace -> benchmark_trace_max_size;
+        }
+        size =  limit / 2;
+        if (size < trace -> benchmark_trace_min_size)
+        {
+            size =  trace -> benchmark_trace_min_size;
+        }
+        benchmark_size[i] =  size + (((ULONG) rand()) % (limit - size + 1));
+    }
+}
+
+
+/* Replay the current trace against the benchmark slab if one is given, and against
+   the benchmark pool otherwise.  */
+
+void    benchmark_trace_replay(const char *back_end, ULONG slots, TX_BLOCK_SLAB *slab_ptr)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              allocate_ns;
+double              allocate_max_ns;
+double              release_ns;
+double              release_max_ns;
+ULONG               allocates;
+ULONG               releases;
+ULONG               failed;
+ULONG               spills;
+ULONG               slot;
+ULONG               i;
+UINT                status;
+
+
+    allocate_ns =      0;
+    allocate_max_ns =  0;
+    release_ns =       0;
+    release_max_ns =   0;
+    allocates =        0;
+    releases =         0;
+    failed =           0;
+    for (i = 0; i < slots; i++)
+    {
+        benchmark_memory[i] =  TX_NULL;
+    }
+
+    for (i = 0; i < BENCHMARK_OPERATIONS; i++)
+    {
+
+        slot =  benchmark_slot[i];
+        if (benchmark_memory[slot] == TX_NULL)
+        {
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            if (slab_ptr != TX_NULL)
+            {
+                status =  tx_block_slab_allocate(slab_ptr, &benchmark_memory[slot], benchmark_size[i], TX_NO_WAIT);
+            }
+            else
+            {
+                status =  tx_byte_allocate(&benchmark_pool, &benchmark_memory[slot], benchmark_size[i], TX_NO_WAIT);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            if (status != TX_SUCCESS)
+            {
+                benchmark_memory[slot] =  TX_NULL;
+                failed++;
+            }
+
+            ns =  benchmark_elapsed_ns(&start, &end);
+            allocate_ns =  allocate_ns + ns;
+            if (ns > allocate_max_ns)
+            {
+                allocate_max_ns =  ns;
+            }
+            allocates++;
+        }
+        else
+        {
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            if (slab_ptr != TX_NULL)
+            {
+                status =  tx_block_release(benchmark_memory[slot]);
+            }
+            else
+            {
+                status =  tx_byte_release(benchmark_memory[slot]);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            benchmark_memory[slot] =  TX_NULL;
+
+            if (status != TX_SUCCESS)
+            {
+                printf("%s release failed, status %u\n", back_end, status);
+                exit(1);
+            }
+
+            ns =  benchmark_elapsed_ns(&start, &end);
+            release_ns =  release_ns + ns;
+            if (ns > release_max_ns)
+            {
+                release_max_ns =  ns;
+            }
+            releases++;
+        }
+    }
+
+    /* The memory still held in a slab is released when the slab is deleted.  */
+    if (slab_ptr != TX_NULL)
+    {
+
+        /* Pickup the number of allocations taken from a larger class.  */
+        tx_block_slab_info_get(slab_ptr, TX_NULL, TX_NULL, &spills, TX_NULL);
+
+        printf("%-28s %12.1f %12.0f %12.1f %12.0f %8lu %8lu\n", back_end,
+               allocate_ns / allocates, allocate_max_ns, release_ns / releases, release_max_ns,
+               (unsigned long) failed, (unsigned long) spills);
+    }
+    else
+    {
+
+        /* Release the memory still held.  */
+        for (i = 0; i < slots; i++)
+        {
+            if (benchmark_memory[i] != TX_NULL)
+            {
+                tx_byte_release(benchmark_memory[i]);
+            }
+        }
+
+        printf("%-28s %12.1f %12.0f %12.1f %12.0f %8lu %8s\n", back_end,
+               allocate_ns / allocates, allocate_max_ns, release_ns / releases, release_max_ns,
+               (unsigned long) failed, "-");
+    }
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
@@ -0,0 +1,311 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Broadcast Benchmark                                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures a producer that hands each message to five  */
+/*    higher priority consumer threads. The queue producer sends a copy   */
+/*    of the message to the queue of each consumer, so every send wakes   */
+/*    one consumer and switches back. The broadcast producer publishes    */
+/*    the message once, which wakes all five subscribers in one pass.     */
+/*    The times are per message delivered to all consumers, and are the   */
+/*    best of several rounds.                                             */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_MESSAGES          10000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_CONSUMERS         5
+#define BENCHMARK_RING_MESSAGES     8
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the producer thread, and the queue and broadcast consumer threads with their objects.  */
+
+TX_THREAD               benchmark_producer;
+ULONG                   benchmark_producer_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_THREAD               benchmark_queue_consumer[BENCHMARK_CONSUMERS];
+ULONG                   benchmark_queue_consumer_stack[BENCHMARK_CONSUMERS][BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_THREAD               benchmark_broadcast_consumer[BENCHMARK_CONSUMERS];
+ULONG                   benchmark_broadcast_consumer_stack[BENCHMARK_CONSUMERS][BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_QUEUE                benchmark_queue[BENCHMARK_CONSUMERS];
+ULONG                   benchmark_queue_memory[BENCHMARK_CONSUMERS][BENCHMARK_RING_MESSAGES];
+TX_BROADCAST            benchmark_broadcast;
+ULONG                   benchmark_broadcast_memory[BENCHMARK_RING_MESSAGES];
+TX_BROADCAST_SUBSCRIBER benchmark_subscriber[BENCHMARK_CONSUMERS];
+
+
+/* Define the number of messages each consumer received and the number received out of
+   order or missed, which must stay zero.  */
+
+volatile ULONG  benchmark_queue_received[BENCHMARK_CONSUMERS];
+volatile ULONG  benchmark_broadcast_received[BENCHMARK_CONSUMERS];
+volatile ULONG  benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_producer_entry(ULONG thread_input);
+void    benchmark_queue_consumer_entry(ULONG thread_input);
+void    benchmark_broadcast_consumer_entry(ULONG thread_input);
+double  benchmark_queue_run(void);
+double  benchmark_broadcast_run(void);
+void    benchmark_received_check(volatile ULONG *received);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+UINT    i;
+
+
+    /* Create the producer, and the consumers at a higher priority.  */
+    tx_thread_create(&benchmark_producer, "benchmark producer", benchmark_producer_entry, 0,
+                     benchmark_producer_stack, sizeof(benchmark_producer_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the broadcast, where every consumer subscribes.  */
+    tx_broadcast_create(&benchmark_broadcast, "benchmark broadcast", TX_1_ULONG,
+                        benchmark_broadcast_memory, sizeof(benchmark_broadcast_memory), TX_BROADCAST_BLOCK);
+
+    for (i = 0; i < BENCHMARK_CONSUMERS; i++)
+    {
+        tx_queue_create(&benchmark_queue[i], "benchmark queue", TX_1_ULONG,
+                        benchmark_queue_memory[i], sizeof(benchmark_queue_memory[i]));
+        tx_broadcast_subscribe(&benchmark_broadcast, &benchmark_subscriber[i]);
+        tx_thread_create(&benchmark_queue_consumer[i], "benchmark queue consumer", benchmark_queue_consumer_entry, i,
+                         benchmark_queue_consumer_stack[i], sizeof(benchmark_queue_consumer_stack[i]),
+                         1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+        tx_thread_create(&benchmark_broadcast_consumer[i], "benchmark broadcast consumer", benchmark_broadcast_consumer_entry, i,
+                         benchmark_broadcast_consumer_stack[i], sizeof(benchmark_broadcast_consumer_stack[i]),
+                         1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    }
+}
+
+
+/* Define the producer thread.  */
+
+void    benchmark_producer_entry(ULONG thread_input)
+{
+
+double  queue_ns;
+double  broadcast_ns;
+
+
+    printf("ThreadX broadcast benchmark, %d consumers, %d messages per round, best of %d rounds\n\n",
+           BENCHMARK_CONSUMERS, BENCHMARK_MESSAGES, BENCHMARK_ROUNDS);
+
+    queue_ns =      benchmark_queue_run();
+    broadcast_ns =  benchmark_broadcast_run();
+
+    printf("%-36s %16s\n", "producer", "ns/message");
+    printf("%-36s %16.1f\n", "tx_queue_send to each consumer", queue_ns);
+    printf("%-36s %16.1f\n", "tx_broadcast_publish", broadcast_ns);
+    printf("\nThe broadcast takes %.2fx the time of the queues\n", broadcast_ns / queue_ns);
+
+    /* Make sure every message was received in order.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected messages, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Define the consumer that receives from its own queue.  */
+
+void    benchmark_queue_consumer_entry(ULONG thread_input)
+{
+
+ULONG   message;
+
+
+    while (1)
+    {
+
+        tx_queue_receive(&benchmark_queue[thread_input], &message, TX_WAIT_FOREVER);
+
+        if (message != benchmark_queue_received[thread_input])
+        {
+            benchmark_failures++;
+        }
+        benchmark_queue_received[thread_input]++;
+    }
+}
+
+
+/* Define the consumer that receives from its broadcast subscriber.  */
+
+void    benchmark_broadcast_consumer_entry(ULONG thread_input)
+{
+
+ULONG   message;
+ULONG   missed;
+
+
+    while (1)
+    {
+
+        tx_broadcast_receive(&benchmark_subscriber[thread_input], &message, &missed, TX_WAIT_FOREVER);
+
+        if ((message != benchmark_broadcast_received[thread_input]) || (missed != 0))
+        {
+            benchmark_failures++;
+        }
+        benchmark_broadcast_received[thread_input]++;
+    }
+}
+
+
+/* Send BENCHMARK_MESSAGES messages to the queue of every consumer, and return the best
+   time per message.  */
+
+double  benchmark_queue_run(void)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message;
+UINT                round;
+ULONG               i;
+UINT                j;
+
+
+    best =  0;
+    message =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            for (j = 0; j < BENCHMARK_CONSUMERS; j++)
+            {
+                tx_queue_send(&benchmark_queue[j], &message, TX_NO_WAIT);
+            }
+            message++;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    benchmark_received_check(benchmark_queue_received);
+    return(best);
+}
+
+
+/* Publish BENCHMARK_MESSAGES messages to the broadcast, and return the best time per
+   message.  */
+
+double  benchmark_broadcast_run(void)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message;
+UINT                round;
+ULONG               i;
+
+
+    best =  0;
+    message =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            tx_broadcast_publish(&benchmark_broadcast, &message, TX_NO_WAIT);
+            message++;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    benchmark_received_check(benchmark_broadcast_received);
+    return(best);
+}
+
+
+/* Make sure every consumer received every message.  */
+
+void    benchmark_received_check(volatile ULONG *received)
+{
+
+UINT    i;
+
+
+    for (i = 0; i < BENCHMARK_CONSUMERS; i++)
+    {
+        if (received[i] != (BENCHMARK_ROUNDS * BENCHMARK_MESSAGES))
+        {
+            benchmark_failures++;
+        }
+    }
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
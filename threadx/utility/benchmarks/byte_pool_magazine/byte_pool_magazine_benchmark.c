@@ -0,0 +1,247 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**                                                                       */
+/**   Byte Pool Magazine Benchmark                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures small allocations from a byte pool with and */
+/*    without a magazine for the allocating thread. A fixed sequence of   */
+/*    allocations and releases of 16 to 256 bytes over a set of slots is  */
+/*    replayed against a first-fit pool and a TLSF pool, each once        */
+/*    without and once with a magazine created with                       */
+/*    tx_byte_pool_magazine_create. The whole replay is timed, so the     */
+/*    result is the average time of one tx_byte_allocate or               */
+/*    tx_byte_release call without the cost of reading the host clock.    */
+/*    The magazine hits and misses are read back with                     */
+/*    tx_byte_pool_magazine_info_get.                                     */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_POOL_SIZE         (4 * 1024 * 1024)
+#define BENCHMARK_OPERATIONS        1000000
+#define BENCHMARK_MIN_SIZE          16
+#define BENCHMARK_MAX_SIZE          256
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_MAX_SLOTS         4096
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the slot counts of the traces.  Few slots keep the pool nearly empty, many
+   slots fragment it.  */
+
+ULONG           benchmark_slot_counts[] =  { 64, BENCHMARK_MAX_SLOTS };
+
+
+/* Define the generated trace operations.  Each operation allocates the slot's memory
+   if the slot is empty, and releases it otherwise.  */
+
+USHORT          benchmark_slot[BENCHMARK_OPERATIONS];
+USHORT          benchmark_size[BENCHMARK_OPERATIONS];
+
+
+/* Define the benchmark thread, the pool, its magazine, and the memory held by each slot.  */
+
+TX_THREAD               benchmark_thread;
+ULONG                   benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_BYTE_POOL            benchmark_pool;
+TX_BYTE_POOL_MAGAZINE   benchmark_magazine;
+ALIGN_TYPE              benchmark_pool_memory[BENCHMARK_POOL_SIZE / sizeof(ALIGN_TYPE)];
+VOID                    *benchmark_memory[BENCHMARK_MAX_SLOTS];
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_trace_generate(ULONG slots);
+void    benchmark_trace_replay(const char *name, UINT tlsf, UINT magazine, ULONG slots);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+ULONG   i;
+
+
+    printf("ThreadX byte pool magazine benchmark, %d operations of %d to %d bytes, best of %d rounds\n\n",
+           BENCHMARK_OPERATIONS, BENCHMARK_MIN_SIZE, BENCHMARK_MAX_SIZE, BENCHMARK_ROUNDS);
+    printf("%-28s %12s %12s %12s %8s\n", "", "ns/call", "hits", "misses", "failed");
+
+    for (i = 0; i < (sizeof(benchmark_slot_counts) / sizeof(benchmark_slot_counts[0])); i++)
+    {
+
+        benchmark_trace_generate(benchmark_slot_counts[i]);
+        printf("%lu slots\n", (unsigned long) benchmark_slot_counts[i]);
+
+        benchmark_trace_replay("  first fit", TX_FALSE, TX_FALSE, benchmark_slot_counts[i]);
+        benchmark_trace_replay("  first fit, magazine", TX_FALSE, TX_TRUE, benchmark_slot_counts[i]);
+        benchmark_trace_replay("  TLSF", TX_TRUE, TX_FALSE, benchmark_slot_counts[i]);
+        benchmark_trace_replay("  TLSF, magazine", TX_TRUE, TX_TRUE, benchmark_slot_counts[i]);
+    }
+
+    exit(0);
+}
+
+
+/* Generate a trace with a fixed seed.  */
+
+void    benchmark_trace_generate(ULONG slots)
+{
+
+ULONG   i;
+
+
+    srand(1);
+    for (i = 0; i < BENCHMARK_OPERATIONS; i++)
+    {
+
+        benchmark_slot[i] =  (USHORT) (((ULONG) rand()) % slots);
+        benchmark_size[i] =  (USHORT) (BENCHMARK_MIN_SIZE + (((ULONG) rand()) % (BENCHMARK_MAX_SIZE - BENCHMARK_MIN_SIZE + 1)));
+    }
+}
+
+
+/* Replay the current trace against a new pool, optionally with a magazine for the
+   benchmark thread.  */
+
+void    benchmark_trace_replay(const char *name, UINT tlsf, UINT magazine, ULONG slots)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               hits;
+ULONG               misses;
+ULONG               failed;
+ULONG               slot;
+ULONG               i;
+UINT                round;
+
+
+    best =    0;
+    hits =    0;
+    misses =  0;
+    failed =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        /* Create the pool and the magazine.  */
+        if (tlsf == TX_TRUE)
+        {
+            tx_byte_pool_tlsf_create(&benchmark_pool, "benchmark pool", benchmark_pool_memory, sizeof(benchmark_pool_memory));
+        }
+        else
+        {
+            tx_byte_pool_create(&benchmark_pool, "benchmark pool", benchmark_pool_memory, sizeof(benchmark_pool_memory));
+        }
+        if (magazine == TX_TRUE)
+        {
+            tx_byte_pool_magazine_create(&benchmark_pool, &benchmark_magazine, &benchmark_thread);
+        }
+        for (i = 0; i < slots; i++)
+        {
+            benchmark_memory[i] =  TX_NULL;
+        }
+
+        failed =  0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_OPERATIONS; i++)
+        {
+
+            slot =  benchmark_slot[i];
+            if (benchmark_memory[slot] == TX_NULL)
+            {
+
+                if (tx_byte_allocate(&benchmark_pool, &benchmark_memory[slot], benchmark_size[i], TX_NO_WAIT) != TX_SUCCESS)
+                {
+                    benchmark_memory[slot] =  TX_NULL;
+                    failed++;
+                }
+            }
+            else
+            {
+
+                tx_byte_release(benchmark_memory[slot]);
+                benchmark_memory[slot] =  TX_NULL;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_OPERATIONS;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+
+        /* Read the magazine counts, and delete the magazine and the pool.  */
+        tx_byte_pool_magazine_info_get(&benchmark_pool, &hits, &misses);
+        if (magazine == TX_TRUE)
+        {
+            tx_byte_pool_magazine_delete(&benchmark_magazine);
+        }
+        tx_byte_pool_delete(&benchmark_pool);
+    }
+
+    printf("%-28s %12.1f %12lu %12lu %8lu\n", name, best, (unsigned long) hits, (unsigned long) misses, (unsigned long) failed);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
@@ -0,0 +1,295 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Byte Pool TLSF Benchmark                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark replays allocation traces against a first-fit byte   */
+/*    pool created with tx_byte_pool_create and a two-level segregated    */
+/*    fit (TLSF) byte pool created with tx_byte_pool_tlsf_create. Each    */
+/*    trace is a fixed sequence of allocations and releases over a set    */
+/*    of slots, generated with a fixed seed, so both pools see exactly    */
+/*    the same requests. Every tx_byte_allocate and tx_byte_release call  */
+/*    is timed on its own, which gives the average and the worst case     */
+/*    time of each, together with the number of fragments, the largest    */
+/*    free block, and the external fragmentation the pool had at the end  */
+/*    of the trace, as reported by tx_byte_pool_fragmentation_info_get.   */
+/*    The times include the cost of reading the host clock, and the       */
+/*    worst cases include host scheduling noise.                          */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_POOL_SIZE         (4 * 1024 * 1024)
+#define BENCHMARK_OPERATIONS        200000
+#define BENCHMARK_MAX_SLOTS         8000
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define a trace.  Each operation allocates the slot's memory if the slot is empty,
+   and releases it otherwise.  */
+
+typedef struct BENCHMARK_TRACE_STRUCT
+{
+    const char      *benchmark_trace_name;
+    ULONG           benchmark_trace_slots;
+    ULONG           benchmark_trace_min_size;
+    ULONG           benchmark_trace_max_size;
+} BENCHMARK_TRACE;
+
+BENCHMARK_TRACE benchmark_traces[] =
+{
+    { "small objects",  BENCHMARK_MAX_SLOTS,   16,   256 },
+    { "mixed sizes",    2000,                  16, 16384 },
+};
+
+
+/* Define the generated trace operations.  */
+
+ULONG           benchmark_slot[BENCHMARK_OPERATIONS];
+ULONG           benchmark_size[BENCHMARK_OPERATIONS];
+
+
+/* Define the benchmark thread, the pools, and the memory held by each slot.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_BYTE_POOL    benchmark_pool;
+ALIGN_TYPE      benchmark_pool_memory[BENCHMARK_POOL_SIZE / sizeof(ALIGN_TYPE)];
+VOID            *benchmark_memory[BENCHMARK_MAX_SLOTS];
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_trace_generate(BENCHMARK_TRACE *trace);
+void    benchmark_trace_replay(const char *back_end, ULONG slots);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+ULONG   i;
+
+
+    printf("ThreadX byte pool benchmark, %d operations per trace on a %d byte pool\n\n",
+           BENCHMARK_OPERATIONS, BENCHMARK_POOL_SIZE);
+    printf("%-28s %12s %12s %12s %12s %10s %12s %6s %8s\n", "", "ns/allocate", "max ns", "ns/release", "max ns", "fragments",
+           "largest free", "frag %", "failed");
+
+    for (i = 0; i < (sizeof(benchmark_traces) / sizeof(benchmark_traces[0])); i++)
+    {
+
+        benchmark_trace_generate(&benchmark_traces[i]);
+        printf("%s, %lu slots of %lu to %lu bytes\n", benchmark_traces[i].benchmark_trace_name,
+               (unsigned long) benchmark_traces[i].benchmark_trace_slots,
+               (unsigned long) benchmark_traces[i].benchmark_trace_min_size,
+               (unsigned long) benchmark_traces[i].benchmark_trace_max_size);
+
+        /* Replay the trace against a first-fit pool.  */
+        tx_byte_pool_create(&benchmark_pool, "benchmark pool", benchmark_pool_memory, sizeof(benchmark_pool_memory));
+        benchmark_trace_replay("  first fit", benchmark_traces[i].benchmark_trace_slots);
+        tx_byte_pool_delete(&benchmark_pool);
+
+        /* Replay the same trace against a TLSF pool.  */
+        tx_byte_pool_tlsf_create(&benchmark_pool, "benchmark pool", benchmark_pool_memory, sizeof(benchmark_pool_memory));
+        benchmark_trace_replay("  TLSF", benchmark_traces[i].benchmark_trace_slots);
+        tx_byte_pool_delete(&benchmark_pool);
+    }
+
+    exit(0);
+}
+
+
+/* Generate a trace with a fixed seed.  Sizes are spread evenly over the powers of two
+   between the minimum and the maximum size, so small requests are the most common.  */
+
+void    benchmark_trace_generate(BENCHMARK_TRACE *trace)
+{
+
+ULONG   i;
+ULONG   size;
+ULONG   limit;
+
+
+    srand(1);
+    for (i = 0; i < BENCHMARK_OPERATIONS; i++)
+    {
+
+        benchmark_slot[i] =  ((ULONG) rand()) % trace -> benchmark_trace_slots;
+
+        /* Pick a power of two range, then a size within it.  */
+        limit =  trace -> benchmark_trace_min_size;
+        while ((limit < trace -> benchmark_trace_max_size) && ((rand() % 2) == 0))
+        {
+            limit =  limit * 2;
+        }
+        if (limit > trace -> benchmark_trace_max_size)
+        {
+            limit =  trace -> benchmark_trace_max_size;
+        }
+        size =  limit / 2;
+        if (size < trace -> benchmark_trace_min_size)
+        {
+            size =  trace -> benchmark_trace_min_size;
+        }
+        benchmark_size[i] =  size + (((ULONG) rand()) % (limit - size + 1));
+    }
+}
+
+
+/* Replay the current trace against the benchmark pool.  */
+
+void    benchmark_trace_replay(const char *back_end, ULONG slots)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              allocate_ns;
+double              allocate_max_ns;
+double              release_ns;
+double              release_max_ns;
+ULONG               allocates;
+ULONG               releases;
+ULONG               failed;
+ULONG               fragments;
+ULONG               largest_free;
+ULONG               fragmentation;
+ULONG               slot;
+ULONG               i;
+UINT                status;
+
+
+    allocate_ns =      0;
+    allocate_max_ns =  0;
+    release_ns =       0;
+    release_max_ns =   0;
+    allocates =        0;
+    releases =         0;
+    failed =           0;
+    for (i = 0; i < slots; i++)
+    {
+        benchmark_memory[i] =  TX_NULL;
+    }
+
+    for (i = 0; i < BENCHMARK_OPERATIONS; i++)
+    {
+
+        slot =  benchmark_slot[i];
+        if (benchmark_memory[slot] == TX_NULL)
+        {
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            status =  tx_byte_allocate(&benchmark_pool, &benchmark_memory[slot], benchmark_size[i], TX_NO_WAIT);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            if (status != TX_SUCCESS)
+            {
+                benchmark_memory[slot] =  TX_NULL;
+                failed++;
+            }
+
+            ns =  benchmark_elapsed_ns(&start, &end);
+            allocate_ns =  allocate_ns + ns;
+            if (ns > allocate_max_ns)
+            {
+                allocate_max_ns =  ns;
+            }
+            allocates++;
+        }
+        else
+        {
+
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            tx_byte_release(benchmark_memory[slot]);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            benchmark_memory[slot] =  TX_NULL;
+
+            ns =  benchmark_elapsed_ns(&start, &end);
+            release_ns =  release_ns + ns;
+            if (ns > release_max_ns)
+            {
+                release_max_ns =  ns;
+            }
+            releases++;
+        }
+    }
+
+    /* Pickup the number of fragments at the end of the trace.  */
+    tx_byte_pool_info_get(&benchmark_pool, TX_NULL, TX_NULL, &fragments, TX_NULL, TX_NULL, TX_NULL);
+    tx_byte_pool_fragmentation_info_get(&benchmark_pool, &largest_free, TX_NULL, TX_NULL, &fragmentation);
+
+    /* Release the memory still held.  */
+    for (i = 0; i < slots; i++)
+    {
+        if (benchmark_memory[i] != TX_NULL)
+        {
+            tx_byte_release(benchmark_memory[i]);
+        }
+    }
+
+    printf("%-28s %12.1f %12.0f %12.1f %12.0f %10lu %12lu %6lu %8lu\n", back_end,
+           allocate_ns / allocates, allocate_max_ns, release_ns / releases, release_max_ns,
+           (unsigned long) fragments, (unsigned long) largest_free, (unsigned long) fragmentation,
+           (unsigned long) failed);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
@@ -0,0 +1,315 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Byte Queue Benchmark                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark compares a TX_QUEUE of TX_16_ULONG messages with a   */
+/*    TX_BYTE_QUEUE built on the same amount of memory, for a stream of   */
+/*    messages whose sizes are spread evenly from 4 to 64 bytes. It       */
+/*    reports how many messages each queue holds when it is full, the     */
+/*    share of its memory that holds message bytes, and the cost of a     */
+/*    send and receive pair. The times are the best of several rounds.    */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_MESSAGES          1000000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_QUEUE_BYTES       4096
+#define BENCHMARK_MINIMUM_SIZE      4
+#define BENCHMARK_MAXIMUM_SIZE      64
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the benchmark thread and the two queues, which are given the same amount of memory.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_QUEUE        benchmark_queue;
+ULONG           benchmark_queue_memory[BENCHMARK_QUEUE_BYTES / sizeof(ULONG)];
+TX_BYTE_QUEUE   benchmark_byte_queue;
+ULONG           benchmark_byte_queue_memory[BENCHMARK_QUEUE_BYTES / sizeof(ULONG)];
+
+
+/* Define the number of messages that were not received intact, which must stay zero.  */
+
+volatile ULONG  benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+ULONG   benchmark_size(ULONG i);
+ULONG   benchmark_queue_fill(ULONG *bytes);
+ULONG   benchmark_byte_queue_fill(ULONG *bytes);
+double  benchmark_queue_pairs_run(VOID);
+double  benchmark_byte_queue_pairs_run(VOID);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the two queues.  */
+    tx_queue_create(&benchmark_queue, "benchmark queue", TX_16_ULONG,
+                    benchmark_queue_memory, sizeof(benchmark_queue_memory));
+    tx_byte_queue_create(&benchmark_byte_queue, "benchmark byte queue",
+                         benchmark_byte_queue_memory, sizeof(benchmark_byte_queue_memory));
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+ULONG   queue_messages;
+ULONG   queue_bytes;
+ULONG   byte_queue_messages;
+ULONG   byte_queue_bytes;
+double  queue_ns;
+double  byte_queue_ns;
+
+
+    printf("ThreadX byte queue benchmark, %d byte queues, %d to %d byte messages, %d messages per round, best of %d rounds\n\n",
+           BENCHMARK_QUEUE_BYTES, BENCHMARK_MINIMUM_SIZE, BENCHMARK_MAXIMUM_SIZE, BENCHMARK_MESSAGES, BENCHMARK_ROUNDS);
+
+    queue_messages =       benchmark_queue_fill(&queue_bytes);
+    byte_queue_messages =  benchmark_byte_queue_fill(&byte_queue_bytes);
+    queue_ns =             benchmark_queue_pairs_run();
+    byte_queue_ns =        benchmark_byte_queue_pairs_run();
+
+    printf("%-14s %16s %16s %22s\n", "queue", "messages held", "memory used %", "send+receive ns/pair");
+    printf("%-14s %16lu %16.1f %22.1f\n", "TX_QUEUE", (unsigned long) queue_messages,
+           (100.0 * (double) queue_bytes) / BENCHMARK_QUEUE_BYTES, queue_ns);
+    printf("%-14s %16lu %16.1f %22.1f\n", "TX_BYTE_QUEUE", (unsigned long) byte_queue_messages,
+           (100.0 * (double) byte_queue_bytes) / BENCHMARK_QUEUE_BYTES, byte_queue_ns);
+    printf("\nThe byte queue holds %.2fx as many messages\n", (double) byte_queue_messages / (double) queue_messages);
+
+    /* Make sure every message was received intact.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected message contents, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Return the size of message i, spread evenly from BENCHMARK_MINIMUM_SIZE to
+   BENCHMARK_MAXIMUM_SIZE bytes.  */
+
+ULONG   benchmark_size(ULONG i)
+{
+
+    return(BENCHMARK_MINIMUM_SIZE + ((i * 37) % (BENCHMARK_MAXIMUM_SIZE - BENCHMARK_MINIMUM_SIZE + 1)));
+}
+
+
+/* Fill the queue until it is full, return the number of messages it holds and the
+   number of message bytes in them, and empty it again.  */
+
+ULONG   benchmark_queue_fill(ULONG *bytes)
+{
+
+ULONG   message[TX_16_ULONG];
+ULONG   messages;
+
+
+    memset(message, 0, sizeof(message));
+    messages =  0;
+    *bytes =    0;
+    while (tx_queue_send(&benchmark_queue, message, TX_NO_WAIT) == TX_SUCCESS)
+    {
+        *bytes =  *bytes + benchmark_size(messages);
+        messages++;
+    }
+    tx_queue_flush(&benchmark_queue);
+
+    return(messages);
+}
+
+
+/* Fill the byte queue until it is full, return the number of messages it holds and the
+   number of message bytes in them, and empty it again.  */
+
+ULONG   benchmark_byte_queue_fill(ULONG *bytes)
+{
+
+UCHAR   message[BENCHMARK_MAXIMUM_SIZE];
+ULONG   messages;
+
+
+    memset(message, 0, sizeof(message));
+    messages =  0;
+    *bytes =    0;
+    while (tx_byte_queue_send(&benchmark_byte_queue, message, benchmark_size(messages), TX_NO_WAIT) == TX_SUCCESS)
+    {
+        *bytes =  *bytes + benchmark_size(messages);
+        messages++;
+    }
+    tx_byte_queue_flush(&benchmark_byte_queue);
+
+    return(messages);
+}
+
+
+/* Send and receive BENCHMARK_MESSAGES messages through the queue one at a time, and
+   return the best time per pair.  */
+
+double  benchmark_queue_pairs_run(VOID)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_16_ULONG];
+ULONG               received[TX_16_ULONG];
+UINT                round;
+ULONG               i;
+
+
+    for (i = 0; i < TX_16_ULONG; i++)
+    {
+        message[i] =   i + 1;
+        received[i] =  0;
+    }
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            tx_queue_send(&benchmark_queue, message, TX_NO_WAIT);
+            tx_queue_receive(&benchmark_queue, received, TX_NO_WAIT);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    /* Make sure the last message was received intact.  */
+    if (memcmp(received, message, sizeof(message)) != 0)
+    {
+        benchmark_failures++;
+    }
+
+    return(best);
+}
+
+
+/* Send and receive BENCHMARK_MESSAGES messages of mixed sizes through the byte queue one
+   at a time, and return the best time per pair.  */
+
+double  benchmark_byte_queue_pairs_run(VOID)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+UCHAR               message[BENCHMARK_MAXIMUM_SIZE];
+UCHAR               received[BENCHMARK_MAXIMUM_SIZE];
+ULONG               actual_size;
+ULONG               size;
+UINT                round;
+ULONG               i;
+
+
+    for (i = 0; i < BENCHMARK_MAXIMUM_SIZE; i++)
+    {
+        message[i] =   (UCHAR) (i + 1);
+        received[i] =  0;
+    }
+
+    best =  0;
+    size =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            size =  benchmark_size(i);
+            tx_byte_queue_send(&benchmark_byte_queue, message, size, TX_NO_WAIT);
+            tx_byte_queue_receive(&benchmark_byte_queue, received, sizeof(received), &actual_size, TX_NO_WAIT);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    /* Make sure the last message was received intact.  */
+    if ((actual_size != size) || (memcmp(received, message, size) != 0))
+    {
+        benchmark_failures++;
+    }
+
+    return(best);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
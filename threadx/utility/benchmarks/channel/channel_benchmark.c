@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Channel Benchmark                                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark compares a TX_QUEUE with a TX_CHANNEL for passing    */
+/*    TX_4_ULONG samples with TX_NO_WAIT, the way an ISR hands samples    */
+/*    to a thread.  It reports the cost of a send and receive pair.  The  */
+/*    queue disables interrupts in both services, while the channel does  */
+/*    not as long as its consumer is not waiting.  The times are the best */
+/*    of several rounds.                                                  */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_MESSAGES          1000000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_QUEUE_MESSAGES    64
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the benchmark thread, the queue, and the channel.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_QUEUE        benchmark_queue;
+ULONG           benchmark_queue_memory[BENCHMARK_QUEUE_MESSAGES * TX_4_ULONG];
+TX_CHANNEL      benchmark_channel;
+ULONG           benchmark_channel_memory[BENCHMARK_QUEUE_MESSAGES * TX_4_ULONG];
+
+
+/* Define the number of messages that were not received intact, which must stay zero.  */
+
+volatile ULONG  benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+double  benchmark_pairs_run(UINT channel);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the queue and the channel.  */
+    tx_queue_create(&benchmark_queue, "benchmark queue", TX_4_ULONG,
+                    benchmark_queue_memory, sizeof(benchmark_queue_memory));
+    tx_channel_create(&benchmark_channel, "benchmark channel", TX_4_ULONG,
+                      benchmark_channel_memory, sizeof(benchmark_channel_memory));
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+double  queue_ns;
+double  channel_ns;
+
+
+    printf("ThreadX channel benchmark, TX_4_ULONG messages, %d messages per round, best of %d rounds\n\n",
+           BENCHMARK_MESSAGES, BENCHMARK_ROUNDS);
+
+    queue_ns =    benchmark_pairs_run(TX_FALSE);
+    channel_ns =  benchmark_pairs_run(TX_TRUE);
+
+    printf("%-12s %22s\n", "object", "send+receive ns/pair");
+    printf("%-12s %22.1f\n", "TX_QUEUE", queue_ns);
+    printf("%-12s %22.1f\n", "TX_CHANNEL", channel_ns);
+    printf("\nThe channel pair takes %.2fx the time of the queue pair\n", channel_ns / queue_ns);
+
+    /* Make sure every message was received intact.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected message contents, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Send and receive BENCHMARK_MESSAGES messages through the queue or the channel one at a
+   time, and return the best time per pair.  */
+
+double  benchmark_pairs_run(UINT channel)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_4_ULONG];
+ULONG               received[TX_4_ULONG];
+UINT                round;
+ULONG               i;
+
+
+    for (i = 0; i < TX_4_ULONG; i++)
+    {
+        received[i] =  0;
+    }
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            message[0] =  i;
+            if (channel == TX_TRUE)
+            {
+                tx_channel_send(&benchmark_channel, message);
+                tx_channel_receive(&benchmark_channel, received, TX_NO_WAIT);
+            }
+            else
+            {
+                tx_queue_send(&benchmark_queue, message, TX_NO_WAIT);
+                tx_queue_receive(&benchmark_queue, received, TX_NO_WAIT);
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    /* Make sure the last message was received intact.  */
+    if (received[0] != (BENCHMARK_MESSAGES - 1))
+    {
+        benchmark_failures++;
+    }
+
+    return(best);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
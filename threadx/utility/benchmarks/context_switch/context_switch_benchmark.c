@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Context Switch Benchmark                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the cost of a ThreadX context switch on the */
+/*    host port it is built with. Two threads of the same priority hand   */
+/*    the processor back and forth with tx_thread_relinquish, so every    */
+/*    relinquish call performs exactly one switch.                        */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_SWITCHES          100000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the benchmark threads.  */
+
+TX_THREAD       benchmark_thread_0;
+TX_THREAD       benchmark_thread_1;
+ULONG           benchmark_thread_0_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+ULONG           benchmark_thread_1_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+
+
+/* Define the counter the partner thread increments on every switch.  */
+
+volatile ULONG  benchmark_partner_switches;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_0_entry(ULONG thread_input);
+void    benchmark_thread_1_entry(ULONG thread_input);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the two threads at the same priority without time-slicing, so that only
+       tx_thread_relinquish moves the processor between them.  */
+    tx_thread_create(&benchmark_thread_0, "benchmark thread 0", benchmark_thread_0_entry, 0,
+                     benchmark_thread_0_stack, sizeof(benchmark_thread_0_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    tx_thread_create(&benchmark_thread_1, "benchmark thread 1", benchmark_thread_1_entry, 0,
+                     benchmark_thread_1_stack, sizeof(benchmark_thread_1_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the measuring thread.  */
+
+void    benchmark_thread_0_entry(ULONG thread_input)
+{
+
+struct timespec     start;
+struct timespec     end;
+UINT                round;
+ULONG               i;
+double              ns;
+double              best;
+
+
+    printf("ThreadX context switch benchmark, %d switches per round, best of %d rounds\n\n",
+           BENCHMARK_SWITCHES, BENCHMARK_ROUNDS);
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        benchmark_partner_switches =  0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_SWITCHES / 2; i++)
+        {
+
+            tx_thread_relinquish();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        /* Make sure the partner really ran once for each relinquish.  */
+        if (benchmark_partner_switches != BENCHMARK_SWITCHES / 2)
+        {
+
+            printf("Unexpected partner switch count %lu\n", (unsigned long) benchmark_partner_switches);
+            exit(1);
+        }
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_SWITCHES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    printf("%-40s %8.1f ns/switch\n", "tx_thread_relinquish", best);
+
+    exit(0);
+}
+
+
+/* Define the partner thread, it hands the processor straight back.  */
+
+void    benchmark_thread_1_entry(ULONG thread_input)
+{
+
+    while(1)
+    {
+
+        benchmark_partner_switches++;
+        tx_thread_relinquish();
+    }
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
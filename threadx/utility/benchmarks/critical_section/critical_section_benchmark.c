@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Critical Section Benchmark                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the cost of the TX_DISABLE/TX_RESTORE pair  */
+/*    used by every kernel service, both as an outer lockout and nested   */
+/*    inside another lockout. On the Linux port the pair obtains and      */
+/*    releases the port critical section.                                 */
+/*                                                                        */
+/*    The benchmark is built twice: critical_section_benchmark uses the   */
+/*    futex based critical section, and critical_section_mutex_benchmark  */
+/*    is linked against a library built with                              */
+/*    TX_LINUX_CRITICAL_SECTION_MUTEX, which uses a pthread mutex as      */
+/*    before the futex was added.                                         */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_ITERATIONS        1000000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the benchmark thread.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+
+
+/* Define the name of the critical section configuration under test.  */
+
+#ifdef TX_LINUX_CRITICAL_SECTION_MUTEX
+#define BENCHMARK_CONFIGURATION     "pthread mutex critical section"
+#else
+#define BENCHMARK_CONFIGURATION     "futex critical section"
+#endif
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+double  benchmark_disable_restore(void);
+double  benchmark_nested_disable_restore(void);
+void    benchmark_report(const char *name, double (*measure)(void));
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  The measurements are taken from a ThreadX
+       thread, since that is where the kernel services are called from.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+    printf("ThreadX critical section benchmark, %s, %d iterations per round, best of %d rounds\n\n",
+           BENCHMARK_CONFIGURATION, BENCHMARK_ITERATIONS, BENCHMARK_ROUNDS);
+
+    benchmark_report("TX_DISABLE/TX_RESTORE", benchmark_disable_restore);
+    benchmark_report("nested TX_DISABLE/TX_RESTORE", benchmark_nested_disable_restore);
+
+    exit(0);
+}
+
+
+/* Run a measurement several times and report the fastest round, which is the
+   one least disturbed by the simulated timer interrupt and the host.  */
+
+void    benchmark_report(const char *name, double (*measure)(void))
+{
+
+UINT    round;
+double  best;
+double  ns;
+
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        ns =  measure();
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    printf("%-40s %8.1f ns/pair\n", name, best);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
+
+
+double  benchmark_disable_restore(void)
+{
+
+TX_INTERRUPT_SAVE_AREA
+struct timespec     start;
+struct timespec     end;
+ULONG               i;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_ITERATIONS; i++)
+    {
+
+        TX_DISABLE
+        TX_RESTORE
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return(benchmark_elapsed_ns(&start, &end) / BENCHMARK_ITERATIONS);
+}
+
+
+double  benchmark_nested_disable_restore(void)
+{
+
+TX_INTERRUPT_SAVE_AREA
+UINT                outer_posture;
+struct timespec     start;
+struct timespec     end;
+ULONG               i;
+
+
+    outer_posture =  tx_interrupt_control(TX_INT_DISABLE);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_ITERATIONS; i++)
+    {
+
+        TX_DISABLE
+        TX_RESTORE
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    tx_interrupt_control(outer_posture);
+
+    return(benchmark_elapsed_ns(&start, &end) / BENCHMARK_ITERATIONS);
+}
+
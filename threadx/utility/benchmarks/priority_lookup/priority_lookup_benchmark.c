@@ -0,0 +1,218 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Priority Lookup Benchmark                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the scheduler's search for the highest      */
+/*    ready priority as the number of priorities in use grows. A thread   */
+/*    at priority 0 is resumed by the benchmark thread and suspends       */
+/*    itself right away, so every round trip searches the ready priority  */
+/*    bit maps for the benchmark thread, whose priority is moved to the   */
+/*    last of 32, 64, ... priorities up to TX_MAX_PRIORITIES. The lowest  */
+/*    set bit calculation that the search is built on is also timed on    */
+/*    its own. Build with TX_MAX_PRIORITIES defined as 1024 to sweep the  */
+/*    full range, and with TX_DISABLE_LOWEST_SET_BIT_INTRINSIC to compare */
+/*    against the generic bit search.                                     */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_ROUND_TRIPS       100000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_MAPS              4096
+#define BENCHMARK_SEARCHES          10000000
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the benchmark threads.  */
+
+TX_THREAD       benchmark_thread;
+TX_THREAD       benchmark_partner_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+ULONG           benchmark_partner_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+
+
+/* Define the counter the partner thread increments each time it runs.  */
+
+volatile ULONG  benchmark_partner_runs;
+
+
+/* Define the bit maps searched by the lowest set bit calculation, and the sum of the
+   results, which keeps the compiler from dropping the searches.  */
+
+ULONG           benchmark_maps[BENCHMARK_MAPS];
+volatile ULONG  benchmark_bit_sum;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_partner_thread_entry(ULONG thread_input);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread, its priority is changed for each priority count.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the partner thread at the highest priority. It is resumed by the benchmark
+       thread once it has suspended itself.  */
+    tx_thread_create(&benchmark_partner_thread, "benchmark partner thread", benchmark_partner_thread_entry, 0,
+                     benchmark_partner_thread_stack, sizeof(benchmark_partner_thread_stack),
+                     0, 0, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the measuring thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+struct timespec     start;
+struct timespec     end;
+UINT                priorities;
+UINT                old_priority;
+UINT                round;
+ULONG               i;
+ULONG               map;
+ULONG               bit;
+ULONG               sum;
+double              ns;
+double              best;
+
+
+    printf("ThreadX priority lookup benchmark, %d round trips per round, best of %d rounds\n\n",
+           BENCHMARK_ROUND_TRIPS, BENCHMARK_ROUNDS);
+
+    for (priorities = 32; priorities <= TX_MAX_PRIORITIES; priorities = priorities * 2)
+    {
+
+        /* Move to the last priority of this priority count.  */
+        tx_thread_priority_change(&benchmark_thread, priorities - 1, &old_priority);
+
+        best =  0;
+        for (round = 0; round < BENCHMARK_ROUNDS; round++)
+        {
+
+            benchmark_partner_runs =  0;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (i = 0; i < BENCHMARK_ROUND_TRIPS; i++)
+            {
+
+                tx_thread_resume(&benchmark_partner_thread);
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+
+            /* Make sure the partner really ran once for each resume.  */
+            if (benchmark_partner_runs != BENCHMARK_ROUND_TRIPS)
+            {
+
+                printf("Unexpected partner run count %lu\n", (unsigned long) benchmark_partner_runs);
+                exit(1);
+            }
+
+            ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_ROUND_TRIPS;
+            if ((round == 0) || (ns < best))
+            {
+                best =  ns;
+            }
+        }
+
+        printf("%4u priorities, lowest priority %-17u %8.1f ns/round trip\n", priorities, priorities - 1, best);
+    }
+
+    /* Fill the maps with random non-zero values, as the scheduler never searches an empty map.  */
+    srand(1);
+    for (i = 0; i < BENCHMARK_MAPS; i++)
+    {
+
+        benchmark_maps[i] =  ((ULONG) rand()) << ((ULONG) rand() % 32);
+        if (benchmark_maps[i] == 0)
+        {
+            benchmark_maps[i] =  ((ULONG) 0x80000000);
+        }
+    }
+
+    /* Time the lowest set bit calculation on its own.  */
+    sum =  0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_SEARCHES; i++)
+    {
+
+        map =  benchmark_maps[i % BENCHMARK_MAPS];
+        TX_LOWEST_SET_BIT_CALCULATE(map, bit)
+        sum =  sum + bit;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    benchmark_bit_sum =  sum;
+
+    printf("%-48s %8.1f ns/search\n", "TX_LOWEST_SET_BIT_CALCULATE", benchmark_elapsed_ns(&start, &end) / BENCHMARK_SEARCHES);
+
+    exit(0);
+}
+
+
+/* Define the partner thread, it suspends itself as soon as it runs.  */
+
+void    benchmark_partner_thread_entry(ULONG thread_input)
+{
+
+    while(1)
+    {
+
+        tx_thread_suspend(&benchmark_partner_thread);
+        benchmark_partner_runs++;
+    }
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
@@ -0,0 +1,464 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Priority Queue Benchmark                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark compares a TX_QUEUE with a TX_PRIORITY_QUEUE of      */
+/*    TX_4_ULONG messages in a control loop, where an urgent command is   */
+/*    sent behind a backlog of routine telemetry messages.  It reports    */
+/*    how many messages are received before the urgent command and the    */
+/*    time from sending the command to receiving it, and the cost of a    */
+/*    send and receive pair with the telemetry messages spread over       */
+/*    several priorities.  The times are the best of several rounds.  It  */
+/*    also checks that an urgent command from a sender suspended on the   */
+/*    full priority queue is received ahead of the backlog.               */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_MESSAGES          1000000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_BACKLOG           200
+#define BENCHMARK_QUEUE_MESSAGES    256
+#define BENCHMARK_URGENT_PRIORITY   0
+#define BENCHMARK_ROUTINE_PRIORITY  16
+#define BENCHMARK_URGENT            0xDEADBEEFUL
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the sender thread, which suspends on the full priority queue with the urgent
+   command.  */
+
+TX_THREAD           benchmark_sender_thread;
+ULONG               benchmark_sender_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+
+
+/* Define the benchmark thread and the two queues, which hold the same number of messages.  A
+   priority queue message takes one more ULONG of storage than a queue message.  */
+
+TX_THREAD           benchmark_thread;
+ULONG               benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_QUEUE            benchmark_queue;
+ULONG               benchmark_queue_memory[BENCHMARK_QUEUE_MESSAGES * TX_4_ULONG];
+TX_PRIORITY_QUEUE   benchmark_priority_queue;
+ULONG               benchmark_priority_queue_memory[BENCHMARK_QUEUE_MESSAGES * (TX_4_ULONG + 1)];
+
+
+/* Define the number of messages that were not received in the expected order, which must stay zero.  */
+
+volatile ULONG      benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_sender_thread_entry(ULONG thread_input);
+VOID    benchmark_priority_queue_suspended_check(VOID);
+double  benchmark_queue_urgent_run(ULONG *received_before);
+double  benchmark_priority_queue_urgent_run(ULONG *received_before);
+double  benchmark_queue_pairs_run(VOID);
+double  benchmark_priority_queue_pairs_run(VOID);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the sender thread, which runs ahead of the benchmark thread when it is
+       resumed.  */
+    tx_thread_create(&benchmark_sender_thread, "benchmark sender thread", benchmark_sender_thread_entry, 0,
+                     benchmark_sender_thread_stack, sizeof(benchmark_sender_thread_stack),
+                     0, 0, TX_NO_TIME_SLICE, TX_DONT_START);
+
+    /* Create the two queues.  */
+    tx_queue_create(&benchmark_queue, "benchmark queue", TX_4_ULONG,
+                    benchmark_queue_memory, sizeof(benchmark_queue_memory));
+    tx_priority_queue_create(&benchmark_priority_queue, "benchmark priority queue", TX_4_ULONG,
+                             benchmark_priority_queue_memory, sizeof(benchmark_priority_queue_memory));
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+ULONG   queue_before;
+ULONG   priority_queue_before;
+double  queue_urgent_ns;
+double  priority_queue_urgent_ns;
+double  queue_ns;
+double  priority_queue_ns;
+
+
+    printf("ThreadX priority queue benchmark, %d message backlog, %d messages per round, best of %d rounds\n\n",
+           BENCHMARK_BACKLOG, BENCHMARK_MESSAGES, BENCHMARK_ROUNDS);
+
+    queue_urgent_ns =           benchmark_queue_urgent_run(&queue_before);
+    priority_queue_urgent_ns =  benchmark_priority_queue_urgent_run(&priority_queue_before);
+    queue_ns =                  benchmark_queue_pairs_run();
+    priority_queue_ns =         benchmark_priority_queue_pairs_run();
+    benchmark_priority_queue_suspended_check();
+
+    printf("%-18s %18s %18s %22s\n", "queue", "received before", "urgent latency ns", "send+receive ns/pair");
+    printf("%-18s %18lu %18.1f %22.1f\n", "TX_QUEUE", (unsigned long) queue_before, queue_urgent_ns, queue_ns);
+    printf("%-18s %18lu %18.1f %22.1f\n", "TX_PRIORITY_QUEUE", (unsigned long) priority_queue_before,
+           priority_queue_urgent_ns, priority_queue_ns);
+
+    /* Make sure every message was received in the expected order.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected message order, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Send the urgent command to the queue behind BENCHMARK_BACKLOG telemetry messages,
+   receive until it arrives, and return the best time from the send of the command
+   to its receive.  */
+
+double  benchmark_queue_urgent_run(ULONG *received_before)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_4_ULONG];
+UINT                round;
+ULONG               i;
+
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        /* Build the backlog of telemetry messages.  */
+        for (i = 0; i < TX_4_ULONG; i++)
+        {
+            message[i] =  i;
+        }
+        for (i = 0; i < BENCHMARK_BACKLOG; i++)
+        {
+            tx_queue_send(&benchmark_queue, message, TX_NO_WAIT);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        message[0] =  BENCHMARK_URGENT;
+        tx_queue_send(&benchmark_queue, message, TX_NO_WAIT);
+        *received_before =  0;
+        while (tx_queue_receive(&benchmark_queue, message, TX_NO_WAIT) == TX_SUCCESS)
+        {
+            if (message[0] == BENCHMARK_URGENT)
+            {
+                break;
+            }
+            (*received_before)++;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        /* Make sure the urgent command arrived, behind the whole backlog.  */
+        if ((message[0] != BENCHMARK_URGENT) || (*received_before != BENCHMARK_BACKLOG))
+        {
+            benchmark_failures++;
+        }
+
+        ns =  benchmark_elapsed_ns(&start, &end);
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    return(best);
+}
+
+
+/* Send the urgent command to the priority queue behind BENCHMARK_BACKLOG telemetry
+   messages, receive until it arrives, and return the best time from the send of the
+   command to its receive.  */
+
+double  benchmark_priority_queue_urgent_run(ULONG *received_before)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_4_ULONG];
+UINT                round;
+ULONG               i;
+
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        /* Build the backlog of telemetry messages.  */
+        for (i = 0; i < TX_4_ULONG; i++)
+        {
+            message[i] =  i;
+        }
+        for (i = 0; i < BENCHMARK_BACKLOG; i++)
+        {
+            tx_priority_queue_send(&benchmark_priority_queue, message, BENCHMARK_ROUTINE_PRIORITY, TX_NO_WAIT);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        message[0] =  BENCHMARK_URGENT;
+        tx_priority_queue_send(&benchmark_priority_queue, message, BENCHMARK_URGENT_PRIORITY, TX_NO_WAIT);
+        *received_before =  0;
+        while (tx_priority_queue_receive(&benchmark_priority_queue, message, TX_NO_WAIT) == TX_SUCCESS)
+        {
+            if (message[0] == BENCHMARK_URGENT)
+            {
+                break;
+            }
+            (*received_before)++;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        /* Make sure the urgent command arrived ahead of the backlog.  */
+        if ((message[0] != BENCHMARK_URGENT) || (*received_before != 0))
+        {
+            benchmark_failures++;
+        }
+
+        /* Drop the backlog before the next round.  */
+        tx_priority_queue_flush(&benchmark_priority_queue);
+
+        ns =  benchmark_elapsed_ns(&start, &end);
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    return(best);
+}
+
+
+/* Define the sender thread, which sends the urgent command to the full priority queue
+   and suspends until it is received.  */
+
+void    benchmark_sender_thread_entry(ULONG thread_input)
+{
+
+ULONG   message[TX_4_ULONG];
+ULONG   i;
+
+
+    while (1)
+    {
+
+        for (i = 0; i < TX_4_ULONG; i++)
+        {
+            message[i] =  i;
+        }
+        message[0] =  BENCHMARK_URGENT;
+        if (tx_priority_queue_send(&benchmark_priority_queue, message, BENCHMARK_URGENT_PRIORITY, TX_WAIT_FOREVER) != TX_SUCCESS)
+        {
+            benchmark_failures++;
+        }
+        tx_thread_suspend(&benchmark_sender_thread);
+    }
+}
+
+
+/* Fill the priority queue with telemetry messages, let the sender thread suspend on it
+   with the urgent command, and make sure the command is received first and the backlog
+   after it.  */
+
+VOID    benchmark_priority_queue_suspended_check(VOID)
+{
+
+ULONG               message[TX_4_ULONG];
+ULONG               received;
+ULONG               i;
+
+
+    /* Fill the priority queue with telemetry messages.  */
+    for (i = 0; i < TX_4_ULONG; i++)
+    {
+        message[i] =  i;
+    }
+    for (i = 0; i < BENCHMARK_QUEUE_MESSAGES; i++)
+    {
+        tx_priority_queue_send(&benchmark_priority_queue, message, BENCHMARK_ROUTINE_PRIORITY, TX_NO_WAIT);
+    }
+
+    /* Let the sender thread suspend on the full priority queue.  */
+    tx_thread_resume(&benchmark_sender_thread);
+
+    /* The urgent command must come first, and the whole backlog after it.  */
+    if ((tx_priority_queue_receive(&benchmark_priority_queue, message, TX_NO_WAIT) != TX_SUCCESS) ||
+        (message[0] != BENCHMARK_URGENT))
+    {
+        benchmark_failures++;
+    }
+    received =  0;
+    while (tx_priority_queue_receive(&benchmark_priority_queue, message, TX_NO_WAIT) == TX_SUCCESS)
+    {
+        if (message[0] == BENCHMARK_URGENT)
+        {
+            benchmark_failures++;
+        }
+        received++;
+    }
+    if (received != BENCHMARK_QUEUE_MESSAGES)
+    {
+        benchmark_failures++;
+    }
+}
+
+
+/* Send and receive BENCHMARK_MESSAGES messages through the queue one at a time, with
+   the backlog in place, and return the best time per pair.  */
+
+double  benchmark_queue_pairs_run(VOID)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_4_ULONG];
+UINT                round;
+ULONG               i;
+
+
+    for (i = 0; i < TX_4_ULONG; i++)
+    {
+        message[i] =  i;
+    }
+    for (i = 0; i < BENCHMARK_BACKLOG; i++)
+    {
+        tx_queue_send(&benchmark_queue, message, TX_NO_WAIT);
+    }
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            tx_queue_send(&benchmark_queue, message, TX_NO_WAIT);
+            tx_queue_receive(&benchmark_queue, message, TX_NO_WAIT);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+    tx_queue_flush(&benchmark_queue);
+
+    return(best);
+}
+
+
+/* Send and receive BENCHMARK_MESSAGES messages of eight priorities through the priority
+   queue one at a time, with the backlog in place, and return the best time per pair.  */
+
+double  benchmark_priority_queue_pairs_run(VOID)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_4_ULONG];
+UINT                round;
+ULONG               i;
+
+
+    for (i = 0; i < TX_4_ULONG; i++)
+    {
+        message[i] =  i;
+    }
+    for (i = 0; i < BENCHMARK_BACKLOG; i++)
+    {
+        tx_priority_queue_send(&benchmark_priority_queue, message, BENCHMARK_ROUTINE_PRIORITY + (UINT) (i % 8), TX_NO_WAIT);
+    }
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            tx_priority_queue_send(&benchmark_priority_queue, message, BENCHMARK_ROUTINE_PRIORITY + (UINT) (i % 8), TX_NO_WAIT);
+            tx_priority_queue_receive(&benchmark_priority_queue, message, TX_NO_WAIT);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+    tx_priority_queue_flush(&benchmark_priority_queue);
+
+    return(best);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
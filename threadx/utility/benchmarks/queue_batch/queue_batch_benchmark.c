@@ -0,0 +1,287 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Queue Batch Benchmark                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the throughput of a message queue between   */
+/*    a dispatcher thread and a lower priority receiver thread, set up    */
+/*    like the queues of ProjectMessageQueues: one ULONG messages and     */
+/*    room for 100 of them. The dispatcher sends its messages in batches  */
+/*    of 1, 8, and 64 messages and the receiver takes up to a batch at a  */
+/*    time. Each batch size is run once with one tx_queue_send and        */
+/*    tx_queue_receive call per message, and once with a single           */
+/*    tx_queue_send_n and tx_queue_receive_n call per batch, which        */
+/*    disable interrupts only once for the whole batch. The times are     */
+/*    the best of several rounds.                                         */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  The number of messages is a multiple of every batch size.  */
+
+#define BENCHMARK_MESSAGES          32000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_MAX_BATCH         64
+#define BENCHMARK_QUEUE_MESSAGES    100
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the batch sizes.  */
+
+UINT            benchmark_batches[] =  { 1, 8, 64 };
+
+
+/* Define the dispatcher and receiver threads, the queue between them, and the
+   semaphore the receiver puts once it has received every message of a round.  */
+
+TX_THREAD       benchmark_dispatcher;
+ULONG           benchmark_dispatcher_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_THREAD       benchmark_receiver;
+ULONG           benchmark_receiver_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_QUEUE        benchmark_queue;
+ULONG           benchmark_queue_memory[BENCHMARK_QUEUE_MESSAGES];
+TX_SEMAPHORE    benchmark_done;
+
+
+/* Define the batch size and call style of the current round, which the receiver
+   picks up before each receive.  */
+
+volatile UINT   benchmark_batch;
+volatile UINT   benchmark_batched;
+
+
+/* Define the number of messages received out of order, which must stay zero.  */
+
+volatile ULONG  benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_dispatcher_entry(ULONG thread_input);
+void    benchmark_receiver_entry(ULONG thread_input);
+double  benchmark_batches_run(UINT batch, UINT batched);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the queue and the semaphore.  */
+    tx_queue_create(&benchmark_queue, "benchmark queue", TX_1_ULONG,
+                    benchmark_queue_memory, sizeof(benchmark_queue_memory));
+    tx_semaphore_create(&benchmark_done, "benchmark done", 0);
+
+    /* Create the dispatcher, which has a higher priority than the receiver.  */
+    tx_thread_create(&benchmark_dispatcher, "benchmark dispatcher", benchmark_dispatcher_entry, 0,
+                     benchmark_dispatcher_stack, sizeof(benchmark_dispatcher_stack),
+                     5, 5, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the receiver.  */
+    tx_thread_create(&benchmark_receiver, "benchmark receiver", benchmark_receiver_entry, 0,
+                     benchmark_receiver_stack, sizeof(benchmark_receiver_stack),
+                     10, 10, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the dispatcher thread.  */
+
+void    benchmark_dispatcher_entry(ULONG thread_input)
+{
+
+double  single_ns;
+double  batched_ns;
+ULONG   i;
+
+
+    printf("ThreadX queue batch benchmark, %d one ULONG messages per round, queue of %d messages, best of %d rounds\n\n",
+           BENCHMARK_MESSAGES, BENCHMARK_QUEUE_MESSAGES, BENCHMARK_ROUNDS);
+    printf("%-12s %22s %22s %12s\n", "batch", "send/receive ns/msg", "send_n/receive_n", "speedup");
+
+    for (i = 0; i < (sizeof(benchmark_batches) / sizeof(benchmark_batches[0])); i++)
+    {
+
+        single_ns =   benchmark_batches_run(benchmark_batches[i], TX_FALSE);
+        batched_ns =  benchmark_batches_run(benchmark_batches[i], TX_TRUE);
+
+        printf("%-12u %22.1f %22.1f %11.2fx\n", benchmark_batches[i],
+               single_ns, batched_ns, single_ns / batched_ns);
+    }
+
+    /* Make sure every message arrived in order.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected message order, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Send BENCHMARK_MESSAGES messages through the queue in batches of the given size, and
+   return the best time per message until the receiver has them all.  */
+
+double  benchmark_batches_run(UINT batch, UINT batched)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               messages[BENCHMARK_MAX_BATCH];
+ULONG               i;
+UINT                round;
+UINT                sent;
+UINT                j;
+
+
+    /* Let the receiver know how the messages are sent.  */
+    benchmark_batch =    batch;
+    benchmark_batched =  batched;
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i = i + batch)
+        {
+
+            /* Number the messages of the batch.  */
+            for (j = 0; j < batch; j++)
+            {
+                messages[j] =  i + j;
+            }
+
+            if (batched == TX_TRUE)
+            {
+
+                /* Send the batch, waiting whenever the queue is full.  */
+                for (j = 0; j < batch; j = j + sent)
+                {
+                    tx_queue_send_n(&benchmark_queue, &messages[j], batch - j, &sent, TX_WAIT_FOREVER);
+                }
+            }
+            else
+            {
+                for (j = 0; j < batch; j++)
+                {
+                    tx_queue_send(&benchmark_queue, &messages[j], TX_WAIT_FOREVER);
+                }
+            }
+        }
+
+        /* Wait for the receiver to take the rest of the messages.  */
+        tx_semaphore_get(&benchmark_done, TX_WAIT_FOREVER);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    /* Make sure the rounds left the queue empty.  */
+    tx_queue_info_get(&benchmark_queue, TX_NULL, &i, TX_NULL, TX_NULL, TX_NULL, TX_NULL);
+    if (i != 0)
+    {
+
+        printf("Unexpected queue state, %lu messages left\n", (unsigned long) i);
+        exit(1);
+    }
+
+    return(best);
+}
+
+
+/* Define the receiver thread, which takes up to a batch of messages at a time and puts
+   the semaphore once it has received every message of a round.  */
+
+void    benchmark_receiver_entry(ULONG thread_input)
+{
+
+ULONG   messages[BENCHMARK_MAX_BATCH];
+ULONG   expected;
+UINT    received;
+UINT    j;
+
+
+    expected =  0;
+    while (1)
+    {
+
+        if (benchmark_batched == TX_TRUE)
+        {
+            tx_queue_receive_n(&benchmark_queue, messages, benchmark_batch, &received, TX_WAIT_FOREVER);
+        }
+        else
+        {
+            tx_queue_receive(&benchmark_queue, &messages[0], TX_WAIT_FOREVER);
+            received =  1;
+        }
+
+        /* Check the order of the messages.  */
+        for (j = 0; j < received; j++)
+        {
+            if (messages[j] != expected)
+            {
+                benchmark_failures++;
+            }
+            expected++;
+        }
+
+        /* Determine if the round is complete.  */
+        if (expected == BENCHMARK_MESSAGES)
+        {
+            expected =  0;
+            tx_semaphore_put(&benchmark_done);
+        }
+    }
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
@@ -0,0 +1,280 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Queue Copy Benchmark                                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the cost of copying one message into the    */
+/*    storage of a queue for each message size from TX_1_ULONG to         */
+/*    TX_16_ULONG. It compares the generic TX_QUEUE_MESSAGE_COPY loop     */
+/*    with the copy routine the queue selects for its message size when   */
+/*    it is created, and also reports the cost of a tx_queue_send and     */
+/*    tx_queue_receive pair, which copy each message twice. The times     */
+/*    are the best of several rounds.                                     */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include "tx_queue.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_MESSAGES          1000000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_QUEUE_MESSAGES    100
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the message sizes.  */
+
+UINT            benchmark_sizes[] =  { TX_1_ULONG, TX_2_ULONG, TX_4_ULONG, TX_8_ULONG, TX_16_ULONG };
+
+
+/* Define the benchmark thread and the queue, which has room for BENCHMARK_QUEUE_MESSAGES
+   messages of the largest size.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_QUEUE        benchmark_queue;
+ULONG           benchmark_queue_memory[BENCHMARK_QUEUE_MESSAGES * TX_16_ULONG];
+
+
+/* Define the number of messages that were not copied intact, which must stay zero.  */
+
+volatile ULONG  benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+double  benchmark_copies_run(UINT routine);
+double  benchmark_pairs_run(VOID);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+double  loop_ns;
+double  routine_ns;
+double  pair_ns;
+CHAR    name[16];
+ULONG   i;
+
+
+    printf("ThreadX queue copy benchmark, %d messages per round, best of %d rounds\n\n",
+           BENCHMARK_MESSAGES, BENCHMARK_ROUNDS);
+    printf("%-12s %18s %18s %12s %22s\n", "message", "loop ns/msg", "routine ns/msg", "speedup",
+           "send+receive ns/pair");
+
+    for (i = 0; i < (sizeof(benchmark_sizes) / sizeof(benchmark_sizes[0])); i++)
+    {
+
+        /* Create a queue for this message size, which selects its copy routine.  */
+        tx_queue_create(&benchmark_queue, "benchmark queue", benchmark_sizes[i],
+                        benchmark_queue_memory, BENCHMARK_QUEUE_MESSAGES * benchmark_sizes[i] * sizeof(ULONG));
+
+        loop_ns =     benchmark_copies_run(TX_FALSE);
+        routine_ns =  benchmark_copies_run(TX_TRUE);
+        pair_ns =     benchmark_pairs_run();
+
+        snprintf(name, sizeof(name), "TX_%u_ULONG", benchmark_sizes[i]);
+        printf("%-12s %18.2f %18.2f %11.2fx %22.1f\n", name,
+               loop_ns, routine_ns, loop_ns / routine_ns, pair_ns);
+
+        tx_queue_delete(&benchmark_queue);
+    }
+
+    /* Make sure every message was copied intact.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected message contents, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Copy BENCHMARK_MESSAGES messages into the queue storage the way the send services do,
+   wrapping around at the end, and return the best time per message.  */
+
+double  benchmark_copies_run(UINT routine)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_16_ULONG];
+ULONG               *source;
+ULONG               *destination;
+UINT                size;
+UINT                round;
+ULONG               i;
+
+
+    for (i = 0; i < TX_16_ULONG; i++)
+    {
+        message[i] =  i + 1;
+    }
+
+    best =         0;
+    destination =  benchmark_queue.tx_queue_start;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+
+            source =  message;
+            size =    benchmark_queue.tx_queue_message_size;
+            if (routine == TX_TRUE)
+            {
+                TX_QUEUE_MESSAGE_ROUTINE_COPY(&benchmark_queue, source, destination, size)
+            }
+            else
+            {
+                TX_QUEUE_MESSAGE_COPY(source, destination, size)
+            }
+            if (destination == benchmark_queue.tx_queue_end)
+            {
+                destination =  benchmark_queue.tx_queue_start;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    /* Make sure the last message was copied intact.  */
+    if (destination == benchmark_queue.tx_queue_start)
+    {
+        destination =  benchmark_queue.tx_queue_end;
+    }
+    destination =  destination - benchmark_queue.tx_queue_message_size;
+    for (i = 0; i < benchmark_queue.tx_queue_message_size; i++)
+    {
+        if (destination[i] != message[i])
+        {
+            benchmark_failures++;
+        }
+    }
+
+    return(best);
+}
+
+
+/* Send and receive BENCHMARK_MESSAGES messages one at a time, and return the best time
+   per pair.  */
+
+double  benchmark_pairs_run(VOID)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_16_ULONG];
+ULONG               received[TX_16_ULONG];
+UINT                round;
+ULONG               i;
+
+
+    for (i = 0; i < TX_16_ULONG; i++)
+    {
+        message[i] =   i + 1;
+        received[i] =  0;
+    }
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            tx_queue_send(&benchmark_queue, message, TX_NO_WAIT);
+            tx_queue_receive(&benchmark_queue, received, TX_NO_WAIT);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    /* Make sure the last message was received intact.  */
+    for (i = 0; i < benchmark_queue.tx_queue_message_size; i++)
+    {
+        if (received[i] != message[i])
+        {
+            benchmark_failures++;
+        }
+    }
+
+    return(best);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
@@ -0,0 +1,343 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Queue Zero Copy Benchmark                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark passes TX_16_ULONG messages through a three stage    */
+/*    pipeline: a producer builds each message and places it in a first   */
+/*    queue, a forwarder moves it to a second queue, and a consumer       */
+/*    checks it.  The copying pipeline uses tx_queue_send and             */
+/*    tx_queue_receive, which copy the message four times.  The zero      */
+/*    copy pipeline uses two queues created with tx_queue_spsc_create.    */
+/*    It builds the message in place with tx_queue_send_reserve,          */
+/*    forwards it with one copy from the slot returned by                 */
+/*    tx_queue_receive_peek to the slot returned by                       */
+/*    tx_queue_send_reserve, and checks it in place with                  */
+/*    tx_queue_receive_peek.  The reserves and peeks do not lock out      */
+/*    interrupts, so both pipelines lock out interrupts four times per    */
+/*    message, and the zero copy pipeline saves three of the four         */
+/*    message copies.  Every service status is checked.  The times are    */
+/*    the best of several rounds.                                         */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_MESSAGES          1000000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_QUEUE_MESSAGES    16
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the benchmark thread and the two queues of the pipeline.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_QUEUE        benchmark_queue_in;
+TX_QUEUE        benchmark_queue_out;
+ULONG           benchmark_queue_in_memory[BENCHMARK_QUEUE_MESSAGES * TX_16_ULONG];
+ULONG           benchmark_queue_out_memory[BENCHMARK_QUEUE_MESSAGES * TX_16_ULONG];
+
+
+/* Define the number of messages that were not passed intact and the number of
+   unexpected service statuses, which must both stay zero.  */
+
+volatile ULONG  benchmark_failures;
+volatile ULONG  benchmark_errors;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+double  benchmark_copy_run(VOID);
+double  benchmark_zero_copy_run(VOID);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+UINT    status;
+
+
+    /* Create the two queues of the pipeline, each with a single producer and a single
+       consumer, so both pipelines can use them.  */
+    status =  tx_queue_spsc_create(&benchmark_queue_in, "benchmark queue in", TX_16_ULONG,
+                                   benchmark_queue_in_memory, sizeof(benchmark_queue_in_memory));
+    if (status == TX_SUCCESS)
+    {
+        status =  tx_queue_spsc_create(&benchmark_queue_out, "benchmark queue out", TX_16_ULONG,
+                                       benchmark_queue_out_memory, sizeof(benchmark_queue_out_memory));
+    }
+    if (status != TX_SUCCESS)
+    {
+
+        printf("tx_queue_spsc_create failed, status %u\n", status);
+        exit(1);
+    }
+
+    /* Create the benchmark thread.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+double  copy_ns;
+double  zero_copy_ns;
+
+
+    printf("ThreadX queue zero copy benchmark, %d TX_16_ULONG messages per round, best of %d rounds\n\n",
+           BENCHMARK_MESSAGES, BENCHMARK_ROUNDS);
+
+    copy_ns =       benchmark_copy_run();
+    zero_copy_ns =  benchmark_zero_copy_run();
+
+    printf("%-30s %12s\n", "pipeline", "ns/msg");
+    printf("%-30s %12.1f\n", "send/receive", copy_ns);
+    printf("%-30s %12.1f\n", "reserve/peek/commit", zero_copy_ns);
+    printf("\nspeedup %.2fx\n", copy_ns / zero_copy_ns);
+
+    /* Make sure every message was passed intact.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected message contents, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    /* Make sure every service call succeeded.  */
+    if (benchmark_errors != 0)
+    {
+
+        printf("Unexpected service status, %lu errors\n", (unsigned long) benchmark_errors);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Pass BENCHMARK_MESSAGES messages through the pipeline with copying sends and receives,
+   and return the best time per message.  */
+
+double  benchmark_copy_run(VOID)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message[TX_16_ULONG];
+ULONG               received[TX_16_ULONG];
+ULONG               sum;
+UINT                round;
+ULONG               i;
+ULONG               j;
+
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+
+            /* Build the message and send it to the first queue.  */
+            for (j = 0; j < TX_16_ULONG; j++)
+            {
+                message[j] =  i + j;
+            }
+            if (tx_queue_send(&benchmark_queue_in, message, TX_NO_WAIT) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+
+            /* Forward the message to the second queue.  */
+            if (tx_queue_receive(&benchmark_queue_in, received, TX_NO_WAIT) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+            if (tx_queue_send(&benchmark_queue_out, received, TX_NO_WAIT) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+
+            /* Receive and check the message.  */
+            if (tx_queue_receive(&benchmark_queue_out, received, TX_NO_WAIT) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+            sum =  0;
+            for (j = 0; j < TX_16_ULONG; j++)
+            {
+                sum =  sum + received[j];
+            }
+            if (sum != ((i * TX_16_ULONG) + 120))
+            {
+                benchmark_failures++;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    return(best);
+}
+
+
+/* Pass BENCHMARK_MESSAGES messages through the pipeline in place, and return the best
+   time per message.  */
+
+double  benchmark_zero_copy_run(VOID)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+VOID                *slot;
+VOID                *forward_slot;
+ULONG               *message;
+ULONG               *forward;
+ULONG               sum;
+UINT                round;
+ULONG               i;
+ULONG               j;
+
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+
+            /* Build the message in the first queue.  */
+            if (tx_queue_send_reserve(&benchmark_queue_in, &slot) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+                continue;
+            }
+            message =  (ULONG *) slot;
+            for (j = 0; j < TX_16_ULONG; j++)
+            {
+                message[j] =  i + j;
+            }
+            if (tx_queue_send_commit(&benchmark_queue_in, slot) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+
+            /* Forward the message with a single copy between the queue storage areas.  */
+            if ((tx_queue_receive_peek(&benchmark_queue_in, &slot) != TX_SUCCESS) ||
+                (tx_queue_send_reserve(&benchmark_queue_out, &forward_slot) != TX_SUCCESS))
+            {
+                benchmark_errors++;
+                continue;
+            }
+            message =  (ULONG *) slot;
+            forward =  (ULONG *) forward_slot;
+            for (j = 0; j < TX_16_ULONG; j++)
+            {
+                forward[j] =  message[j];
+            }
+            if (tx_queue_send_commit(&benchmark_queue_out, forward_slot) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+            if (tx_queue_receive_commit(&benchmark_queue_in, slot) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+
+            /* Check the message in place.  */
+            if (tx_queue_receive_peek(&benchmark_queue_out, &slot) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+                continue;
+            }
+            message =  (ULONG *) slot;
+            sum =  0;
+            for (j = 0; j < TX_16_ULONG; j++)
+            {
+                sum =  sum + message[j];
+            }
+            if (sum != ((i * TX_16_ULONG) + 120))
+            {
+                benchmark_failures++;
+            }
+            if (tx_queue_receive_commit(&benchmark_queue_out, slot) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    return(best);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
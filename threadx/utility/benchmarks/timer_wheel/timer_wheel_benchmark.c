@@ -0,0 +1,259 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Timer Wheel Benchmark                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures the timer services with a large number of   */
+/*    long periodic timers active at once. It times the activation and    */
+/*    deactivation of every timer, and the processing of each tick while  */
+/*    all timers are active. The ticks are generated with                 */
+/*    tx_time_increment from the benchmark thread, so the cost of moving  */
+/*    long timers through the timer list or the timing wheel is included  */
+/*    in the tick time, together with the expirations themselves. It      */
+/*    also times what virtual time and tickless idle do on every wakeup:  */
+/*    increments of several ticks at once, tx_timer_get_next, and a       */
+/*    wakeup that advances the clock to the next expiration. Build with   */
+/*    TX_LINUX_VIRTUAL_TIME, so the simulated timer interrupt does not    */
+/*    add ticks of its own during the measurement.                        */
+/*                                                                        */
+/*    The benchmark is built twice: timer_wheel_benchmark uses the        */
+/*    timing wheel, and timer_wheel_list_benchmark is linked against a    */
+/*    library built with TX_TIMER_WHEEL_LEVELS set to 0, which keeps long */
+/*    timers on the timer list as before the wheel was added.             */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_TIMERS            100000
+#define BENCHMARK_MIN_PERIOD        20000
+#define BENCHMARK_MAX_PERIOD        200000
+#define BENCHMARK_TICKS             100000
+#define BENCHMARK_INCREMENTS        10000
+#define BENCHMARK_LONG_INCREMENT    50
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the name of the timer configuration under test.  */
+
+#if defined(TX_TIMER_WHEEL_LEVELS) && (TX_TIMER_WHEEL_LEVELS == 0)
+#define BENCHMARK_CONFIGURATION     "timer list only"
+#else
+#define BENCHMARK_CONFIGURATION     "timing wheel"
+#endif
+
+
+/* Define the benchmark thread and timers.  */
+
+TX_THREAD       benchmark_thread;
+ULONG           benchmark_thread_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_TIMER        benchmark_timers[BENCHMARK_TIMERS];
+
+
+/* Define the counter of timer expirations.  */
+
+volatile ULONG  benchmark_expirations;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_thread_entry(ULONG thread_input);
+void    benchmark_timer_expiration(ULONG timer_input);
+double  benchmark_increment_run(ULONG ticks);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+ULONG   period;
+ULONG   i;
+
+
+    /* Create the timers with a fixed seed, so every run uses the same periods.  */
+    srand(1);
+    for (i = 0; i < BENCHMARK_TIMERS; i++)
+    {
+
+        period =  BENCHMARK_MIN_PERIOD + ((ULONG) rand() % (BENCHMARK_MAX_PERIOD - BENCHMARK_MIN_PERIOD));
+        tx_timer_create(&benchmark_timers[i], "benchmark timer", benchmark_timer_expiration, i,
+                        period, period, TX_NO_ACTIVATE);
+    }
+
+    /* Create the benchmark thread.  The system timer thread has a higher priority, so
+       the expirations of each tick are processed before the next tick is generated.  */
+    tx_thread_create(&benchmark_thread, "benchmark thread", benchmark_thread_entry, 0,
+                     benchmark_thread_stack, sizeof(benchmark_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Define the benchmark thread.  */
+
+void    benchmark_thread_entry(ULONG thread_input)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              activate_ns;
+double              tick_ns;
+double              deactivate_ns;
+double              increment_ns;
+double              long_increment_ns;
+double              get_next_ns;
+double              wakeup_ns;
+ULONG               next_ticks;
+ULONG               i;
+char                label[40];
+
+
+    printf("ThreadX timer benchmark, %s, %d periodic timers with periods of %d to %d ticks\n\n",
+           BENCHMARK_CONFIGURATION, BENCHMARK_TIMERS, BENCHMARK_MIN_PERIOD, BENCHMARK_MAX_PERIOD);
+
+    /* Activate all the timers.  */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_TIMERS; i++)
+    {
+
+        tx_timer_activate(&benchmark_timers[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    activate_ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_TIMERS;
+
+    /* Advance the system clock one tick at a time.  */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_TICKS; i++)
+    {
+
+        tx_time_increment(1);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    tick_ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_TICKS;
+
+    /* Advance the system clock several ticks at a time, as virtual time and tickless
+       idle do.  */
+    increment_ns =       benchmark_increment_run(2);
+    long_increment_ns =  benchmark_increment_run(BENCHMARK_LONG_INCREMENT);
+
+    /* Find the next expiration, as tickless idle does before it stops the tick.  */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_INCREMENTS; i++)
+    {
+
+        tx_timer_get_next(&next_ticks);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    get_next_ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_INCREMENTS;
+
+    /* Wake up at each next expiration, as tickless idle does while the system is idle.  */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_INCREMENTS; i++)
+    {
+
+        if (tx_timer_get_next(&next_ticks) == TX_TRUE)
+        {
+
+            tx_time_increment(next_ticks);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    wakeup_ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_INCREMENTS;
+
+    /* Deactivate all the timers.  */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_TIMERS; i++)
+    {
+
+        tx_timer_deactivate(&benchmark_timers[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    deactivate_ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_TIMERS;
+
+    printf("%-40s %10.1f ns/timer\n", "tx_timer_activate", activate_ns);
+    printf("%-40s %10.1f ns/tick\n", "tick processing", tick_ns);
+    printf("%-40s %10.1f ns/call\n", "tx_time_increment(2)", increment_ns);
+    sprintf(label, "tx_time_increment(%d)", BENCHMARK_LONG_INCREMENT);
+    printf("%-40s %10.1f ns/call\n", label, long_increment_ns);
+    printf("%-40s %10.1f ns/call\n", "tx_timer_get_next", get_next_ns);
+    printf("%-40s %10.1f ns/wakeup\n", "tickless wakeup at next expiration", wakeup_ns);
+    printf("%-40s %10.1f ns/timer\n", "tx_timer_deactivate", deactivate_ns);
+    printf("%-40s %10lu in %lu ticks\n", "expirations", (unsigned long) benchmark_expirations, (unsigned long) tx_time_get());
+
+    exit(0);
+}
+
+
+/* Advance the system clock BENCHMARK_INCREMENTS times by the specified number of ticks,
+   and return the time per increment.  */
+
+double  benchmark_increment_run(ULONG ticks)
+{
+
+struct timespec     start;
+struct timespec     end;
+ULONG               i;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < BENCHMARK_INCREMENTS; i++)
+    {
+
+        tx_time_increment(ticks);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return(benchmark_elapsed_ns(&start, &end) / BENCHMARK_INCREMENTS);
+}
+
+
+void    benchmark_timer_expiration(ULONG timer_input)
+{
+
+    benchmark_expirations++;
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
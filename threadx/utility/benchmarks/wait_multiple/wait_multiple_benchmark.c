@@ -0,0 +1,278 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Benchmark Component                                           */
+/**                                                                       */
+/**   Wait For Multiple Objects Benchmark                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  BENCHMARK DESCRIPTION                                                 */
+/*                                                                        */
+/*    This benchmark measures a consumer thread that receives messages    */
+/*    from two queues, which a lower priority producer fills in turn.     */
+/*    The chained consumer waits on a gatekeeper semaphore that the send  */
+/*    notify callbacks of the queues put, as in the event chaining        */
+/*    training project, and then receives from whichever queue holds a   */
+/*    message. The native consumer suspends on both queues at once with   */
+/*    tx_thread_wait_multiple. Each message wakes the consumer, and the   */
+/*    times are the best of several rounds.                               */
+/*                                                                        */
+/**************************************************************************/
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Define the benchmark parameters.  */
+
+#define BENCHMARK_MESSAGES          100000
+#define BENCHMARK_ROUNDS            5
+#define BENCHMARK_QUEUE_MESSAGES    4
+#define BENCHMARK_STACK_SIZE        4096
+
+
+/* Define the producer thread, and the chained and native consumer threads with their objects.  */
+
+TX_THREAD       benchmark_producer;
+ULONG           benchmark_producer_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_THREAD       benchmark_chained_consumer;
+ULONG           benchmark_chained_consumer_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_THREAD       benchmark_native_consumer;
+ULONG           benchmark_native_consumer_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+TX_SEMAPHORE    benchmark_gatekeeper;
+TX_QUEUE        benchmark_chained_queue[2];
+ULONG           benchmark_chained_queue_memory[2][BENCHMARK_QUEUE_MESSAGES];
+TX_QUEUE        benchmark_native_queue[2];
+ULONG           benchmark_native_queue_memory[2][BENCHMARK_QUEUE_MESSAGES];
+
+
+/* Define the number of messages each consumer received and the number received out of
+   order, which must stay zero.  */
+
+volatile ULONG  benchmark_chained_received;
+volatile ULONG  benchmark_native_received;
+volatile ULONG  benchmark_failures;
+
+
+/* Define the prototypes for the benchmark.  */
+
+void    benchmark_producer_entry(ULONG thread_input);
+void    benchmark_chained_consumer_entry(ULONG thread_input);
+void    benchmark_native_consumer_entry(ULONG thread_input);
+void    benchmark_chained_queue_notify(TX_QUEUE *queue_ptr);
+double  benchmark_messages_run(TX_QUEUE *queues, volatile ULONG *received);
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+UINT    i;
+
+
+    /* Create the producer, and the consumers at a higher priority.  */
+    tx_thread_create(&benchmark_producer, "benchmark producer", benchmark_producer_entry, 0,
+                     benchmark_producer_stack, sizeof(benchmark_producer_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+    tx_thread_create(&benchmark_chained_consumer, "benchmark chained consumer", benchmark_chained_consumer_entry, 0,
+                     benchmark_chained_consumer_stack, sizeof(benchmark_chained_consumer_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    tx_thread_create(&benchmark_native_consumer, "benchmark native consumer", benchmark_native_consumer_entry, 0,
+                     benchmark_native_consumer_stack, sizeof(benchmark_native_consumer_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the gatekeeper semaphore and the queues.  */
+    tx_semaphore_create(&benchmark_gatekeeper, "benchmark gatekeeper", 0);
+    for (i = 0; i < 2; i++)
+    {
+        tx_queue_create(&benchmark_chained_queue[i], "benchmark chained queue", TX_1_ULONG,
+                        benchmark_chained_queue_memory[i], sizeof(benchmark_chained_queue_memory[i]));
+        tx_queue_send_notify(&benchmark_chained_queue[i], benchmark_chained_queue_notify);
+        tx_queue_create(&benchmark_native_queue[i], "benchmark native queue", TX_1_ULONG,
+                        benchmark_native_queue_memory[i], sizeof(benchmark_native_queue_memory[i]));
+    }
+}
+
+
+/* Define the producer thread.  */
+
+void    benchmark_producer_entry(ULONG thread_input)
+{
+
+double  chained_ns;
+double  native_ns;
+
+
+    printf("ThreadX wait for multiple objects benchmark, 2 queues, %d messages per round, best of %d rounds\n\n",
+           BENCHMARK_MESSAGES, BENCHMARK_ROUNDS);
+
+    chained_ns =  benchmark_messages_run(benchmark_chained_queue, &benchmark_chained_received);
+    native_ns =   benchmark_messages_run(benchmark_native_queue, &benchmark_native_received);
+
+    printf("%-36s %16s\n", "consumer", "ns/message");
+    printf("%-36s %16.1f\n", "gatekeeper semaphore and notify", chained_ns);
+    printf("%-36s %16.1f\n", "tx_thread_wait_multiple", native_ns);
+    printf("\nThe native wait takes %.2fx the time of the chained wait\n", native_ns / chained_ns);
+
+    /* Make sure every message was received in order.  */
+    if (benchmark_failures != 0)
+    {
+
+        printf("Unexpected messages, %lu failures\n", (unsigned long) benchmark_failures);
+        exit(1);
+    }
+
+    exit(0);
+}
+
+
+/* Define the consumer that waits on the gatekeeper semaphore.  */
+
+void    benchmark_chained_consumer_entry(ULONG thread_input)
+{
+
+ULONG   message;
+
+
+    while (1)
+    {
+
+        /* Wait for either queue to receive a message.  */
+        tx_semaphore_get(&benchmark_gatekeeper, TX_WAIT_FOREVER);
+
+        /* Receive the message from whichever queue holds it.  */
+        if (tx_queue_receive(&benchmark_chained_queue[0], &message, TX_NO_WAIT) != TX_SUCCESS)
+        {
+            tx_queue_receive(&benchmark_chained_queue[1], &message, TX_NO_WAIT);
+        }
+
+        if (message != benchmark_chained_received)
+        {
+            benchmark_failures++;
+        }
+        benchmark_chained_received++;
+    }
+}
+
+
+/* Define the consumer that waits on both queues at once.  */
+
+void    benchmark_native_consumer_entry(ULONG thread_input)
+{
+
+TX_WAIT_BLOCK   wait_blocks[2];
+ULONG           message;
+UINT            ready_index;
+UINT            i;
+
+
+    for (i = 0; i < 2; i++)
+    {
+        wait_blocks[i].tx_wait_block_type =         TX_WAIT_QUEUE;
+        wait_blocks[i].tx_wait_block_object =       &benchmark_native_queue[i];
+        wait_blocks[i].tx_wait_block_destination =  &message;
+    }
+
+    while (1)
+    {
+
+        /* Wait for a message from either queue.  */
+        tx_thread_wait_multiple(wait_blocks, 2, &ready_index, TX_WAIT_FOREVER);
+
+        if (message != benchmark_native_received)
+        {
+            benchmark_failures++;
+        }
+        benchmark_native_received++;
+    }
+}
+
+
+/* Define the send notify callback of the chained queues.  */
+
+void    benchmark_chained_queue_notify(TX_QUEUE *queue_ptr)
+{
+
+    tx_semaphore_put(&benchmark_gatekeeper);
+}
+
+
+/* Send BENCHMARK_MESSAGES messages alternately to the two queues, each of which wakes the
+   consumer, and return the best time per message.  */
+
+double  benchmark_messages_run(TX_QUEUE *queues, volatile ULONG *received)
+{
+
+struct timespec     start;
+struct timespec     end;
+double              ns;
+double              best;
+ULONG               message;
+UINT                round;
+ULONG               i;
+
+
+    best =  0;
+    for (round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (i = 0; i < BENCHMARK_MESSAGES; i++)
+        {
+            message =  *received;
+            tx_queue_send(&queues[i & 1], &message, TX_NO_WAIT);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        ns =  benchmark_elapsed_ns(&start, &end) / BENCHMARK_MESSAGES;
+        if ((round == 0) || (ns < best))
+        {
+            best =  ns;
+        }
+    }
+
+    /* Make sure the consumer received every message.  */
+    if (*received != (BENCHMARK_ROUNDS * BENCHMARK_MESSAGES))
+    {
+        benchmark_failures++;
+    }
+
+    return(best);
+}
+
+
+double  benchmark_elapsed_ns(struct timespec *start, struct timespec *end)
+{
+
+    return(((double) (end -> tv_sec - start -> tv_sec) * 1e9) + (double) (end -> tv_nsec - start -> tv_nsec));
+}
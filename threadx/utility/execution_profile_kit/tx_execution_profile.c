@@ -0,0 +1,985 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Execution Profile Kit                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_execution_profile.h"
+
+
+#if defined(TX_EXECUTION_PROFILE_ENABLE) && !defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY)
+
+/* Define the total time of all threads, of interrupt processing, and of idle time.  */
+
+EXECUTION_TIME                  _tx_execution_thread_time_total;
+EXECUTION_TIME                  _tx_execution_isr_time_total;
+EXECUTION_TIME                  _tx_execution_idle_time_total;
+
+
+/* Define the start time of the current interrupt processing and idle period. A value
+   of 0 indicates that no interrupt processing or idle period is being measured.  */
+
+EXECUTION_TIME_SOURCE_TYPE      _tx_execution_isr_time_last_start;
+EXECUTION_TIME_SOURCE_TYPE      _tx_execution_idle_time_last_start;
+
+
+/* Add the time elapsed since the start time to the total time. The time source may
+   wrap once in between, and the total saturates at its maximum.  */
+
+static EXECUTION_TIME  _tx_execution_time_add(EXECUTION_TIME total_time, EXECUTION_TIME_SOURCE_TYPE start_time,
+                                              EXECUTION_TIME_SOURCE_TYPE current_time)
+{
+
+EXECUTION_TIME      delta_time;
+
+
+    /* Calculate the time elapsed since the start.  */
+    if (current_time >= start_time)
+    {
+        delta_time =  (EXECUTION_TIME) (current_time - start_time);
+    }
+    else
+    {
+        delta_time =  ((EXECUTION_TIME) (TX_EXECUTION_MAX_TIME_SOURCE - start_time)) + ((EXECUTION_TIME) current_time) + ((EXECUTION_TIME) 1);
+    }
+
+    /* Add it to the total, unless the total would overflow.  */
+    if (total_time > (TX_EXECUTION_TIME_MAX - delta_time))
+    {
+        total_time =  TX_EXECUTION_TIME_MAX;
+    }
+    else
+    {
+        total_time =  total_time + delta_time;
+    }
+
+    /* Return the new total.  */
+    return(total_time);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_enter                          PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port when a thread is about to run.  */
+/*    It records the start time of the thread and ends the idle period,   */
+/*    if one is being measured.  It is called with interrupts disabled.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Port scheduler and context switch code                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_thread_enter(VOID)
+{
+
+TX_THREAD                   *thread_ptr;
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+
+
+    /* Pickup the thread that is about to run.  */
+    thread_ptr =  _tx_thread_current_ptr;
+
+    /* Determine if there is a thread.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Pickup the current time.  */
+        current_time =  TX_EXECUTION_TIME_SOURCE;
+
+        /* Record the start time of the thread.  */
+        thread_ptr -> tx_thread_execution_time_last_start =  current_time;
+
+        /* Determine if the system was idle.  */
+        if (_tx_execution_idle_time_last_start != ((EXECUTION_TIME_SOURCE_TYPE) 0))
+        {
+
+            /* Yes, add the idle period to the idle time.  */
+            _tx_execution_idle_time_total =  _tx_execution_time_add(_tx_execution_idle_time_total,
+                                                                    _tx_execution_idle_time_last_start, current_time);
+            _tx_execution_idle_time_last_start =  ((EXECUTION_TIME_SOURCE_TYPE) 0);
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_exit                           PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port when the current thread returns */
+/*    to the scheduler.  It adds the time since the thread started        */
+/*    running to the thread's execution time and to the total thread      */
+/*    time, and starts an idle period if no other thread is ready.  It is */
+/*    called with interrupts disabled.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_time_add                Accumulate elapsed time       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Port scheduler and context switch code                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_thread_exit(VOID)
+{
+
+TX_THREAD                   *thread_ptr;
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+
+
+    /* Pickup the thread that is leaving.  */
+    thread_ptr =  _tx_thread_current_ptr;
+
+    /* Determine if there is a thread.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Pickup the current time.  */
+        current_time =  TX_EXECUTION_TIME_SOURCE;
+
+        /* Determine if the thread's execution is being measured.  */
+        if (thread_ptr -> tx_thread_execution_time_last_start != ((unsigned long long) 0))
+        {
+
+            /* Add the time since the thread started running.  */
+            thread_ptr -> tx_thread_execution_time_total =  _tx_execution_time_add(thread_ptr -> tx_thread_execution_time_total,
+                                                                                   (EXECUTION_TIME_SOURCE_TYPE) thread_ptr -> tx_thread_execution_time_last_start, current_time);
+            _tx_execution_thread_time_total =  _tx_execution_time_add(_tx_execution_thread_time_total,
+                                                                      (EXECUTION_TIME_SOURCE_TYPE) thread_ptr -> tx_thread_execution_time_last_start, current_time);
+            thread_ptr -> tx_thread_execution_time_last_start =  ((unsigned long long) 0);
+        }
+
+        /* Determine if the system is now idle.  */
+        if (_tx_thread_execute_ptr == TX_NULL)
+        {
+
+            /* Yes, start the idle period.  */
+            _tx_execution_idle_time_last_start =  current_time;
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_enter                             PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port from the context save           */
+/*    processing of an interrupt.  On the outermost interrupt, it stops   */
+/*    measuring the interrupted thread or idle period and starts          */
+/*    measuring the interrupt processing.  Nested interrupts are part of  */
+/*    the outermost interrupt.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_time_add                Accumulate elapsed time       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Port scheduler and context switch code                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_isr_enter(VOID)
+{
+
+TX_THREAD                   *thread_ptr;
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+
+
+    /* Determine if this is the outermost interrupt.  */
+    if (TX_THREAD_GET_SYSTEM_STATE() == ((ULONG) 1))
+    {
+
+        /* Pickup the current time.  */
+        current_time =  TX_EXECUTION_TIME_SOURCE;
+
+        /* Pickup the interrupted thread.  */
+        thread_ptr =  _tx_thread_current_ptr;
+
+        /* Determine if a thread was interrupted.  */
+        if (thread_ptr != TX_NULL)
+        {
+
+            /* Determine if the thread's execution is being measured.  */
+            if (thread_ptr -> tx_thread_execution_time_last_start != ((unsigned long long) 0))
+            {
+
+                /* Add the time since the thread started running.  */
+                thread_ptr -> tx_thread_execution_time_total =  _tx_execution_time_add(thread_ptr -> tx_thread_execution_time_total,
+                                                                                       (EXECUTION_TIME_SOURCE_TYPE) thread_ptr -> tx_thread_execution_time_last_start, current_time);
+                _tx_execution_thread_time_total =  _tx_execution_time_add(_tx_execution_thread_time_total,
+                                                                          (EXECUTION_TIME_SOURCE_TYPE) thread_ptr -> tx_thread_execution_time_last_start, current_time);
+                thread_ptr -> tx_thread_execution_time_last_start =  ((unsigned long long) 0);
+            }
+        }
+
+        /* Otherwise, determine if the system was idle.  */
+        else if (_tx_execution_idle_time_last_start != ((EXECUTION_TIME_SOURCE_TYPE) 0))
+        {
+
+            /* Add the idle period to the idle time.  */
+            _tx_execution_idle_time_total =  _tx_execution_time_add(_tx_execution_idle_time_total,
+                                                                    _tx_execution_idle_time_last_start, current_time);
+            _tx_execution_idle_time_last_start =  ((EXECUTION_TIME_SOURCE_TYPE) 0);
+        }
+
+        /* Start measuring the interrupt processing.  */
+        _tx_execution_isr_time_last_start =  current_time;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_exit                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port from the context restore        */
+/*    processing of an interrupt, before the interrupt nesting is undone. */
+/*    On the outermost interrupt, it adds the interrupt processing to the */
+/*    interrupt time.  It then resumes measuring the interrupted thread   */
+/*    if that thread continues, or starts an idle period if no thread is  */
+/*    ready.  A thread that is preempted is measured again once it is     */
+/*    scheduled.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_time_add                Accumulate elapsed time       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Port scheduler and context switch code                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_isr_exit(VOID)
+{
+
+TX_THREAD                   *thread_ptr;
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+
+
+    /* Determine if this is the outermost interrupt.  */
+    if (TX_THREAD_GET_SYSTEM_STATE() == ((ULONG) 1))
+    {
+
+        /* Pickup the current time.  */
+        current_time =  TX_EXECUTION_TIME_SOURCE;
+
+        /* Determine if the interrupt processing is being measured.  */
+        if (_tx_execution_isr_time_last_start != ((EXECUTION_TIME_SOURCE_TYPE) 0))
+        {
+
+            /* Add the interrupt processing to the interrupt time.  */
+            _tx_execution_isr_time_total =  _tx_execution_time_add(_tx_execution_isr_time_total,
+                                                                   _tx_execution_isr_time_last_start, current_time);
+            _tx_execution_isr_time_last_start =  ((EXECUTION_TIME_SOURCE_TYPE) 0);
+        }
+
+        /* Pickup the interrupted thread.  */
+        thread_ptr =  _tx_thread_current_ptr;
+
+        /* Determine if the interrupted thread continues, either because it is still the
+           thread to execute or because preemption is disabled.  */
+        if ((thread_ptr != TX_NULL) && ((thread_ptr == _tx_thread_execute_ptr) || (_tx_thread_preempt_disable != ((UINT) 0))))
+        {
+
+            /* Resume measuring the thread.  */
+            thread_ptr -> tx_thread_execution_time_last_start =  current_time;
+        }
+
+        /* Otherwise, determine if the system is idle.  */
+        else if (_tx_thread_execute_ptr == TX_NULL)
+        {
+
+            /* Start the idle period.  */
+            _tx_execution_idle_time_last_start =  current_time;
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_time_reset                     PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the execution time of the specified thread.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                            Pointer to thread             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_time_reset(TX_THREAD *thread_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Check for an invalid thread pointer.  */
+    if (thread_ptr == TX_NULL)
+    {
+
+        /* Return thread pointer error.  */
+        return(TX_THREAD_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Reset the thread's execution time.  */
+    thread_ptr -> tx_thread_execution_time_total =  ((unsigned long long) 0);
+
+    /* Restart the measurement if the thread is the one executing.  */
+    if (thread_ptr -> tx_thread_execution_time_last_start != ((unsigned long long) 0))
+    {
+        thread_ptr -> tx_thread_execution_time_last_start =  (unsigned long long) TX_EXECUTION_TIME_SOURCE;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_total_time_reset               PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the total time of all threads, as well as the  */
+/*    execution time of every created thread.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_total_time_reset(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD                   *thread_ptr;
+ULONG                       total_threads;
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the current time.  */
+    current_time =  TX_EXECUTION_TIME_SOURCE;
+
+    /* Reset the total time of all threads.  */
+    _tx_execution_thread_time_total =  ((EXECUTION_TIME) 0);
+
+    /* Walk the created thread list and reset each thread's execution time.  */
+    thread_ptr =     _tx_thread_created_ptr;
+    total_threads =  _tx_thread_created_count;
+    while (total_threads != ((ULONG) 0))
+    {
+
+        /* Reset the thread's execution time.  */
+        thread_ptr -> tx_thread_execution_time_total =  ((unsigned long long) 0);
+
+        /* Restart the measurement if the thread is the one executing.  */
+        if (thread_ptr -> tx_thread_execution_time_last_start != ((unsigned long long) 0))
+        {
+            thread_ptr -> tx_thread_execution_time_last_start =  (unsigned long long) current_time;
+        }
+
+        /* Move to the next thread.  */
+        thread_ptr =  thread_ptr -> tx_thread_created_next;
+        total_threads--;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_time_reset                        PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the total interrupt processing time.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_isr_time_reset(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Reset the interrupt time.  */
+    _tx_execution_isr_time_total =  ((EXECUTION_TIME) 0);
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_idle_time_reset                       PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the total idle time.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_idle_time_reset(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Reset the idle time.  */
+    _tx_execution_idle_time_total =  ((EXECUTION_TIME) 0);
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_time_get                       PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the execution time of the specified thread.   */
+/*    If the thread is the one executing, the time since it started       */
+/*    running is included.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                            Pointer to thread             */
+/*    total_time                            Destination for the time      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_time_add                Accumulate elapsed time       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_time_get(TX_THREAD *thread_ptr, EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+EXECUTION_TIME              thread_time;
+
+
+    /* Check for an invalid thread pointer.  */
+    if (thread_ptr == TX_NULL)
+    {
+
+        /* Return thread pointer error.  */
+        return(TX_THREAD_ERROR);
+    }
+
+    /* Check for an invalid destination pointer.  */
+    if (total_time == TX_NULL)
+    {
+
+        /* Return pointer error.  */
+        return(TX_PTR_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the thread's execution time.  */
+    thread_time =  thread_ptr -> tx_thread_execution_time_total;
+
+    /* Include the current run of the thread, if it is the one executing.  */
+    if (thread_ptr -> tx_thread_execution_time_last_start != ((unsigned long long) 0))
+    {
+        thread_time =  _tx_execution_time_add(thread_time, (EXECUTION_TIME_SOURCE_TYPE) thread_ptr -> tx_thread_execution_time_last_start,
+                                              TX_EXECUTION_TIME_SOURCE);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the execution time.  */
+    *total_time =  thread_time;
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_total_time_get                 PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the total execution time of all threads,      */
+/*    including the current run of the executing thread.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    total_time                            Destination for the time      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_time_add                Accumulate elapsed time       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_total_time_get(EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD                   *thread_ptr;
+EXECUTION_TIME              thread_time;
+
+
+    /* Check for an invalid destination pointer.  */
+    if (total_time == TX_NULL)
+    {
+
+        /* Return pointer error.  */
+        return(TX_PTR_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the total time of all threads.  */
+    thread_time =  _tx_execution_thread_time_total;
+
+    /* Include the current run of the executing thread.  */
+    thread_ptr =  _tx_thread_current_ptr;
+    if ((thread_ptr != TX_NULL) && (thread_ptr -> tx_thread_execution_time_last_start != ((unsigned long long) 0)))
+    {
+        thread_time =  _tx_execution_time_add(thread_time, (EXECUTION_TIME_SOURCE_TYPE) thread_ptr -> tx_thread_execution_time_last_start,
+                                              TX_EXECUTION_TIME_SOURCE);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the total time.  */
+    *total_time =  thread_time;
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_time_get                          PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the total interrupt processing time.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    total_time                            Destination for the time      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_isr_time_get(EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Check for an invalid destination pointer.  */
+    if (total_time == TX_NULL)
+    {
+
+        /* Return pointer error.  */
+        return(TX_PTR_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Return the interrupt time.  */
+    *total_time =  _tx_execution_isr_time_total;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_idle_time_get                         PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the total idle time.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    total_time                            Destination for the time      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_idle_time_get(EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Check for an invalid destination pointer.  */
+    if (total_time == TX_NULL)
+    {
+
+        /* Return pointer error.  */
+        return(TX_PTR_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Return the idle time.  */
+    *total_time =  _tx_execution_idle_time_total;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+#endif
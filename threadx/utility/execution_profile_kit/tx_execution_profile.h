@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Execution Profile Kit                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_execution_profile.h                              PORTABLE C      */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX execution profile kit, which          */
+/*    accumulates the time spent in each thread, in interrupt processing, */
+/*    and in the idle scheduler loop.  It is assumed that tx_api.h and    */
+/*    tx_port.h have already been included.                               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-17-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_EXECUTION_PROFILE_H
+#define TX_EXECUTION_PROFILE_H
+
+
+/* The execution profile kit measures time with the time source defined by
+   TX_EXECUTION_TIME_SOURCE, which wraps after TX_EXECUTION_MAX_TIME_SOURCE.
+   The following must hold for the kit to operate:
+
+   1. The ThreadX library and the application are built with
+      TX_EXECUTION_PROFILE_ENABLE defined.
+
+   2. The port calls _tx_execution_thread_enter when a thread is scheduled,
+      _tx_execution_thread_exit when a thread returns to the scheduler, and
+      _tx_execution_isr_enter and _tx_execution_isr_exit from its context
+      save and restore processing.
+
+   3. TX_EXECUTION_TIME_SOURCE and TX_EXECUTION_MAX_TIME_SOURCE are defined,
+      either in tx_port.h or below.  A time source value of 0 is treated as
+      "not started", so the source should not rest at 0.
+
+   Each total saturates at TX_EXECUTION_TIME_MAX until it is reset.  */
+
+
+/* Define the time source type. Define TX_EXECUTION_64BIT_TIME_SOURCE for a
+   64-bit time source, otherwise a 32-bit hardware counter is assumed.  */
+
+#ifdef TX_EXECUTION_64BIT_TIME_SOURCE
+typedef unsigned long long              EXECUTION_TIME_SOURCE_TYPE;
+#else
+typedef ULONG                           EXECUTION_TIME_SOURCE_TYPE;
+#endif
+
+
+/* Define the accumulated time type, which matches the thread control block fields.  */
+
+typedef unsigned long long              EXECUTION_TIME;
+
+
+/* Define the default time source, the cycle counter of Cortex-M targets.  */
+
+#ifndef TX_EXECUTION_TIME_SOURCE
+#define TX_EXECUTION_TIME_SOURCE        ((EXECUTION_TIME_SOURCE_TYPE) *((volatile ULONG *) 0xE0001004))
+#endif
+#ifndef TX_EXECUTION_MAX_TIME_SOURCE
+#define TX_EXECUTION_MAX_TIME_SOURCE    ((EXECUTION_TIME_SOURCE_TYPE) 0xFFFFFFFFUL)
+#endif
+
+
+/* Define the maximum accumulated time.  */
+
+#define TX_EXECUTION_TIME_MAX           ((EXECUTION_TIME) ~((EXECUTION_TIME) 0))
+
+
+/* Define the execution profile kit function prototypes.  */
+
+VOID    _tx_execution_thread_enter(VOID);
+VOID    _tx_execution_thread_exit(VOID);
+VOID    _tx_execution_isr_enter(VOID);
+VOID    _tx_execution_isr_exit(VOID);
+UINT    _tx_execution_thread_time_reset(TX_THREAD *thread_ptr);
+UINT    _tx_execution_thread_total_time_reset(VOID);
+UINT    _tx_execution_isr_time_reset(VOID);
+UINT    _tx_execution_idle_time_reset(VOID);
+UINT    _tx_execution_thread_time_get(TX_THREAD *thread_ptr, EXECUTION_TIME *total_time);
+UINT    _tx_execution_thread_total_time_get(EXECUTION_TIME *total_time);
+UINT    _tx_execution_isr_time_get(EXECUTION_TIME *total_time);
+UINT    _tx_execution_idle_time_get(EXECUTION_TIME *total_time);
+
+
+/* Define the execution profile kit data.  */
+
+extern EXECUTION_TIME               _tx_execution_thread_time_total;
+extern EXECUTION_TIME               _tx_execution_isr_time_total;
+extern EXECUTION_TIME               _tx_execution_idle_time_total;
+extern EXECUTION_TIME_SOURCE_TYPE   _tx_execution_isr_time_last_start;
+extern EXECUTION_TIME_SOURCE_TYPE   _tx_execution_idle_time_last_start;
+
+#endif
+